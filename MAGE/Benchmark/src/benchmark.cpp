@@ -0,0 +1,58 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace details {
+
+		const void* volatile g_sink = nullptr;
+	}
+
+	[[nodiscard]]
+	ComPtr< ID3D11Device > CreateDevice() {
+		ComPtr< ID3D11Device > device;
+		const HRESULT result = D3D11CreateDevice(nullptr, 
+												 D3D_DRIVER_TYPE_WARP, 
+												 nullptr, 
+												 0u, 
+												 nullptr, 
+												 0u, 
+												 D3D11_SDK_VERSION, 
+												 device.GetAddressOf(), 
+												 nullptr, 
+												 nullptr);
+		ThrowIfFailed(result, "ID3D11Device creation failed: %08X.", result);
+
+		return device;
+	}
+}
+
+/**
+ The entry point of the MAGE benchmarks.
+
+ Each benchmark prints the time per iteration of its fastest repetition. The 
+ benchmarks are only meaningful for release builds.
+
+ @return		@c 0.
+ */
+int main() {
+	using namespace mage::benchmark;
+
+	RunTransformBenchmarks();
+	RunLoaderBenchmarks();
+	RunJobSystemBenchmarks();
+	RunMemoryBenchmarks();
+	RunCommandBenchmarks();
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "direct3d11.hpp"
+#include "memory\memory.hpp"
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <chrono>
+#include <string_view>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	/**
+	 The number of repetitions of each benchmark. Only the fastest repetition 
+	 is reported.
+	 */
+	constexpr size_t g_nb_repetitions = 5u;
+
+	namespace details {
+
+		/**
+		 The sink for values which may not be optimized away.
+		 */
+		extern const void* volatile g_sink;
+	}
+
+	/**
+	 Prevents the compiler from optimizing away the computation of the given 
+	 value.
+
+	 @tparam		T
+					The value type.
+	 @param[in]		value
+					A reference to the value.
+	 */
+	template< typename T >
+	inline void DoNotOptimize(const T& value) noexcept {
+		details::g_sink = static_cast< const void* >(&value);
+		// The value must be stored before its address escapes.
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	}
+
+	/**
+	 Runs the given benchmark and prints its (fastest) time per iteration.
+
+	 @tparam		ActionT
+					An action type to invoke per iteration.
+	 @param[in]		name
+					The name of the benchmark.
+	 @param[in]		nb_iterations
+					The number of iterations per repetition.
+	 @param[in]		action
+					A reference to the action to invoke per iteration.
+	 */
+	template< typename ActionT >
+	void Run(std::string_view name, size_t nb_iterations, ActionT&& action);
+
+	/**
+	 Creates a (WARP) device for the benchmarks which need Direct3D 11 
+	 resources.
+
+	 @return		A pointer to the device.
+	 @throws		Exception
+					Failed to create the device.
+	 */
+	[[nodiscard]]
+	ComPtr< ID3D11Device > CreateDevice();
+
+	/**
+	 Runs the transform and proxy pointer benchmarks.
+	 */
+	void RunTransformBenchmarks();
+
+	/**
+	 Runs the line reader and OBJ loader benchmarks.
+	 */
+	void RunLoaderBenchmarks();
+
+	/**
+	 Runs the job system benchmarks.
+	 */
+	void RunJobSystemBenchmarks();
+
+	/**
+	 Runs the memory arena and memory stack benchmarks.
+	 */
+	void RunMemoryBenchmarks();
+
+	/**
+	 Runs the command recording benchmarks.
+	 */
+	void RunCommandBenchmarks();
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstdio>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	template< typename ActionT >
+	void Run(std::string_view name, size_t nb_iterations, ActionT&& action) {
+		using Clock = std::chrono::high_resolution_clock;
+
+		auto best = Clock::duration::max();
+		for (size_t repetition = 0u; repetition < g_nb_repetitions; ++repetition) {
+			const auto start = Clock::now();
+			for (size_t i = 0u; i < nb_iterations; ++i) {
+				action();
+			}
+			best = std::min(best, Clock::now() - start);
+		}
+
+		const std::chrono::duration< F64, std::nano > time = best;
+		std::printf("%-56.*s %14.2f ns\n", 
+					static_cast< int >(name.size()), name.data(), 
+					time.count() / static_cast< F64 >(nb_iterations));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "renderer\command_executor.hpp"
+#include "renderer\parallel_command_recorder.hpp"
+#include "resource\mesh\static_mesh.hpp"
+#include "resource\mesh\vertex.hpp"
+#include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_factory.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		using namespace rendering;
+		using VertexT = VertexPositionNormalTexture;
+		using IndexT  = U32;
+		using MeshT   = StaticMesh< VertexT, IndexT >;
+
+		/**
+		 The number of instance batches per recorded pass.
+		 */
+		constexpr size_t g_nb_batches = 4096u;
+
+		/**
+		 The number of distinct meshes of the instance batches.
+		 */
+		constexpr size_t g_nb_meshes = 64u;
+
+		/**
+		 The number of instances per instance batch.
+		 */
+		constexpr U32 g_nb_instances = 4u;
+
+		/**
+		 The PS SRV slot of the base color textures of the depth pass.
+		 */
+		constexpr U32 g_base_color_slot = 11u; // SLOT_SRV_BASE_COLOR
+
+		/**
+		 A class of depth pass recordings.
+
+		 The instance batches are recorded like the opaque and transparent
+		 instance batches of the depth pass, with consecutive batches sharing
+		 their mesh as after sorting the draw lists.
+		 */
+		class DepthPassRecording {
+
+		public:
+
+			explicit DepthPassRecording(ID3D11Device& device,
+										ResourceManager& resource_manager)
+				: m_opaque_vs(CreateDepthInstancedVS(resource_manager)),
+				m_transparent_vs(CreateDepthTransparentInstancedVS(resource_manager)),
+				m_transparent_ps(CreateDepthTransparentPS(resource_manager)),
+				m_meshes() {
+
+				const std::vector< VertexT > vertices(4u);
+				const std::vector< IndexT >  indices = { 0u, 1u, 2u, 0u, 2u, 3u };
+
+				m_meshes.reserve(g_nb_meshes);
+				for (size_t i = 0u; i < g_nb_meshes; ++i) {
+					m_meshes.push_back(MakeUnique< MeshT >(
+						device, gsl::make_span(vertices), gsl::make_span(indices)));
+				}
+			}
+
+			void RecordOpaque(size_t batch,
+							  PipelineStateFilter& filter,
+							  CommandList& commands) const {
+
+				const auto& mesh = GetMesh(batch);
+
+				filter.BindShader(commands, *m_opaque_vs);
+				filter.BindMesh(commands, mesh);
+				mesh.DrawInstanced(commands, 0u, mesh.GetNumberOfIndices(),
+								   GetStartInstance(batch), g_nb_instances);
+			}
+
+			void RecordTransparent(size_t batch,
+								   PipelineStateFilter& filter,
+								   CommandList& commands) const {
+
+				const auto& mesh = GetMesh(batch);
+
+				filter.BindShader(commands, *m_transparent_vs);
+				filter.BindShader(commands, *m_transparent_ps);
+				// Bind a null base color SRV (materials without textures).
+				ID3D11ShaderResourceView* const srv = nullptr;
+				filter.BindPSSRVs(commands, g_base_color_slot, 1u, &srv);
+				filter.BindMesh(commands, mesh);
+				mesh.DrawInstanced(commands, 0u, mesh.GetNumberOfIndices(),
+								   GetStartInstance(batch), g_nb_instances);
+			}
+
+		private:
+
+			[[nodiscard]]
+			const MeshT& GetMesh(size_t batch) const noexcept {
+				return *m_meshes[batch * g_nb_meshes / g_nb_batches];
+			}
+
+			[[nodiscard]]
+			static U32 GetStartInstance(size_t batch) noexcept {
+				return static_cast< U32 >(batch) * g_nb_instances;
+			}
+
+			VertexShaderPtr m_opaque_vs;
+
+			VertexShaderPtr m_transparent_vs;
+
+			PixelShaderPtr m_transparent_ps;
+
+			std::vector< UniquePtr< MeshT > > m_meshes;
+		};
+
+		/**
+		 Checks the given null command executor after executing a depth pass
+		 recording.
+
+		 @param[in]		executor
+						A reference to the null command executor.
+		 @throws		Exception
+						The recorded command lists are invalid.
+		 */
+		void CheckExecution(const NullCommandExecutor& executor) {
+			ThrowIfFailed(0u == executor.GetNumberOfErrors(),
+						  "Recorded command lists contain %zu errors.",
+						  executor.GetNumberOfErrors());
+			ThrowIfFailed(2u * g_nb_batches == executor.GetNumberOfDraws(),
+						  "Recorded command lists contain %zu draws.",
+						  executor.GetNumberOfDraws());
+		}
+	}
+
+	void RunCommandBenchmarks() {
+		const auto device = CreateDevice();
+		JobSystem job_system;
+		ResourceManager resource_manager(*device.Get(), job_system);
+		const DepthPassRecording recording(*device.Get(), resource_manager);
+
+		NullCommandExecutor executor;
+		ParallelCommandRecorder recorder(job_system);
+
+		const auto record_opaque
+			= [&recording](size_t batch,
+						   PipelineStateFilter& filter,
+						   CommandList& commands) {
+				recording.RecordOpaque(batch, filter, commands);
+			};
+		const auto record_transparent
+			= [&recording](size_t batch,
+						   PipelineStateFilter& filter,
+						   CommandList& commands) {
+				recording.RecordTransparent(batch, filter, commands);
+			};
+
+		Run("Record depth pass (sequential)", 16u,
+			[&executor, &record_opaque, &record_transparent]() {
+
+			CommandList commands;
+
+			PipelineStateFilter opaque_filter;
+			for (size_t batch = 0u; batch < g_nb_batches; ++batch) {
+				record_opaque(batch, opaque_filter, commands);
+			}
+			PipelineStateFilter transparent_filter;
+			for (size_t batch = 0u; batch < g_nb_batches; ++batch) {
+				record_transparent(batch, transparent_filter, commands);
+			}
+
+			executor.Reset();
+			executor.Execute(commands);
+			DoNotOptimize(executor.GetNumberOfCommands());
+		});
+		CheckExecution(executor);
+
+		Run("Record depth pass (parallel)", 16u,
+			[&executor, &recorder, &record_opaque, &record_transparent]() {
+
+			executor.Reset();
+			executor.Execute(recorder.Record(g_nb_batches, record_opaque));
+			executor.Execute(recorder.Record(g_nb_batches, record_transparent));
+			DoNotOptimize(executor.GetNumberOfCommands());
+		});
+		CheckExecution(executor);
+	}
+}
@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		/**
+		 The number of jobs of the submission benchmarks.
+		 */
+		constexpr size_t g_nb_jobs = 4096u;
+
+		/**
+		 The number of jobs of the dependency chain benchmark.
+		 */
+		constexpr size_t g_nb_chained_jobs = 256u;
+
+		/**
+		 The number of elements of the fine-grained workload.
+		 */
+		constexpr size_t g_nb_fine_elements = 1u << 20u;
+
+		/**
+		 The number of elements of the coarse-grained workload.
+		 */
+		constexpr size_t g_nb_coarse_elements = 256u;
+
+		/**
+		 The number of steps per element of the coarse-grained workload.
+		 */
+		constexpr size_t g_nb_coarse_steps = 16384u;
+
+		[[nodiscard]]
+		inline F32 FineWork(size_t index) noexcept {
+			return std::sqrt(static_cast< F32 >(index));
+		}
+
+		[[nodiscard]]
+		inline F32 CoarseWork(size_t index) noexcept {
+			auto x = static_cast< F32 >(index);
+			for (size_t step = 0u; step < g_nb_coarse_steps; ++step) {
+				x = std::sin(x) + 1.0f;
+			}
+			return x;
+		}
+	}
+
+	void RunJobSystemBenchmarks() {
+		JobSystem job_system;
+		std::printf("Job system threads: %zu\n", job_system.GetNumberOfThreads());
+
+		Run("Submit and wait 4096 empty jobs", 100u, [&job_system]() {
+			JobCounter counter;
+			for (size_t i = 0u; i < g_nb_jobs; ++i) {
+				job_system.Submit([]() noexcept {}, counter);
+			}
+			job_system.Wait(counter);
+		});
+		Run("Submit and wait 256 chained jobs", 100u, [&job_system]() {
+			std::array< JobCounter, g_nb_chained_jobs > counters;
+			job_system.Submit([]() noexcept {}, counters[0]);
+			for (size_t i = 1u; i < g_nb_chained_jobs; ++i) {
+				job_system.Submit([]() noexcept {}, counters[i], counters[i - 1u]);
+			}
+			job_system.Wait(counters.back());
+		});
+
+		std::vector< F32 > fine_output(g_nb_fine_elements);
+		Run("Fine-grained workload (serial)", 10u, [&fine_output]() noexcept {
+			for (size_t i = 0u; i < g_nb_fine_elements; ++i) {
+				fine_output[i] = FineWork(i);
+			}
+			DoNotOptimize(fine_output.back());
+		});
+		Run("Fine-grained workload (ParallelFor)", 10u, 
+			[&job_system, &fine_output]() {
+			
+			job_system.ParallelFor(0u, g_nb_fine_elements, 
+				[&fine_output](size_t first, size_t last) noexcept {
+					for (auto i = first; i < last; ++i) {
+						fine_output[i] = FineWork(i);
+					}
+				}, 1024u);
+			DoNotOptimize(fine_output.back());
+		});
+
+		std::vector< F32 > coarse_output(g_nb_coarse_elements);
+		Run("Coarse-grained workload (serial)", 1u, [&coarse_output]() noexcept {
+			for (size_t i = 0u; i < g_nb_coarse_elements; ++i) {
+				coarse_output[i] = CoarseWork(i);
+			}
+			DoNotOptimize(coarse_output.back());
+		});
+		Run("Coarse-grained workload (ParallelFor)", 1u, 
+			[&job_system, &coarse_output]() {
+			
+			job_system.ParallelFor(0u, g_nb_coarse_elements, 
+				[&coarse_output](size_t first, size_t last) noexcept {
+					for (auto i = first; i < last; ++i) {
+						coarse_output[i] = CoarseWork(i);
+					}
+				}, 1u);
+			DoNotOptimize(coarse_output.back());
+		});
+	}
+}
\ No newline at end of file
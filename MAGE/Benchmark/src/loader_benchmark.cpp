@@ -0,0 +1,193 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "io\line_reader.hpp"
+#include "loaders\obj\obj_loader.hpp"
+#include "resource\mesh\vertex_quantization.hpp"
+#include "resource\rendering_resource_manager.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <fstream>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		/**
+		 The number of vertices per side of the grid of the benchmark OBJ 
+		 file.
+		 */
+		constexpr size_t g_grid_resolution = 256u;
+
+		/**
+		 A class of line readers tokenizing and converting OBJ files without 
+		 storing any data.
+		 */
+		class OBJTokenReader : public LineReader {
+
+		public:
+
+			OBJTokenReader() = default;
+
+			[[nodiscard]]
+			F32 GetChecksum() const noexcept {
+				return m_checksum;
+			}
+
+		private:
+
+			virtual void ReadLine() override {
+				const auto token = Read< std::string_view >();
+
+				if ("v" == token || "vn" == token) {
+					m_checksum += Read< F32, 3 >()[0];
+				}
+				else if ("vt" == token) {
+					m_checksum += Read< F32, 2 >()[0];
+				}
+				else if ("f" == token) {
+					for (size_t i = 0u; i < 3u; ++i) {
+						m_checksum += static_cast< F32 >(
+							Read< std::string_view >().size());
+					}
+				}
+			}
+
+			F32 m_checksum = 0.0f;
+		};
+
+		/**
+		 Writes a triangulated grid OBJ file to the given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 */
+		void WriteGridOBJFile(const std::filesystem::path& path) {
+			std::ofstream file(path);
+			
+			constexpr auto inv_resolution 
+				= 1.0f / static_cast< F32 >(g_grid_resolution - 1u);
+			for (size_t i = 0u; i < g_grid_resolution; ++i) {
+				for (size_t j = 0u; j < g_grid_resolution; ++j) {
+					const auto u = static_cast< F32 >(i) * inv_resolution;
+					const auto v = static_cast< F32 >(j) * inv_resolution;
+					file << "v " << u << " 0.0 " << v << '\n'
+						 << "vt " << u << ' ' << v << '\n'
+						 << "vn 0.0 1.0 0.0\n";
+				}
+			}
+
+			const auto face_vertex = [&file](size_t i, size_t j) {
+				const auto index = i * g_grid_resolution + j + 1u;
+				file << ' ' << index << '/' << index << '/' << index;
+			};
+			for (size_t i = 0u; i + 1u < g_grid_resolution; ++i) {
+				for (size_t j = 0u; j + 1u < g_grid_resolution; ++j) {
+					file << 'f';
+					face_vertex(i,      j);
+					face_vertex(i + 1u, j);
+					face_vertex(i + 1u, j + 1u);
+					file << "\nf";
+					face_vertex(i,      j);
+					face_vertex(i + 1u, j + 1u);
+					face_vertex(i,      j + 1u);
+					file << '\n';
+				}
+			}
+		}
+
+		/**
+		 Checks the octahedral round trip of the normals of quantized 
+		 vertices.
+
+		 @throws		Exception
+						A normal does not survive the round trip.
+		 */
+		void CheckOctahedralRoundTrip() {
+			using namespace rendering;
+
+			constexpr F32 max_error = 1e-3f;
+			const XMVECTOR normals[] = {
+				XMVectorSet( 0.0f,  0.0f,  1.0f, 0.0f),
+				XMVectorSet( 0.0f,  0.0f, -1.0f, 0.0f),
+				XMVectorSet( 1.0f,  0.0f,  0.0f, 0.0f),
+				XMVectorSet( 0.0f, -1.0f,  0.0f, 0.0f),
+				XMVector3Normalize(XMVectorSet( 1.0f,  2.0f,  3.0f, 0.0f)),
+				XMVector3Normalize(XMVectorSet(-3.0f,  1.0f, -2.0f, 0.0f)),
+				XMVector3Normalize(XMVectorSet( 1.0f, -1.0f, -1.0f, 0.0f))
+			};
+			for (const auto n : normals) {
+				const auto error = XMVectorGetX(XMVector3Length(
+					DecodeOctahedral(EncodeOctahedral(n)) - n));
+				ThrowIfFailed(error <= max_error, 
+							  "Octahedral round trip failed: %f.", error);
+			}
+
+			// Zero normals (e.g. of OBJ faces without normals) map to +Z.
+			const auto error = XMVectorGetX(XMVector3Length(
+				DecodeOctahedral(EncodeOctahedral(XMVectorZero())) 
+				- g_XMIdentityR2));
+			ThrowIfFailed(error <= max_error, 
+						  "Octahedral round trip of zero normal failed: %f.", 
+						  error);
+		}
+	}
+
+	void RunLoaderBenchmarks() {
+		using namespace rendering;
+		using VertexT = VertexPositionNormalTexture;
+		using IndexT  = U32;
+
+		CheckOctahedralRoundTrip();
+
+		const auto path 
+			= std::filesystem::temp_directory_path() / L"mage_benchmark.obj";
+		WriteGridOBJFile(path);
+
+		Run("Tokenize OBJ (mapped file)", 1u, [&path]() {
+			OBJTokenReader reader;
+			reader.ReadFromFile(path);
+			DoNotOptimize(reader.GetChecksum());
+		});
+		Run("Tokenize OBJ (regex)", 1u, [&path]() {
+			OBJTokenReader reader;
+			reader.ReadFromFile(path, LineReader::s_default_regex);
+			DoNotOptimize(reader.GetChecksum());
+		});
+
+		const auto device = CreateDevice();
+		JobSystem job_system;
+		ResourceManager resource_manager(*device.Get(), job_system);
+
+		Run("Import OBJ", 1u, [&path, &resource_manager]() {
+			ModelOutput< VertexT, IndexT > model_output;
+			loader::ImportOBJMeshFromFile(path, resource_manager, model_output, 
+										  MeshDescriptor< VertexT, IndexT >());
+			DoNotOptimize(model_output);
+		});
+		Run("Import OBJ (parallel)", 1u, [&path, &resource_manager]() {
+			ModelOutput< VertexT, IndexT > model_output;
+			loader::ImportOBJMeshFromFile(path, resource_manager, model_output, 
+										  MeshDescriptor< VertexT, IndexT >(
+											  false, true, true));
+			DoNotOptimize(model_output);
+		});
+
+		std::filesystem::remove(path);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "memory\memory_arena.hpp"
+#include "memory\memory_resource.hpp"
+#include "memory\memory_stack.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <memory_resource>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		/**
+		 The number of allocations per iteration.
+		 */
+		constexpr size_t g_nb_allocations = 4096u;
+
+		/**
+		 The size in bytes of the small allocations.
+		 */
+		constexpr size_t g_small_size = 32u;
+
+		/**
+		 The alignment in bytes of the memory arenas and memory stacks.
+		 */
+		constexpr size_t g_alignment = 16u;
+
+		/**
+		 Returns the sizes of the mixed allocations (i.e. pseudo-random sizes 
+		 between 16 and 4096 bytes).
+
+		 @return		The sizes of the mixed allocations.
+		 */
+		[[nodiscard]]
+		std::vector< size_t > GetMixedSizes() {
+			std::vector< size_t > sizes(g_nb_allocations);
+			U32 state = 1u;
+			for (auto& size : sizes) {
+				// Linear congruential generator for reproducible sizes.
+				state = state * 1664525u + 1013904223u;
+				size  = 16u + (state >> 8u) % 4081u;
+			}
+			return sizes;
+		}
+
+		template< typename SizeT >
+		void RunHeapBenchmark(std::string_view name, const SizeT& size_of) {
+			std::vector< void* > ptrs(g_nb_allocations);
+			Run(name, 100u, [&ptrs, &size_of]() {
+				for (size_t i = 0u; i < g_nb_allocations; ++i) {
+					ptrs[i] = ::operator new(size_of(i));
+				}
+				DoNotOptimize(ptrs.back());
+				for (const auto ptr : ptrs) {
+					::operator delete(ptr);
+				}
+			});
+		}
+
+		template< typename MemoryT, typename SizeT >
+		void RunMemoryBenchmark(std::string_view name, 
+								MemoryT& memory, const SizeT& size_of) {
+			
+			Run(name, 100u, [&memory, &size_of]() {
+				for (size_t i = 0u; i < g_nb_allocations; ++i) {
+					DoNotOptimize(memory.Alloc(size_of(i)));
+				}
+				memory.Reset();
+			});
+		}
+	}
+
+	void RunMemoryBenchmarks() {
+		const auto small_size = [](size_t) noexcept {
+			return g_small_size;
+		};
+		const auto mixed_sizes = GetMixedSizes();
+		const auto mixed_size  = [&mixed_sizes](size_t i) noexcept {
+			return mixed_sizes[i];
+		};
+
+		// Small allocations.
+		{
+			MemoryArena arena(64u * 1024u, g_alignment);
+			SingleEndedMemoryStack stack(g_nb_allocations * g_small_size, 
+										 g_alignment);
+
+			RunHeapBenchmark("Small allocations (heap)", small_size);
+			RunMemoryBenchmark("Small allocations (MemoryArena)", 
+							   arena, small_size);
+			RunMemoryBenchmark("Small allocations (SingleEndedMemoryStack)", 
+							   stack, small_size);
+		}
+
+		// Mixed allocations: the arena overflows its blocks and reuses them 
+		// after each reset.
+		{
+			MemoryArena arena(16u * 1024u, g_alignment);
+
+			RunHeapBenchmark("Mixed allocations (heap)", mixed_size);
+			RunMemoryBenchmark("Mixed allocations (MemoryArena)", 
+							   arena, mixed_size);
+			Run("Mixed allocations (pmr::monotonic_buffer_resource)", 100u, 
+				[&mixed_size]() {
+				
+				std::pmr::monotonic_buffer_resource resource;
+				for (size_t i = 0u; i < g_nb_allocations; ++i) {
+					DoNotOptimize(resource.allocate(mixed_size(i), g_alignment));
+				}
+			});
+		}
+
+		// Containers.
+		{
+			MemoryArena arena(64u * 1024u, g_alignment);
+			MemoryResource< MemoryArena > resource(arena);
+
+			Run("Vector push_back (std::allocator)", 100u, []() {
+				std::vector< U32 > values;
+				for (U32 i = 0u; i < g_nb_allocations; ++i) {
+					values.push_back(i);
+				}
+				DoNotOptimize(values.back());
+			});
+			Run("Vector push_back (MemoryResource< MemoryArena >)", 100u, 
+				[&arena, &resource]() {
+				
+				{
+					std::pmr::vector< U32 > values(&resource);
+					for (U32 i = 0u; i < g_nb_allocations; ++i) {
+						values.push_back(i);
+					}
+					DoNotOptimize(values.back());
+				}
+				arena.Reset();
+			});
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "scene\scene.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		/**
+		 The number of root nodes of the benchmark scene.
+		 */
+		constexpr size_t g_nb_roots = 1024u;
+
+		/**
+		 The number of child nodes per root node of the benchmark scene.
+		 */
+		constexpr size_t g_nb_childs_per_root = 15u;
+
+		/**
+		 The number of nodes of the benchmark scene.
+		 */
+		constexpr size_t g_nb_nodes = g_nb_roots * (1u + g_nb_childs_per_root);
+
+		/**
+		 A class of scenes for benchmarking.
+		 */
+		class BenchmarkScene : public Scene {
+
+		public:
+
+			BenchmarkScene()
+				: Scene("benchmark") {}
+		};
+
+		/**
+		 A struct of components for benchmarking proxy pointer conversions.
+		 */
+		struct BenchmarkComponent {
+
+			U64 m_value = 0u;
+		};
+
+		/**
+		 A struct of elements for benchmarking proxy pointers.
+		 */
+		struct BenchmarkElement : public BenchmarkComponent {
+
+			[[nodiscard]]
+			U64 GetGuid() const noexcept {
+				return m_guid;
+			}
+
+			U64 m_guid = 0u;
+		};
+
+		/**
+		 A class of proxy pointers backed by a @c std::function getter (i.e. 
+		 the proxy pointers before the index handles) as a reference.
+
+		 @tparam		T
+						The element type.
+		 */
+		template< typename T >
+		class FunctionProxyPtr {
+
+		public:
+
+			template< typename ContainerT >
+			explicit FunctionProxyPtr(ContainerT& container, size_t index)
+				: m_getter([&container, index]() noexcept {
+					return &container[index];
+				}) {}
+
+			template< typename FromT >
+			FunctionProxyPtr(const FunctionProxyPtr< FromT >& ptr)
+				: m_getter(ptr.m_getter) {}
+
+			[[nodiscard]]
+			T* Get() const noexcept {
+				return m_getter();
+			}
+
+		private:
+
+			template< typename FromT >
+			friend class FunctionProxyPtr;
+
+			std::function< T*() > m_getter;
+		};
+
+		void RunProxyPtrBenchmarks() {
+			AlignedVector< BenchmarkElement > elements(g_nb_nodes);
+			for (size_t i = 0u; i < g_nb_nodes; ++i) {
+				elements[i].m_guid = i + 1u;
+			}
+
+			std::vector< BenchmarkElement* > raw_ptrs;
+			std::vector< ProxyPtr< BenchmarkElement > > proxy_ptrs;
+			std::vector< FunctionProxyPtr< BenchmarkElement > > function_ptrs;
+			raw_ptrs.reserve(g_nb_nodes);
+			proxy_ptrs.reserve(g_nb_nodes);
+			function_ptrs.reserve(g_nb_nodes);
+			for (size_t i = 0u; i < g_nb_nodes; ++i) {
+				raw_ptrs.push_back(&elements[i]);
+				proxy_ptrs.emplace_back(elements, i);
+				function_ptrs.emplace_back(elements, i);
+			}
+
+			Run("Dereference raw pointer", 100u, [&raw_ptrs]() noexcept {
+				for (const auto ptr : raw_ptrs) {
+					DoNotOptimize(ptr->m_value);
+				}
+			});
+			Run("Dereference ProxyPtr", 100u, [&proxy_ptrs]() noexcept {
+				for (const auto& ptr : proxy_ptrs) {
+					DoNotOptimize(ptr->m_value);
+				}
+			});
+			Run("Dereference std::function proxy pointer", 100u, 
+				[&function_ptrs]() noexcept {
+				
+				for (const auto& ptr : function_ptrs) {
+					DoNotOptimize(ptr.Get()->m_value);
+				}
+			});
+
+			Run("Copy ProxyPtr", 100u, [&proxy_ptrs]() {
+				std::vector< ProxyPtr< BenchmarkElement > > copies(
+					proxy_ptrs.cbegin(), proxy_ptrs.cend());
+				DoNotOptimize(copies.back());
+			});
+			Run("Copy std::function proxy pointer", 100u, [&function_ptrs]() {
+				std::vector< FunctionProxyPtr< BenchmarkElement > > copies(
+					function_ptrs.cbegin(), function_ptrs.cend());
+				DoNotOptimize(copies.back());
+			});
+
+			Run("Convert ProxyPtr", 100u, [&proxy_ptrs]() {
+				std::vector< ProxyPtr< BenchmarkComponent > > copies(
+					proxy_ptrs.cbegin(), proxy_ptrs.cend());
+				DoNotOptimize(copies.back());
+			});
+			Run("Convert std::function proxy pointer", 100u, [&function_ptrs]() {
+				std::vector< FunctionProxyPtr< BenchmarkComponent > > copies(
+					function_ptrs.cbegin(), function_ptrs.cend());
+				DoNotOptimize(copies.back());
+			});
+		}
+
+		void RunResolveBenchmarks() {
+			JobSystem job_system;
+			BenchmarkScene scene;
+
+			std::vector< ProxyPtr< Node > > roots;
+			roots.reserve(g_nb_roots);
+			for (size_t i = 0u; i < g_nb_roots; ++i) {
+				const auto root = scene.Create< Node >();
+				for (size_t j = 0u; j < g_nb_childs_per_root; ++j) {
+					root->AddChild(scene.Create< Node >());
+				}
+				roots.push_back(root);
+			}
+
+			// Sort the nodes and resolve all transforms once.
+			scene.ResolveTransforms(job_system);
+
+			Run("Resolve transforms (clean)", 100u, [&job_system, &scene]() {
+				scene.ResolveTransforms(job_system);
+			});
+			Run("Resolve transforms (dirty roots)", 100u, 
+				[&job_system, &scene, &roots]() {
+					for (const auto& root : roots) {
+						root->GetTransform().AddTranslationX(0.001f);
+					}
+					scene.ResolveTransforms(job_system);
+				});
+		}
+	}
+
+	void RunTransformBenchmarks() {
+		RunProxyPtrBenchmarks();
+		RunResolveBenchmarks();
+	}
+}
\ No newline at end of file
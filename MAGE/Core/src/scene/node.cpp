@@ -13,6 +13,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	AtomicU64 Node::s_hierarchy_version = 0ull;
+
 	Node::Node(std::string name)
 		: m_transform(),
 		m_parent(nullptr),
@@ -49,6 +51,7 @@ namespace mage {
 
 	void Node::Set(NodePtr ptr) noexcept {
 		m_this = std::move(ptr);
+		++s_hierarchy_version;
 
 		TransformClient::SetOwner(m_transform, m_this);
 
@@ -80,6 +83,7 @@ namespace mage {
 
 		node->m_parent = m_this;
 		node->m_transform.SetDirty();
+		++s_hierarchy_version;
 
 		m_childs.push_back(std::move(node));
 	}
@@ -95,6 +99,7 @@ namespace mage {
 
 		node->m_parent = nullptr;
 		node->m_transform.SetDirty();
+		++s_hierarchy_version;
 
 		if (const auto it = std::find(cbegin(m_childs), cend(m_childs), node); 
 			it != cend(m_childs)) {
@@ -113,6 +118,7 @@ namespace mage {
 		});
 
 		m_childs.clear();
+		++s_hierarchy_version;
 	}
 
 	//-------------------------------------------------------------------------
@@ -33,6 +33,23 @@ namespace mage {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the hierarchy version of all nodes.
+
+		 The hierarchy version changes whenever a node is bound to a new 
+		 pointer or whenever a parent-child relation between nodes changes.
+
+		 @return		The hierarchy version of all nodes.
+		 */
+		[[nodiscard]]
+		static U64 GetHierarchyVersion() noexcept {
+			return s_hierarchy_version;
+		}
+
 		//---------------------------------------------------------------------
 		// Class Member Types
 		//---------------------------------------------------------------------
@@ -480,6 +497,15 @@ namespace mage {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The hierarchy version of all nodes.
+		 */
+		static AtomicU64 s_hierarchy_version;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Transform
 		//---------------------------------------------------------------------
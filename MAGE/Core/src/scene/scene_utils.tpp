@@ -39,9 +39,7 @@ namespace mage {
 			if (State::Terminated == element->GetState()) {
 				element = MakeUnique< ElementT >(
 					std::forward< ConstructorArgsT >(args)...);
-				return ProxyPtr< ElementT >([&elements, index]() noexcept {
-						return static_cast< ElementT* >(elements[index].get());
-				});
+				return ProxyPtr< ElementT >(elements, index);
 			}
 
 			++index;
@@ -49,8 +47,6 @@ namespace mage {
 
 		elements.push_back(MakeUnique< ElementT >(
 			std::forward< ConstructorArgsT >(args)...));
-		return ProxyPtr< ElementT >([&elements, index]() noexcept {
-				return static_cast< ElementT * >(elements[index].get());
-		});
+		return ProxyPtr< ElementT >(elements, index);
 	}
 }
\ No newline at end of file
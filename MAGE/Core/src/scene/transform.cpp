@@ -12,48 +12,107 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	void Transform::SetDirty() const noexcept {
-		m_dirty_object_to_world = true;
-		m_dirty_world_to_object = true;
+	AtomicU32 Transform::s_nb_dirty_transforms = 0u;
 
-		if (HasOwner()) {
-			m_owner->ForEachChild([](const Node& node) noexcept {
-				node.GetTransform().SetDirty();
-			});
+	AtomicU32 Transform::s_nb_transforms = 0u;
+
+	void Transform::Resolve(const Transform* parent) noexcept {
+		if (parent) {
+			m_parent_version  = parent->m_version;
+			m_object_to_world = GetObjectToParentMatrix() 
+				              * parent->m_object_to_world;
+			m_world_to_object = parent->m_world_to_object 
+				              * GetParentToObjectMatrix();
+		}
+		else {
+			m_parent_version  = 0ull;
+			m_object_to_world = GetObjectToParentMatrix();
+			m_world_to_object = GetParentToObjectMatrix();
+		}
+
+		if (m_dirty) {
+			m_dirty = false;
+			--s_nb_dirty_transforms;
 		}
+
+		++m_version;
 	}
 
-	void Transform::UpdateObjectToWorldMatrix() const noexcept {
-		if (m_dirty_object_to_world) {
-			m_dirty_object_to_world = false;
+	[[nodiscard]]
+	const Transform* Transform::GetParentTransform() const noexcept {
+		if (!HasOwner()) {
+			return nullptr;
+		}
 
-			Assert(HasOwner());
-			const auto parent = m_owner->GetParent();
+		const auto parent = m_owner->GetParent();
+		return (nullptr != parent) ? &parent->GetTransform() : nullptr;
+	}
+
+	[[nodiscard]]
+	const XMMATRIX XM_CALLCONV 
+		Transform::ComputeObjectToWorldMatrix() const noexcept {
+
+		// Find the top-most dirty transform on the path to the root.
+		auto top_dirty = m_dirty ? this : nullptr;
+		for (auto transform = GetParentTransform(); transform; 
+			 transform = transform->GetParentTransform()) {
 			
-			if (nullptr != parent) {
-				m_object_to_world = GetObjectToParentMatrix() 
-					              * parent->GetTransform().GetObjectToWorldMatrix();
-			}
-			else {
-				m_object_to_world = GetObjectToParentMatrix();
+			if (transform->m_dirty) {
+				top_dirty = transform;
 			}
 		}
+
+		if (nullptr == top_dirty) {
+			return m_object_to_world;
+		}
+
+		// Accumulate the local transforms up to and including the top-most 
+		// dirty transform and reuse the cached matrix of its parent.
+		auto object_to_world = GetObjectToParentMatrix();
+		for (auto transform = this; transform != top_dirty; ) {
+			transform       = transform->GetParentTransform();
+			object_to_world = object_to_world 
+				            * transform->GetObjectToParentMatrix();
+		}
+
+		if (const auto parent = top_dirty->GetParentTransform(); parent) {
+			object_to_world = object_to_world * parent->m_object_to_world;
+		}
+
+		return object_to_world;
 	}
 
-	void Transform::UpdateWorldToObjectMatrix() const noexcept {
-		if (m_dirty_world_to_object) {
-			m_dirty_world_to_object = false;
+	[[nodiscard]]
+	const XMMATRIX XM_CALLCONV 
+		Transform::ComputeWorldToObjectMatrix() const noexcept {
 
-			Assert(HasOwner());
-			const auto parent = m_owner->GetParent();
+		// Find the top-most dirty transform on the path to the root.
+		auto top_dirty = m_dirty ? this : nullptr;
+		for (auto transform = GetParentTransform(); transform; 
+			 transform = transform->GetParentTransform()) {
 			
-			if (nullptr != parent) {
-				m_world_to_object = parent->GetTransform().GetWorldToObjectMatrix() 
-					              * GetParentToObjectMatrix();
-			}
-			else {
-				m_world_to_object = GetParentToObjectMatrix();
+			if (transform->m_dirty) {
+				top_dirty = transform;
 			}
 		}
+
+		if (nullptr == top_dirty) {
+			return m_world_to_object;
+		}
+
+		// Accumulate the local transforms up to and including the top-most 
+		// dirty transform and reuse the cached matrix of its parent.
+		auto world_to_object = GetParentToObjectMatrix();
+		for (auto transform = this; transform != top_dirty; ) {
+			transform       = transform->GetParentTransform();
+			world_to_object = transform->GetParentToObjectMatrix() 
+				            * world_to_object;
+		}
+
+		if (const auto parent = top_dirty->GetParentTransform(); parent) {
+			world_to_object = parent->m_world_to_object * world_to_object;
+		}
+
+		return world_to_object;
 	}
-}
\ No newline at end of file
+}
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "transform\local_transform.hpp"
+#include "type\atomic_types.hpp"
 
 #pragma endregion
 
@@ -38,11 +39,15 @@ namespace mage {
 		 */
 		Transform() noexcept
 			: m_transform(),
-			m_object_to_world(),
-			m_world_to_object(),
-			m_dirty_object_to_world(true),
-			m_dirty_world_to_object(true),
-			m_owner() {}
+			m_object_to_world(XMMatrixIdentity()),
+			m_world_to_object(XMMatrixIdentity()),
+			m_dirty(false),
+			m_version(static_cast< U64 >(++s_nb_transforms) << 32u),
+			m_parent_version(0ull),
+			m_owner() {
+			
+			SetDirty();
+		}
 
 		/**
 		 Constructs a transform from the given transform.
@@ -52,11 +57,15 @@ namespace mage {
 		 */
 		Transform(const Transform& transform) noexcept
 			: m_transform(transform.m_transform),
-			m_object_to_world(),
-			m_world_to_object(),
-			m_dirty_object_to_world(true),
-			m_dirty_world_to_object(true),
-			m_owner() {}
+			m_object_to_world(XMMatrixIdentity()),
+			m_world_to_object(XMMatrixIdentity()),
+			m_dirty(false),
+			m_version(static_cast< U64 >(++s_nb_transforms) << 32u),
+			m_parent_version(0ull),
+			m_owner() {
+			
+			SetDirty();
+		}
 
 		/**
 		 Constructs a transform by moving the given transform.
@@ -64,12 +73,27 @@ namespace mage {
 		 @param[in]		transform
 						A reference to the transform to move.
 		 */
-		Transform(Transform&& transform) noexcept = default;
+		Transform(Transform&& transform) noexcept
+			: m_transform(std::move(transform.m_transform)),
+			m_object_to_world(transform.m_object_to_world),
+			m_world_to_object(transform.m_world_to_object),
+			m_dirty(transform.m_dirty),
+			m_version(transform.m_version),
+			m_parent_version(transform.m_parent_version),
+			m_owner(std::move(transform.m_owner)) {
+
+			// The dirty transform count moves along with the dirty flag.
+			transform.m_dirty = false;
+		}
 
 		/**
 		 Destructs this transform.
 		 */
-		~Transform() = default;
+		~Transform() {
+			if (m_dirty) {
+				--s_nb_dirty_transforms;
+			}
+		}
 
 		//---------------------------------------------------------------------
 		// Assignment Operators
@@ -1199,23 +1223,31 @@ namespace mage {
 		/**
 		 Returns the object-to-world matrix of this transform.
 
+		 If neither this transform nor any of its ancestors has been modified 
+		 since the last resolve, the cached object-to-world matrix is 
+		 returned.
+
 		 @return		The object-to-world matrix of this transform.
 		 */
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetObjectToWorldMatrix() const noexcept {
-			UpdateObjectToWorldMatrix();
-			return m_object_to_world;
+			return IsResolved() ? m_object_to_world 
+				                : ComputeObjectToWorldMatrix();
 		}
 
 		/**
 		 Returns the world-to-object matrix of this transform.
 
+		 If neither this transform nor any of its ancestors has been modified 
+		 since the last resolve, the cached world-to-object matrix is 
+		 returned.
+
 		 @return		The world-to-object matrix of this transform.
 		 */
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetWorldToObjectMatrix() const noexcept {
-			UpdateWorldToObjectMatrix();
-			return m_world_to_object;
+			return IsResolved() ? m_world_to_object 
+				                : ComputeWorldToObjectMatrix();
 		}
 
 		/**
@@ -1455,10 +1487,44 @@ namespace mage {
 		//---------------------------------------------------------------------
 		#pragma region
 
+		/**
+		 Checks whether this transform is dirty.
+
+		 @return		@c true if the local transform of this transform 
+						changed since the last resolve. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDirty() const noexcept {
+			return m_dirty;
+		}
+
+		/**
+		 Returns the version of this transform.
+
+		 The version changes each time the object-to-world and world-to-object
+		 matrices of this transform are resolved. Versions are unique across 
+		 transforms: a version identifies both this transform and its 
+		 matrices.
+
+		 @return		The version of this transform.
+		 */
+		[[nodiscard]]
+		U64 GetVersion() const noexcept {
+			return m_version;
+		}
+
 		/**
 		 Sets this transform to dirty.
+
+		 Only this transform is marked. The descendants are updated by the 
+		 next resolve.
 		 */
-		void SetDirty() const noexcept;
+		void SetDirty() noexcept {
+			if (!m_dirty) {
+				m_dirty = true;
+				++s_nb_dirty_transforms;
+			}
+		}
 
 		#pragma endregion
 
@@ -1487,21 +1553,89 @@ namespace mage {
 		}
 
 		/**
-		 Updates the object-to-world matrix of this transform if dirty.
+		 Resolves the object-to-world and world-to-object matrices of this 
+		 transform and clears its dirty flag.
 
-		 @pre			This transform must have an owner.
+		 @pre			The matrices of the given parent transform are 
+						resolved.
+		 @param[in]		parent
+						A pointer to the transform of the parent node. 
+						@c nullptr if the owner of this transform has no 
+						parent.
 		 */
-		void UpdateObjectToWorldMatrix() const noexcept;
+		void Resolve(const Transform* parent) noexcept;
 
 		/**
-		 Updates the world-to-object matrix of this transform if dirty.
+		 Checks whether the cached matrices of this transform can be used 
+		 as is.
 
-		 @pre			This transform must have an owner.
+		 The ancestors are only visited if some transform is dirty. 
+
+		 @return		@c true if neither this transform nor any of its 
+						ancestors has been set dirty since this transform 
+						was resolved. @c false otherwise.
 		 */
-		void UpdateWorldToObjectMatrix() const noexcept;
+		[[nodiscard]]
+		bool IsResolved() const noexcept {
+			if (m_dirty) {
+				return false;
+			}
+			if (0u == s_nb_dirty_transforms) {
+				return true;
+			}
+
+			const auto parent = GetParentTransform();
+			return (nullptr == parent) 
+				|| (m_parent_version == parent->m_version 
+				    && parent->IsResolved());
+		}
+
+		/**
+		 Returns the transform of the parent of the owner of this transform.
+
+		 @return		@c nullptr if this transform has no owner or if the 
+						owner of this transform has no parent.
+		 @return		A pointer to the transform of the parent of the owner 
+						of this transform.
+		 */
+		[[nodiscard]]
+		const Transform* GetParentTransform() const noexcept;
+
+		/**
+		 Computes the object-to-world matrix of this transform without 
+		 relying on the cached matrices of dirty ancestors.
+
+		 @return		The object-to-world matrix of this transform.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV ComputeObjectToWorldMatrix() const noexcept;
+
+		/**
+		 Computes the world-to-object matrix of this transform without 
+		 relying on the cached matrices of dirty ancestors.
+
+		 @return		The world-to-object matrix of this transform.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV ComputeWorldToObjectMatrix() const noexcept;
 
 		#pragma endregion
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of dirty transforms.
+		 */
+		static AtomicU32 s_nb_dirty_transforms;
+
+		/**
+		 The number of constructed transforms (used for generating the 
+		 versions of the transforms).
+		 */
+		static AtomicU32 s_nb_transforms;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -1514,24 +1648,30 @@ namespace mage {
 		/**
 		 The cached object-to-world matrix of this transform.
 		 */
-		mutable XMMATRIX m_object_to_world;
+		XMMATRIX m_object_to_world;
 
 		/**
 		 The cached world-to-object matrix of this transform.
 		 */
-		mutable XMMATRIX m_world_to_object;
+		XMMATRIX m_world_to_object;
+
+		/**
+		 A flag indicating whether the local transform of this transform 
+		 changed since the last resolve.
+		 */
+		bool m_dirty;
 
 		/**
-		 A flag indicating whether the object-to-world matrix of this transform 
-		 is dirty.
+		 The version of this transform. The upper 32 bits identify this 
+		 transform, the lower 32 bits count the resolves of this transform.
 		 */
-		mutable bool m_dirty_object_to_world;
+		U64 m_version;
 
 		/**
-		 A flag indicating whether the world-to-object matrix of this transform 
-		 is dirty.
+		 The version of the parent transform of this transform at the last 
+		 resolve of this transform.
 		 */
-		mutable bool m_dirty_world_to_object;
+		U64 m_parent_version;
 
 		/**
 		 A pointer to the node owning this transform.
@@ -1558,11 +1698,29 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		friend class Node;
+		friend class Scene;
 
 		//---------------------------------------------------------------------
 		// Static Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Resolves the matrices of the given transform.
+
+		 @pre			The matrices of the given parent transform are 
+						resolved.
+		 @param[in]		transform
+						A reference to the transform.
+		 @param[in]		parent
+						A pointer to the transform of the parent node. 
+						@c nullptr if there is no parent node.
+		 */
+		static void Resolve(Transform& transform, 
+							const Transform* parent) noexcept {
+
+			transform.Resolve(parent);
+		}
+
 		/**
 		 Sets the owner of the given transform to the given owner.
 
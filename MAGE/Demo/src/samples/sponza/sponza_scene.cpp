@@ -51,20 +51,27 @@ namespace mage {
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
 		
-		const auto plane_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		// Load the models and textures in parallel.
+		auto plane_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/plane/plane.obj", mesh_desc);
-		const auto sponza_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		auto sponza_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/sponza/sponza.mdl",    mesh_desc);
-		const auto tree_model_desc_tree
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		auto tree_model_desc_tree_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
-		const auto sky_texture
-			= rendering_factory.GetOrCreate< Texture >(
+		auto sky_texture_future
+			= rendering_factory.GetOrCreateAsync< Texture >(
 				L"assets/textures/sky/sky.dds");
+
 		const auto logo_texture = CreateMAGETexture(rendering_factory);
 
+		const auto plane_model_desc     = plane_model_desc_future.get();
+		const auto sponza_model_desc    = sponza_model_desc_future.get();
+		const auto tree_model_desc_tree = tree_model_desc_tree_future.get();
+		const auto sky_texture          = sky_texture_future.get();
+
 		//---------------------------------------------------------------------
 		// Cameras
 		//---------------------------------------------------------------------
@@ -35,7 +35,8 @@ namespace mage {
 		: WindowMessageHandler(std::move(handler)), 
 		m_on_active_change(std::move(handler.m_on_active_change)),
 		m_on_mode_switch(std::move(handler.m_on_mode_switch)),
-		m_on_print_screen(std::move(handler.m_on_print_screen)) {}
+		m_on_print_screen(std::move(handler.m_on_print_screen)),
+		m_on_frame_capture(std::move(handler.m_on_frame_capture)) {}
 
 	EngineMessageHandler::~EngineMessageHandler() = default;
 
@@ -50,6 +51,7 @@ namespace mage {
 		m_on_active_change = std::move(handler.m_on_active_change);
 		m_on_mode_switch   = std::move(handler.m_on_mode_switch);
 		m_on_print_screen  = std::move(handler.m_on_print_screen);
+		m_on_frame_capture = std::move(handler.m_on_frame_capture);
 		return *this;
 	}
 
@@ -86,6 +88,11 @@ namespace mage {
 				return 0;
 			}
 
+			case static_cast< WPARAM >(HotKey::CtrlPrintScreen): {
+				m_on_frame_capture();
+				return 0;
+			}
+
 			}
 		
 			break;
@@ -122,10 +129,13 @@ namespace mage {
 
 	Engine::Engine(const EngineSetup& setup, 
 				   rendering::DisplayConfiguration display_config)
-		: m_window(), 
+		: m_job_system(), 
+		m_window(), 
 		m_message_handler(), 
 		m_input_manager(), 
 		m_rendering_manager(), 
+		m_frame_statistics(), 
+		m_frame_pipeline(), 
 		m_scene(), 
 		m_requested_scene(), 
 		m_timer(), 
@@ -150,6 +160,9 @@ namespace mage {
 	void Engine::InitializeSystems(const EngineSetup& setup, 
 								   rendering::DisplayConfiguration display_config) {
 
+		// Initialize the job system (the calling thread participates).
+		m_job_system = MakeUnique< JobSystem >();
+
 		// Initialize the window.
 		{
 			auto window_desc
@@ -176,9 +189,20 @@ namespace mage {
 			
 			m_message_handler.m_on_print_screen  = [this]() {
 				auto& swap_chain = m_rendering_manager->GetSwapChain();
-				const auto fname = L"screenshot-" + GetLocalSystemDateAndTimeAsString() 
-					             + L".png";
-				swap_chain.TakeScreenShot(fname);
+				auto fname = L"screenshot-" + GetLocalSystemDateAndTimeAsString() 
+					       + L".png";
+				swap_chain.RequestScreenShot(std::move(fname));
+			};
+
+			m_message_handler.m_on_frame_capture = [this]() {
+				auto& swap_chain = m_rendering_manager->GetSwapChain();
+				if (swap_chain.IsCapturingFrames()) {
+					swap_chain.StopFrameCapture();
+				}
+				else {
+					swap_chain.StartFrameCapture(
+						L"capture-" + GetLocalSystemDateAndTimeAsString());
+				}
 			};
 		
 			m_window->AddListener(
@@ -194,8 +218,20 @@ namespace mage {
 
 		// Initialize the rendering system.
 		m_rendering_manager = MakeUnique< rendering::Manager >(window, 
-															   std::move(display_config));
+															   std::move(display_config), 
+															   *m_job_system, 
+															   setup.IsPipelined());
 		m_rendering_manager->BindPersistentState();
+		if (setup.PrewarmsShaders()) {
+			m_rendering_manager->PrewarmShaders();
+		}
+
+		// Initialize the frame pipeline.
+		m_frame_statistics = MakeUnique< FrameStatistics >();
+		if (setup.IsPipelined()) {
+			m_frame_pipeline = MakeUnique< FramePipeline >(*m_rendering_manager, 
+														   *m_frame_statistics);
+		}
 		
 		// Initializes the COM library for use by the calling thread and sets 
 		// the thread's concurrency model to multithreaded concurrency.
@@ -209,6 +245,8 @@ namespace mage {
 		// Uninitialize the COM library.
 		CoUninitialize();
 
+		// Uninitialize the frame pipeline.
+		m_frame_pipeline.reset();
 		// Uninitialize the scene system.
 		m_scene.reset();
 		// Uninitialize the rendering system.
@@ -217,6 +255,8 @@ namespace mage {
 		m_input_manager.reset();
 		// Uninitialize the window system.
 		m_window.reset();
+		// Uninitialize the job system.
+		m_job_system.reset();
 	}
 
 	void Engine::RequestScene(UniquePtr< Scene >&& scene) noexcept {
@@ -225,6 +265,9 @@ namespace mage {
 	}
 
 	void Engine::ApplyRequestedScene() {
+		// Scenes may use the device context while (un)initializing.
+		WaitForPresent();
+
 		if (m_scene) {
 			m_scene->Uninitialize(*this);
 		}
@@ -260,8 +303,11 @@ namespace mage {
 	bool Engine::UpdateRendering() {
 		// Handle switch between full screen and windowed mode.
 		auto& swap_chain     = m_rendering_manager->GetSwapChain();
-		const auto lost_mode = swap_chain.LostMode();
+		const auto lost_mode = m_frame_pipeline 
+			                   ? m_frame_pipeline->ConsumeLostMode() 
+			                   : swap_chain.LostMode();
 		if (m_mode_switch || lost_mode) {
+			WaitForPresent();
 			swap_chain.SwitchMode(!lost_mode);
 			m_mode_switch = false;
 			return true;
@@ -317,6 +363,12 @@ namespace mage {
 		return false;
 	}
 
+	void Engine::WaitForPresent() noexcept {
+		if (m_frame_pipeline) {
+			m_frame_pipeline->Wait();
+		}
+	}
+
 	[[nodiscard]]
 	int Engine::Run(UniquePtr< Scene >&& scene, int nCmdShow) {
 		// Show the main window.
@@ -354,6 +406,8 @@ namespace mage {
 				continue;
 			}
 
+			const auto simulation_start = FrameStatistics::Clock::now();
+
 			if (UpdateInput()) {
 				continue;
 			}
@@ -369,7 +423,20 @@ namespace mage {
 				continue;
 			}
 
-			m_rendering_manager->Render(m_time);
+			// Resolve the transforms of the current scene.
+			m_scene->ResolveTransforms(*m_job_system);
+
+			if (m_frame_pipeline) {
+				// Overlap the presentation of the previous frame with the 
+				// simulation and drawing of this frame.
+				m_rendering_manager->Draw(m_time);
+				m_frame_pipeline->Submit(simulation_start);
+			}
+			else {
+				m_rendering_manager->Render(m_time);
+				m_frame_statistics->Record(simulation_start, 
+										   FrameStatistics::Clock::now());
+			}
 		}
 
 		return static_cast< int >(msg.wParam);
@@ -6,8 +6,10 @@
 #pragma region
 
 #include "engine_setup.hpp"
+#include "frame_pipeline.hpp"
 #include "input_manager.hpp"
 #include "rendering_manager.hpp"
+#include "parallel\job_system.hpp"
 #include "ui\window.hpp"
 
 #pragma endregion
@@ -122,6 +124,8 @@ namespace mage {
 		std::function< void() > m_on_mode_switch;
 
 		std::function< void() > m_on_print_screen;
+
+		std::function< void() > m_on_frame_capture;
 	};
 
 	#pragma endregion
@@ -241,6 +245,27 @@ namespace mage {
 			return *m_rendering_manager;
 		}
 
+		/**
+		 Returns the job system of this engine.
+
+		 @return		A reference to the job system of this engine.
+		 */
+		[[nodiscard]]
+		JobSystem& GetJobSystem() const noexcept {
+			return *m_job_system;
+		}
+
+		/**
+		 Returns the frame statistics (i.e. the latency and throughput of the 
+		 presented frames) of this engine.
+
+		 @return		A reference to the frame statistics of this engine.
+		 */
+		[[nodiscard]]
+		const FrameStatistics& GetFrameStatistics() const noexcept {
+			return *m_frame_statistics;
+		}
+
 		/**
 		 Returns the current scene of this engine.
 
@@ -304,10 +329,21 @@ namespace mage {
 		[[nodiscard]]
 		bool UpdateScripting();
 
+		/**
+		 Waits until the previous frame is presented (if the frame pipeline of 
+		 this engine is enabled).
+		 */
+		void WaitForPresent() noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
+		/**
+		 A pointer to the job system of this engine.
+		 */
+		UniquePtr< JobSystem > m_job_system;
+
 		/**
 		 A pointer to the window of this engine.
 		 */
@@ -328,6 +364,17 @@ namespace mage {
 		 */
 		UniquePtr< rendering::Manager > m_rendering_manager;
 
+		/**
+		 A pointer to the frame statistics of this engine.
+		 */
+		UniquePtr< FrameStatistics > m_frame_statistics;
+
+		/**
+		 A pointer to the frame pipeline of this engine. @c nullptr if the 
+		 frames are simulated and presented sequentially.
+		 */
+		UniquePtr< FramePipeline > m_frame_pipeline;
+
 		/**
 		 A pointer to the current scene of this engine.
 		 */
@@ -32,11 +32,21 @@ namespace mage {
 						The application instance handle.
 		 @param[in]		name
 						The name of the application.
+		 @param[in]		pipelined
+						A flag indicating whether the simulation of a frame 
+						overlaps with the presentation of the previous frame.
+		 @param[in]		prewarm_shaders
+						A flag indicating whether all shader permutations 
+						should be created at startup.
 		 */
 		explicit EngineSetup(NotNull< HINSTANCE > instance, 
-							 std::wstring name = L"MAGE")
+							 std::wstring name = L"MAGE", 
+							 bool pipelined = false, 
+							 bool prewarm_shaders = false)
 			: m_instance(instance),
-			m_name(std::move(name)) {}
+			m_name(std::move(name)), 
+			m_pipelined(pipelined), 
+			m_prewarm_shaders(prewarm_shaders) {}
 
 		/**
 		 Constructs an engine setup from the given engine setup.
@@ -107,6 +117,29 @@ namespace mage {
 			return m_name;
 		}
 
+		/**
+		 Checks whether the simulation of a frame overlaps with the 
+		 presentation of the previous frame.
+
+		 @return		@c true if the simulation of a frame overlaps with the 
+						presentation of the previous frame. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsPipelined() const noexcept {
+			return m_pipelined;
+		}
+
+		/**
+		 Checks whether all shader permutations should be created at startup.
+
+		 @return		@c true if all shader permutations should be created at 
+						startup. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool PrewarmsShaders() const noexcept {
+			return m_prewarm_shaders;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -122,5 +155,17 @@ namespace mage {
 		 The name of the application.
 		 */
 		std::wstring m_name;
+
+		/**
+		 A flag indicating whether the simulation of a frame overlaps with the 
+		 presentation of the previous frame.
+		 */
+		bool m_pipelined;
+
+		/**
+		 A flag indicating whether all shader permutations should be created 
+		 at startup.
+		 */
+		bool m_prewarm_shaders;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "frame_pipeline.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The weight of the most recent frame in the exponential moving
+		 averages of frame statistics.
+		 */
+		constexpr F64 g_frame_weight = 0.05;
+	}
+
+	//-------------------------------------------------------------------------
+	// FrameStatistics
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	FrameStatistics::FrameStatistics() noexcept
+		: m_mutex(),
+		m_last_present_end(),
+		m_latency(TimeIntervalSeconds::zero()),
+		m_frame_time(TimeIntervalSeconds::zero()),
+		m_nb_frames(0u) {}
+
+	FrameStatistics::~FrameStatistics() = default;
+
+	void FrameStatistics::Record(TimeStamp simulation_start,
+								 TimeStamp present_end) noexcept {
+
+		const TimeIntervalSeconds latency = present_end - simulation_start;
+
+		const std::scoped_lock lock(m_mutex);
+
+		if (0u == m_nb_frames) {
+			m_latency = latency;
+		}
+		else {
+			m_latency += g_frame_weight * (latency - m_latency);
+
+			const TimeIntervalSeconds frame_time
+				= present_end - m_last_present_end;
+			m_frame_time = (1u == m_nb_frames)
+				? frame_time
+				: m_frame_time + g_frame_weight * (frame_time - m_frame_time);
+		}
+
+		m_last_present_end = present_end;
+		++m_nb_frames;
+	}
+
+	[[nodiscard]]
+	const TimeIntervalSeconds FrameStatistics::GetLatency() const noexcept {
+		const std::scoped_lock lock(m_mutex);
+		return m_latency;
+	}
+
+	[[nodiscard]]
+	F64 FrameStatistics::GetThroughput() const noexcept {
+		const std::scoped_lock lock(m_mutex);
+		return (TimeIntervalSeconds::zero() < m_frame_time)
+			   ? 1.0 / m_frame_time.count() : 0.0;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// FramePipeline
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	FramePipeline::FramePipeline(rendering::Manager& rendering_manager,
+								 FrameStatistics& statistics)
+		: m_rendering_manager(rendering_manager),
+		m_statistics(statistics),
+		m_submit_event(CreateUniqueHandle(
+			CreateEvent(nullptr, FALSE, FALSE, nullptr))),
+		m_idle_event(CreateUniqueHandle(
+			CreateEvent(nullptr, TRUE, TRUE, nullptr))),
+		m_simulation_start(),
+		m_lost_mode(false),
+		m_terminate(false),
+		m_thread() {
+
+		ThrowIfFailed((nullptr != m_submit_event && nullptr != m_idle_event),
+					  "Frame pipeline event creation failed: %lu.",
+					  GetLastError());
+
+		m_thread = std::thread(&FramePipeline::Run, this);
+	}
+
+	FramePipeline::~FramePipeline() {
+		Wait();
+
+		m_terminate.store(true, std::memory_order_release);
+		SetEvent(m_submit_event.get());
+
+		m_thread.join();
+	}
+
+	void FramePipeline::Submit(TimeStamp simulation_start) noexcept {
+		// Hand off the drawn frame snapshot once the previous one is
+		// presented.
+		Wait();
+
+		m_rendering_manager.SubmitFrame();
+		m_simulation_start = simulation_start;
+
+		ResetEvent(m_idle_event.get());
+		SetEvent(m_submit_event.get());
+	}
+
+	void FramePipeline::Wait() noexcept {
+		const auto idle_event = m_idle_event.get();
+
+		// Presenting may send messages to the windows of the calling thread
+		// and wait for their processing.
+		while (WAIT_OBJECT_0 != MsgWaitForMultipleObjects(1u, &idle_event,
+														  FALSE, INFINITE,
+														  QS_SENDMESSAGE)) {
+			MSG msg;
+			PeekMessage(&msg, nullptr, 0u, 0u,
+						PM_NOREMOVE | PM_QS_SENDMESSAGE);
+		}
+	}
+
+	void FramePipeline::Run() noexcept {
+		const auto& swap_chain = m_rendering_manager.GetSwapChain();
+
+		while (true) {
+			WaitForSingleObject(m_submit_event.get(), INFINITE);
+			if (m_terminate.load(std::memory_order_acquire)) {
+				break;
+			}
+
+			m_rendering_manager.Present();
+			const auto present_end = FrameStatistics::Clock::now();
+
+			if (swap_chain.LostMode()) {
+				m_lost_mode.store(true);
+			}
+
+			m_statistics.Record(m_simulation_start, present_end);
+
+			SetEvent(m_idle_event.get());
+		}
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
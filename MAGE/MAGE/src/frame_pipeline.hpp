@@ -0,0 +1,375 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering_manager.hpp"
+#include "system\timer.hpp"
+#include "type\atomic_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <mutex>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// FrameStatistics
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of frame statistics tracking the latency and the throughput of
+	 frames.
+
+	 The latency of a frame is the time between the start of its simulation
+	 and the end of its presentation. The throughput is the number of frames
+	 presented per second. Both are smoothed with an exponential moving
+	 average. Frame statistics can be recorded and queried from different
+	 threads.
+	 */
+	class FrameStatistics {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The clock type of frame statistics.
+		 */
+		using Clock = std::chrono::high_resolution_clock;
+
+		/**
+		 The time stamp type of frame statistics.
+		 */
+		using TimeStamp = Clock::time_point;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a frame statistics.
+		 */
+		FrameStatistics() noexcept;
+
+		/**
+		 Constructs a frame statistics from the given frame statistics.
+
+		 @param[in]		statistics
+						A reference to the frame statistics to copy.
+		 */
+		FrameStatistics(const FrameStatistics& statistics) = delete;
+
+		/**
+		 Constructs a frame statistics by moving the given frame statistics.
+
+		 @param[in]		statistics
+						A reference to the frame statistics to move.
+		 */
+		FrameStatistics(FrameStatistics&& statistics) = delete;
+
+		/**
+		 Destructs this frame statistics.
+		 */
+		~FrameStatistics();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given frame statistics to this frame statistics.
+
+		 @param[in]		statistics
+						A reference to the frame statistics to copy.
+		 @return		A reference to the copy of the given frame statistics
+						(i.e. this frame statistics).
+		 */
+		FrameStatistics& operator=(const FrameStatistics& statistics) = delete;
+
+		/**
+		 Moves the given frame statistics to this frame statistics.
+
+		 @param[in]		statistics
+						A reference to the frame statistics to move.
+		 @return		A reference to the moved frame statistics (i.e. this
+						frame statistics).
+		 */
+		FrameStatistics& operator=(FrameStatistics&& statistics) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records a presented frame.
+
+		 @param[in]		simulation_start
+						The time stamp at which the simulation of the frame
+						started.
+		 @param[in]		present_end
+						The time stamp at which the presentation of the frame
+						ended.
+		 */
+		void Record(TimeStamp simulation_start, TimeStamp present_end) noexcept;
+
+		/**
+		 Returns the (smoothed) latency of this frame statistics.
+
+		 @return		The latency (in seconds) of this frame statistics.
+		 */
+		[[nodiscard]]
+		const TimeIntervalSeconds GetLatency() const noexcept;
+
+		/**
+		 Returns the (smoothed) throughput of this frame statistics.
+
+		 @return		The throughput (in frames per second) of this frame
+						statistics.
+		 */
+		[[nodiscard]]
+		F64 GetThroughput() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The mutex of this frame statistics.
+		 */
+		mutable std::mutex m_mutex;
+
+		/**
+		 The time stamp at which the presentation of the last frame ended.
+		 */
+		TimeStamp m_last_present_end;
+
+		/**
+		 The (smoothed) latency of this frame statistics.
+		 */
+		TimeIntervalSeconds m_latency;
+
+		/**
+		 The (smoothed) time between two presented frames of this frame
+		 statistics.
+		 */
+		TimeIntervalSeconds m_frame_time;
+
+		/**
+		 The number of recorded frames of this frame statistics.
+		 */
+		U64 m_nb_frames;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// FramePipeline
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of frame pipelines presenting frames on a separate render thread.
+
+	 Frames are double buffered: the submitting thread draws a frame to a frame
+	 snapshot of the (pipelined) rendering manager, while the render thread
+	 executes and presents the previously submitted frame snapshot (i.e. while
+	 the render thread waits for the GPU and the vertical blank). Since a frame
+	 snapshot captures all the per-frame data, the submitting thread simulates
+	 and draws the next frame while the previous frame is presented. The
+	 submitting thread must wait for the render thread before otherwise using
+	 the immediate device context or the swap chain.
+	 */
+	class FramePipeline {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time stamp type of frame pipelines.
+		 */
+		using TimeStamp = FrameStatistics::TimeStamp;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a frame pipeline.
+
+		 @param[in]		rendering_manager
+						A reference to the (pipelined) rendering manager.
+		 @param[in]		statistics
+						A reference to the frame statistics to record the
+						presented frames to.
+		 @throws		Exception
+						Failed to create the synchronization events.
+		 */
+		explicit FramePipeline(rendering::Manager& rendering_manager,
+							   FrameStatistics& statistics);
+
+		/**
+		 Constructs a frame pipeline from the given frame pipeline.
+
+		 @param[in]		pipeline
+						A reference to the frame pipeline to copy.
+		 */
+		FramePipeline(const FramePipeline& pipeline) = delete;
+
+		/**
+		 Constructs a frame pipeline by moving the given frame pipeline.
+
+		 @param[in]		pipeline
+						A reference to the frame pipeline to move.
+		 */
+		FramePipeline(FramePipeline&& pipeline) = delete;
+
+		/**
+		 Destructs this frame pipeline. The frame being presented (if any) is
+		 finished first.
+		 */
+		~FramePipeline();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given frame pipeline to this frame pipeline.
+
+		 @param[in]		pipeline
+						A reference to the frame pipeline to copy.
+		 @return		A reference to the copy of the given frame pipeline
+						(i.e. this frame pipeline).
+		 */
+		FramePipeline& operator=(const FramePipeline& pipeline) = delete;
+
+		/**
+		 Moves the given frame pipeline to this frame pipeline.
+
+		 @param[in]		pipeline
+						A reference to the moved frame pipeline.
+		 @return		A reference to the moved frame pipeline (i.e. this
+						frame pipeline).
+		 */
+		FramePipeline& operator=(FramePipeline&& pipeline) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Submits the drawn frame snapshot for presentation on the render
+		 thread. Waits until the render thread presented the previously
+		 submitted frame snapshot first.
+
+		 @param[in]		simulation_start
+						The time stamp at which the simulation of the frame
+						started.
+		 */
+		void Submit(TimeStamp simulation_start) noexcept;
+
+		/**
+		 Waits until the render thread is idle.
+
+		 Messages sent to the windows of the calling thread are dispatched
+		 while waiting, since presenting may depend on them (e.g., when
+		 switching between full screen and windowed mode).
+		 */
+		void Wait() noexcept;
+
+		/**
+		 Checks whether the swap chain lost its mode during the last
+		 presentation and resets this flag.
+
+		 @return		@c true if the swap chain lost its mode. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool ConsumeLostMode() noexcept {
+			return m_lost_mode.exchange(false);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Executes and presents the submitted frame snapshots on the render
+		 thread until this frame pipeline terminates.
+		 */
+		void Run() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the rendering manager of this frame pipeline.
+		 */
+		rendering::Manager& m_rendering_manager;
+
+		/**
+		 A reference to the frame statistics of this frame pipeline.
+		 */
+		FrameStatistics& m_statistics;
+
+		/**
+		 The (auto-reset) event signaled when a frame is submitted to this
+		 frame pipeline.
+		 */
+		UniqueHandle m_submit_event;
+
+		/**
+		 The (manual-reset) event signaled while the render thread of this
+		 frame pipeline is idle.
+		 */
+		UniqueHandle m_idle_event;
+
+		/**
+		 The time stamp at which the simulation of the submitted frame
+		 started. Only written while the render thread is idle.
+		 */
+		TimeStamp m_simulation_start;
+
+		/**
+		 A flag indicating whether the swap chain lost its mode.
+		 */
+		AtomicBool m_lost_mode;
+
+		/**
+		 A flag indicating whether this frame pipeline terminates.
+		 */
+		AtomicBool m_terminate;
+
+		/**
+		 The render thread of this frame pipeline.
+		 */
+		std::thread m_thread;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -8,6 +8,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -16,7 +25,12 @@ namespace mage {
 	Scene::Scene(std::string name)
 		: m_name(std::move(name)),
 		m_nodes(),
-		m_scripts() {}
+		m_scripts(),
+		m_transform_entries(),
+		m_transform_levels(),
+		m_transform_changed(),
+		m_nb_sorted_nodes(0),
+		m_hierarchy_version(0ull) {}
 
 	Scene::Scene(Scene&& scene) noexcept = default;
 
@@ -60,6 +74,104 @@ namespace mage {
 	void Scene::Clear() noexcept {
 		m_nodes.clear();
 		m_scripts.clear();
+		
+		m_transform_entries.clear();
+		m_transform_levels.clear();
+		m_transform_changed.clear();
+		m_nb_sorted_nodes = 0;
+	}
+
+	//-------------------------------------------------------------------------
+	// Scene Member Methods: Transforms
+	//-------------------------------------------------------------------------
+
+	void Scene::SortNodes() {
+		using std::size;
+
+		m_transform_entries.clear();
+		m_transform_levels.clear();
+
+		const auto get_index = [this](const Node& node) noexcept {
+			return static_cast< U32 >(&node - m_nodes.data());
+		};
+
+		// Add the root nodes (i.e. the first level).
+		for (const auto& node : m_nodes) {
+			if (State::Terminated != node.GetState() && !node.HasParent()) {
+				m_transform_entries.push_back({ get_index(node), s_no_parent });
+			}
+		}
+
+		// Add the childs of the nodes of the previous level.
+		size_t begin = 0;
+		m_transform_levels.push_back(begin);
+		while (begin != size(m_transform_entries)) {
+			const auto end = size(m_transform_entries);
+			m_transform_levels.push_back(end);
+
+			for (auto i = begin; i < end; ++i) {
+				const auto parent = static_cast< U32 >(i);
+				const auto& node  = m_nodes[m_transform_entries[i].m_node];
+				node.ForEachChild([this, parent, &get_index](const Node& child) {
+					m_transform_entries.push_back({ get_index(child), parent });
+				});
+			}
+
+			begin = end;
+		}
+
+		m_transform_changed.resize(size(m_transform_entries));
+		m_nb_sorted_nodes   = size(m_nodes);
+		m_hierarchy_version = Node::GetHierarchyVersion();
+	}
+
+	void Scene::ResolveTransforms(JobSystem& job_system) {
+		using std::size;
+
+		if (size(m_nodes) != m_nb_sorted_nodes
+			|| Node::GetHierarchyVersion() != m_hierarchy_version) {
+			SortNodes();
+		}
+
+		const auto first = m_transform_entries.data();
+
+		const auto resolve = [this, first](const TransformEntry& entry) noexcept {
+			const auto index     = static_cast< size_t >(&entry - first);
+			auto& transform      = m_nodes[entry.m_node].GetTransform();
+			const bool has_parent = (s_no_parent != entry.m_parent);
+			
+			const bool changed = transform.IsDirty() 
+				|| (has_parent && m_transform_changed[entry.m_parent]);
+			m_transform_changed[index] = changed;
+			
+			if (changed) {
+				const auto parent = has_parent ? 
+					&m_nodes[m_transform_entries[entry.m_parent].m_node].GetTransform()
+					: nullptr;
+				TransformClient::Resolve(transform, parent);
+			}
+		};
+
+		// The levels are resolved one after the other, the entries of a 
+		// single level are independent.
+		for (size_t level = 1; level < size(m_transform_levels); ++level) {
+			const auto level_begin = first + m_transform_levels[level - 1];
+			const auto level_end   = first + m_transform_levels[level];
+
+			if (s_min_parallel_level_size 
+				<= static_cast< size_t >(level_end - level_begin)) {
+				
+				job_system.ParallelFor(m_transform_levels[level - 1], 
+									   m_transform_levels[level], 
+									   [first, &resolve](size_t begin, 
+										                 size_t end) noexcept {
+					std::for_each(first + begin, first + end, resolve);
+				});
+			}
+			else {
+				std::for_each(level_begin, level_end, resolve);
+			}
+		}
 	}
 
 	//-------------------------------------------------------------------------
@@ -79,9 +191,8 @@ namespace mage {
 		using namespace rendering;
 		using ModelPtr = ProxyPtr< Model >;
 		using NodePtr  = ProxyPtr< Node >;
-		using NodePair = std::pair< NodePtr, std::string >;
 
-		std::map< std::string, NodePair > mapping;
+		const auto first = nodes.size();
 		NodePtr root;
 		size_t nb_root_childs = 0;
 
@@ -103,10 +214,16 @@ namespace mage {
 						   model_part.m_start_index, 
 						   model_part.m_nb_indices, 
 						   model_part.m_aabb, 
-						   model_part.m_sphere);
+						   model_part.m_sphere, 
+						   model_part.m_lods,
+						   model_part.m_position_offset,
+						   model_part.m_position_scale);
 			
 			// Set the material of the model component.
-			const auto material = desc.GetMaterial(model_part.m_material);
+			const auto material 
+				= (ModelPart::s_no_index != model_part.m_material_index)
+				? desc.GetMaterial(size_t(model_part.m_material_index))
+				: desc.GetMaterial(model_part.m_material);
 			model->GetMaterial() = (material) ? *material : default_material;
 
 			// Set the transform of the node.
@@ -121,10 +238,6 @@ namespace mage {
 				++nb_root_childs;
 			}
 
-			// Add the node to the mapping.
-			mapping.emplace(model_part.m_child, 
-							NodePair(node, model_part.m_parent));
-			
 			// Add the node to the collection to return.
 			nodes.push_back(std::move(node));
 		});
@@ -144,18 +257,37 @@ namespace mage {
 			nodes.push_back(root);
 		}
 
+		// The mapping from names to nodes is only created if some model part 
+		// refers to its parent model part by name.
+		std::map< std::string, NodePtr > mapping;
+		const auto get_node = [&](const std::string& name) {
+			using std::empty;
+			if (empty(mapping)) {
+				size_t index = first;
+				desc.ForEachModelPart([&](const rendering::ModelPart& model_part) {
+					mapping.emplace(model_part.m_child, nodes[index++]);
+				});
+			}
+			
+			return mapping[name];
+		};
+
 		// Connect the nodes.
-		for (const auto& model_pair : mapping) {
-			const auto& [child, parent] = model_pair.second;
-			if (ModelPart::s_default_parent == parent) {
+		size_t index = first;
+		desc.ForEachModelPart([&](const rendering::ModelPart& model_part) {
+			const auto& child = nodes[index++];
+			if (model_part.HasDefaultParent()) {
 				if (create_root_model_node) {
 					root->AddChild(child);
 				}
 			}
+			else if (ModelPart::s_no_index != model_part.m_parent_index) {
+				nodes[first + model_part.m_parent_index]->AddChild(child);
+			}
 			else {
-				mapping[parent].first->AddChild(child);
+				get_node(model_part.m_parent)->AddChild(child);
 			}
-		}
+		});
 
 		return root;
 	}
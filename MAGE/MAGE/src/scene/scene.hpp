@@ -108,6 +108,24 @@ namespace mage {
 		template< typename ElementT, typename ActionT >
 		void ForEach(ActionT&& action) const;
 
+		//---------------------------------------------------------------------
+		// Member Methods: Transforms
+		//---------------------------------------------------------------------
+
+		/**
+		 Resolves the object-to-world and world-to-object matrices of the 
+		 transforms of the nodes of this scene.
+
+		 The nodes are visited level by level in a parents-before-childs 
+		 order. Only dirty transforms and the descendants of dirty transforms 
+		 are recomputed. Large levels are distributed across the worker 
+		 threads of the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system.
+		 */
+		void ResolveTransforms(JobSystem& job_system);
+
 		//---------------------------------------------------------------------
 		// Member Methods: Identification
 		//---------------------------------------------------------------------
@@ -195,6 +213,51 @@ namespace mage {
 		 */
 		void Clear() noexcept;
 
+		//---------------------------------------------------------------------
+		// Member Methods: Transforms
+		//---------------------------------------------------------------------
+
+		/**
+		 Sorts the nodes of this scene in a parents-before-childs order.
+		 */
+		void SortNodes();
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of transform entries.
+		 */
+		struct TransformEntry {
+
+			/**
+			 The index of the node into the nodes of this scene.
+			 */
+			U32 m_node;
+
+			/**
+			 The index of the parent entry into the sorted transform entries 
+			 of this scene.
+			 */
+			U32 m_parent;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The parent index of transform entries of nodes without a parent.
+		 */
+		static constexpr U32 s_no_parent = std::numeric_limits< U32 >::max();
+
+		/**
+		 The minimum number of transform entries of a level to distribute its 
+		 resolve across multiple worker threads.
+		 */
+		static constexpr size_t s_min_parallel_level_size = 256u;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Nodes and Components
 		//---------------------------------------------------------------------
@@ -209,6 +272,42 @@ namespace mage {
 		 */
 		AlignedVector< UniquePtr< BehaviorScript > > m_scripts;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Transforms
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the transform entries of the nodes of this scene 
+		 sorted in a parents-before-childs order.
+		 */
+		std::vector< TransformEntry > m_transform_entries;
+
+		/**
+		 A vector containing the begin indices of each level into the 
+		 transform entries of this scene followed by the end index of the 
+		 last level.
+		 */
+		std::vector< size_t > m_transform_levels;
+
+		/**
+		 A vector containing a flag per transform entry of this scene 
+		 indicating whether the matrices have been recomputed during the 
+		 current resolve.
+		 */
+		std::vector< U8 > m_transform_changed;
+
+		/**
+		 The number of nodes of this scene at the time the transform entries 
+		 were sorted.
+		 */
+		size_t m_nb_sorted_nodes;
+
+		/**
+		 The hierarchy version of the nodes at the time the transform entries 
+		 were sorted.
+		 */
+		U64 m_hierarchy_version;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Identification
 		//---------------------------------------------------------------------
@@ -1193,6 +1193,34 @@ namespace mage {
 		BoundingFrustum& operator=(BoundingFrustum&& 
 								   frustum) noexcept = default;
 		
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of planes of this bounding frustum.
+
+		 @return		The number of planes of this bounding frustum.
+		 */
+		[[nodiscard]]
+		static constexpr size_t GetNumberOfPlanes() noexcept {
+			return 6u;
+		}
+
+		/**
+		 Returns the plane at the given index of this bounding frustum.
+
+		 @pre			@a index < GetNumberOfPlanes().
+		 @param[in]		index
+						The index of the plane.
+		 @return		The (normalized, inward facing) plane at the given
+						index of this bounding frustum.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV GetPlane(size_t index) const noexcept {
+			return m_planes[index];
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Enclosing = Full Coverage
 		//---------------------------------------------------------------------
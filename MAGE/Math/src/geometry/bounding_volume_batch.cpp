@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume_batch.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Returns a bitmask containing the sign bits of the four components of
+		 the given comparison result.
+
+		 @param[in]		control
+						The comparison result.
+		 @return		A bitmask containing the sign bits of the four
+						components of @a control.
+		 */
+		[[nodiscard]]
+		inline U32 XM_CALLCONV GetMask(FXMVECTOR control) noexcept {
+			#if defined(_XM_SSE_INTRINSICS_)
+			return static_cast< U32 >(_mm_movemask_ps(control));
+			#else  // _XM_SSE_INTRINSICS_
+			return   (XMVectorGetIntX(control) & 1u)
+				   | ((XMVectorGetIntY(control) & 1u) << 1u)
+				   | ((XMVectorGetIntZ(control) & 1u) << 2u)
+				   | ((XMVectorGetIntW(control) & 1u) << 3u);
+			#endif // _XM_SSE_INTRINSICS_
+		}
+	}
+
+	BoundingVolumeBatch::BoundingVolumeBatch()
+		: m_blocks(),
+		m_nb_volumes(0u) {}
+
+	BoundingVolumeBatch::BoundingVolumeBatch(
+		const BoundingVolumeBatch& batch) = default;
+
+	BoundingVolumeBatch::BoundingVolumeBatch(
+		BoundingVolumeBatch&& batch) noexcept = default;
+
+	BoundingVolumeBatch::~BoundingVolumeBatch() = default;
+
+	BoundingVolumeBatch& BoundingVolumeBatch
+		::operator=(const BoundingVolumeBatch& batch) = default;
+
+	BoundingVolumeBatch& BoundingVolumeBatch
+		::operator=(BoundingVolumeBatch&& batch) noexcept = default;
+
+	void BoundingVolumeBatch::reserve(size_t nb_volumes) {
+		m_blocks.reserve((nb_volumes + 3u) / 4u);
+	}
+
+	void BoundingVolumeBatch::clear() noexcept {
+		m_blocks.clear();
+		m_nb_volumes = 0u;
+	}
+
+	U32 XM_CALLCONV BoundingVolumeBatch::Add(const AABB& aabb,
+											 FXMMATRIX object_to_world) {
+
+		// Transform the centroid and the extents: the extents of the
+		// world-space AABB are the absolute values of the rotated extents.
+		const auto centroid = XMVector3TransformCoord(aabb.Centroid(),
+													  object_to_world);
+		const auto e        = aabb.Radius();
+		const auto extents  = XMVectorSplatX(e) * XMVectorAbs(object_to_world.r[0])
+			                + XMVectorSplatY(e) * XMVectorAbs(object_to_world.r[1])
+			                + XMVectorSplatZ(e) * XMVectorAbs(object_to_world.r[2]);
+
+		return Add(centroid, extents, 0.0f);
+	}
+
+	U32 XM_CALLCONV BoundingVolumeBatch::Add(const BoundingSphere& sphere,
+											 FXMMATRIX object_to_world) {
+
+		const auto centroid = XMVector3TransformCoord(sphere.Centroid(),
+													  object_to_world);
+		const auto scale    = XMVectorMax(
+			XMVector3LengthSq(object_to_world.r[0]), XMVectorMax(
+			XMVector3LengthSq(object_to_world.r[1]),
+			XMVector3LengthSq(object_to_world.r[2])));
+		const auto radius   = sphere.Radius()
+			                * XMVectorGetX(XMVectorSqrt(scale));
+
+		return Add(centroid, g_XMZero, radius);
+	}
+
+	U32 XM_CALLCONV BoundingVolumeBatch::Add(FXMVECTOR centroid,
+											 FXMVECTOR extents,
+											 F32 radius) {
+
+		const auto index = m_nb_volumes;
+		const auto lane  = index & 3u;
+		if (0u == lane) {
+			m_blocks.emplace_back();
+		}
+
+		auto& block = m_blocks.back();
+		block.m_centroid_x[lane] = XMVectorGetX(centroid);
+		block.m_centroid_y[lane] = XMVectorGetY(centroid);
+		block.m_centroid_z[lane] = XMVectorGetZ(centroid);
+		block.m_extents_x[lane]  = XMVectorGetX(extents);
+		block.m_extents_y[lane]  = XMVectorGetY(extents);
+		block.m_extents_z[lane]  = XMVectorGetZ(extents);
+		block.m_radius[lane]     = radius;
+
+		++m_nb_volumes;
+
+		return static_cast< U32 >(index);
+	}
+
+	void BoundingVolumeBatch::Cull(const BoundingFrustum& frustum,
+								   std::vector< U32 >& indices) const {
+
+		constexpr auto nb_planes = BoundingFrustum::GetNumberOfPlanes();
+
+		// Splat the plane components once per frustum.
+		XMVECTOR n_x[nb_planes];
+		XMVECTOR n_y[nb_planes];
+		XMVECTOR n_z[nb_planes];
+		XMVECTOR n_w[nb_planes];
+		XMVECTOR abs_n_x[nb_planes];
+		XMVECTOR abs_n_y[nb_planes];
+		XMVECTOR abs_n_z[nb_planes];
+		for (size_t i = 0u; i < nb_planes; ++i) {
+			const auto plane = frustum.GetPlane(i);
+			n_x[i] = XMVectorSplatX(plane);
+			n_y[i] = XMVectorSplatY(plane);
+			n_z[i] = XMVectorSplatZ(plane);
+			n_w[i] = XMVectorSplatW(plane);
+			abs_n_x[i] = XMVectorAbs(n_x[i]);
+			abs_n_y[i] = XMVectorAbs(n_y[i]);
+			abs_n_z[i] = XMVectorAbs(n_z[i]);
+		}
+
+		indices.clear();
+		indices.reserve(m_nb_volumes);
+
+		U32 base = 0u;
+		for (const auto& block : m_blocks) {
+			const auto c_x = XMLoad(block.m_centroid_x);
+			const auto c_y = XMLoad(block.m_centroid_y);
+			const auto c_z = XMLoad(block.m_centroid_z);
+			const auto e_x = XMLoad(block.m_extents_x);
+			const auto e_y = XMLoad(block.m_extents_y);
+			const auto e_z = XMLoad(block.m_extents_z);
+			const auto r   = XMLoad(block.m_radius);
+
+			// A volume is culled if it lies completely outside one of the
+			// (inward facing) planes: n . c + d + |n| . e + r < 0.
+			auto culled = XMVectorFalseInt();
+			for (size_t i = 0u; i < nb_planes; ++i) {
+				auto distance = XMVectorMultiplyAdd(n_x[i], c_x, n_w[i]);
+				distance = XMVectorMultiplyAdd(n_y[i], c_y, distance);
+				distance = XMVectorMultiplyAdd(n_z[i], c_z, distance);
+				distance = XMVectorMultiplyAdd(abs_n_x[i], e_x, distance);
+				distance = XMVectorMultiplyAdd(abs_n_y[i], e_y, distance);
+				distance = XMVectorMultiplyAdd(abs_n_z[i], e_z, distance);
+				distance += r;
+
+				culled = XMVectorOrInt(culled,
+									   XMVectorLess(distance, g_XMZero));
+			}
+
+			// Compact the indices of the visible volumes.
+			const auto count   = std::min(m_nb_volumes - base, size_t(4u));
+			const auto visible = ~GetMask(culled) & ((1u << count) - 1u);
+			for (U32 lane = 0u; lane < count; ++lane) {
+				if (visible & (1u << lane)) {
+					indices.push_back(base + lane);
+				}
+			}
+
+			base += 4u;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,252 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of batches of world-space bounding volumes.
+
+	 The bounding volumes are stored as a structure of arrays in blocks of
+	 four volumes, which allows a bounding frustum to test four volumes at
+	 once against each of its planes. AABBs are stored as a centroid and
+	 extents (with a zero radius), bounding spheres as a centroid and radius
+	 (with zero extents).
+	 */
+	class BoundingVolumeBatch {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a bounding volume batch.
+		 */
+		BoundingVolumeBatch();
+
+		/**
+		 Constructs a bounding volume batch from the given bounding volume
+		 batch.
+
+		 @param[in]		batch
+						A reference to the bounding volume batch to copy.
+		 */
+		BoundingVolumeBatch(const BoundingVolumeBatch& batch);
+
+		/**
+		 Constructs a bounding volume batch by moving the given bounding
+		 volume batch.
+
+		 @param[in]		batch
+						A reference to the bounding volume batch to move.
+		 */
+		BoundingVolumeBatch(BoundingVolumeBatch&& batch) noexcept;
+
+		/**
+		 Destructs this bounding volume batch.
+		 */
+		~BoundingVolumeBatch();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given bounding volume batch to this bounding volume batch.
+
+		 @param[in]		batch
+						A reference to the bounding volume batch to copy.
+		 @return		A reference to the copy of the given bounding volume
+						batch (i.e. this bounding volume batch).
+		 */
+		BoundingVolumeBatch& operator=(const BoundingVolumeBatch& batch);
+
+		/**
+		 Moves the given bounding volume batch to this bounding volume batch.
+
+		 @param[in]		batch
+						A reference to the bounding volume batch to move.
+		 @return		A reference to the moved bounding volume batch (i.e.
+						this bounding volume batch).
+		 */
+		BoundingVolumeBatch& operator=(BoundingVolumeBatch&& batch) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of bounding volumes of this bounding volume batch.
+
+		 @return		The number of bounding volumes of this bounding volume
+						batch.
+		 */
+		[[nodiscard]]
+		size_t size() const noexcept {
+			return m_nb_volumes;
+		}
+
+		/**
+		 Checks whether this bounding volume batch is empty.
+
+		 @return		@c true if this bounding volume batch is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return 0u == m_nb_volumes;
+		}
+
+		/**
+		 Reserves storage for the given number of bounding volumes.
+
+		 @param[in]		nb_volumes
+						The number of bounding volumes.
+		 */
+		void reserve(size_t nb_volumes);
+
+		/**
+		 Removes all bounding volumes from this bounding volume batch.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Adds the given AABB, transformed to world space, to this bounding
+		 volume batch.
+
+		 The world-space AABB encloses the transformed (oriented) box.
+
+		 @param[in]		aabb
+						A reference to the (object-space) AABB.
+		 @param[in]		object_to_world
+						The object-to-world transformation matrix.
+		 @return		The index of the added bounding volume.
+		 */
+		U32 XM_CALLCONV Add(const AABB& aabb, FXMMATRIX object_to_world);
+
+		/**
+		 Adds the given bounding sphere, transformed to world space, to this
+		 bounding volume batch.
+
+		 The world-space radius is scaled by the largest scale factor of the
+		 given transformation matrix.
+
+		 @param[in]		sphere
+						A reference to the (object-space) bounding sphere.
+		 @param[in]		object_to_world
+						The object-to-world transformation matrix.
+		 @return		The index of the added bounding volume.
+		 */
+		U32 XM_CALLCONV Add(const BoundingSphere& sphere,
+							FXMMATRIX object_to_world);
+
+		/**
+		 Collects the indices of the bounding volumes of this bounding volume
+		 batch which are not culled by the given bounding frustum.
+
+		 @param[in]		frustum
+						A reference to the (world-space) bounding frustum.
+		 @param[out]	indices
+						A reference to the vector which will contain the
+						indices of the visible bounding volumes in increasing
+						order. Any previous contents are discarded.
+		 */
+		void Cull(const BoundingFrustum& frustum,
+				  std::vector< U32 >& indices) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds a bounding volume to this bounding volume batch.
+
+		 @param[in]		centroid
+						The world-space centroid.
+		 @param[in]		extents
+						The world-space extents.
+		 @param[in]		radius
+						The world-space radius.
+		 @return		The index of the added bounding volume.
+		 */
+		U32 XM_CALLCONV Add(FXMVECTOR centroid,
+							FXMVECTOR extents,
+							F32 radius);
+
+		//---------------------------------------------------------------------
+		// Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of blocks of four world-space bounding volumes.
+		 */
+		struct alignas(16) Block {
+
+			/**
+			 The x coordinates of the centroids.
+			 */
+			F32x4A m_centroid_x;
+
+			/**
+			 The y coordinates of the centroids.
+			 */
+			F32x4A m_centroid_y;
+
+			/**
+			 The z coordinates of the centroids.
+			 */
+			F32x4A m_centroid_z;
+
+			/**
+			 The x extents.
+			 */
+			F32x4A m_extents_x;
+
+			/**
+			 The y extents.
+			 */
+			F32x4A m_extents_y;
+
+			/**
+			 The z extents.
+			 */
+			F32x4A m_extents_z;
+
+			/**
+			 The radii.
+			 */
+			F32x4A m_radius;
+		};
+
+		static_assert(112 == sizeof(Block));
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The blocks of this bounding volume batch.
+		 */
+		AlignedVector< Block > m_blocks;
+
+		/**
+		 The number of bounding volumes of this bounding volume batch.
+		 */
+		size_t m_nb_volumes;
+	};
+}
\ No newline at end of file
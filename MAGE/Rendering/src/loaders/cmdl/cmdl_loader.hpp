@@ -0,0 +1,81 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+	// Forward declaration.
+	class ResourceManager;
+}
+
+namespace mage::rendering::loader {
+
+	/**
+	 Imports the model from the CMDL file associated with the given path.
+
+	 The vertices and indices are not copied, but refer to the mapped CMDL 
+	 file which is kept alive by the given model output.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[out]	model_output
+					A reference to the model output.
+	 @throws		Exception
+					Failed to import the model from file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ImportCMDLModelFromFile(const std::filesystem::path& path, 
+								 ResourceManager& resource_manager, 
+								 ModelOutput< VertexT, IndexT >& model_output);
+
+	/**
+	 Exports the given model to the CMDL file associated with the given path.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		model_output
+					A reference to the model output.
+	 @throws		Exception
+					Failed to export the model to file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ExportCMDLModelToFile(const std::filesystem::path& path, 
+							   const ModelOutput< VertexT, IndexT >& model_output);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\cmdl\cmdl_loader.tpp"
+
+#pragma endregion
\ No newline at end of file
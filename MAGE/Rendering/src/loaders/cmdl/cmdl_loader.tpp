@@ -0,0 +1,36 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\cmdl\cmdl_reader.hpp"
+#include "loaders\cmdl\cmdl_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename VertexT, typename IndexT >
+	void ImportCMDLModelFromFile(const std::filesystem::path& path, 
+								 ResourceManager& resource_manager, 
+								 ModelOutput< VertexT, IndexT >& model_output) {
+		
+		model_output.m_mapped_file = MappedFile(path);
+		
+		CMDLReader< VertexT, IndexT > reader(resource_manager, model_output);
+		reader.ReadFromFile(model_output.m_mapped_file);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ExportCMDLModelToFile(const std::filesystem::path& path, 
+							   const ModelOutput< VertexT, IndexT >& model_output) {
+		
+		CMDLWriter< VertexT, IndexT > writer(model_output);
+		writer.WriteToFile(path);
+	}
+}
\ No newline at end of file
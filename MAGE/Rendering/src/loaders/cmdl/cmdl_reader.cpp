@@ -0,0 +1,86 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\cmdl\cmdl_reader.hpp"
+#include "resource\rendering_resource_manager.hpp"
+#include "string\string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader::details {
+
+	void ReadCMDLMaterials(const std::filesystem::path& path,
+						   ResourceManager& resource_manager,
+						   gsl::span< const CMDLMaterial > materials,
+						   std::string_view strings,
+						   std::vector< Material >& material_buffer) {
+
+		const auto get_string = [&path, strings](const U32x2& entry) {
+			ThrowIfFailed(size_t(entry[0u]) + entry[1u] <= strings.size(),
+						  "%ls: string table entry out of range.",
+						  path.c_str());
+
+			return std::string(strings.substr(entry[0u], entry[1u]));
+		};
+
+		struct TextureRequest {
+			std::wstring m_path;
+			std::shared_future< TexturePtr > m_texture;
+			size_t m_material_index;
+			void (Material::*m_setter)(TexturePtr);
+		};
+		std::vector< TextureRequest > texture_requests;
+
+		const auto request_texture = [&](const U32x2& entry,
+										 void (Material::*setter)(TexturePtr)) {
+			if (0u == entry[1u]) {
+				return;
+			}
+
+			// The texture path is normalized to match the key of the same 
+			// texture loaded through other paths (e.g., MTL files).
+			auto texture_path = path.parent_path();
+			texture_path /= StringToWString(get_string(entry));
+			texture_path = texture_path.lexically_normal();
+
+			auto texture = resource_manager.GetOrCreateAsync< Texture >(
+				texture_path.wstring());
+			texture_requests.push_back({
+				texture_path.wstring(),
+				std::move(texture),
+				material_buffer.size() - 1u,
+				setter
+			});
+		};
+
+		material_buffer.reserve(material_buffer.size() + materials.size());
+		for (const auto& material : materials) {
+			auto& result = material_buffer.emplace_back(get_string(material.m_name));
+			result.GetBaseColor() = material.m_base_color;
+			result.SetRoughness(material.m_roughness);
+			result.SetMetalness(material.m_metalness);
+			result.SetRadiance(material.m_radiance);
+			result.SetTransparent(0u != material.m_transparent);
+
+			request_texture(material.m_base_color_texture,
+							&Material::SetBaseColorTexture);
+			request_texture(material.m_material_texture,
+							&Material::SetMaterialTexture);
+			request_texture(material.m_normal_texture,
+							&Material::SetNormalTexture);
+		}
+
+		// The synchronous lookup creates a not yet started texture on this
+		// thread instead of waiting for a (possibly busy) worker thread.
+		for (const auto& request : texture_requests) {
+			auto texture = resource_manager.GetOrCreate< Texture >(request.m_path);
+			(material_buffer[request.m_material_index].*request.m_setter)(
+				std::move(texture));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_reader.hpp"
+#include "loaders\cmdl\cmdl_records.hpp"
+#include "resource\model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string_view>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+	// Forward declaration.
+	class ResourceManager;
+}
+
+namespace mage::rendering::loader {
+
+	namespace details {
+
+		/**
+		 Creates the materials of the given CMDL materials.
+
+		 @param[in]		path
+						A reference to the path of the CMDL file.
+		 @param[in]		resource_manager
+						A reference to the resource manager.
+		 @param[in]		materials
+						A span containing the CMDL materials.
+		 @param[in]		strings
+						The string table of the CMDL file.
+		 @param[out]	material_buffer
+						A reference to a vector for storing the materials.
+		 @throws		Exception
+						Failed to create the materials.
+		 */
+		void ReadCMDLMaterials(const std::filesystem::path& path,
+							   ResourceManager& resource_manager,
+							   gsl::span< const CMDLMaterial > materials,
+							   std::string_view strings,
+							   std::vector< Material >& material_buffer);
+	}
+
+	/**
+	 A class of CMDL file readers for reading cooked models.
+
+	 A CMDL file contains all the data of a model (i.e. vertices, indices,
+	 model parts with their bounding volumes, levels of detail, hierarchy and
+	 materials) as fixed-size records which are used as is. The vertices and
+	 indices are not copied, but refer to the data of the file read by the
+	 CMDL reader.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	class CMDLReader : private BigEndianBinaryReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a CMDL reader.
+
+		 @param[in]		resource_manager
+						A reference to the resource manager.
+		 @param[in]		model_output
+						A reference to the model output for storing the model
+						data from file.
+		 */
+		explicit CMDLReader(ResourceManager& resource_manager,
+							ModelOutput< VertexT, IndexT >& model_output);
+
+		/**
+		 Constructs a CMDL reader from the given CMDL reader.
+
+		 @param[in]		reader
+						A reference to the CMDL reader to copy.
+		 */
+		CMDLReader(const CMDLReader& reader) = delete;
+
+		/**
+		 Constructs a CMDL reader by moving the given CMDL reader.
+
+		 @param[in]		reader
+						A reference to the CMDL reader to move.
+		 */
+		CMDLReader(CMDLReader&& reader) noexcept;
+
+		/**
+		 Destructs this CMDL reader.
+		 */
+		~CMDLReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given CMDL reader to this CMDL reader.
+
+		 @param[in]		reader
+						A reference to a CMDL reader to copy.
+		 @return		A reference to the copy of the given CMDL reader (i.e.
+						this CMDL reader).
+		 */
+		CMDLReader& operator=(const CMDLReader& reader) = delete;
+
+		/**
+		 Moves the given CMDL reader to this CMDL reader.
+
+		 @param[in]		reader
+						A reference to a CMDL reader to move.
+		 @return		A reference to the moved CMDL reader (i.e. this CMDL
+						reader).
+		 */
+		CMDLReader& operator=(CMDLReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryReader::ReadFromFile;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts reading.
+
+		 @throws		Exception
+						Failed to read from the given file.
+		 */
+		virtual void ReadData() override;
+
+		/**
+		 Checks whether the header of the file is valid.
+
+		 @return		@c true if the header of the file is valid. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsHeaderValid();
+
+		/**
+		 Returns the string of the given string table entry.
+
+		 @param[in]		entry
+						A reference to the offset and length of the string in
+						the string table.
+		 @return		The string of the given string table entry.
+		 @throws		Exception
+						The given string table entry is out of range.
+		 */
+		[[nodiscard]]
+		std::string_view GetString(const U32x2& entry) const;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the resource manager of this CMDL reader.
+		 */
+		ResourceManager& m_resource_manager;
+
+		/**
+		 A reference to the model output of this CMDL reader.
+		 */
+		ModelOutput< VertexT, IndexT >& m_model_output;
+
+		/**
+		 The string table of the file read by this CMDL reader.
+		 */
+		std::string_view m_strings;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\cmdl\cmdl_reader.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,151 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\cmdl\cmdl_tokens.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename VertexT, typename IndexT >
+	CMDLReader< VertexT, IndexT >
+		::CMDLReader(ResourceManager& resource_manager,
+					 ModelOutput< VertexT, IndexT >& model_output)
+		: BigEndianBinaryReader(),
+		m_resource_manager(resource_manager),
+		m_model_output(model_output),
+		m_strings() {}
+
+	template< typename VertexT, typename IndexT >
+	CMDLReader< VertexT, IndexT >::CMDLReader(
+		CMDLReader&& reader) noexcept = default;
+
+	template< typename VertexT, typename IndexT >
+	CMDLReader< VertexT, IndexT >::~CMDLReader() = default;
+
+	template< typename VertexT, typename IndexT >
+	void CMDLReader< VertexT, IndexT >::ReadData() {
+		// Read the header.
+		{
+			const bool result = IsHeaderValid();
+			ThrowIfFailed(result,
+						  "%ls: invalid cooked model header.", GetPath().c_str());
+		}
+
+		const auto vertex_size  = Read< U32 >();
+		const auto index_size   = Read< U32 >();
+		ThrowIfFailed(sizeof(VertexT) == vertex_size
+					  && sizeof(IndexT) == index_size,
+					  "%ls: vertex or index type mismatch.", GetPath().c_str());
+
+		const auto nb_vertices  = Read< U32 >();
+		const auto nb_indices   = Read< U32 >();
+		const auto nb_parts     = Read< U32 >();
+		const auto nb_lods      = Read< U32 >();
+		const auto nb_materials = Read< U32 >();
+		const auto nb_chars     = Read< U32 >();
+
+		// The tables are used as is. The string table is padded to keep the
+		// subsequent vertices aligned.
+		const auto parts     = ReadArray< CMDLModelPart >(nb_parts);
+		const auto lods      = ReadArray< U32x2 >(nb_lods);
+		const auto materials = ReadArray< CMDLMaterial >(nb_materials);
+		const auto chars     = ReadArray< char >((nb_chars + 3u) & ~3u);
+		m_strings = std::string_view(chars, nb_chars);
+
+		const auto vertices  = ReadArray< VertexT >(nb_vertices);
+		const auto indices   = ReadArray< IndexT >(nb_indices);
+		m_model_output.m_mapped_vertex_buffer
+			= gsl::make_span(vertices, static_cast< std::ptrdiff_t >(nb_vertices));
+		m_model_output.m_mapped_index_buffer
+			= gsl::make_span(indices,  static_cast< std::ptrdiff_t >(nb_indices));
+
+		details::ReadCMDLMaterials(GetPath(), m_resource_manager,
+			gsl::make_span(materials, static_cast< std::ptrdiff_t >(nb_materials)),
+			m_strings, m_model_output.m_material_buffer);
+
+		// The bounding volumes are precomputed and the hierarchy and
+		// materials are referenced by index.
+		m_model_output.m_model_parts.reserve(nb_parts);
+		for (U32 i = 0u; i < nb_parts; ++i) {
+			const auto& part = parts[i];
+
+			ThrowIfFailed(size_t(part.m_start_index) + part.m_nb_indices <= nb_indices,
+						  "%ls: model part %u: index range out of range.",
+						  GetPath().c_str(), i);
+			ThrowIfFailed(size_t(part.m_first_lod) + part.m_nb_lods <= nb_lods,
+						  "%ls: model part %u: level of detail range out of range.",
+						  GetPath().c_str(), i);
+			for (U32 j = 0u; j < part.m_nb_lods; ++j) {
+				const auto& lod = lods[part.m_first_lod + j];
+				ThrowIfFailed(size_t(lod[0]) + lod[1] <= nb_indices,
+							  "%ls: model part %u: level of detail %u: index range out of range.",
+							  GetPath().c_str(), i, j);
+			}
+
+			ModelPart model_part;
+			model_part.m_aabb   = AABB(XMLoad(part.m_aabb_min),
+									   XMLoad(part.m_aabb_max));
+			model_part.m_sphere = BoundingSphere(XMLoad(part.m_sphere_centroid),
+												 part.m_sphere_radius);
+			model_part.m_transform.SetTranslation(part.m_translation);
+			model_part.m_transform.SetRotation(   part.m_rotation);
+			model_part.m_transform.SetScale(      part.m_scale);
+			model_part.m_start_index = part.m_start_index;
+			model_part.m_nb_indices  = part.m_nb_indices;
+			model_part.m_lods.assign(lods + part.m_first_lod,
+									 lods + part.m_first_lod + part.m_nb_lods);
+			model_part.m_child       = GetString(part.m_name);
+
+			// The parent model part and material are passed by index and are
+			// not resolved by name.
+			if (g_cmdl_token_none != part.m_parent) {
+				ThrowIfFailed(part.m_parent < nb_parts,
+							  "%ls: model part %u: parent out of range.",
+							  GetPath().c_str(), i);
+				model_part.m_parent_index = part.m_parent;
+			}
+
+			if (g_cmdl_token_none != part.m_material) {
+				ThrowIfFailed(part.m_material < nb_materials,
+							  "%ls: model part %u: material out of range.",
+							  GetPath().c_str(), i);
+				model_part.m_material_index = part.m_material;
+			}
+
+			m_model_output.AddModelPart(std::move(model_part), false);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	bool CMDLReader< VertexT, IndexT >::IsHeaderValid() {
+		for (auto magic = g_cmdl_token_magic; *magic != L'\0'; ++magic) {
+			if (Read< U8 >() != *magic) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	std::string_view CMDLReader< VertexT, IndexT >
+		::GetString(const U32x2& entry) const {
+
+		ThrowIfFailed(size_t(entry[0u]) + entry[1u] <= m_strings.size(),
+					  "%ls: string table entry out of range.",
+					  GetPath().c_str());
+
+		return m_strings.substr(entry[0u], entry[1u]);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "spectrum\spectrum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A struct of CMDL model parts.
+
+	 CMDL model parts are stored as is in the part table of a CMDL file and
+	 refer to other CMDL model parts, CMDL materials, levels of detail and
+	 strings by index (i.e. no names need to be resolved).
+	 */
+	struct CMDLModelPart {
+
+		/**
+		 The minimum point of the AABB of this CMDL model part.
+		 */
+		F32x3 m_aabb_min;
+
+		/**
+		 The maximum point of the AABB of this CMDL model part.
+		 */
+		F32x3 m_aabb_max;
+
+		/**
+		 The centroid of the bounding sphere of this CMDL model part.
+		 */
+		F32x3 m_sphere_centroid;
+
+		/**
+		 The radius of the bounding sphere of this CMDL model part.
+		 */
+		F32 m_sphere_radius;
+
+		/**
+		 The translation of this CMDL model part.
+		 */
+		F32x3 m_translation;
+
+		/**
+		 The rotation of this CMDL model part.
+		 */
+		F32x3 m_rotation;
+
+		/**
+		 The scale of this CMDL model part.
+		 */
+		F32x3 m_scale;
+
+		/**
+		 The start index of this CMDL model part in the index buffer.
+		 */
+		U32 m_start_index;
+
+		/**
+		 The number of indices of this CMDL model part.
+		 */
+		U32 m_nb_indices;
+
+		/**
+		 The index of the first coarser level of detail of this CMDL model
+		 part in the level of detail table.
+		 */
+		U32 m_first_lod;
+
+		/**
+		 The number of coarser levels of detail of this CMDL model part.
+		 */
+		U32 m_nb_lods;
+
+		/**
+		 The index of the parent CMDL model part of this CMDL model part in
+		 the part table, or @c g_cmdl_token_none for the root.
+		 */
+		U32 m_parent;
+
+		/**
+		 The index of the CMDL material of this CMDL model part in the
+		 material table, or @c g_cmdl_token_none for no material.
+		 */
+		U32 m_material;
+
+		/**
+		 The offset and length of the name of this CMDL model part in the
+		 string table.
+		 */
+		U32x2 m_name;
+	};
+
+	static_assert(108 == sizeof(CMDLModelPart),
+				  "CMDL model part struct/layout mismatch");
+
+	/**
+	 A struct of CMDL materials.
+
+	 The texture paths are stored relative to the CMDL file in the string
+	 table. Empty texture paths correspond to no texture.
+	 */
+	struct CMDLMaterial {
+
+		/**
+		 The (linear) base color of this CMDL material.
+		 */
+		RGBA m_base_color;
+
+		/**
+		 The roughness of this CMDL material.
+		 */
+		F32 m_roughness;
+
+		/**
+		 The metalness of this CMDL material.
+		 */
+		F32 m_metalness;
+
+		/**
+		 The radiance of this CMDL material.
+		 */
+		F32 m_radiance;
+
+		/**
+		 A flag indicating whether this CMDL material is transparent.
+		 */
+		U32 m_transparent;
+
+		/**
+		 The offset and length of the name of this CMDL material in the
+		 string table.
+		 */
+		U32x2 m_name;
+
+		/**
+		 The offset and length of the base color texture path of this CMDL
+		 material in the string table.
+		 */
+		U32x2 m_base_color_texture;
+
+		/**
+		 The offset and length of the material texture path of this CMDL
+		 material in the string table.
+		 */
+		U32x2 m_material_texture;
+
+		/**
+		 The offset and length of the normal texture path of this CMDL
+		 material in the string table.
+		 */
+		U32x2 m_normal_texture;
+	};
+
+	static_assert(64 == sizeof(CMDLMaterial),
+				  "CMDL material struct/layout mismatch");
+}
\ No newline at end of file
@@ -0,0 +1,10 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	constexpr const_zstring g_cmdl_token_magic = "MAGEcmdl";
+	constexpr U32           g_cmdl_token_none  = 0xFFFFFFFFu;
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_writer.hpp"
+#include "loaders\cmdl\cmdl_records.hpp"
+#include "resource\model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string_view>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of CMDL file writers for writing cooked models.
+
+	 The names of the model parts are resolved to indices and the bounding
+	 volumes of the model parts are stored, such that reading a CMDL file
+	 requires no parsing.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	class CMDLWriter : private BigEndianBinaryWriter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a CMDL writer.
+
+		 @param[in]		model_output
+						A reference to the model output.
+		 */
+		explicit CMDLWriter(const ModelOutput< VertexT, IndexT >& model_output);
+
+		/**
+		 Constructs a CMDL writer from the given CMDL writer.
+
+		 @param[in]		writer
+						A reference to the CMDL writer to copy.
+		 */
+		CMDLWriter(const CMDLWriter& writer) = delete;
+
+		/**
+		 Constructs a CMDL writer by moving the given CMDL writer.
+
+		 @param[in]		writer
+						A reference to the CMDL writer to move.
+		 */
+		CMDLWriter(CMDLWriter&& writer) noexcept;
+
+		/**
+		 Destructs this CMDL writer.
+		 */
+		~CMDLWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given CMDL writer to this CMDL writer.
+
+		 @param[in]		writer
+						A reference to a CMDL writer to copy.
+		 @return		A reference to the copy of the given CMDL writer (i.e.
+						this CMDL writer).
+		 */
+		CMDLWriter& operator=(const CMDLWriter& writer) = delete;
+
+		/**
+		 Moves the given CMDL writer to this CMDL writer.
+
+		 @param[in]		writer
+						A reference to a CMDL writer to move.
+		 @return		A reference to the moved CMDL writer (i.e. this CMDL
+						writer).
+		 */
+		CMDLWriter& operator=(CMDLWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryWriter::WriteToFile;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		Exception
+						Failed to write.
+		 */
+		virtual void WriteData() override;
+
+		/**
+		 Adds the given string to the string table of this CMDL writer.
+
+		 @param[in]		str
+						The string.
+		 @return		The offset and length of the given string in the
+						string table of this CMDL writer.
+		 */
+		const U32x2 AddString(std::string_view str);
+
+		/**
+		 Adds the path of the given texture relative to the file of this CMDL
+		 writer to the string table of this CMDL writer.
+
+		 @param[in]		texture
+						A pointer to the texture.
+		 @return		The offset and length of the path of the given texture
+						in the string table of this CMDL writer. The length is
+						zero if @a texture is @c nullptr.
+		 */
+		const U32x2 AddTexturePath(const TexturePtr& texture);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the model output to write by this CMDL writer.
+		 */
+		const ModelOutput< VertexT, IndexT >& m_model_output;
+
+		/**
+		 The string table of this CMDL writer.
+		 */
+		std::string m_strings;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\cmdl\cmdl_writer.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\cmdl\cmdl_tokens.hpp"
+#include "logging\error.hpp"
+#include "string\string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename VertexT, typename IndexT >
+	CMDLWriter< VertexT, IndexT >
+		::CMDLWriter(const ModelOutput< VertexT, IndexT >& model_output)
+		: BigEndianBinaryWriter(),
+		m_model_output(model_output),
+		m_strings() {}
+
+	template< typename VertexT, typename IndexT >
+	CMDLWriter< VertexT, IndexT >
+		::CMDLWriter(CMDLWriter&& writer) noexcept = default;
+
+	template< typename VertexT, typename IndexT >
+	CMDLWriter< VertexT, IndexT >::~CMDLWriter() = default;
+
+	template< typename VertexT, typename IndexT >
+	void CMDLWriter< VertexT, IndexT >::WriteData() {
+		const auto& materials   = m_model_output.m_material_buffer;
+		const auto& model_parts = m_model_output.m_model_parts;
+		m_strings.clear();
+
+		// Build the material table.
+		std::vector< CMDLMaterial > cmdl_materials;
+		cmdl_materials.reserve(materials.size());
+		for (const auto& material : materials) {
+			CMDLMaterial record;
+			record.m_base_color         = material.GetBaseColor();
+			record.m_roughness          = material.GetRoughness();
+			record.m_metalness          = material.GetMetalness();
+			record.m_radiance           = material.GetRadiance();
+			record.m_transparent        = material.IsTransparant() ? 1u : 0u;
+			record.m_name               = AddString(material.GetName());
+			record.m_base_color_texture = AddTexturePath(material.GetBaseColorTexture());
+			record.m_material_texture   = AddTexturePath(material.GetMaterialTexture());
+			record.m_normal_texture     = AddTexturePath(material.GetNormalTexture());
+			cmdl_materials.push_back(record);
+		}
+
+		// Resolve the names of the parents and materials which are not 
+		// referred to by index.
+		const auto find_material = [&materials](const std::string& name) noexcept {
+			for (size_t i = 0u; i < materials.size(); ++i) {
+				if (name == materials[i].GetName()) {
+					return static_cast< U32 >(i);
+				}
+			}
+			return g_cmdl_token_none;
+		};
+		const auto find_model_part = [&model_parts](const std::string& name) noexcept {
+			for (size_t i = 0u; i < model_parts.size(); ++i) {
+				if (name == model_parts[i].m_child) {
+					return static_cast< U32 >(i);
+				}
+			}
+			return g_cmdl_token_none;
+		};
+
+		// Build the part and level of detail tables.
+		std::vector< CMDLModelPart > cmdl_model_parts;
+		cmdl_model_parts.reserve(model_parts.size());
+		std::vector< U32x2 > lods;
+		for (const auto& model_part : model_parts) {
+			CMDLModelPart record;
+			record.m_aabb_min        = XMStore< F32x3 >(model_part.m_aabb.MinPoint());
+			record.m_aabb_max        = XMStore< F32x3 >(model_part.m_aabb.MaxPoint());
+			record.m_sphere_centroid = XMStore< F32x3 >(model_part.m_sphere.Centroid());
+			record.m_sphere_radius   = model_part.m_sphere.Radius();
+			record.m_translation     = model_part.m_transform.GetTranslation();
+			record.m_rotation        = model_part.m_transform.GetRotation();
+			record.m_scale           = model_part.m_transform.GetScale();
+			record.m_start_index     = model_part.m_start_index;
+			record.m_nb_indices      = model_part.m_nb_indices;
+			record.m_first_lod       = static_cast< U32 >(lods.size());
+			record.m_nb_lods         = static_cast< U32 >(model_part.m_lods.size());
+			record.m_parent          = (ModelPart::s_no_index != model_part.m_parent_index)
+				                     ? model_part.m_parent_index
+				                     : find_model_part(model_part.m_parent);
+			record.m_material        = (ModelPart::s_no_index != model_part.m_material_index)
+				                     ? model_part.m_material_index
+				                     : find_material(model_part.m_material);
+			record.m_name            = AddString(model_part.m_child);
+			cmdl_model_parts.push_back(record);
+
+			lods.insert(lods.end(), model_part.m_lods.cbegin(),
+									model_part.m_lods.cend());
+		}
+
+		const auto vertices = m_model_output.GetVertices();
+		const auto indices  = m_model_output.GetIndices();
+		const auto nb_chars = static_cast< U32 >(m_strings.size());
+
+		// Pad the string table to keep the subsequent vertices aligned.
+		m_strings.resize((m_strings.size() + 3u) & ~size_t(3u), '\0');
+
+		WriteString(NotNull< const_zstring >(g_cmdl_token_magic));
+
+		Write< U32 >(static_cast< U32 >(sizeof(VertexT)));
+		Write< U32 >(static_cast< U32 >(sizeof(IndexT)));
+		Write< U32 >(static_cast< U32 >(vertices.size()));
+		Write< U32 >(static_cast< U32 >(indices.size()));
+		Write< U32 >(static_cast< U32 >(cmdl_model_parts.size()));
+		Write< U32 >(static_cast< U32 >(lods.size()));
+		Write< U32 >(static_cast< U32 >(cmdl_materials.size()));
+		Write< U32 >(nb_chars);
+
+		WriteArray(gsl::span< const CMDLModelPart >(cmdl_model_parts));
+		WriteArray(gsl::span< const U32x2 >(lods));
+		WriteArray(gsl::span< const CMDLMaterial >(cmdl_materials));
+		WriteArray(gsl::span< const char >(m_strings));
+		WriteArray(vertices);
+		WriteArray(indices);
+	}
+
+	template< typename VertexT, typename IndexT >
+	const U32x2 CMDLWriter< VertexT, IndexT >::AddString(std::string_view str) {
+		const auto offset = static_cast< U32 >(m_strings.size());
+		m_strings.append(str);
+		return { offset, static_cast< U32 >(str.size()) };
+	}
+
+	template< typename VertexT, typename IndexT >
+	const U32x2 CMDLWriter< VertexT, IndexT >
+		::AddTexturePath(const TexturePtr& texture) {
+
+		if (nullptr == texture) {
+			return { 0u, 0u };
+		}
+
+		if (!texture->IsFileResource()) {
+			Warning("%ls: texture %ls is not a file and is not exported.",
+					GetPath().c_str(), texture->GetGuid().c_str());
+			return { 0u, 0u };
+		}
+
+		const auto texture_path = texture->GetPath();
+		auto relative_path
+			= texture_path.lexically_relative(GetPath().parent_path());
+		if (relative_path.empty()) {
+			relative_path = texture_path;
+		}
+
+		return AddString(WStringToString(relative_path.wstring()));
+	}
+}
\ No newline at end of file
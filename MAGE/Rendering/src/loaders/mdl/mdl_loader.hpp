@@ -60,12 +60,16 @@ namespace mage::rendering::loader {
 					A reference to the path.
 	 @param[in]		model_output
 					A reference to the model output.
+	 @param[in]		quantize_vertices
+					A flag indicating whether the vertices of the mesh must be
+					quantized.
 	 @throws		Exception
 					Failed to export the model to file.
 	 */
 	template< typename VertexT, typename IndexT >
 	void ExportMDLModelToFile(const std::filesystem::path& path, 
-							  const ModelOutput< VertexT, IndexT >& model_output);
+							  const ModelOutput< VertexT, IndexT >& model_output, 
+							  bool quantize_vertices = false);
 }
 
 //-----------------------------------------------------------------------------
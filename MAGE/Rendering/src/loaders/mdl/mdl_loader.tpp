@@ -26,9 +26,10 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	void ExportMDLModelToFile(const std::filesystem::path& path, 
-							  const ModelOutput< VertexT, IndexT >& model_output) {
+							  const ModelOutput< VertexT, IndexT >& model_output, 
+							  bool quantize_vertices) {
 		
-		MDLWriter< VertexT, IndexT > writer(model_output);
+		MDLWriter< VertexT, IndexT > writer(model_output, quantize_vertices);
 		writer.WriteToFile(path);
 	}
 }
\ No newline at end of file
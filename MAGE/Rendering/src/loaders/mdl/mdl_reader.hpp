@@ -132,6 +132,14 @@ namespace mage::rendering::loader {
 		 */
 		void ReadMDLSubModel();
 
+		/**
+		 Reads a Level of Detail definition of the last Submodel.
+
+		 @throws		Exception
+						Failed to read a Level of Detail definition.
+		 */
+		void ReadMDLLOD();
+
 		/**
 		 Reads a Material Library definition and imports the materials 
 		 corresponding to the model.
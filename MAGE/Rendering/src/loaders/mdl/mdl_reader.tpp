@@ -35,8 +35,15 @@ namespace mage::rendering::loader {
 		auto msh_path = GetPath();
 		msh_path.replace_extension(L".msh");
 
-		ImportMSHMeshFromFile(msh_path, m_model_output.m_vertex_buffer,
-							  m_model_output.m_index_buffer);
+		// The vertices and indices are not copied, but refer to the mapped 
+		// MSH file which is kept alive by the model output. Quantized 
+		// vertices are not dequantized, but are decoded by the vertex shaders.
+		m_model_output.m_mapped_file = MappedFile(std::move(msh_path));
+		ImportMSHMeshFromFile(m_model_output.m_mapped_file,
+							  m_model_output.m_mapped_vertex_buffer,
+							  m_model_output.m_mapped_index_buffer, 
+							  m_model_output.m_mapped_quantized_vertex_buffer, 
+							  m_model_output.m_mapped_vertex_ranges);
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -49,6 +56,9 @@ namespace mage::rendering::loader {
 		else if (g_mdl_token_submodel         == token) {
 			ReadMDLSubModel();
 		}
+		else if (g_mdl_token_lod              == token) {
+			ReadMDLLOD();
+		}
 		else if (g_mdl_token_material_library == token) {
 			ReadMDLMaterialLibrary();
 		}
@@ -77,6 +87,20 @@ namespace mage::rendering::loader {
 		m_model_output.AddModelPart(std::move(model_part));
 	}
 
+	template< typename VertexT, typename IndexT >
+	void MDLReader< VertexT, IndexT >::ReadMDLLOD() {
+		using std::empty;
+		ThrowIfFailed(!empty(m_model_output.m_model_parts), 
+					  "%ls: line %u: level of detail without submodel.",
+					  GetPath().c_str(), GetCurrentLineNumber());
+		
+		const auto start_index = Read< U32 >();
+		const auto nb_indices  = Read< U32 >();
+		
+		auto& model_part = m_model_output.m_model_parts.back();
+		model_part.m_lods.push_back({ start_index, nb_indices });
+	}
+
 	template< typename VertexT, typename IndexT >
 	void MDLReader< VertexT, IndexT >::ReadMDLMaterialLibrary() {
 		const auto mtl_name = StringToWString(Read< std::string >());
@@ -7,5 +7,6 @@ namespace mage::rendering::loader {
 
 	constexpr const char    g_mdl_token_comment          = '#';
 	constexpr const_zstring g_mdl_token_submodel         = "s";
+	constexpr const_zstring g_mdl_token_lod              = "lod";
 	constexpr const_zstring g_mdl_token_material_library = "mtllib";
 }
\ No newline at end of file
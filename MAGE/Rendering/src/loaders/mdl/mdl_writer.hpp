@@ -43,8 +43,12 @@ namespace mage::rendering::loader {
 		 @param[in]		model_output
 						A reference to the model output containing the model 
 						data.
+		 @param[in]		quantize_vertices
+						A flag indicating whether the vertices of the mesh 
+						must be quantized.
 		 */
-		explicit MDLWriter(const ModelOutput< VertexT, IndexT >& model_output);
+		explicit MDLWriter(const ModelOutput< VertexT, IndexT >& model_output, 
+						   bool quantize_vertices = false);
 
 		/**
 		 Constructs a MDL writer from the given MDL writer.
@@ -147,6 +151,12 @@ namespace mage::rendering::loader {
 		 writer.
 		 */
 		const ModelOutput< VertexT, IndexT >& m_model_output;
+
+		/**
+		 A flag indicating whether the vertices of the mesh must be quantized
+		 by this MDL writer.
+		 */
+		bool m_quantize_vertices;
 	};
 }
 
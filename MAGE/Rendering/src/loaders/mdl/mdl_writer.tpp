@@ -18,9 +18,11 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	MDLWriter< VertexT, IndexT >
-		::MDLWriter(const ModelOutput< VertexT, IndexT >& model_output)
+		::MDLWriter(const ModelOutput< VertexT, IndexT >& model_output, 
+					bool quantize_vertices)
 		: Writer(), 
-		m_model_output(model_output) {}
+		m_model_output(model_output), 
+		m_quantize_vertices(quantize_vertices) {}
 
 	template< typename VertexT, typename IndexT >
 	MDLWriter< VertexT, IndexT >::MDLWriter(MDLWriter&& writer) noexcept = default;
@@ -45,8 +47,29 @@ namespace mage::rendering::loader {
 		auto msh_path = GetPath();
 		msh_path.replace_extension(L".msh");
 
-		ExportMSHMeshToFile(msh_path, m_model_output.m_vertex_buffer,
-			                          m_model_output.m_index_buffer);
+		if (!m_quantize_vertices) {
+			ExportMSHMeshToFile(msh_path, m_model_output.GetVertices(),
+				                          m_model_output.GetIndices());
+			return;
+		}
+
+		// Quantize the vertices relative to the AABB of each model part. The 
+		// levels of detail of a model part share its vertices.
+		std::vector< std::vector< U32x2 > > index_range_groups;
+		index_range_groups.reserve(m_model_output.m_model_parts.size());
+		for (const auto& model_part : m_model_output.m_model_parts) {
+			auto& index_ranges = index_range_groups.emplace_back();
+			index_ranges.reserve(1u + model_part.m_lods.size());
+			index_ranges.push_back({ model_part.m_start_index, 
+									 model_part.m_nb_indices });
+			index_ranges.insert(index_ranges.end(), 
+								model_part.m_lods.cbegin(), 
+								model_part.m_lods.cend());
+		}
+
+		ExportQuantizedMSHMeshToFile(msh_path, m_model_output.GetVertices(),
+			                                   m_model_output.GetIndices(), 
+			                                   gsl::make_span(index_range_groups));
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -76,13 +99,23 @@ namespace mage::rendering::loader {
 		char buffer[MAX_PATH];
 		const auto not_null_buffer = NotNull< const_zstring >(buffer);
 
-		for (const auto& model_part : m_model_output.m_model_parts) {
+		const auto& model_parts = m_model_output.m_model_parts;
+		const auto& materials   = m_model_output.m_material_buffer;
+
+		for (const auto& model_part : model_parts) {
+			// MDL files refer to the parent model part and material by name.
+			const auto& parent   = (ModelPart::s_no_index != model_part.m_parent_index)
+				                 ? model_parts[model_part.m_parent_index].m_child
+				                 : model_part.m_parent;
+			const auto& material = (ModelPart::s_no_index != model_part.m_material_index)
+				                 ? materials[model_part.m_material_index].GetName()
+				                 : model_part.m_material;
 
 			sprintf_s(buffer, std::size(buffer),
 				      "%s %s %s %f %f %f %f %f %f %f %f %f %s %u %u",
 				      g_mdl_token_submodel, 
 				      model_part.m_child.c_str(), 
-				      model_part.m_parent.c_str(),
+				      parent.c_str(),
 				      model_part.m_transform.GetTranslationX(),
 				      model_part.m_transform.GetTranslationY(),
 				      model_part.m_transform.GetTranslationZ(),
@@ -92,11 +125,21 @@ namespace mage::rendering::loader {
 				      model_part.m_transform.GetScaleX(),
 				      model_part.m_transform.GetScaleY(),
 				      model_part.m_transform.GetScaleZ(),
-				      model_part.m_material.c_str(),
+				      material.c_str(),
 				      model_part.m_start_index, 
 				      model_part.m_nb_indices);
 			
 			WriteStringLine(not_null_buffer);
+
+			for (const auto& lod : model_part.m_lods) {
+				sprintf_s(buffer, std::size(buffer),
+					      "%s %u %u",
+					      g_mdl_token_lod, 
+					      lod[0u], 
+					      lod[1u]);
+				
+				WriteStringLine(not_null_buffer);
+			}
 		}
 	}
 }
\ No newline at end of file
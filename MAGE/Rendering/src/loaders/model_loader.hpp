@@ -65,12 +65,16 @@ namespace mage::rendering::loader {
 					A reference to the path.
 	 @param[in]		model_output
 					A reference to the model output.
+	 @param[in]		mesh_desc
+					A reference to the mesh descriptor.
 	 @throws		Exception
 					Failed to export the model to file.
 	 */
 	template< typename VertexT, typename IndexT >
 	void ExportModelToFile(const std::filesystem::path& path, 
-						   const ModelOutput< VertexT, IndexT >& model_output);
+						   const ModelOutput< VertexT, IndexT >& model_output, 
+						   const MeshDescriptor< VertexT, IndexT >& 
+						   mesh_desc = MeshDescriptor< VertexT, IndexT >());
 }
 
 //-----------------------------------------------------------------------------
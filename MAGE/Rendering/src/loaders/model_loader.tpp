@@ -5,6 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "loaders\cmdl\cmdl_loader.hpp"
 #include "loaders\mdl\mdl_loader.hpp"
 #include "loaders\obj\obj_loader.hpp"
 
@@ -24,7 +25,10 @@ namespace mage::rendering::loader {
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
 
-		if (L".mdl" == extension) {
+		if (L".cmdl" == extension) {
+			ImportCMDLModelFromFile(path, resource_manager, model_output);
+		}
+		else if (L".mdl" == extension) {
 			ImportMDLModelFromFile(path, resource_manager, model_output);
 		} 
 		else if (L".obj" == extension) {
@@ -33,17 +37,31 @@ namespace mage::rendering::loader {
 		else {
 			throw Exception("Unknown model file extension: %ls", path.c_str());
 		}
+
+		// Imported CMDL and MDL models keep their mapped vertices and indices 
+		// as is.
+		if (mesh_desc.VertexCacheOptimization()) {
+			model_output.OptimizeMesh(mesh_desc.OverdrawOptimization());
+		}
+		if (0u != mesh_desc.GetNumberOfLODs()) {
+			model_output.GenerateLODs(mesh_desc.GetNumberOfLODs());
+		}
 	}
 
 	template< typename VertexT, typename IndexT >
 	void ExportModelToFile(const std::filesystem::path& path, 
-						   const ModelOutput< VertexT, IndexT >& model_output) {
+						   const ModelOutput< VertexT, IndexT >& model_output, 
+						   const MeshDescriptor< VertexT, IndexT >& mesh_desc) {
 
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
 
-		if (L".mdl" == extension) {
-			ExportMDLModelToFile(path, model_output);
+		if (L".cmdl" == extension) {
+			ExportCMDLModelToFile(path, model_output);
+		}
+		else if (L".mdl" == extension) {
+			ExportMDLModelToFile(path, model_output, 
+								 mesh_desc.VertexQuantization());
 		}
 		else {
 			throw Exception("Unknown model file extension: %ls", path.c_str());
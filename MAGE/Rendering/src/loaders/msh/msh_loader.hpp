@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "io\mapped_file.hpp"
 
 #pragma endregion
 
@@ -46,6 +46,43 @@ namespace mage::rendering::loader {
 		                       std::vector< VertexT >& vertices, 
 		                       std::vector< IndexT >& indices);
 
+	/**
+	 Imports the mesh from the given mapped MSH file without copying the 
+	 vertices and indices. Quantized vertices are not dequantized.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		file
+					A reference to the mapped file. The given mapped file must 
+					outlive the given spans.
+	 @param[out]	vertices
+					A reference to a span referring to the vertices of the 
+					mesh if the given mapped file contains no quantized 
+					vertices.
+	 @param[out]	indices
+					A reference to a span referring to the indices of the 
+					mesh.
+	 @param[out]	quantized_vertices
+					A reference to a span referring to the quantized vertices
+					of the mesh if the given mapped file contains quantized 
+					vertices.
+	 @param[out]	ranges
+					A reference to a span referring to the quantized vertex 
+					ranges of the mesh if the given mapped file contains 
+					quantized vertices.
+	 @throws		Exception
+					Failed to import the mesh from file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ImportMSHMeshFromFile(
+		const MappedFile& file, 
+		gsl::span< const VertexT >& vertices, 
+		gsl::span< const IndexT >& indices, 
+		gsl::span< const QuantizedVertexPositionNormalTexture >& quantized_vertices, 
+		gsl::span< const QuantizedVertexRange >& ranges);
+
 	/**
 	 Exports the given mesh to the MSH file associated with the given path.
 
@@ -56,17 +93,48 @@ namespace mage::rendering::loader {
 	 @param[in]		path
 					A reference to the path.
 	 @param[in]		vertices
-					A reference to a vector containing the vertices of the 
-					mesh.
+					A span containing the vertices of the mesh.
 	 @param[in]		indices
-					A reference to a vector containing the indices of the mesh.
+					A span containing the indices of the mesh.
 	 @throws		Exception
 					Failed to export the mesh to file.
 	 */
 	template< typename VertexT, typename IndexT >
 	void ExportMSHMeshToFile(const std::filesystem::path& path, 
-		                     const std::vector< VertexT >& vertices, 
-		                     const std::vector< IndexT >& indices);
+		                     gsl::span< const VertexT > vertices, 
+		                     gsl::span< const IndexT > indices);
+
+	/**
+	 Exports the given mesh with quantized vertices to the MSH file associated
+	 with the given path.
+
+	 The vertices referenced by each of the given groups of index ranges 
+	 (e.g., the levels of detail of a model part) are split off and are 
+	 quantized relative to their AABB. The indices keep their position.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		vertices
+					A span containing the vertices of the mesh.
+	 @param[in]		indices
+					A span containing the indices of the mesh.
+	 @param[in]		index_range_groups
+					A span containing the groups of index ranges (i.e. start 
+					index and number of indices) of the mesh. Each index 
+					must belong to exactly one group.
+	 @throws		Exception
+					Failed to export the mesh to file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ExportQuantizedMSHMeshToFile(
+		const std::filesystem::path& path, 
+		gsl::span< const VertexT > vertices, 
+		gsl::span< const IndexT > indices, 
+		gsl::span< const std::vector< U32x2 > > index_range_groups);
 }
 
 //-----------------------------------------------------------------------------
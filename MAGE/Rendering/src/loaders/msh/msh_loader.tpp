@@ -7,6 +7,7 @@
 
 #include "loaders\msh\msh_reader.hpp"
 #include "loaders\msh\msh_writer.hpp"
+#include "logging\error.hpp"
 
 #pragma endregion
 
@@ -20,16 +21,75 @@ namespace mage::rendering::loader {
 		                       std::vector< VertexT >& vertices, 
 		                       std::vector< IndexT >& indices) {
 		
-		MSHReader< VertexT, IndexT > reader(vertices, indices);
-		reader.ReadFromFile(path);
+		using std::empty;
+		ThrowIfFailed(empty(vertices), 
+					  "%ls: vertex buffer must be empty.", path.c_str());
+		ThrowIfFailed(empty(indices),
+					  "%ls: index buffer must be empty.", path.c_str());
+
+		const MappedFile file(path);
+		gsl::span< const VertexT > file_vertices;
+		gsl::span< const IndexT >  file_indices;
+		gsl::span< const QuantizedVertexPositionNormalTexture > file_quantized_vertices;
+		gsl::span< const QuantizedVertexRange > file_ranges;
+		ImportMSHMeshFromFile(file, file_vertices, file_indices, 
+							  file_quantized_vertices, file_ranges);
+		
+		if (empty(file_quantized_vertices)) {
+			vertices.assign(file_vertices.begin(), file_vertices.end());
+		}
+		else {
+			vertices = DequantizeVertices< VertexT >(file_quantized_vertices, 
+													 file_ranges);
+		}
+		indices.assign(file_indices.begin(), file_indices.end());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ImportMSHMeshFromFile(
+		const MappedFile& file, 
+		gsl::span< const VertexT >& vertices, 
+		gsl::span< const IndexT >& indices, 
+		gsl::span< const QuantizedVertexPositionNormalTexture >& quantized_vertices, 
+		gsl::span< const QuantizedVertexRange >& ranges) {
+		
+		MSHReader< VertexT, IndexT > reader(vertices, indices, 
+											quantized_vertices, ranges);
+		reader.ReadFromFile(file);
 	}
 
 	template< typename VertexT, typename IndexT >
 	void ExportMSHMeshToFile(const std::filesystem::path& path, 
-		                     const std::vector< VertexT >& vertices, 
-		                     const std::vector< IndexT >& indices) {
+		                     gsl::span< const VertexT > vertices, 
+		                     gsl::span< const IndexT > indices) {
 		
 		MSHWriter< VertexT, IndexT > writer(vertices, indices);
 		writer.WriteToFile(path);
 	}
+
+	template< typename VertexT, typename IndexT >
+	void ExportQuantizedMSHMeshToFile(
+		const std::filesystem::path& path, 
+		gsl::span< const VertexT > vertices, 
+		gsl::span< const IndexT > indices, 
+		gsl::span< const std::vector< U32x2 > > index_range_groups) {
+		
+		std::vector< VertexT > split_vertices;
+		std::vector< IndexT >  split_indices;
+		const auto ranges = SplitQuantizedVertexRanges(vertices, indices, 
+													   index_range_groups, 
+													   split_vertices, 
+													   split_indices);
+		
+		MSHWriter< VertexT, IndexT > writer(gsl::make_span(split_vertices), 
+											gsl::make_span(split_indices), 
+											gsl::make_span(ranges));
+		writer.WriteToFile(path);
+
+		Info("%ls: quantized %zu -> %zu vertices in %zu ranges (%zu -> %zu bytes).",
+			 path.c_str(), vertices.size(), split_vertices.size(), ranges.size(), 
+			 vertices.size() * sizeof(VertexT), 
+			 split_vertices.size() * sizeof(QuantizedVertexPositionNormalTexture) 
+			 + ranges.size() * sizeof(QuantizedVertexRange));
+	}
 }
\ No newline at end of file
@@ -6,15 +6,7 @@
 #pragma region
 
 #include "io\binary_reader.hpp"
-
-#pragma endregion
-
-//-----------------------------------------------------------------------------
-// System Includes
-//-----------------------------------------------------------------------------
-#pragma region
-
-#include <vector>
+#include "resource\mesh\vertex_quantization.hpp"
 
 #pragma endregion
 
@@ -26,6 +18,11 @@ namespace mage::rendering::loader {
 	/**
 	 A class of MSH file readers for reading meshes.
 
+	 The vertices and indices are not copied, but refer to the data of the
+	 file read by the MSH reader. Quantized vertices and their quantized 
+	 vertex ranges are not dequantized, but refer to the data of the file read
+	 by the MSH reader as well.
+
 	 @tparam		VertexT
 					The vertex type.
 	 @tparam		IndexT
@@ -44,14 +41,25 @@ namespace mage::rendering::loader {
 		 Constructs a MSH reader.
 
 		 @param[in]		vertices
-						A reference to a vector for storing the read vertices
+						A reference to a span for storing the read vertices
 						from file.
 		 @param[in]		indices
-						A reference to a vector for storing the read indices
+						A reference to a span for storing the read indices
 						from file.
+		 @param[in]		quantized_vertices
+						A reference to a span for storing the read quantized 
+						vertices from file if the file contains quantized 
+						vertices.
+		 @param[in]		ranges
+						A reference to a span for storing the read quantized 
+						vertex ranges from file if the file contains quantized
+						vertices.
 		 */
-		explicit MSHReader(std::vector< VertexT >& vertices, 
-			               std::vector< IndexT >& indices);
+		explicit MSHReader(
+			gsl::span< const VertexT >& vertices, 
+			gsl::span< const IndexT >& indices, 
+			gsl::span< const QuantizedVertexPositionNormalTexture >& quantized_vertices, 
+			gsl::span< const QuantizedVertexRange >& ranges);
 
 		/**
 		 Constructs a MSH reader from the given MSH reader.
@@ -121,7 +129,8 @@ namespace mage::rendering::loader {
 		virtual void ReadData() override;
 
 		/**
-		 Checks whether the header of the file is valid.
+		 Checks whether the header of the file is valid. Both the header of 
+		 non-quantized and the header of quantized meshes are valid.
 
 		 @return		@c true if the header of the file is valid. @c false 
 						otherwise.
@@ -134,16 +143,34 @@ namespace mage::rendering::loader {
 		//---------------------------------------------------------------------
 
 		/**
-		 A reference to a vector containing the read vertices of this MSH 
+		 A reference to a span containing the read vertices of this MSH 
 		 reader.
 		 */
-		std::vector< VertexT >& m_vertices;
+		gsl::span< const VertexT >& m_vertices;
 
 		/**
-		 A reference to a vector containing the read indices of this MSH 
+		 A reference to a span containing the read indices of this MSH 
 		 reader.
 		 */
-		std::vector< IndexT >& m_indices;
+		gsl::span< const IndexT >& m_indices;
+
+		/**
+		 A reference to a span containing the read quantized vertices of this 
+		 MSH reader.
+		 */
+		gsl::span< const QuantizedVertexPositionNormalTexture >& m_quantized_vertices;
+
+		/**
+		 A reference to a span containing the read quantized vertex ranges of 
+		 this MSH reader.
+		 */
+		gsl::span< const QuantizedVertexRange >& m_ranges;
+
+		/**
+		 A flag indicating whether the file read by this MSH reader contains 
+		 quantized vertices.
+		 */
+		bool m_quantized;
 	};
 }
 
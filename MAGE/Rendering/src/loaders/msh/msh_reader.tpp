@@ -17,11 +17,17 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	MSHReader< VertexT, IndexT >
-		::MSHReader(std::vector< VertexT >& vertices, 
-		            std::vector< IndexT >& indices)
+		::MSHReader(
+			gsl::span< const VertexT >& vertices, 
+			gsl::span< const IndexT >& indices, 
+			gsl::span< const QuantizedVertexPositionNormalTexture >& quantized_vertices, 
+			gsl::span< const QuantizedVertexRange >& ranges)
 		: BigEndianBinaryReader(), 
 		m_vertices(vertices), 
-		m_indices(indices) {}
+		m_indices(indices), 
+		m_quantized_vertices(quantized_vertices), 
+		m_ranges(ranges), 
+		m_quantized(false) {}
 
 	template< typename VertexT, typename IndexT >
 	MSHReader< VertexT, IndexT >::MSHReader(
@@ -32,14 +38,6 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	void MSHReader< VertexT, IndexT >::ReadData() {
-		using std::empty;
-		ThrowIfFailed(empty(m_vertices), 
-					  "%ls: vertex buffer must be empty.",
-					  GetPath().c_str());
-		ThrowIfFailed(empty(m_indices),
-					  "%ls: index buffer must be empty.",
-					  GetPath().c_str());
-		
 		// Read the header.
 		{
 			const bool result = IsHeaderValid();
@@ -50,22 +48,52 @@ namespace mage::rendering::loader {
 		const auto nb_vertices = Read< U32 >();
 		const auto nb_indices  = Read< U32 >();
 		
-		const auto vertices = ReadArray< VertexT >(nb_vertices);
-		m_vertices.assign(vertices, vertices + nb_vertices);
+		if (m_quantized) {
+			const auto nb_ranges = Read< U32 >();
+			const auto ranges    = ReadArray< QuantizedVertexRange >(nb_ranges);
+			const auto vertices  
+				= ReadArray< QuantizedVertexPositionNormalTexture >(nb_vertices);
+			
+			for (U32 i = 0u; i < nb_ranges; ++i) {
+				const auto& range = ranges[i];
+				ThrowIfFailed(size_t(range.m_start_vertex) + range.m_nb_vertices 
+							  <= nb_vertices,
+							  "%ls: quantized vertex range %u out of range.", 
+							  GetPath().c_str(), i);
+			}
+
+			m_ranges             = gsl::make_span(ranges, 
+				static_cast< std::ptrdiff_t >(nb_ranges));
+			m_quantized_vertices = gsl::make_span(vertices, 
+				static_cast< std::ptrdiff_t >(nb_vertices));
+		}
+		else {
+			const auto vertices = ReadArray< VertexT >(nb_vertices);
+			m_vertices = gsl::make_span(vertices, 
+										static_cast< std::ptrdiff_t >(nb_vertices));
+		}
 
-		const auto indices   = ReadArray< IndexT >(nb_indices);
-		m_indices.assign(indices, indices + nb_indices);
+		const auto indices  = ReadArray< IndexT >(nb_indices);
+		m_indices  = gsl::make_span(indices, 
+									static_cast< std::ptrdiff_t >(nb_indices));
 	}
 
 	template< typename VertexT, typename IndexT >
 	[[nodiscard]]
 	bool MSHReader< VertexT, IndexT >::IsHeaderValid() {
-		for (auto magic = g_msh_token_magic; *magic != L'\0'; ++magic) {
-			if (*magic != Read< U8 >()) {
-				return false;
-			}
+		// Both magic tokens have the same length.
+		bool valid     = true;
+		bool quantized = true;
+		for (auto magic = g_msh_token_magic, 
+			 magic_quantized = g_msh_token_magic_quantized; 
+			 *magic != L'\0'; ++magic, ++magic_quantized) {
+			
+			const auto c = Read< U8 >();
+			valid     = valid     && (*magic           == c);
+			quantized = quantized && (*magic_quantized == c);
 		}
 
-		return true;
+		m_quantized = quantized;
+		return valid || quantized;
 	}
 }
\ No newline at end of file
@@ -5,5 +5,6 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering::loader {
 
-	constexpr const_zstring g_msh_token_magic = "MAGEmesh";
+	constexpr const_zstring g_msh_token_magic           = "MAGEmesh";
+	constexpr const_zstring g_msh_token_magic_quantized = "MAGEmsh2";
 }
\ No newline at end of file
@@ -6,15 +6,7 @@
 #pragma region
 
 #include "io\binary_writer.hpp"
-
-#pragma endregion
-
-//-----------------------------------------------------------------------------
-// System Includes
-//-----------------------------------------------------------------------------
-#pragma region
-
-#include <vector>
+#include "resource\mesh\vertex_quantization.hpp"
 
 #pragma endregion
 
@@ -26,6 +18,11 @@ namespace mage::rendering::loader {
 	/**
 	 A class of MSH file writers for writing meshes.
 
+	 If quantized vertex ranges are provided, the vertices are written as
+	 quantized vertices (i.e. 16-bit normalized positions relative to the 
+	 AABB of their quantized vertex range, octahedral encoded normals and 
+	 half float texture coordinates) preceded by the quantized vertex ranges.
+
 	 @tparam		VertexT
 					The vertex type.
 	 @tparam		IndexT
@@ -45,12 +42,18 @@ namespace mage::rendering::loader {
 		 Constructs a MSH writer.
 
 		 @param[in]		vertices
-						A reference to a vector containing the vertices.
+						A span containing the vertices.
 		 @param[in]		indices
-						A reference to a vector containing the indices.
+						A span containing the indices.
+		 @param[in]		ranges
+						A span containing the quantized vertex ranges 
+						covering the given vertices. If empty, the vertices
+						are not quantized.
 		 */
-		explicit MSHWriter(const std::vector< VertexT >& vertices, 
-			               const std::vector< IndexT >& indices);
+		explicit MSHWriter(gsl::span< const VertexT > vertices, 
+			               gsl::span< const IndexT > indices, 
+			               gsl::span< const QuantizedVertexRange > ranges 
+			               = {});
 		
 		/**
 		 Constructs a MSH writer from the given MSH writer.
@@ -122,16 +125,20 @@ namespace mage::rendering::loader {
 		//---------------------------------------------------------------------
 
 		/**
-		 A reference to a vector containing the vertices to write by this VS 
-		 writer.
+		 A span containing the vertices to write by this VS writer.
 		 */
-		const std::vector< VertexT >& m_vertices;
+		gsl::span< const VertexT > m_vertices;
 		
 		/**
-		 A reference to a vector containing the indices to write by this VS 
+		 A span containing the indices to write by this VS writer.
+		 */
+		gsl::span< const IndexT > m_indices;
+
+		/**
+		 A span containing the quantized vertex ranges to write by this VS 
 		 writer.
 		 */
-		const std::vector< IndexT >& m_indices;
+		gsl::span< const QuantizedVertexRange > m_ranges;
 	};
 }
 
@@ -16,11 +16,13 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	MSHWriter< VertexT, IndexT >
-		::MSHWriter(const std::vector< VertexT >& vertices, 
-		            const std::vector< IndexT >& indices)
+		::MSHWriter(gsl::span< const VertexT > vertices, 
+		            gsl::span< const IndexT > indices, 
+		            gsl::span< const QuantizedVertexRange > ranges)
 		: BigEndianBinaryWriter(), 
 		m_vertices(vertices), 
-		m_indices(indices) {}
+		m_indices(indices), 
+		m_ranges(ranges) {}
 
 	template< typename VertexT, typename IndexT >
 	MSHWriter< VertexT, IndexT >
@@ -32,14 +34,31 @@ namespace mage::rendering::loader {
 	template< typename VertexT, typename IndexT >
 	void MSHWriter< VertexT, IndexT >::WriteData() {
 
-		WriteString(NotNull< const_zstring >(g_msh_token_magic));
+		using std::empty;
+		const bool quantize = !empty(m_ranges);
+
+		WriteString(NotNull< const_zstring >(quantize ? 
+												 g_msh_token_magic_quantized :
+												 g_msh_token_magic));
 
 		const auto nb_vertices = static_cast< U32 >(m_vertices.size());
 		Write< U32 >(nb_vertices);
 		const auto nb_indices  = static_cast< U32 >(m_indices.size());
 		Write< U32 >(nb_indices);
 		
-		WriteArray(gsl::make_span(m_vertices));
-		WriteArray(gsl::make_span(m_indices));
+		if (quantize) {
+			const auto nb_ranges = static_cast< U32 >(m_ranges.size());
+			Write< U32 >(nb_ranges);
+			WriteArray(m_ranges);
+
+			const auto vertices = QuantizeVertices(m_vertices, m_ranges);
+			WriteArray(gsl::span< const QuantizedVertexPositionNormalTexture >(
+				vertices));
+		}
+		else {
+			WriteArray(m_vertices);
+		}
+		
+		WriteArray(m_indices);
 	}
 }
\ No newline at end of file
@@ -18,7 +18,8 @@ namespace mage::rendering::loader {
 						 std::vector< Material >& material_buffer)
 		: LineReader(), 
 		m_resource_manager(resource_manager), 
-		m_material_buffer(material_buffer) {}
+		m_material_buffer(material_buffer),
+		m_texture_requests() {}
 
 	MTLReader::MTLReader(MTLReader&& reader) noexcept = default;
 
@@ -96,15 +97,15 @@ namespace mage::rendering::loader {
 	}
 
 	void MTLReader::ReadMTLBaseColorTexture() {
-		m_material_buffer.back().SetBaseColorTexture(ReadMTLTexture());
+		RequestMTLTexture(&Material::SetBaseColorTexture);
 	}
 
 	void MTLReader::ReadMTLMaterialTexture() {
-		m_material_buffer.back().SetMaterialTexture(ReadMTLTexture());
+		RequestMTLTexture(&Material::SetMaterialTexture);
 	}
 
 	void MTLReader::ReadMTLNormalTexture() {
-		m_material_buffer.back().SetNormalTexture(ReadMTLTexture());
+		RequestMTLTexture(&Material::SetNormalTexture);
 	}
 
 	[[nodiscard]]
@@ -137,13 +138,37 @@ namespace mage::rendering::loader {
 		return { red, green, blue, alpha };
 	}
 
-	[[nodiscard]]
-	TexturePtr MTLReader::ReadMTLTexture() {
+	void MTLReader::RequestMTLTexture(void (Material::*setter)(TexturePtr)) {
 		// "-options args" are not supported and are not allowed.
 		const auto texture_name = StringToWString(Read< std::string >());
 		auto texture_path       = GetPath();
 		texture_path.replace_filename(texture_name);
+		// The texture path is normalized to match the key of the same texture
+		// loaded through other paths (e.g., CMDL files).
+		texture_path = texture_path.lexically_normal();
+
+		auto texture = m_resource_manager.GetOrCreateAsync< Texture >(
+			texture_path);
+		m_texture_requests.push_back({ 
+			texture_path.wstring(), 
+			std::move(texture), 
+			m_material_buffer.size() - 1u, 
+			setter 
+		});
+	}
+
+	void MTLReader::Postprocess() {
+		LineReader::Postprocess();
+
+		// The synchronous lookup creates a not yet started texture on this 
+		// thread instead of waiting for a (possibly busy) worker thread.
+		for (const auto& request : m_texture_requests) {
+			auto texture 
+				= m_resource_manager.GetOrCreate< Texture >(request.m_path);
+			(m_material_buffer[request.m_material_index].*request.m_setter)(
+				std::move(texture));
+		}
 
-		return m_resource_manager.GetOrCreate< Texture >(texture_path);
+		m_texture_requests.clear();
 	}
 }
\ No newline at end of file
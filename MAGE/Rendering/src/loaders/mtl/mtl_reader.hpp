@@ -105,6 +105,16 @@ namespace mage::rendering::loader {
 		 */
 		virtual void ReadLine() override;
 
+		/**
+		 Post-processes after reading the current file of this MTL reader.
+
+		 The textures requested while reading are assigned to their materials.
+
+		 @throws		Exception
+						Failed to finish post-processing successfully.
+		 */
+		virtual void Postprocess() override;
+
 		/**
 		 Reads a Material Name definition.
 
@@ -192,15 +202,19 @@ namespace mage::rendering::loader {
 		const SRGBA ReadMTLSRGBA();
 
 		/**
-		 Reads a texture.
+		 Requests the texture represented by the next token of this MTL reader 
+		 for the current material.
+
+		 The texture is created asynchronously and assigned to the material 
+		 while post-processing. Hence, all the textures of a MTL file are 
+		 created in parallel.
 
-		 @return		A pointer to the texture represented by the next token
-						of this MTL reader.
+		 @param[in]		setter
+						The texture setter of the material.
 		 @throws		Exception
 						Failed to read a texture.
 		 */
-		[[nodiscard]]
-		TexturePtr ReadMTLTexture();
+		void RequestMTLTexture(void (Material::*setter)(TexturePtr));
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -216,5 +230,43 @@ namespace mage::rendering::loader {
 		 reader.
 		 */
 		std::vector< Material >& m_material_buffer;
+
+		/**
+		 A struct of texture requests.
+		 */
+		struct TextureRequest {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The path of the texture.
+			 */
+			std::wstring m_path;
+
+			/**
+			 The future of the texture (which keeps the texture alive until it 
+			 is assigned).
+			 */
+			std::shared_future< TexturePtr > m_texture;
+
+			/**
+			 The index of the material in the material buffer.
+			 */
+			size_t m_material_index;
+
+			/**
+			 The texture setter of the material.
+			 */
+			void (Material::*m_setter)(TexturePtr);
+		};
+
+		/**
+		 A vector containing the pending texture requests of this MTL reader.
+		 */
+		std::vector< TextureRequest > m_texture_requests;
 	};
 }
\ No newline at end of file
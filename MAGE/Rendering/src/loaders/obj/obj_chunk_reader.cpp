@@ -0,0 +1,397 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\obj\obj_chunk_reader.hpp"
+#include "loaders\obj\obj_tokens.hpp"
+#include "resource\rendering_resource_manager.hpp"
+#include "geometry\geometry.hpp"
+#include "exception\exception.hpp"
+#include "logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <exception>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	namespace {
+
+		/**
+		 Checks whether the given character is a whitespace character (i.e.
+		 a token separator of line readers).
+
+		 @param[in]		c
+						The character.
+		 @return		@c true if the given character is a whitespace
+						character. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool IsWhitespace(char c) noexcept {
+			return ' ' == c || '\t' == c || '\r' == c || '\v' == c || '\f' == c;
+		}
+
+		/**
+		 Returns the first token of the given line (like line readers).
+
+		 @param[in]		first
+						A pointer to the first character of the line.
+		 @param[in]		last
+						A pointer to the past-the-end character of the line.
+		 @return		The first token of the given line.
+		 */
+		[[nodiscard]]
+		const std::string_view GetFirstToken(const char* first,
+											 const char* last) noexcept {
+
+			first = std::find_if_not(first, last, IsWhitespace);
+			if (last == first) {
+				return {};
+			}
+
+			if ('"' == *first) {
+				const auto token_last = std::find(first + 1, last, '"');
+				if (last != token_last) {
+					return { first + 1,
+						     static_cast< size_t >(token_last - first - 1) };
+				}
+			}
+
+			const auto token_last = std::find_if(first, last, IsWhitespace);
+			return { first, static_cast< size_t >(token_last - first) };
+		}
+	}
+
+	[[nodiscard]]
+	const OBJChunkCounts CountOBJChunk(std::string_view input) noexcept {
+		OBJChunkCounts counts = {};
+
+		auto first = input.data();
+		const auto last = input.data() + input.size();
+		while (last != first) {
+			const auto line_last = std::find(first, last, '\n');
+
+			const auto token = GetFirstToken(first, line_last);
+			if (g_obj_token_vertex == token) {
+				++counts.m_nb_vertex_coordinates;
+			}
+			else if (g_obj_token_texture == token) {
+				++counts.m_nb_vertex_texture_coordinates;
+			}
+			else if (g_obj_token_normal == token) {
+				++counts.m_nb_vertex_normal_coordinates;
+			}
+
+			++counts.m_nb_lines;
+
+			first = (last == line_last) ? last : line_last + 1;
+		}
+
+		return counts;
+	}
+
+	[[nodiscard]]
+	const std::vector< OBJChunk >
+		ReadOBJChunks(ResourceManager& resource_manager,
+					  const std::vector< std::string_view >& inputs,
+					  const std::filesystem::path& path,
+					  bool invert_handedness,
+					  bool clockwise_order) {
+
+		auto& job_system = resource_manager.GetJobSystem();
+
+		// Count the lines and vertex coordinates of all chunks in parallel.
+		std::vector< OBJChunkCounts > counts(inputs.size());
+		job_system.ParallelFor(0u, inputs.size(),
+			[&counts, &inputs](size_t first, size_t last) noexcept {
+				for (auto i = first; i < last; ++i) {
+					counts[i] = CountOBJChunk(inputs[i]);
+				}
+			}, 1u);
+
+		// The line number and relative vertex indices of a chunk depend on
+		// the counts of all the preceding chunks.
+		std::vector< OBJChunkCounts > offsets(inputs.size());
+		OBJChunkCounts total = {};
+		for (size_t i = 0u; i < inputs.size(); ++i) {
+			offsets[i] = total;
+
+			const auto& count = counts[i];
+			total.m_nb_lines                      += count.m_nb_lines;
+			total.m_nb_vertex_coordinates         += count.m_nb_vertex_coordinates;
+			total.m_nb_vertex_texture_coordinates += count.m_nb_vertex_texture_coordinates;
+			total.m_nb_vertex_normal_coordinates  += count.m_nb_vertex_normal_coordinates;
+		}
+
+		// Read all chunks in parallel. Exceptions may not escape from a job: 
+		// the exception (if any) of each chunk is kept for the calling thread.
+		std::vector< OBJChunk > chunks(inputs.size());
+		std::vector< std::exception_ptr > exceptions(inputs.size());
+		job_system.ParallelFor(0u, inputs.size(),
+			[&](size_t first, size_t last) noexcept {
+				for (auto i = first; i < last; ++i) {
+					try {
+						OBJChunkReader reader(chunks[i], offsets[i],
+											  invert_handedness,
+											  clockwise_order);
+						reader.ReadFromMemory(inputs[i], path,
+											  offsets[i].m_nb_lines);
+					}
+					catch (...) {
+						exceptions[i] = std::current_exception();
+					}
+				}
+			}, 1u);
+
+		// Rethrow the exception (if any) of the first failing chunk.
+		for (const auto& exception : exceptions) {
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+		}
+
+		return chunks;
+	}
+
+	OBJChunkReader::OBJChunkReader(OBJChunk& chunk,
+								   const OBJChunkCounts& counts,
+								   bool invert_handedness,
+								   bool clockwise_order)
+		: LineReader(),
+		m_chunk(chunk),
+		m_counts(counts),
+		m_mapping(),
+		m_face(),
+		m_invert_handedness(invert_handedness),
+		m_clockwise_order(clockwise_order) {}
+
+	OBJChunkReader::OBJChunkReader(OBJChunkReader&& reader) noexcept = default;
+
+	OBJChunkReader::~OBJChunkReader() = default;
+
+	void OBJChunkReader::ReadLine() {
+		const auto token = Read< std::string_view >();
+
+		if (g_obj_token_comment == token[0]) {
+			return;
+		}
+		else if (g_obj_token_vertex           == token) {
+			ReadOBJVertex();
+		}
+		else if (g_obj_token_texture          == token) {
+			ReadOBJVertexTexture();
+		}
+		else if (g_obj_token_normal           == token) {
+			ReadOBJVertexNormal();
+		}
+		else if (g_obj_token_face             == token) {
+			ReadOBJFace();
+		}
+		else if (g_obj_token_material_library == token) {
+			ReadOBJMaterialLibrary();
+		}
+		else if (g_obj_token_material_use     == token) {
+			ReadOBJMaterialUse();
+		}
+		else if (g_obj_token_group            == token) {
+			ReadOBJGroup();
+		}
+		else if (g_obj_token_object           == token
+			  || g_obj_token_smoothing_group  == token) {
+			// Silently ignore object and smoothing group declarations.
+			Read< std::string_view >();
+		}
+		else {
+			Warning("%ls: line %u: unsupported keyword token: %s.",
+					GetPath().c_str(), GetCurrentLineNumber(),
+					std::string(token).c_str());
+			return;
+		}
+
+		ReadRemainingTokens();
+	}
+
+	void OBJChunkReader::ReadOBJMaterialLibrary() {
+		OBJChunkEvent event;
+		event.m_name        = Read< std::string >();
+		event.m_start_index = m_chunk.m_indices.size();
+		event.m_type        = OBJChunkEvent::Type::MaterialLibrary;
+
+		m_chunk.m_events.push_back(std::move(event));
+	}
+
+	void OBJChunkReader::ReadOBJMaterialUse() {
+		OBJChunkEvent event;
+		event.m_name        = Read< std::string >();
+		event.m_start_index = m_chunk.m_indices.size();
+		event.m_type        = OBJChunkEvent::Type::MaterialUse;
+
+		m_chunk.m_events.push_back(std::move(event));
+	}
+
+	void OBJChunkReader::ReadOBJGroup() {
+		OBJChunkEvent event;
+		event.m_start_index = m_chunk.m_indices.size();
+		event.m_type        = OBJChunkEvent::Type::Group;
+
+		auto& model_part = event.m_model_part;
+		model_part.m_child = Read< std::string >();
+		if (ContainsTokens()) {
+			if (!Contains< F32 >()) {
+				model_part.m_parent  = Read< std::string >();
+			}
+
+			auto translation = InvertHandness(Point3(Read< F32, 3 >()));
+			model_part.m_transform.SetTranslation(std::move(translation));
+			model_part.m_transform.SetRotation(Read< F32, 3 >());
+			model_part.m_transform.SetScale(   Read< F32, 3 >());
+		}
+
+		m_chunk.m_events.push_back(std::move(event));
+	}
+
+	void OBJChunkReader::ReadOBJVertex() {
+		const Point3 read_vertex(Read< F32, 3 >());
+		auto vertex = m_invert_handedness ?
+			InvertHandness(read_vertex) : read_vertex;
+
+		m_chunk.m_vertex_coordinates.push_back(std::move(vertex));
+	}
+
+	void OBJChunkReader::ReadOBJVertexTexture() {
+		const UV read_texture(Read< F32, 2 >());
+		if (Contains< F32 >()) {
+			// Silently ignore 3D vertex texture coordinates.
+			Read< F32 >();
+		}
+
+		auto texture = m_invert_handedness ?
+			InvertHandness(read_texture) : read_texture;
+
+		m_chunk.m_vertex_texture_coordinates.push_back(std::move(texture));
+	}
+
+	void OBJChunkReader::ReadOBJVertexNormal() {
+		const Normal3 read_normal(Read< F32, 3 >());
+		auto normal = m_invert_handedness ?
+			InvertHandness(read_normal) : read_normal;
+
+		m_chunk.m_vertex_normal_coordinates.push_back(std::move(normal));
+	}
+
+	void OBJChunkReader::ReadOBJFace() {
+		m_face.clear();
+		while (m_face.size() < 3 || ContainsTokens()) {
+			const auto vertex_indices = ReadOBJVertexIndices();
+
+			const auto index = static_cast< U32 >(m_chunk.m_vertices.size());
+			if (const auto [it, inserted]
+				= m_mapping.try_emplace(vertex_indices, index);
+				inserted) {
+
+				m_chunk.m_vertices.push_back(vertex_indices);
+				m_face.push_back(index);
+			}
+			else {
+				m_face.push_back(it->second);
+			}
+		}
+
+		auto& indices = m_chunk.m_indices;
+		if (m_clockwise_order) {
+			for (size_t i = 1; i < m_face.size() - 1; ++i) {
+				indices.push_back(m_face[0]);
+				indices.push_back(m_face[i + 1]);
+				indices.push_back(m_face[i]);
+			}
+		}
+		else {
+			for (size_t i = 1; i < m_face.size() - 1; ++i) {
+				indices.push_back(m_face[0]);
+				indices.push_back(m_face[i]);
+				indices.push_back(m_face[i + 1]);
+			}
+		}
+	}
+
+	[[nodiscard]]
+	const U32x3 OBJChunkReader::ReadOBJVertexIndices() {
+		const auto token = Read< std::string_view >();
+
+		S32 v_index  = 0;
+		S32 vt_index = 0;
+		S32 vn_index = 0;
+
+		// v, v/vt, v/vt/vn or v//vn
+		const auto slash1 = token.find('/');
+		v_index = ToOBJVertexIndex(token.substr(0u, slash1), "v", token);
+		if (std::string_view::npos != slash1) {
+			const auto slash2 = token.find('/', slash1 + 1u);
+			if (std::string_view::npos == slash2) {
+				vt_index = ToOBJVertexIndex(token.substr(slash1 + 1u),
+											"vt", token);
+			}
+			else {
+				if (slash1 + 1u != slash2) {
+					vt_index = ToOBJVertexIndex(
+						token.substr(slash1 + 1u, slash2 - slash1 - 1u),
+						"vt", token);
+				}
+				vn_index = ToOBJVertexIndex(token.substr(slash2 + 1u),
+											"vn", token);
+			}
+		}
+
+		// Relative indices refer to the coordinates read so far (including
+		// the coordinates of all the preceding OBJ chunks).
+		const auto nb_v  = m_counts.m_nb_vertex_coordinates
+			+ static_cast< U32 >(m_chunk.m_vertex_coordinates.size());
+		const auto nb_vt = m_counts.m_nb_vertex_texture_coordinates
+			+ static_cast< U32 >(m_chunk.m_vertex_texture_coordinates.size());
+		const auto nb_vn = m_counts.m_nb_vertex_normal_coordinates
+			+ static_cast< U32 >(m_chunk.m_vertex_normal_coordinates.size());
+
+		const auto v  = static_cast< U32 >((0 <=  v_index) ?  v_index
+		              : static_cast< S32 >(nb_v)  +  v_index);
+		const auto vt = static_cast< U32 >((0 <= vt_index) ? vt_index
+		              : static_cast< S32 >(nb_vt) + vt_index);
+		const auto vn = static_cast< U32 >((0 <= vn_index) ? vn_index
+		              : static_cast< S32 >(nb_vn) + vn_index);
+
+		return { v, vt, vn };
+	}
+
+	[[nodiscard]]
+	S32 OBJChunkReader::ToOBJVertexIndex(std::string_view token,
+										 const_zstring component,
+										 std::string_view vertex_indices_token) const {
+
+		const auto first = token.data();
+		const auto last  = first + token.size();
+
+		if (const auto result
+			= StringTo< S32 >(NotNull< const char* >(first),
+							  NotNull< const char* >(last));
+			bool(result)) {
+
+			return *result;
+		}
+		else {
+			throw Exception("%ls: line %u: invalid %s index value found in %s.",
+							GetPath().c_str(), GetCurrentLineNumber(), component,
+							std::string(vertex_indices_token).c_str());
+		}
+	}
+}
\ No newline at end of file
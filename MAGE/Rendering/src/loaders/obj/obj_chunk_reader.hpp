@@ -0,0 +1,477 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\line_reader.hpp"
+#include "resource\model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+	// Forward declaration.
+	class ResourceManager;
+}
+
+namespace mage::rendering::loader {
+
+	//-------------------------------------------------------------------------
+	// OBJVertexIndicesHash
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of @c U32x3 hash functions for OBJ vertex indices.
+	 */
+	struct OBJVertexIndicesHash {
+
+	public:
+
+		/**
+		 Hashes the given @c U32x3 vector.
+
+		 @param[in]		vertex_indices
+						A reference to the vector.
+		 @return		The hash value of the given vector.
+		 */
+		[[nodiscard]]
+		size_t operator()(const U32x3& vertex_indices) const noexcept {
+			U64 hash = vertex_indices[0];
+			hash = hash * 0x9E3779B97F4A7C15ull + vertex_indices[1];
+			hash = hash * 0x9E3779B97F4A7C15ull + vertex_indices[2];
+			return static_cast< size_t >(hash ^ (hash >> 32u));
+		}
+	};
+
+	//-------------------------------------------------------------------------
+	// OBJChunkCounts
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of OBJ chunk counts.
+	 */
+	struct OBJChunkCounts {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of lines of the OBJ chunk.
+		 */
+		U32 m_nb_lines;
+
+		/**
+		 The number of vertex position coordinates of the OBJ chunk.
+		 */
+		U32 m_nb_vertex_coordinates;
+
+		/**
+		 The number of vertex texture coordinates of the OBJ chunk.
+		 */
+		U32 m_nb_vertex_texture_coordinates;
+
+		/**
+		 The number of vertex normal coordinates of the OBJ chunk.
+		 */
+		U32 m_nb_vertex_normal_coordinates;
+	};
+
+	/**
+	 Counts the lines and vertex coordinates definitions of the given OBJ
+	 chunk.
+
+	 @param[in]		input
+					The OBJ chunk.
+	 @return		The counts of the given OBJ chunk.
+	 */
+	[[nodiscard]]
+	const OBJChunkCounts CountOBJChunk(std::string_view input) noexcept;
+
+	//-------------------------------------------------------------------------
+	// OBJChunk
+	//-------------------------------------------------------------------------
+
+	/**
+	 A struct of OBJ chunk events (i.e. definitions which must be applied to
+	 the model output in file order).
+	 */
+	struct alignas(16) OBJChunkEvent {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the different OBJ chunk event types.
+
+		 This contains:
+		 @c MaterialLibrary,
+		 @c MaterialUse and
+		 @c Group.
+		 */
+		enum class Type : U8 {
+			MaterialLibrary,
+			MaterialUse,
+			Group
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The model part of this OBJ chunk event (@c Type::Group).
+		 */
+		ModelPart m_model_part;
+
+		/**
+		 The name of this OBJ chunk event (@c Type::MaterialLibrary and
+		 @c Type::MaterialUse).
+		 */
+		std::string m_name;
+
+		/**
+		 The number of indices of the OBJ chunk preceding this OBJ chunk event.
+		 */
+		size_t m_start_index;
+
+		/**
+		 The type of this OBJ chunk event.
+		 */
+		Type m_type;
+	};
+
+	/**
+	 A struct of OBJ chunks containing the data read from a line-aligned
+	 range of an OBJ file.
+	 */
+	struct OBJChunk {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the read vertex position coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< Point3 > m_vertex_coordinates;
+
+		/**
+		 A vector containing the read vertex texture coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< UV > m_vertex_texture_coordinates;
+
+		/**
+		 A vector containing the read vertex normal coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< Normal3 > m_vertex_normal_coordinates;
+
+		/**
+		 A vector containing the (file-wide) vertex position/texture/normal
+		 coordinates' indices of the unique vertices of this OBJ chunk in
+		 order of first occurrence.
+		 */
+		std::vector< U32x3 > m_vertices;
+
+		/**
+		 A vector containing the indices of this OBJ chunk into the unique
+		 vertices of this OBJ chunk.
+		 */
+		std::vector< U32 > m_indices;
+
+		/**
+		 A vector containing the events of this OBJ chunk in file order.
+		 */
+		AlignedVector< OBJChunkEvent > m_events;
+	};
+
+	//-------------------------------------------------------------------------
+	// OBJChunkReader
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of OBJ chunk readers for reading a line-aligned range of an OBJ
+	 file.
+	 */
+	class OBJChunkReader : private LineReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an OBJ chunk reader.
+
+		 @param[in]		chunk
+						A reference to an OBJ chunk for storing the read data.
+		 @param[in]		counts
+						A reference to the counts of all the preceding OBJ
+						chunks.
+		 @param[in]		invert_handedness
+						A flag indicating whether the mesh coordinate system
+						handness should be inverted.
+		 @param[in]		clockwise_order
+						A flag indicating whether the face vertices should be
+						defined in clockwise order or not (i.e.
+						counterclockwise order).
+		 */
+		explicit OBJChunkReader(OBJChunk& chunk,
+								const OBJChunkCounts& counts,
+								bool invert_handedness,
+								bool clockwise_order);
+
+		/**
+		 Constructs an OBJ chunk reader from the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to copy.
+		 */
+		OBJChunkReader(const OBJChunkReader& reader) = delete;
+
+		/**
+		 Constructs an OBJ chunk reader by moving the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to move.
+		 */
+		OBJChunkReader(OBJChunkReader&& reader) noexcept;
+
+		/**
+		 Destructs this OBJ chunk reader.
+		 */
+		~OBJChunkReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to copy.
+		 @return		A reference to the copy of the given OBJ chunk reader
+						(i.e. this OBJ chunk reader).
+		 */
+		OBJChunkReader& operator=(const OBJChunkReader& reader) = delete;
+
+		/**
+		 Moves the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to move.
+		 @return		A reference to the moved OBJ chunk reader (i.e. this
+						OBJ chunk reader).
+		 */
+		OBJChunkReader& operator=(OBJChunkReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using LineReader::ReadFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads the current line of this OBJ chunk reader.
+
+		 @throws		Exception
+						Failed to the current line of this OBJ chunk reader.
+		 */
+		virtual void ReadLine() override;
+
+		/**
+		 Reads a Material Library Include definition.
+
+		 @throws		Exception
+						Failed to read a Material Library Include definition.
+		 */
+		void ReadOBJMaterialLibrary();
+
+		/**
+		 Reads a Material Usage definition.
+
+		 @throws		Exception
+						Failed to read a Material Usage definition.
+		 */
+		void ReadOBJMaterialUse();
+
+		/**
+		 Reads a Group definition.
+
+		 @throws		Exception
+						Failed to read a Group definition.
+		 */
+		void ReadOBJGroup();
+
+		/**
+		 Reads a Vertex Position Coordinates definition.
+
+		 @throws		Exception
+						Failed to read a Vertex Position Coordinates
+						definition.
+		 */
+		void ReadOBJVertex();
+
+		/**
+		 Reads a Vertex Texture Coordinates definition.
+
+		 @note			Only UV texture coordinates are supported,
+						The W component of UVW texture coordinates
+						is, if present, silently ignored.
+		 @throws		Exception
+						Failed to read a Vertex Texture Coordinates definition.
+		 */
+		void ReadOBJVertexTexture();
+
+		/**
+		 Reads a Vertex Normal Coordinates definition.
+
+		 @pre			All the vertex normals in the OBJ file are normalized.
+		 @throws		Exception
+						Failed to read a Vertex Normal Coordinates definition.
+		 */
+		void ReadOBJVertexNormal();
+
+		/**
+		 Reads a Face definition.
+
+		 @throws		Exception
+						Failed to read a Face definition.
+		 */
+		void ReadOBJFace();
+
+		/**
+		 Reads a set of vertex indices.
+
+		 @return		The (file-wide) vertex indices represented by the next
+						token of this OBJ chunk reader. A zero indicates the
+						absence of a component.
+		 @throws		Exception
+						Failed to read the vertex indices.
+		 */
+		[[nodiscard]]
+		const U32x3 ReadOBJVertexIndices();
+
+		/**
+		 Converts the given vertex index token component.
+
+		 @param[in]		token
+						The vertex index token component.
+		 @param[in]		component
+						The name of the vertex index token component.
+		 @param[in]		vertex_indices_token
+						The vertex indices token.
+		 @return		The vertex index represented by the given vertex index
+						token component.
+		 @throws		Exception
+						Failed to convert the given vertex index token
+						component.
+		 */
+		[[nodiscard]]
+		S32 ToOBJVertexIndex(std::string_view token,
+							 const_zstring component,
+							 std::string_view vertex_indices_token) const;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the OBJ chunk containing the read data of this OBJ
+		 chunk reader.
+		 */
+		OBJChunk& m_chunk;
+
+		/**
+		 The counts of all the OBJ chunks preceding the OBJ chunk of this OBJ
+		 chunk reader.
+		 */
+		OBJChunkCounts m_counts;
+
+		/**
+		 A mapping between vertex position/texture/normal coordinates' indices
+		 and the index of a unique vertex of the OBJ chunk of this OBJ chunk
+		 reader.
+		 */
+		std::unordered_map< U32x3, U32, OBJVertexIndicesHash > m_mapping;
+
+		/**
+		 A vector containing the indices of the current face of this OBJ chunk
+		 reader.
+		 */
+		std::vector< U32 > m_face;
+
+		/**
+		 A flag indicating whether the mesh coordinate system handness should
+		 be inverted or not for this OBJ chunk reader.
+		 */
+		bool m_invert_handedness;
+
+		/**
+		 A flag indicating whether the face vertices should be defined in
+		 clockwise order or not (i.e. counterclockwise order) for this OBJ
+		 chunk reader.
+		 */
+		bool m_clockwise_order;
+	};
+	/**
+	 Reads the given line-aligned OBJ chunks in parallel on the job system of
+	 the given resource manager.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[in]		inputs
+					A reference to a vector containing the line-aligned OBJ
+					chunks.
+	 @param[in]		path
+					A reference to the path of the OBJ file.
+	 @param[in]		invert_handedness
+					A flag indicating whether the mesh coordinate system
+					handness should be inverted.
+	 @param[in]		clockwise_order
+					A flag indicating whether the face vertices should be
+					defined in clockwise order or not (i.e. counterclockwise
+					order).
+	 @return		A vector containing the read OBJ chunks.
+	 @throws		Exception
+					Failed to read an OBJ chunk.
+	 */
+	[[nodiscard]]
+	const std::vector< OBJChunk >
+		ReadOBJChunks(ResourceManager& resource_manager,
+					  const std::vector< std::string_view >& inputs,
+					  const std::filesystem::path& path,
+					  bool invert_handedness,
+					  bool clockwise_order);
+}
\ No newline at end of file
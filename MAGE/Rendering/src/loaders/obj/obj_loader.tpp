@@ -6,6 +6,7 @@
 #pragma region
 
 #include "loaders\obj\obj_reader.hpp"
+#include "loaders\obj\obj_parallel_reader.hpp"
 
 #pragma endregion
 
@@ -20,7 +21,15 @@ namespace mage::rendering::loader {
 							   ModelOutput< VertexT, IndexT >& model_output, 
 							   const MeshDescriptor< VertexT, IndexT >& mesh_desc) {
 		
-		OBJReader< VertexT, IndexT > reader(resource_manager, model_output, mesh_desc);
-		reader.ReadFromFile(path);
+		if (mesh_desc.ParallelImport()) {
+			OBJParallelReader< VertexT, IndexT > 
+				reader(resource_manager, model_output, mesh_desc);
+			reader.ReadFromFile(path);
+		}
+		else {
+			OBJReader< VertexT, IndexT > 
+				reader(resource_manager, model_output, mesh_desc);
+			reader.ReadFromFile(path);
+		}
 	}
 }
\ No newline at end of file
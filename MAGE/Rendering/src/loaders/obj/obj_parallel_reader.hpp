@@ -0,0 +1,262 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\obj\obj_chunk_reader.hpp"
+#include "resource\mesh\mesh_descriptor.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+	// Forward declaration.
+	class ResourceManager;
+}
+
+namespace mage::rendering::loader {
+
+	/**
+	 A class of parallel OBJ file readers for reading meshes.
+
+	 The OBJ file is split into line-aligned chunks which are read in
+	 parallel. The unique vertices of all chunks are merged and the indices,
+	 model parts and materials are stitched back together in file order. The
+	 resulting model output is identical to the model output of an
+	 @c OBJReader.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	class OBJParallelReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a parallel OBJ reader.
+
+		 @param[in]		resource_manager
+						A reference to the resource manager.
+		 @param[in]		model_output
+						A reference to a model output for storing the read data
+						from file.
+		 @param[in]		mesh_desc
+						A reference to a mesh descriptor.
+		 */
+		explicit OBJParallelReader(ResourceManager& resource_manager,
+								   ModelOutput< VertexT, IndexT >& model_output,
+								   const MeshDescriptor< VertexT, IndexT >& mesh_desc);
+
+		/**
+		 Constructs a parallel OBJ reader from the given parallel OBJ reader.
+
+		 @param[in]		reader
+						A reference to the parallel OBJ reader to copy.
+		 */
+		OBJParallelReader(const OBJParallelReader& reader) = delete;
+
+		/**
+		 Constructs a parallel OBJ reader by moving the given parallel OBJ
+		 reader.
+
+		 @param[in]		reader
+						A reference to the parallel OBJ reader to move.
+		 */
+		OBJParallelReader(OBJParallelReader&& reader) noexcept;
+
+		/**
+		 Destructs this parallel OBJ reader.
+		 */
+		~OBJParallelReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given parallel OBJ reader to this parallel OBJ reader.
+
+		 @param[in]		reader
+						A reference to a parallel OBJ reader to copy.
+		 @return		A reference to the copy of the given parallel OBJ
+						reader (i.e. this parallel OBJ reader).
+		 */
+		OBJParallelReader& operator=(const OBJParallelReader& reader) = delete;
+
+		/**
+		 Moves the given parallel OBJ reader to this parallel OBJ reader.
+
+		 @param[in]		reader
+						A reference to a parallel OBJ reader to move.
+		 @return		A reference to the moved parallel OBJ reader (i.e.
+						this parallel OBJ reader).
+		 */
+		OBJParallelReader& operator=(OBJParallelReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads from the file associated with the given path.
+
+		 @param[in]		path
+						The path.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		void ReadFromFile(std::filesystem::path path);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Splits the given input into line-aligned chunks.
+
+		 @param[in]		input
+						The input.
+		 @return		A vector containing the line-aligned chunks of the
+						given input.
+		 */
+		[[nodiscard]]
+		static const std::vector< std::string_view >
+			SplitIntoChunks(std::string_view input);
+
+		/**
+		 Reads the given line-aligned chunks in parallel.
+
+		 @param[in]		inputs
+						A reference to a vector containing the line-aligned
+						chunks.
+		 @return		A vector containing the read chunks.
+		 @throws		Exception
+						Failed to read a chunk.
+		 */
+		[[nodiscard]]
+		const std::vector< OBJChunk >
+			ReadChunks(const std::vector< std::string_view >& inputs) const;
+
+		/**
+		 Merges the unique vertices of the given chunks into the vertex buffer
+		 of the model output of this parallel OBJ reader.
+
+		 @param[in]		chunks
+						A reference to a vector containing the chunks.
+		 @return		A vector containing, for each chunk, a mapping between
+						the indices of the unique vertices of the chunk and
+						the indices of the vertex buffer.
+		 */
+		[[nodiscard]]
+		const std::vector< std::vector< IndexT > >
+			MergeVertices(const std::vector< OBJChunk >& chunks);
+
+		/**
+		 Appends the indices of the given chunk, up to the given index, to the
+		 index buffer of the model output of this parallel OBJ reader.
+
+		 @param[in]		chunk
+						A reference to the chunk.
+		 @param[in]		mapping
+						A reference to the vertex index mapping of the given
+						chunk.
+		 @param[in]		first
+						The index of the first index of the given chunk to
+						append.
+		 @param[in]		last
+						The index of the past-the-end index of the given chunk
+						to append.
+		 */
+		void AppendIndices(const OBJChunk& chunk,
+						   const std::vector< IndexT >& mapping,
+						   size_t first,
+						   size_t last);
+
+		/**
+		 Applies the given chunk event to the model output of this parallel
+		 OBJ reader.
+
+		 @param[in]		event
+						A reference to the chunk event.
+		 @throws		Exception
+						Failed to import the materials.
+		 */
+		void ApplyEvent(const OBJChunkEvent& event);
+
+		/**
+		 Constructs the vertex matching the given vertex indices.
+
+		 @param[in]		vertex_indices
+						A reference to the vertex indices.
+		 @return		The vertex matching the given vertex indices
+						@a vertex_indices.
+		 */
+		[[nodiscard]]
+		const VertexT ConstructVertex(const U32x3& vertex_indices) const;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The current path of this parallel OBJ reader.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 A vector containing the read vertex position coordinates of this
+		 parallel OBJ reader.
+		 */
+		std::vector< Point3 > m_vertex_coordinates;
+
+		/**
+		 A vector containing the read vertex texture coordinates of this
+		 parallel OBJ reader.
+		 */
+		std::vector< UV > m_vertex_texture_coordinates;
+
+		/**
+		 A vector containing the read normal texture coordinates of this
+		 parallel OBJ reader.
+		 */
+		std::vector< Normal3 > m_vertex_normal_coordinates;
+
+		/**
+		 A reference to the resource manager of this parallel OBJ reader.
+		 */
+		ResourceManager& m_resource_manager;
+
+		/**
+		 A reference to a model output containing the read data of this
+		 parallel OBJ reader.
+		 */
+		ModelOutput< VertexT, IndexT >& m_model_output;
+
+		/**
+		 A reference to the mesh descriptor for this parallel OBJ reader.
+		 */
+		const MeshDescriptor< VertexT, IndexT >& m_mesh_desc;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\obj\obj_parallel_reader.tpp"
+
+#pragma endregion
\ No newline at end of file
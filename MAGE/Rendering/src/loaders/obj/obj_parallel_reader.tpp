@@ -0,0 +1,268 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\material_loader.hpp"
+#include "io\mapped_file.hpp"
+#include "parallel\parallel.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename VertexT, typename IndexT >
+	OBJParallelReader< VertexT, IndexT >
+		::OBJParallelReader(ResourceManager& resource_manager,
+							ModelOutput< VertexT, IndexT >& model_output,
+							const MeshDescriptor< VertexT, IndexT >& mesh_desc)
+		: m_path(),
+		m_vertex_coordinates(),
+		m_vertex_texture_coordinates(),
+		m_vertex_normal_coordinates(),
+		m_resource_manager(resource_manager),
+		m_model_output(model_output),
+		m_mesh_desc(mesh_desc) {}
+
+	template< typename VertexT, typename IndexT >
+	OBJParallelReader< VertexT, IndexT >
+		::OBJParallelReader(OBJParallelReader&& reader) noexcept = default;
+
+	template< typename VertexT, typename IndexT >
+	OBJParallelReader< VertexT, IndexT >::~OBJParallelReader() = default;
+
+	template< typename VertexT, typename IndexT >
+	void OBJParallelReader< VertexT, IndexT >
+		::ReadFromFile(std::filesystem::path path) {
+
+		m_path = std::move(path);
+
+		using std::empty;
+		ThrowIfFailed(empty(m_model_output.m_vertex_buffer),
+					  "%ls: vertex buffer must be empty.",
+					  m_path.c_str());
+		ThrowIfFailed(empty(m_model_output.m_index_buffer),
+					  "%ls: index buffer must be empty.",
+					  m_path.c_str());
+
+		const MappedFile file(m_path);
+		const auto data = file.GetData();
+		const std::string_view input(reinterpret_cast< const char* >(data.data()),
+									 file.GetSize());
+
+		// Read all chunks in parallel.
+		const auto chunks = ReadChunks(SplitIntoChunks(input));
+
+		for (const auto& chunk : chunks) {
+			m_vertex_coordinates.insert(m_vertex_coordinates.cend(),
+				chunk.m_vertex_coordinates.cbegin(),
+				chunk.m_vertex_coordinates.cend());
+			m_vertex_texture_coordinates.insert(m_vertex_texture_coordinates.cend(),
+				chunk.m_vertex_texture_coordinates.cbegin(),
+				chunk.m_vertex_texture_coordinates.cend());
+			m_vertex_normal_coordinates.insert(m_vertex_normal_coordinates.cend(),
+				chunk.m_vertex_normal_coordinates.cbegin(),
+				chunk.m_vertex_normal_coordinates.cend());
+		}
+
+		// Begin current group.
+		m_model_output.StartModelPart(ModelPart());
+
+		const auto mappings = MergeVertices(chunks);
+
+		// Stitch the indices, groups and materials back in file order.
+		for (size_t i = 0u; i < chunks.size(); ++i) {
+			const auto& chunk = chunks[i];
+
+			size_t first = 0u;
+			for (const auto& event : chunk.m_events) {
+				AppendIndices(chunk, mappings[i], first, event.m_start_index);
+				first = event.m_start_index;
+
+				ApplyEvent(event);
+			}
+
+			AppendIndices(chunk, mappings[i], first, chunk.m_indices.size());
+		}
+
+		// End current group.
+		m_model_output.EndModelPart();
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	const std::vector< std::string_view > OBJParallelReader< VertexT, IndexT >
+		::SplitIntoChunks(std::string_view input) {
+
+		// Small files are not worth the synchronization.
+		constexpr size_t min_chunk_size = 1u << 20u;
+
+		const size_t nb_cores  = std::max(NumberOfSystemCores(), U16(1u));
+		const size_t nb_chunks = std::clamp(input.size() / min_chunk_size,
+											size_t(1u), nb_cores);
+
+		std::vector< std::string_view > chunks;
+		chunks.reserve(nb_chunks);
+
+		size_t first = 0u;
+		for (size_t i = 1u; i <= nb_chunks; ++i) {
+			auto last = std::max(first, (i * input.size()) / nb_chunks);
+			if (input.size() != last) {
+				// Move the end of this chunk to the end of the current line.
+				const auto newline = input.find('\n', last);
+				last = (std::string_view::npos == newline) ? input.size()
+					                                       : newline + 1u;
+			}
+
+			if (first != last) {
+				chunks.push_back(input.substr(first, last - first));
+			}
+
+			first = last;
+		}
+
+		return chunks;
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	const std::vector< OBJChunk > OBJParallelReader< VertexT, IndexT >
+		::ReadChunks(const std::vector< std::string_view >& inputs) const {
+
+		return ReadOBJChunks(m_resource_manager, inputs, m_path,
+							 m_mesh_desc.InvertHandness(),
+							 m_mesh_desc.ClockwiseOrder());
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	const std::vector< std::vector< IndexT > > OBJParallelReader< VertexT, IndexT >
+		::MergeVertices(const std::vector< OBJChunk >& chunks) {
+
+		size_t nb_vertices = 0u;
+		for (const auto& chunk : chunks) {
+			nb_vertices += chunk.m_vertices.size();
+		}
+
+		std::unordered_map< U32x3, IndexT, OBJVertexIndicesHash > mapping;
+		mapping.reserve(nb_vertices);
+
+		auto& vertex_buffer = m_model_output.m_vertex_buffer;
+		vertex_buffer.reserve(nb_vertices);
+
+		// The chunks are merged in file order and the unique vertices of each
+		// chunk are in order of first occurrence. Hence, the vertex buffer
+		// matches the vertex buffer of a serial read.
+		std::vector< std::vector< IndexT > > mappings;
+		mappings.reserve(chunks.size());
+		for (const auto& chunk : chunks) {
+			auto& chunk_mapping = mappings.emplace_back();
+			chunk_mapping.reserve(chunk.m_vertices.size());
+
+			for (const auto& vertex_indices : chunk.m_vertices) {
+				const auto index = static_cast< IndexT >(vertex_buffer.size());
+				if (const auto [it, inserted]
+					= mapping.try_emplace(vertex_indices, index);
+					inserted) {
+
+					vertex_buffer.push_back(ConstructVertex(vertex_indices));
+					chunk_mapping.push_back(index);
+				}
+				else {
+					chunk_mapping.push_back(it->second);
+				}
+			}
+		}
+
+		return mappings;
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJParallelReader< VertexT, IndexT >
+		::AppendIndices(const OBJChunk& chunk,
+						const std::vector< IndexT >& mapping,
+						size_t first,
+						size_t last) {
+
+		auto& index_buffer = m_model_output.m_index_buffer;
+		index_buffer.reserve(index_buffer.size() + (last - first));
+		for (auto i = first; i < last; ++i) {
+			index_buffer.push_back(mapping[chunk.m_indices[i]]);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJParallelReader< VertexT, IndexT >
+		::ApplyEvent(const OBJChunkEvent& event) {
+
+		switch (event.m_type) {
+
+		case OBJChunkEvent::Type::MaterialLibrary: {
+			const auto mtl_name = StringToWString(event.m_name);
+			auto mtl_path       = m_path;
+			mtl_path.replace_filename(mtl_name);
+
+			ImportMaterialFromFile(mtl_path,
+								   m_resource_manager,
+								   m_model_output.m_material_buffer);
+			break;
+		}
+
+		case OBJChunkEvent::Type::MaterialUse: {
+			m_model_output.SetMaterial(event.m_name);
+			break;
+		}
+
+		case OBJChunkEvent::Type::Group: {
+			// End current group.
+			m_model_output.EndModelPart();
+			// Begin current group.
+			m_model_output.StartModelPart(event.m_model_part);
+			break;
+		}
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	const VertexT OBJParallelReader< VertexT, IndexT >
+		::ConstructVertex(const U32x3& vertex_indices) const {
+
+		VertexT vertex;
+
+		if constexpr(VertexT::HasPosition()) {
+			if (vertex_indices[0]) {
+				vertex.m_p = m_vertex_coordinates[vertex_indices[0] - 1];
+			}
+		}
+
+		if constexpr(VertexT::HasTexture()) {
+			if (vertex_indices[1]) {
+				vertex.m_tex = m_vertex_texture_coordinates[vertex_indices[1] - 1];
+			}
+		}
+
+		if constexpr(VertexT::HasNormal()) {
+			if (vertex_indices[2]) {
+				vertex.m_n = m_vertex_normal_coordinates[vertex_indices[2] - 1];
+			}
+		}
+
+		return vertex;
+	}
+}
\ No newline at end of file
@@ -120,4 +120,25 @@ namespace mage::rendering::loader {
 			ThrowIfFailed(result, "Texture exporting failed: %08X.", result);
 		}
 	}
+
+	void ExportImageToFile(const std::filesystem::path& path, 
+						   DXGI_FORMAT format, 
+						   U32 width, 
+						   U32 height, 
+						   U32 row_pitch, 
+						   NotNull< const U8* > data) {
+
+		std::wstring extension(path.extension());
+		TransformToLowerCase(extension);
+
+		const auto container_format = GetGUIDContainerFormat(extension);
+		ThrowIfFailed((GUID_NULL != container_format), 
+					  "Unknown image file extension: %ls", 
+					  path.c_str());
+
+		const HRESULT result = DirectX::SaveWICPixelsToFile(
+			format, width, height, row_pitch, data, container_format, 
+			path.c_str());
+		ThrowIfFailed(result, "Image exporting failed: %08X.", result);
+	}
 }
\ No newline at end of file
@@ -55,4 +55,33 @@ namespace mage::rendering::loader {
 	void ExportTextureToFile(const std::filesystem::path& path, 
 		                     ID3D11DeviceContext& device_context, 
 		                     ID3D11Resource& texture);
+
+	/**
+	 Exports the given image to the file associated with the given path.
+
+	 Unlike {@link mage::rendering::loader::ExportTextureToFile}, this 
+	 function does not use the device context and can be called from any 
+	 thread which initialized the COM library.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		format
+					The pixel format of the image.
+	 @param[in]		width
+					The width in pixels of the image.
+	 @param[in]		height
+					The height in pixels of the image.
+	 @param[in]		row_pitch
+					The size in bytes of a row of the image.
+	 @param[in]		data
+					A pointer to the pixels of the image.
+	 @throws		Exception
+					Failed to export the image to file.
+	 */
+	void ExportImageToFile(const std::filesystem::path& path, 
+						   DXGI_FORMAT format, 
+						   U32 width, 
+						   U32 height, 
+						   U32 row_pitch, 
+						   NotNull< const U8* > data);
 }
\ No newline at end of file
@@ -946,9 +946,45 @@ HRESULT DirectX::SaveWICTextureToFile(
     if ( FAILED(hr) )
         return hr;
 
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    hr = pContext->Map( pStaging.Get(), 0, D3D11_MAP_READ, 0, &mapped );
+    if ( FAILED(hr) )
+        return hr;
+
+    hr = SaveWICPixelsToFile( desc.Format, desc.Width, desc.Height, mapped.RowPitch, mapped.pData,
+                              guidContainerFormat, fileName, targetFormat, setCustomProps );
+
+    pContext->Unmap( pStaging.Get(), 0 );
+
+    return hr;
+}
+
+
+//--------------------------------------------------------------------------------------
+_Use_decl_annotations_
+HRESULT DirectX::SaveWICPixelsToFile(
+    DXGI_FORMAT format,
+    UINT width,
+    UINT height,
+    UINT rowPitch,
+    const void* pixels,
+    REFGUID guidContainerFormat,
+    const wchar_t* fileName,
+    const GUID* targetFormat,
+    std::function<void(IPropertyBag2*)> setCustomProps )
+{
+    if ( !pixels || !fileName )
+        return E_INVALIDARG;
+
+    D3D11_TEXTURE2D_DESC desc = {};
+    desc.Format = format;
+    desc.Width  = width;
+    desc.Height = height;
+
     // Determine source format's WIC equivalent
     WICPixelFormatGUID pfGuid;
     bool sRGB = false;
+    HRESULT hr = S_OK;
     switch ( desc.Format )
     {
     case DXGI_FORMAT_R32G32B32A32_FLOAT:            pfGuid = GUID_WICPixelFormat128bppRGBAFloat; break;
@@ -1155,31 +1191,22 @@ HRESULT DirectX::SaveWICTextureToFile(
         }
     }
 
-    D3D11_MAPPED_SUBRESOURCE mapped;
-    hr = pContext->Map( pStaging.Get(), 0, D3D11_MAP_READ, 0, &mapped );
-    if ( FAILED(hr) )
-        return hr;
+    BYTE* pData = static_cast<BYTE*>( const_cast<void*>( pixels ) );
 
     if ( memcmp( &targetGuid, &pfGuid, sizeof(WICPixelFormatGUID) ) != 0 )
     {
         // Conversion required to write
         ComPtr<IWICBitmap> source;
         hr = pWIC->CreateBitmapFromMemory( desc.Width, desc.Height, pfGuid,
-                                           mapped.RowPitch, mapped.RowPitch * desc.Height,
-                                           static_cast<BYTE*>( mapped.pData ), source.GetAddressOf() );
+                                           rowPitch, rowPitch * desc.Height,
+                                           pData, source.GetAddressOf() );
         if ( FAILED(hr) )
-        {
-            pContext->Unmap( pStaging.Get(), 0 );
             return hr;
-        }
 
         ComPtr<IWICFormatConverter> FC;
         hr = pWIC->CreateFormatConverter( FC.GetAddressOf() );
         if ( FAILED(hr) )
-        {
-            pContext->Unmap( pStaging.Get(), 0 );
             return hr;
-        }
 
         BOOL canConvert = FALSE;
         hr = FC->CanConvert( pfGuid, targetGuid, &canConvert );
@@ -1190,29 +1217,21 @@ HRESULT DirectX::SaveWICTextureToFile(
 
         hr = FC->Initialize( source.Get(), targetGuid, WICBitmapDitherTypeNone, nullptr, 0, WICBitmapPaletteTypeMedianCut );
         if ( FAILED(hr) )
-        {
-            pContext->Unmap( pStaging.Get(), 0 );
             return hr;
-        }
 
         WICRect rect = { 0, 0, static_cast<INT>( desc.Width ), static_cast<INT>( desc.Height ) };
         hr = frame->WriteSource( FC.Get(), &rect );
         if ( FAILED(hr) )
-        {
-            pContext->Unmap( pStaging.Get(), 0 );
             return hr;
-        }
     }
     else
     {
         // No conversion required
-        hr = frame->WritePixels( desc.Height, mapped.RowPitch, mapped.RowPitch * desc.Height, static_cast<BYTE*>( mapped.pData ) );
+        hr = frame->WritePixels( desc.Height, rowPitch, rowPitch * desc.Height, pData );
         if ( FAILED(hr) )
             return hr;
     }
 
-    pContext->Unmap( pStaging.Get(), 0 );
-
     hr = frame->Commit();
     if ( FAILED(hr) )
         return hr;
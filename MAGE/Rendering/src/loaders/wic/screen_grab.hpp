@@ -36,4 +36,14 @@ namespace DirectX
                                   _In_z_ const wchar_t* fileName,
                                   _In_opt_ const GUID* targetFormat = nullptr,
                                   _In_opt_ std::function<void(IPropertyBag2*)> setCustomProps = nullptr );
+
+    HRESULT SaveWICPixelsToFile( _In_ DXGI_FORMAT format,
+                                 _In_ UINT width,
+                                 _In_ UINT height,
+                                 _In_ UINT rowPitch,
+                                 _In_reads_bytes_(rowPitch * height) const void* pixels,
+                                 _In_ REFGUID guidContainerFormat,
+                                 _In_z_ const wchar_t* fileName,
+                                 _In_opt_ const GUID* targetFormat = nullptr,
+                                 _In_opt_ std::function<void(IPropertyBag2*)> setCustomProps = nullptr );
 }
\ No newline at end of file
@@ -38,6 +38,7 @@ namespace mage::rendering {
 						D3D11_MAP_WRITE_DISCARD, mapped_buffer);
 
 		memcpy(mapped_buffer.pData, &data, sizeof(T));
+		Pipeline::s_nb_mapped_bytes += static_cast< U32 >(sizeof(T));
 	}
 
 	template< typename T >
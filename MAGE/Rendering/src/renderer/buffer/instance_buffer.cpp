@@ -0,0 +1,176 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\instance_buffer.hpp"
+#include "exception\exception.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+		constexpr const_zstring g_vertex_semantic_name_instance = "INSTANCE";
+		constexpr const_zstring g_vertex_semantic_name_normal   = "NORMAL";
+		constexpr const_zstring g_vertex_semantic_name_position = "POSITION";
+		constexpr const_zstring g_vertex_semantic_name_texture  = "TEXCOORD";
+
+		/**
+		 Checks whether the given models can be drawn as instances of the
+		 same draw call.
+
+		 @param[in]		lhs
+						A reference to the first model.
+		 @param[in]		lhs_lod
+						The level of detail of the first model.
+		 @param[in]		rhs
+						A reference to the second model.
+		 @param[in]		rhs_lod
+						The level of detail of the second model.
+		 @return		@c true if the given models share the same mesh,
+						submesh and material. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsInstanceOf(const Model& lhs, size_t lhs_lod, 
+						  const Model& rhs, size_t rhs_lod) noexcept {
+			if (lhs.GetMesh() != rhs.GetMesh()
+				|| lhs.GetStartIndex(lhs_lod) != rhs.GetStartIndex(rhs_lod)
+				|| lhs.GetNumberOfIndices(lhs_lod) 
+				!= rhs.GetNumberOfIndices(rhs_lod)) {
+				return false;
+			}
+
+			const auto& lhs_material = lhs.GetMaterial();
+			const auto& rhs_material = rhs.GetMaterial();
+			if (lhs_material.GetBaseColorSRV()   != rhs_material.GetBaseColorSRV()
+				|| lhs_material.GetMaterialSRV() != rhs_material.GetMaterialSRV()
+				|| lhs_material.GetNormalSRV()   != rhs_material.GetNormalSRV()
+				|| lhs_material.IsEmissive()     != rhs_material.IsEmissive()) {
+				return false;
+			}
+
+			// The material coefficients are read from the constant buffer of
+			// the first model of an instance batch.
+			const auto& lhs_buffer = lhs.GetBufferData();
+			const auto& rhs_buffer = rhs.GetBufferData();
+			return lhs_buffer.m_base_color == rhs_buffer.m_base_color
+				&& lhs_buffer.m_roughness  == rhs_buffer.m_roughness
+				&& lhs_buffer.m_metalness  == rhs_buffer.m_metalness;
+		}
+	}
+
+	const D3D11_INPUT_ELEMENT_DESC InstanceBuffer::s_input_element_descs[] = {
+		{ g_vertex_semantic_name_position, 0u, DXGI_FORMAT_R32G32B32_FLOAT,    0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,   0u },
+		{ g_vertex_semantic_name_normal,   0u, DXGI_FORMAT_R32G32B32_FLOAT,    0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,   0u },
+		{ g_vertex_semantic_name_texture,  0u, DXGI_FORMAT_R32G32_FLOAT,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,   0u },
+		{ g_vertex_semantic_name_instance, 0u, DXGI_FORMAT_R32_UINT,           1u, 0u,                           D3D11_INPUT_PER_INSTANCE_DATA, 1u }
+	};
+
+	const D3D11_INPUT_ELEMENT_DESC InstanceBuffer::s_quantized_input_element_descs[] = {
+		{ g_vertex_semantic_name_position, 0u, DXGI_FORMAT_R16G16B16A16_UNORM, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,   0u },
+		{ g_vertex_semantic_name_normal,   0u, DXGI_FORMAT_R16G16_SNORM,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,   0u },
+		{ g_vertex_semantic_name_texture,  0u, DXGI_FORMAT_R16G16_FLOAT,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,   0u },
+		{ g_vertex_semantic_name_instance, 0u, DXGI_FORMAT_R32_UINT,           1u, 0u,                           D3D11_INPUT_PER_INSTANCE_DATA, 1u }
+	};
+
+	InstanceBuffer::InstanceBuffer(ID3D11Device& device, size_t capacity)
+		: m_buffer(device, capacity),
+		m_index_buffer(),
+		m_index_capacity(0u),
+		m_data(),
+		m_batches(),
+		m_batch_offsets() {
+
+		SetupIndexBuffer(device, capacity);
+	}
+
+	InstanceBuffer::InstanceBuffer(InstanceBuffer&& buffer) noexcept = default;
+
+	InstanceBuffer::~InstanceBuffer() = default;
+
+	InstanceBuffer& InstanceBuffer::operator=(InstanceBuffer&& buffer) noexcept = default;
+
+	void InstanceBuffer::SetupIndexBuffer(ID3D11Device& device, size_t capacity) {
+		std::vector< U32 > indices(capacity);
+		std::iota(indices.begin(), indices.end(), 0u);
+
+		const HRESULT result = CreateStaticVertexBuffer< U32 >(
+			device, NotNull< ID3D11Buffer** >(m_index_buffer.ReleaseAndGetAddressOf()),
+			gsl::make_span(indices));
+		ThrowIfFailed(result, "Instance index buffer creation failed: %08X.", result);
+
+		m_index_capacity = capacity;
+	}
+
+	const std::vector< InstanceBatch >& InstanceBuffer
+		::UpdateData(ID3D11DeviceContext& device_context,
+					 const std::vector< ModelDraw >& draws) {
+
+		UpdateData(device_context, { std::cref(draws) });
+		return m_batches;
+	}
+
+	void InstanceBuffer
+		::UpdateData(ID3D11DeviceContext& device_context,
+					 std::initializer_list< std::reference_wrapper< 
+						 const std::vector< ModelDraw > > > lists) {
+
+		m_data.clear();
+		m_batches.clear();
+		m_batch_offsets.clear();
+
+		for (const auto& draws : lists) {
+			m_batch_offsets.push_back(static_cast< U32 >(m_batches.size()));
+			// Instance batches never span two lists.
+			const auto first_batch = m_batches.size();
+
+			for (const auto& [model, lod] : draws.get()) {
+				const auto instance = static_cast< U32 >(m_data.size());
+				m_data.push_back(model->GetBufferData());
+
+				if (first_batch < m_batches.size()
+					&& IsInstanceOf(*m_batches.back().m_model, m_batches.back().m_lod,
+									*model, lod)) {
+					++m_batches.back().m_nb_instances;
+				}
+				else {
+					m_batches.push_back({ model, lod, instance, 1u });
+				}
+			}
+		}
+		m_batch_offsets.push_back(static_cast< U32 >(m_batches.size()));
+
+		if (m_index_capacity < m_data.size()) {
+			ComPtr< ID3D11Device > device;
+			device_context.GetDevice(device.ReleaseAndGetAddressOf());
+			// Grow geometrically to avoid recreating the immutable buffer.
+			SetupIndexBuffer(*device.Get(),
+							 std::max(m_data.size(), 2u * m_index_capacity));
+		}
+
+		m_buffer.UpdateData(device_context, m_data);
+	}
+
+	void InstanceBuffer::Bind(ID3D11DeviceContext& device_context) const noexcept {
+		m_buffer.Bind< Pipeline::VS >(device_context, SLOT_SRV_INSTANCES);
+		Pipeline::IA::BindVertexBuffer(device_context, 1u, *m_index_buffer.Get(),
+									   static_cast< U32 >(sizeof(U32)));
+	}
+}
\ No newline at end of file
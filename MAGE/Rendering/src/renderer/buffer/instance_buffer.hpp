@@ -0,0 +1,285 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\structured_buffer.hpp"
+#include "renderer\draw_key.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of instance batches.
+
+	 An instance batch is a range of consecutive instances sharing the same
+	 mesh, submesh, level of detail and material, which can be drawn with a 
+	 single draw call.
+	 */
+	struct InstanceBatch {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the first model of this instance batch.
+		 */
+		const Model* m_model;
+
+		/**
+		 The level of detail of the models of this instance batch.
+		 */
+		U32 m_lod;
+
+		/**
+		 The index of the first instance of this instance batch.
+		 */
+		U32 m_start_instance;
+
+		/**
+		 The number of instances of this instance batch.
+		 */
+		U32 m_nb_instances;
+	};
+
+	/**
+	 A class of instance buffers.
+
+	 An instance buffer groups consecutive models sharing the same mesh,
+	 submesh, level of detail and material into instance batches, and uploads the model
+	 buffers of all these models with a single map into a structured buffer.
+	 The instanced vertex shaders obtain the index of their model buffer from
+	 a second, per-instance vertex buffer stream, which takes the start
+	 instance of each draw call into account.
+	 */
+	class InstanceBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The input element descriptors of the instanced
+		 @c VertexPositionNormalTexture vertices.
+		 */
+		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[4];
+
+		/**
+		 The input element descriptors of the instanced
+		 @c QuantizedVertexPositionNormalTexture vertices.
+		 */
+		static const D3D11_INPUT_ELEMENT_DESC s_quantized_input_element_descs[4];
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an instance buffer.
+
+		 @param[in]		device
+						A reference to the device.
+		 @param[in]		capacity
+						The initial capacity.
+		 @throws		Exception
+						Failed to setup this instance buffer.
+		 */
+		explicit InstanceBuffer(ID3D11Device& device, size_t capacity = 64u);
+
+		/**
+		 Constructs an instance buffer from the given instance buffer.
+
+		 @param[in]		buffer
+						A reference to the instance buffer to copy.
+		 */
+		InstanceBuffer(const InstanceBuffer& buffer) = delete;
+
+		/**
+		 Constructs an instance buffer by moving the given instance buffer.
+
+		 @param[in]		buffer
+						A reference to the instance buffer to move.
+		 */
+		InstanceBuffer(InstanceBuffer&& buffer) noexcept;
+
+		/**
+		 Destructs this instance buffer.
+		 */
+		~InstanceBuffer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given instance buffer to this instance buffer.
+
+		 @param[in]		buffer
+						A reference to the instance buffer to copy.
+		 @return		A reference to the copy of the given instance buffer
+						(i.e. this instance buffer).
+		 */
+		InstanceBuffer& operator=(const InstanceBuffer& buffer) = delete;
+
+		/**
+		 Moves the given instance buffer to this instance buffer.
+
+		 @param[in]		buffer
+						A reference to the instance buffer to move.
+		 @return		A reference to the moved instance buffer (i.e. this
+						instance buffer).
+		 */
+		InstanceBuffer& operator=(InstanceBuffer&& buffer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the data of this instance buffer with the given model draws.
+
+		 @pre			The buffers of the given models are up to date.
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		draws
+						A reference to a vector containing the model draws.
+		 @return		A reference to a vector containing the instance
+						batches of the given model draws in the order of the 
+						given model draws.
+		 @throws		Exception
+						Failed to update the data.
+		 */
+		const std::vector< InstanceBatch >& UpdateData(
+			ID3D11DeviceContext& device_context,
+			const std::vector< ModelDraw >& draws);
+
+		/**
+		 Updates the data of this instance buffer with the given lists of 
+		 model draws.
+
+		 The model buffers of all lists are uploaded with a single map. The 
+		 instance batches of each list start at the instance offset of that 
+		 list and are never merged with the instance batches of another 
+		 list.
+
+		 @pre			The buffers of the given models are up to date.
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		lists
+						The lists of model draws.
+		 @throws		Exception
+						Failed to update the data.
+		 */
+		void UpdateData(
+			ID3D11DeviceContext& device_context,
+			std::initializer_list< std::reference_wrapper< 
+				const std::vector< ModelDraw > > > lists);
+
+		/**
+		 Returns the instance batches of the given list of model draws of the 
+		 last update of this instance buffer.
+
+		 @pre			@a index is smaller than the number of lists of the 
+						last update of this instance buffer.
+		 @param[in]		index
+						The index of the list of model draws.
+		 @return		The instance batches of the given list of model draws 
+						in the order of its model draws.
+		 */
+		[[nodiscard]]
+		gsl::span< const InstanceBatch > GetBatches(size_t index) const noexcept {
+			const auto begin = m_batch_offsets[index];
+			const auto end   = m_batch_offsets[index + 1u];
+			return { m_batches.data() + begin,
+				     static_cast< std::ptrdiff_t >(end - begin) };
+		}
+
+		/**
+		 Binds this instance buffer.
+
+		 The model buffers are bound to the vertex shader stage and the
+		 instance indices are bound to the second vertex buffer slot of the
+		 input-assembler stage.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 */
+		void Bind(ID3D11DeviceContext& device_context) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets up the instance index buffer of this instance buffer.
+
+		 @param[in]		device
+						A reference to the device.
+		 @param[in]		capacity
+						The capacity.
+		 @throws		Exception
+						Failed to setup the instance index buffer of this
+						instance buffer.
+		 */
+		void SetupIndexBuffer(ID3D11Device& device, size_t capacity);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The model buffers of this instance buffer.
+		 */
+		StructuredBuffer< ModelBuffer > m_buffer;
+
+		/**
+		 A pointer to the instance index buffer of this instance buffer.
+		 */
+		ComPtr< ID3D11Buffer > m_index_buffer;
+
+		/**
+		 The capacity of the instance index buffer of this instance buffer.
+		 */
+		size_t m_index_capacity;
+
+		/**
+		 A vector containing the model buffers of this instance buffer.
+		 */
+		AlignedVector< ModelBuffer > m_data;
+
+		/**
+		 A vector containing the instance batches of this instance buffer.
+		 */
+		std::vector< InstanceBatch > m_batches;
+
+		/**
+		 A vector containing the offsets of the instance batches of the lists 
+		 of model draws of this instance buffer.
+		 */
+		std::vector< U32 > m_batch_offsets;
+	};
+}
\ No newline at end of file
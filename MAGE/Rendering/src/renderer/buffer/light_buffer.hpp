@@ -44,7 +44,10 @@ namespace mage::rendering {
 			m_nb_sm_spot_lights(0u), 
 			m_padding1(0u), 
 			m_La(),
-			m_padding2(0.0f) {}
+			m_padding2(0.0f), 
+			m_light_cluster_z_scale(0.0f), 
+			m_light_cluster_z_bias(0.0f), 
+			m_padding3{} {}
 		
 		/**
 		 Constructs a light buffer from the given light buffer.
@@ -153,9 +156,30 @@ namespace mage::rendering {
 		 The padding of this light buffer.
 		 */
 		F32 m_padding2;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Light Clusters
+		//---------------------------------------------------------------------
+
+		/**
+		 The scale of the (base-2) logarithm of the camera-space z coordinate 
+		 to obtain the light cluster slice of this light buffer.
+		 */
+		F32 m_light_cluster_z_scale;
+
+		/**
+		 The bias of the (base-2) logarithm of the camera-space z coordinate 
+		 to obtain the light cluster slice of this light buffer.
+		 */
+		F32 m_light_cluster_z_bias;
+
+		/**
+		 The padding of this light buffer.
+		 */
+		U32 m_padding3[2];
 	};
 
-	static_assert(48 == sizeof(LightBuffer), 
+	static_assert(64 == sizeof(LightBuffer), 
 				  "CPU/GPU struct mismatch");
 
 	#pragma endregion
@@ -788,4 +812,115 @@ namespace mage::rendering {
 				  "CPU/GPU struct mismatch");
 
 	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// LightClusterBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of light cluster buffers used by shaders.
+
+	 Each member contains the offset into the light index list and the number 
+	 of lights of the corresponding light type overlapping the light cluster.
+	 */
+	struct LightClusterBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a light cluster buffer.
+		 */
+		LightClusterBuffer() noexcept
+			: m_omni_lights{}, 
+			m_spot_lights{}, 
+			m_sm_omni_lights{}, 
+			m_sm_spot_lights{} {}
+
+		/**
+		 Constructs a light cluster buffer from the given light cluster 
+		 buffer.
+
+		 @param[in]		buffer
+						A reference to the light cluster buffer to copy.
+		 */
+		LightClusterBuffer(const LightClusterBuffer& buffer) noexcept = default;
+
+		/**
+		 Constructs a light cluster buffer by moving the given light cluster 
+		 buffer.
+
+		 @param[in]		buffer
+						A reference to the light cluster buffer to move.
+		 */
+		LightClusterBuffer(LightClusterBuffer&& buffer) noexcept = default;
+
+		/**
+		 Destructs this light cluster buffer.
+		 */
+		~LightClusterBuffer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given light cluster buffer to this light cluster buffer.
+
+		 @param[in]		buffer
+						A reference to the light cluster buffer to copy.
+		 @return		A reference to the copy of the given light cluster 
+						buffer (i.e. this light cluster buffer).
+		 */
+		LightClusterBuffer& operator=(
+			const LightClusterBuffer& buffer) noexcept = default;
+
+		/**
+		 Moves the given light cluster buffer to this light cluster buffer.
+
+		 @param[in]		buffer
+						A reference to the light cluster buffer to move.
+		 @return		A reference to the moved light cluster buffer (i.e. 
+						this light cluster buffer).
+		 */
+		LightClusterBuffer& operator=(
+			LightClusterBuffer&& buffer) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The offset and number of the omni lights of this light cluster 
+		 buffer.
+		 */
+		U32x2 m_omni_lights;
+
+		/**
+		 The offset and number of the spotlights of this light cluster 
+		 buffer.
+		 */
+		U32x2 m_spot_lights;
+
+		/**
+		 The offset and number of the shadow mapped omni lights of this light 
+		 cluster buffer.
+		 */
+		U32x2 m_sm_omni_lights;
+
+		/**
+		 The offset and number of the shadow mapped spotlights of this light 
+		 cluster buffer.
+		 */
+		U32x2 m_sm_spot_lights;
+	};
+
+	static_assert(32 == sizeof(LightClusterBuffer), 
+				  "CPU/GPU struct mismatch");
+
+	#pragma endregion
 }
\ No newline at end of file
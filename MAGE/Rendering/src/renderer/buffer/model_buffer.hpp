@@ -35,7 +35,11 @@ namespace mage::rendering {
 			m_base_color{}, 
 			m_roughness(0.0f),
 			m_metalness(0.0f),
-			m_padding{} {}
+			m_padding0{},
+			m_position_offset(0.0f, 0.0f, 0.0f),
+			m_padding1(0u),
+			m_position_scale(1.0f, 1.0f, 1.0f),
+			m_padding2(0u) {}
 
 		/**
 		 Constructs a model buffer from the given model buffer.
@@ -130,8 +134,34 @@ namespace mage::rendering {
 		/**
 		 The padding of this world buffer.
 		 */
-		U32 m_padding[2];
+		U32 m_padding0[2];
+
+		//---------------------------------------------------------------------
+		// Member Variables: Dequantization
+		//---------------------------------------------------------------------
+
+		/**
+		 The dequantization offset of the quantized vertex positions of this 
+		 model buffer.
+		 */
+		F32x3 m_position_offset;
+
+		/**
+		 The padding of this world buffer.
+		 */
+		U32 m_padding1;
+
+		/**
+		 The dequantization scale of the quantized vertex positions of this 
+		 model buffer.
+		 */
+		F32x3 m_position_scale;
+
+		/**
+		 The padding of this world buffer.
+		 */
+		U32 m_padding2;
 	};
 
-	static_assert(224 == sizeof(ModelBuffer), "CPU/GPU struct mismatch");
+	static_assert(256 == sizeof(ModelBuffer), "CPU/GPU struct mismatch");
 }
\ No newline at end of file
@@ -94,6 +94,11 @@ namespace mage::rendering {
 				Pipeline::OM::ClearDepthOfDSV(device_context, dsv.Get());
 			}
 		}
+		void ClearDSV(ID3D11DeviceContext& device_context, 
+			          size_t dsv_index) const noexcept {
+
+			Pipeline::OM::ClearDepthOfDSV(device_context, m_dsvs[dsv_index].Get());
+		}
 		void BindDSV(ID3D11DeviceContext& device_context, 
 			         size_t dsv_index) const noexcept {
 
@@ -193,6 +198,11 @@ namespace mage::rendering {
 				Pipeline::OM::ClearDepthOfDSV(device_context, dsv.Get());
 			}
 		}
+		void ClearDSV(ID3D11DeviceContext& device_context, 
+			          size_t dsv_index) const noexcept {
+
+			Pipeline::OM::ClearDepthOfDSV(device_context, m_dsvs[dsv_index].Get());
+		}
 		void BindDSV(ID3D11DeviceContext& device_context, 
 			         size_t dsv_index) const noexcept {
 
@@ -110,6 +110,8 @@ namespace mage::rendering {
 		/**
 		 Updates the data of this structured buffer with the given data.
 
+		 @tparam		AllocatorT
+						The allocator type of the vector.
 		 @param[in]		device_context
 						A reference to the device context.
 		 @param[in]		data
@@ -117,8 +119,9 @@ namespace mage::rendering {
 	     @throws		Exception
 						Failed to update the data.
 		 */
+		template< typename AllocatorT >
 		void UpdateData(ID3D11DeviceContext& device_context, 
-						const AlignedVector< T >& data);
+						const std::vector< T, AllocatorT >& data);
 
 		/**
 		 Returns the shader resource view of this structured buffer.
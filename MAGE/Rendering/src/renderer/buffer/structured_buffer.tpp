@@ -55,9 +55,10 @@ namespace mage::rendering {
 	}
 
 	template< typename T >
+	template< typename AllocatorT >
 	void StructuredBuffer< T >
 		::UpdateData(ID3D11DeviceContext& device_context, 
-			         const AlignedVector< T >& data) {
+			         const std::vector< T, AllocatorT >& data) {
 
 		m_size = data.size();
 
@@ -76,6 +77,7 @@ namespace mage::rendering {
 						D3D11_MAP_WRITE_DISCARD, mapped_buffer);
 			
 		memcpy(mapped_buffer.pData, data.data(), m_size * sizeof(T));
+		Pipeline::s_nb_mapped_bytes += static_cast< U32 >(m_size * sizeof(T));
 	}
 
 	template< typename T >
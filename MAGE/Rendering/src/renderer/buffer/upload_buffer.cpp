@@ -0,0 +1,226 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\upload_buffer.hpp"
+#include "renderer\factory.hpp"
+#include "exception\exception.hpp"
+#include "logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	[[nodiscard]]
+	bool UploadBuffer::IsSupported(ID3D11Device& device) noexcept {
+		// Check the support for constant buffer offsets and no-overwrite maps
+		// (i.e. D3D11.1 with Windows 8 or later).
+		D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+		const HRESULT result
+			= device.CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS,
+										 &options, sizeof(options));
+		return SUCCEEDED(result)
+			&& TRUE == options.ConstantBufferOffsetting
+			&& TRUE == options.MapNoOverwriteOnDynamicConstantBuffer;
+	}
+
+	UploadBuffer::UploadBuffer(ID3D11Device& device,
+							   ID3D11DeviceContext& device_context,
+							   size_t size)
+		: m_device_context(),
+		m_buffer(),
+		m_mapped_data(nullptr),
+		m_mapped_offset(0u),
+		m_size(0u),
+		m_offset(0u),
+		m_generation(0ull),
+		m_discard(true),
+		m_staged(D3D11_DEVICE_CONTEXT_DEFERRED == device_context.GetType()),
+		m_pending_allocations(),
+		m_submitted_allocations() {
+
+		ThrowIfFailed(IsSupported(device),
+					  "Constant buffer offsets or no-overwrite maps of constant "
+					  "buffers are not supported.");
+
+		{
+			// Get the ID3D11DeviceContext1.
+			ComPtr< ID3D11DeviceContext > device_context0(&device_context);
+			const HRESULT result = device_context0.As(&m_device_context);
+			ThrowIfFailed(result,
+						  "ID3D11DeviceContext1 creation failed: %08X.", result);
+		}
+
+		SetupUploadBuffer(device, size);
+	}
+
+	UploadBuffer::UploadBuffer(UploadBuffer&& buffer) noexcept = default;
+
+	UploadBuffer::~UploadBuffer() = default;
+
+	UploadBuffer& UploadBuffer::operator=(UploadBuffer&& buffer) noexcept = default;
+
+	void UploadBuffer::SetupUploadBuffer(ID3D11Device& device, size_t size) {
+		const auto aligned_size = GetAllocationSize(size);
+
+		const HRESULT result = CreateDynamicConstantBuffer< U8 >(
+			device, NotNull< ID3D11Buffer** >(m_buffer.ReleaseAndGetAddressOf()),
+			aligned_size);
+		ThrowIfFailed(result, "Upload buffer creation failed: %08X.", result);
+
+		m_size = aligned_size;
+	}
+
+	void UploadBuffer::Reset(ID3D11DeviceContext& device_context, size_t size) {
+		if (m_size < size) {
+			ComPtr< ID3D11Device > device;
+			device_context.GetDevice(device.ReleaseAndGetAddressOf());
+			// Grow geometrically to avoid recreating the buffer every frame.
+			SetupUploadBuffer(*device.Get(), std::max(size, 2u * m_size));
+		}
+
+		m_offset  = 0u;
+		m_discard = true;
+		++m_generation;
+	}
+
+	void UploadBuffer::Map(ID3D11DeviceContext& device_context) {
+		if (m_staged) {
+			auto& pending = m_pending_allocations;
+
+			if (m_discard || pending.m_begin == pending.m_end) {
+				// Start a new range of staged allocations. Allocations staged 
+				// before a wrap-around are invalid and dropped.
+				pending.m_buffer  = m_buffer;
+				pending.m_begin   = m_offset;
+				pending.m_end     = m_offset;
+				pending.m_discard = pending.m_discard || m_discard;
+			}
+
+			if (pending.m_capacity < m_size - pending.m_begin) {
+				pending.m_data     = MakeUnique< U8[] >(m_size);
+				pending.m_capacity = m_size;
+				// Growing only happens after a wrap-around, which drops the 
+				// staged allocations.
+				Assert(pending.m_begin == pending.m_end);
+			}
+
+			// The map of the buffer resource is counted for the frame of the 
+			// staged allocations.
+			++Pipeline::s_nb_maps;
+
+			m_mapped_data   = pending.m_data.get();
+			m_mapped_offset = pending.m_begin;
+			m_discard       = false;
+			return;
+		}
+
+		const auto map_type = m_discard ? D3D11_MAP_WRITE_DISCARD
+			                            : D3D11_MAP_WRITE_NO_OVERWRITE;
+
+		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+		const HRESULT result = Pipeline::Map(device_context, *m_buffer.Get(),
+											 0u, map_type, 0u, mapped_buffer);
+		ThrowIfFailed(result, "Buffer mapping failed: %08X.", result);
+
+		m_mapped_data   = static_cast< U8* >(mapped_buffer.pData);
+		m_mapped_offset = 0u;
+		m_discard       = false;
+	}
+
+	void UploadBuffer::Unmap(ID3D11DeviceContext& device_context) noexcept {
+		if (m_staged) {
+			m_pending_allocations.m_end = m_offset;
+		}
+		else {
+			Pipeline::Unmap(device_context, *m_buffer.Get(), 0u);
+		}
+
+		m_mapped_data = nullptr;
+	}
+
+	void UploadBuffer::SubmitStagedAllocations() noexcept {
+		if (!m_staged) {
+			return;
+		}
+
+		Assert(nullptr == m_mapped_data);
+
+		std::swap(m_pending_allocations, m_submitted_allocations);
+
+		// Reuse the data of the executed staged allocations.
+		m_pending_allocations.m_buffer.Reset();
+		m_pending_allocations.m_begin   = 0u;
+		m_pending_allocations.m_end     = 0u;
+		m_pending_allocations.m_discard = false;
+	}
+
+	void UploadBuffer::ExecuteStagedAllocations(
+		ID3D11DeviceContext& device_context) noexcept {
+
+		auto& submitted = m_submitted_allocations;
+		if (!m_staged || !submitted.m_buffer) {
+			return;
+		}
+
+		const auto map_type = submitted.m_discard ? D3D11_MAP_WRITE_DISCARD
+			                                      : D3D11_MAP_WRITE_NO_OVERWRITE;
+
+		// Map the buffer resource directly: the map is already counted for 
+		// the frame of the staged allocations.
+		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+		const HRESULT result = device_context.Map(submitted.m_buffer.Get(),
+												  0u, map_type, 0u, 
+												  &mapped_buffer);
+		if (SUCCEEDED(result)) {
+			std::memcpy(static_cast< U8* >(mapped_buffer.pData) + submitted.m_begin,
+						submitted.m_data.get(),
+						submitted.m_end - submitted.m_begin);
+			device_context.Unmap(submitted.m_buffer.Get(), 0u);
+		}
+		else {
+			Error("Buffer mapping failed: %08X.", result);
+		}
+
+		submitted.m_buffer.Reset();
+		submitted.m_begin   = 0u;
+		submitted.m_end     = 0u;
+		submitted.m_discard = false;
+	}
+
+	UploadAllocation UploadBuffer::Allocate(const void* data,
+											size_t size) noexcept {
+		Assert(nullptr != m_mapped_data);
+
+		const auto allocation_size = GetAllocationSize(size);
+		Assert(CanAllocate(allocation_size));
+
+		std::memcpy(m_mapped_data + (m_offset - m_mapped_offset), data, size);
+		Pipeline::s_nb_mapped_bytes += static_cast< U32 >(size);
+
+		UploadAllocation allocation = {};
+		allocation.m_buffer         = this;
+		allocation.m_first_constant = static_cast< U32 >(m_offset / 16u);
+		allocation.m_nb_constants   = static_cast< U32 >(allocation_size / 16u);
+		allocation.m_generation     = m_generation;
+
+		m_offset += allocation_size;
+
+		return allocation;
+	}
+}
\ No newline at end of file
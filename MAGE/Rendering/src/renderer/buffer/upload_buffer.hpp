@@ -0,0 +1,471 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command_list.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// UploadAllocation
+	//-------------------------------------------------------------------------
+
+	class UploadBuffer;
+
+	/**
+	 A struct of upload allocations.
+
+	 An upload allocation is a range of constants of an upload buffer. It
+	 remains valid until the upload buffer wraps around.
+	 */
+	struct UploadAllocation {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the upload buffer of this upload allocation.
+		 */
+		const UploadBuffer* m_buffer;
+
+		/**
+		 The offset (in shader constants) of this upload allocation.
+		 */
+		U32 m_first_constant;
+
+		/**
+		 The number of shader constants of this upload allocation.
+		 */
+		U32 m_nb_constants;
+
+		/**
+		 The generation of the upload buffer of this upload allocation.
+		 */
+		U64 m_generation;
+	};
+
+	//-------------------------------------------------------------------------
+	// UploadBuffer
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of upload buffers.
+
+	 An upload buffer is a single, large dynamic constant buffer which is
+	 sub-allocated linearly and mapped with @c D3D11_MAP_WRITE_NO_OVERWRITE.
+	 The allocations are bound with constant buffer offsets. Once the upload
+	 buffer is full, it wraps around with a single @c D3D11_MAP_WRITE_DISCARD
+	 and starts a new generation, invalidating all previous allocations.
+
+	 An upload buffer of a deferred device context is staged: the 
+	 allocations are written to system memory and only copied to the buffer 
+	 resource on the immediate device context once their frame is executed. 
+	 Otherwise, the first map in each command list would have to discard the 
+	 buffer resource and thus re-upload all allocations.
+	 */
+	class UploadBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The alignment (in bytes) of the allocations of upload buffers.
+
+		 Constant buffer offsets must be multiples of 16 shader constants.
+		 */
+		static constexpr size_t s_alignment = 256u;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the size of an allocation of the given size.
+
+		 @param[in]		size
+						The size in bytes.
+		 @return		The size in bytes of an allocation of the given size.
+		 */
+		[[nodiscard]]
+		static constexpr size_t GetAllocationSize(size_t size) noexcept {
+			return (size + s_alignment - 1u) & ~(s_alignment - 1u);
+		}
+
+		/**
+		 Checks whether upload buffers are supported by the given device.
+
+		 Upload buffers require constant buffer offsets and no-overwrite maps
+		 of dynamic constant buffers, which are not supported by D3D11.0
+		 devices.
+
+		 @param[in]		device
+						A reference to the device.
+		 @return		@c true if upload buffers are supported by the given
+						device. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static bool IsSupported(ID3D11Device& device) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an upload buffer.
+
+		 @param[in]		device
+						A reference to the device.
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		size
+						The size in bytes.
+		 @pre			@c IsSupported(device).
+		 @throws		Exception
+						Failed to setup this upload buffer.
+		 */
+		explicit UploadBuffer(ID3D11Device& device,
+							  ID3D11DeviceContext& device_context,
+							  size_t size = 1u << 22u);
+
+		/**
+		 Constructs an upload buffer from the given upload buffer.
+
+		 @param[in]		buffer
+						A reference to the upload buffer to copy.
+		 */
+		UploadBuffer(const UploadBuffer& buffer) = delete;
+
+		/**
+		 Constructs an upload buffer by moving the given upload buffer.
+
+		 @param[in]		buffer
+						A reference to the upload buffer to move.
+		 */
+		UploadBuffer(UploadBuffer&& buffer) noexcept;
+
+		/**
+		 Destructs this upload buffer.
+		 */
+		~UploadBuffer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given upload buffer to this upload buffer.
+
+		 @param[in]		buffer
+						A reference to the upload buffer to copy.
+		 @return		A reference to the copy of the given upload buffer
+						(i.e. this upload buffer).
+		 */
+		UploadBuffer& operator=(const UploadBuffer& buffer) = delete;
+
+		/**
+		 Moves the given upload buffer to this upload buffer.
+
+		 @param[in]		buffer
+						A reference to the upload buffer to move.
+		 @return		A reference to the moved upload buffer (i.e. this
+						upload buffer).
+		 */
+		UploadBuffer& operator=(UploadBuffer&& buffer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the given allocation is still valid.
+
+		 @param[in]		allocation
+						A reference to the allocation.
+		 @return		@c true if the given allocation belongs to the current
+						generation of this upload buffer. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsValid(const UploadAllocation& allocation) const noexcept {
+			return this == allocation.m_buffer
+				&& m_generation == allocation.m_generation;
+		}
+
+		/**
+		 Checks whether the given number of bytes can be allocated without
+		 wrapping around.
+
+		 @param[in]		size
+						The size in bytes (i.e. the sum of allocation sizes).
+		 @return		@c true if the given number of bytes can be allocated
+						without wrapping around. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool CanAllocate(size_t size) const noexcept {
+			return m_offset + size <= m_size;
+		}
+
+		/**
+		 Wraps this upload buffer around and starts a new generation.
+
+		 All allocations of previous generations become invalid. The next
+		 map discards the current contents.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		size
+						The minimal size in bytes. The buffer resource of this
+						upload buffer is recreated if it is smaller.
+		 @throws		Exception
+						Failed to resize this upload buffer.
+		 */
+		void Reset(ID3D11DeviceContext& device_context, size_t size);
+
+		/**
+		 Maps this upload buffer.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @throws		Exception
+						Failed to map this upload buffer.
+		 */
+		void Map(ID3D11DeviceContext& device_context);
+
+		/**
+		 Unmaps this upload buffer.
+
+		 @pre			This upload buffer is mapped.
+		 @param[in]		device_context
+						A reference to the device context.
+		 */
+		void Unmap(ID3D11DeviceContext& device_context) noexcept;
+
+		/**
+		 Submits the staged allocations of this upload buffer of the current 
+		 frame. This is a no-op if this upload buffer is not staged.
+
+		 @pre			This upload buffer is not mapped.
+		 @pre			The previously submitted allocations are executed.
+		 */
+		void SubmitStagedAllocations() noexcept;
+
+		/**
+		 Copies the submitted staged allocations of this upload buffer to its 
+		 buffer resource. This is a no-op if this upload buffer is not staged 
+		 or if no allocations are submitted.
+
+		 This must be called before executing the command list of the frame of 
+		 the submitted allocations, and may be called from another thread 
+		 than the thread allocating, as long as it does not overlap with 
+		 submitting.
+
+		 @param[in]		device_context
+						A reference to the immediate device context.
+		 */
+		void ExecuteStagedAllocations(
+			ID3D11DeviceContext& device_context) noexcept;
+
+		/**
+		 Allocates and uploads the given data.
+
+		 @pre			This upload buffer is mapped.
+		 @pre			@c CanAllocate(GetAllocationSize(size)).
+		 @param[in]		data
+						A pointer to the data.
+		 @param[in]		size
+						The size in bytes of the data.
+		 @return		The allocation of the given data.
+		 */
+		[[nodiscard]]
+		UploadAllocation Allocate(const void* data, size_t size) noexcept;
+
+		/**
+		 Binds the given allocation of this upload buffer.
+
+		 @pre			@c IsValid(allocation).
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the constant buffer to (ranges from 0 to
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+		 @param[in]		allocation
+						A reference to the allocation.
+		 */
+		template< typename PipelineStageT >
+		void Bind(U32 slot, const UploadAllocation& allocation) const noexcept {
+			PipelineStageT::BindConstantBuffer(*m_device_context.Get(),
+											   slot,
+											   m_buffer.Get(),
+											   allocation.m_first_constant,
+											   allocation.m_nb_constants);
+		}
+
+		/**
+		 Records binding the given allocation of this upload buffer.
+
+		 @pre			@c IsValid(allocation).
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the constant buffer to (ranges from 0 to
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+		 @param[in]		allocation
+						A reference to the allocation.
+		 */
+		template< typename PipelineStageT >
+		void Bind(CommandList& commands,
+				  U32 slot, 
+				  const UploadAllocation& allocation) const {
+
+			commands.BindConstantBuffer< PipelineStageT >(
+				slot, m_buffer.Get(), 
+				allocation.m_first_constant, allocation.m_nb_constants);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of staged allocations.
+
+		 The staged allocations of a frame cover a single range of the buffer 
+		 resource, since allocations are linear within a generation.
+		 */
+		struct StagedAllocations {
+
+		public:
+
+			/**
+			 A pointer to the buffer resource of these staged allocations.
+			 */
+			ComPtr< ID3D11Buffer > m_buffer;
+
+			/**
+			 A pointer to the data of these staged allocations.
+			 */
+			UniquePtr< U8[] > m_data;
+
+			/**
+			 The capacity in bytes of the data of these staged allocations.
+			 */
+			size_t m_capacity;
+
+			/**
+			 The offset in bytes of the first staged allocation in the buffer 
+			 resource.
+			 */
+			size_t m_begin;
+
+			/**
+			 The offset in bytes past the last staged allocation in the buffer 
+			 resource.
+			 */
+			size_t m_end;
+
+			/**
+			 A flag indicating whether copying these staged allocations 
+			 discards the current contents of the buffer resource.
+			 */
+			bool m_discard;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets up the buffer resource of this upload buffer.
+
+		 @param[in]		device
+						A reference to the device.
+		 @param[in]		size
+						The size in bytes.
+		 @throws		Exception
+						Failed to setup the buffer resource of this upload
+						buffer.
+		 */
+		void SetupUploadBuffer(ID3D11Device& device, size_t size);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the device context (supporting constant buffer offsets)
+		 of this upload buffer.
+		 */
+		ComPtr< ID3D11DeviceContext1 > m_device_context;
+
+		/**
+		 A pointer to the buffer resource of this upload buffer.
+		 */
+		ComPtr< ID3D11Buffer > m_buffer;
+
+		/**
+		 A pointer to the mapped data of this upload buffer.
+		 */
+		U8* m_mapped_data;
+
+		/**
+		 The offset in bytes in the buffer resource of the mapped data of 
+		 this upload buffer.
+		 */
+		size_t m_mapped_offset;
+
+		/**
+		 The size in bytes of this upload buffer.
+		 */
+		size_t m_size;
+
+		/**
+		 The offset in bytes of the next allocation of this upload buffer.
+		 */
+		size_t m_offset;
+
+		/**
+		 The generation of this upload buffer.
+		 */
+		U64 m_generation;
+
+		/**
+		 A flag indicating whether the next map of this upload buffer
+		 discards the current contents.
+		 */
+		bool m_discard;
+
+		/**
+		 A flag indicating whether this upload buffer is staged.
+		 */
+		bool m_staged;
+
+		/**
+		 The staged allocations of this upload buffer of the current frame.
+		 */
+		StagedAllocations m_pending_allocations;
+
+		/**
+		 The staged allocations of this upload buffer of the submitted frame.
+		 */
+		StagedAllocations m_submitted_allocations;
+	};
+}
\ No newline at end of file
@@ -182,6 +182,12 @@ namespace mage::rendering {
 
 		device_context.GenerateMips(m_texture_srv.Get());
 
+		BindVoxelTexture(device_context);
+	}
+
+	void VoxelGrid::BindVoxelTexture(
+		ID3D11DeviceContext& device_context) const noexcept {
+
 		Pipeline::VS::BindSRV(device_context, SLOT_SRV_VOXEL_TEXTURE, 
 							  m_texture_srv.Get());
 		Pipeline::PS::BindSRV(device_context, SLOT_SRV_VOXEL_TEXTURE,
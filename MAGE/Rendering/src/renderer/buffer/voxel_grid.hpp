@@ -39,6 +39,8 @@ namespace mage::rendering {
 			ID3D11DeviceContext& device_context) const noexcept;
 		void BindEndVoxelizationTexture(
 			ID3D11DeviceContext& device_context) const noexcept;
+		void BindVoxelTexture(
+			ID3D11DeviceContext& device_context) const noexcept;
 
 	private:
 
@@ -0,0 +1,478 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command_executor.hpp"
+#include "exception\exception.hpp"
+#include "logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <iterator>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Casts the given command header to the command it belongs to.
+
+		 @tparam		CommandT
+						The command type.
+		 @param[in]		header
+						A reference to the command header.
+		 @return		A reference to the command.
+		 */
+		template< typename CommandT >
+		[[nodiscard]]
+		inline const CommandT& CastTo(const CommandHeader& header) noexcept {
+			return *reinterpret_cast< const CommandT* >(&header);
+		}
+
+		/**
+		 Calls the given function with the pipeline stage corresponding to the
+		 given shader stage.
+
+		 @tparam		FunctionT
+						The function type.
+		 @param[in]		stage
+						The shader stage.
+		 @param[in]		function
+						The function which is called with a value of the
+						pipeline stage type.
+		 */
+		template< typename FunctionT >
+		inline void VisitStage(ShaderStage stage,
+							   const FunctionT& function) noexcept {
+
+			switch (stage) {
+
+			case ShaderStage::VS: {
+				function(Pipeline::VS());
+				break;
+			}
+			case ShaderStage::HS: {
+				function(Pipeline::HS());
+				break;
+			}
+			case ShaderStage::DS: {
+				function(Pipeline::DS());
+				break;
+			}
+			case ShaderStage::GS: {
+				function(Pipeline::GS());
+				break;
+			}
+			case ShaderStage::PS: {
+				function(Pipeline::PS());
+				break;
+			}
+			case ShaderStage::CS: {
+				function(Pipeline::CS());
+				break;
+			}
+
+			}
+		}
+
+		/**
+		 Binds the given shader to the given shader stage.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		stage
+						The shader stage.
+		 @param[in]		shader
+						A pointer to the shader.
+		 */
+		void BindShader(ID3D11DeviceContext& device_context,
+						ShaderStage stage,
+						ID3D11DeviceChild* shader) noexcept {
+
+			switch (stage) {
+
+			case ShaderStage::VS: {
+				Pipeline::VS::BindShader(device_context,
+					static_cast< ID3D11VertexShader* >(shader));
+				break;
+			}
+			case ShaderStage::HS: {
+				Pipeline::HS::BindShader(device_context,
+					static_cast< ID3D11HullShader* >(shader));
+				break;
+			}
+			case ShaderStage::DS: {
+				Pipeline::DS::BindShader(device_context,
+					static_cast< ID3D11DomainShader* >(shader));
+				break;
+			}
+			case ShaderStage::GS: {
+				Pipeline::GS::BindShader(device_context,
+					static_cast< ID3D11GeometryShader* >(shader));
+				break;
+			}
+			case ShaderStage::PS: {
+				Pipeline::PS::BindShader(device_context,
+					static_cast< ID3D11PixelShader* >(shader));
+				break;
+			}
+			case ShaderStage::CS: {
+				Pipeline::CS::BindShader(device_context,
+					static_cast< ID3D11ComputeShader* >(shader));
+				break;
+			}
+
+			}
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// D3D11CommandExecutor
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	D3D11CommandExecutor::D3D11CommandExecutor(ID3D11DeviceContext& device_context)
+		: m_device_context() {
+
+		// Get the ID3D11DeviceContext1.
+		ComPtr< ID3D11DeviceContext > device_context0(&device_context);
+		const HRESULT result = device_context0.As(&m_device_context);
+		ThrowIfFailed(result,
+					  "ID3D11DeviceContext1 creation failed: %08X.", result);
+	}
+
+	D3D11CommandExecutor::D3D11CommandExecutor(
+		D3D11CommandExecutor&& executor) noexcept = default;
+
+	D3D11CommandExecutor::~D3D11CommandExecutor() = default;
+
+	D3D11CommandExecutor& D3D11CommandExecutor
+		::operator=(D3D11CommandExecutor&& executor) noexcept = default;
+
+	void D3D11CommandExecutor::Execute(const CommandList& commands) const noexcept {
+		auto& device_context = *m_device_context.Get();
+
+		commands.ForEach([&device_context, &commands](
+			const CommandHeader& header) noexcept {
+
+			switch (header.m_type) {
+
+			case CommandType::BindShader: {
+				const auto& command = CastTo< BindShaderCommand >(header);
+				BindShader(device_context, header.m_stage, 
+						   commands.GetResource< ID3D11DeviceChild >(
+							   command.m_shader));
+				break;
+			}
+			case CommandType::BindConstantBuffer: {
+				const auto& command = CastTo< BindConstantBufferCommand >(header);
+				const auto buffer 
+					= commands.GetResource< ID3D11Buffer >(command.m_buffer);
+				VisitStage(header.m_stage, [&](auto stage) noexcept {
+					using PipelineStage = decltype(stage);
+					if (0u == command.m_nb_constants) {
+						PipelineStage::BindConstantBuffer(
+							device_context, command.m_slot, buffer);
+					}
+					else {
+						PipelineStage::BindConstantBuffer(
+							device_context, command.m_slot, buffer,
+							command.m_first_constant, command.m_nb_constants);
+					}
+				});
+				break;
+			}
+			case CommandType::BindSRVs: {
+				const auto& command = CastTo< BindSRVsCommand >(header);
+				const auto  handles = GetSRVs(command);
+				const auto  nb_views = std::min(command.m_nb_views, 
+					U32(D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT));
+				ID3D11ShaderResourceView* 
+					srvs[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+				for (U32 i = 0u; i < nb_views; ++i) {
+					srvs[i] = commands.GetResource< ID3D11ShaderResourceView >(
+						handles[i]);
+				}
+				VisitStage(header.m_stage, [&](auto stage) noexcept {
+					decltype(stage)::BindSRVs(device_context, command.m_slot,
+											  nb_views, srvs);
+				});
+				break;
+			}
+			case CommandType::BindSampler: {
+				const auto& command = CastTo< BindSamplerCommand >(header);
+				const auto sampler 
+					= commands.GetResource< ID3D11SamplerState >(command.m_sampler);
+				VisitStage(header.m_stage, [&](auto stage) noexcept {
+					decltype(stage)::BindSampler(device_context, command.m_slot,
+												 sampler);
+				});
+				break;
+			}
+			case CommandType::BindVertexBuffer: {
+				const auto& command = CastTo< BindVertexBufferCommand >(header);
+				Pipeline::IA::BindVertexBuffer(device_context, command.m_slot,
+					*commands.GetResource< ID3D11Buffer >(command.m_buffer),
+					command.m_stride,
+					command.m_offset);
+				break;
+			}
+			case CommandType::BindIndexBuffer: {
+				const auto& command = CastTo< BindIndexBufferCommand >(header);
+				Pipeline::IA::BindIndexBuffer(device_context, 
+					*commands.GetResource< ID3D11Buffer >(command.m_buffer),
+					command.m_format,
+					command.m_offset);
+				break;
+			}
+			case CommandType::BindPrimitiveTopology: {
+				const auto& command = CastTo< BindPrimitiveTopologyCommand >(header);
+				Pipeline::IA::BindPrimitiveTopology(device_context,
+													command.m_topology);
+				break;
+			}
+			case CommandType::BindInputLayout: {
+				const auto& command = CastTo< BindInputLayoutCommand >(header);
+				Pipeline::IA::BindInputLayout(device_context,
+					*commands.GetResource< ID3D11InputLayout >(
+						command.m_input_layout));
+				break;
+			}
+			case CommandType::Draw: {
+				const auto& command = CastTo< DrawCommand >(header);
+				Pipeline::DrawInstanced(device_context,
+										command.m_nb_vertices,
+										command.m_nb_instances,
+										command.m_vertex_start,
+										command.m_instance_start);
+				break;
+			}
+			case CommandType::DrawIndexed: {
+				const auto& command = CastTo< DrawIndexedCommand >(header);
+				Pipeline::DrawIndexedInstanced(device_context,
+											   command.m_nb_indices,
+											   command.m_nb_instances,
+											   command.m_index_start,
+											   command.m_index_offset,
+											   command.m_instance_start);
+				break;
+			}
+			case CommandType::Dispatch: {
+				const auto& command = CastTo< DispatchCommand >(header);
+				Pipeline::Dispatch(device_context,
+								   command.m_nb_thread_groups_x,
+								   command.m_nb_thread_groups_y,
+								   command.m_nb_thread_groups_z);
+				break;
+			}
+
+			}
+		});
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// NullCommandExecutor
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	NullCommandExecutor::NullCommandExecutor() noexcept
+		: m_shaders{},
+		m_input_layout(BindingState::Unknown),
+		m_topology(BindingState::Unknown),
+		m_index_buffer(BindingState::Unknown),
+		m_nb_commands(0u),
+		m_nb_draws(0u),
+		m_nb_dispatches(0u),
+		m_nb_errors(0u) {}
+
+	NullCommandExecutor::NullCommandExecutor(
+		const NullCommandExecutor& executor) noexcept = default;
+
+	NullCommandExecutor::NullCommandExecutor(
+		NullCommandExecutor&& executor) noexcept = default;
+
+	NullCommandExecutor::~NullCommandExecutor() = default;
+
+	NullCommandExecutor& NullCommandExecutor
+		::operator=(const NullCommandExecutor& executor) noexcept = default;
+
+	NullCommandExecutor& NullCommandExecutor
+		::operator=(NullCommandExecutor&& executor) noexcept = default;
+
+	void NullCommandExecutor::Reset() noexcept {
+		std::fill(std::begin(m_shaders), std::end(m_shaders),
+				  BindingState::Unknown);
+		m_input_layout  = BindingState::Unknown;
+		m_topology      = BindingState::Unknown;
+		m_index_buffer  = BindingState::Unknown;
+		m_nb_commands   = 0u;
+		m_nb_draws      = 0u;
+		m_nb_dispatches = 0u;
+		m_nb_errors     = 0u;
+	}
+
+	void NullCommandExecutor::Validate(bool condition,
+									   const_zstring message) noexcept {
+		if (condition) {
+			return;
+		}
+
+		++m_nb_errors;
+		Warning("Invalid command: %s", message);
+	}
+
+	void NullCommandExecutor::ValidateDraw(bool indexed) noexcept {
+		const auto vs = m_shaders[static_cast< size_t >(ShaderStage::VS)];
+		Validate(BindingState::Unbound != vs,
+				 "draw without vertex shader.");
+		Validate(BindingState::Unbound != m_input_layout,
+				 "draw without input layout.");
+		Validate(BindingState::Unbound != m_topology,
+				 "draw without primitive topology.");
+		if (indexed) {
+			Validate(BindingState::Unbound != m_index_buffer,
+					 "indexed draw without index buffer.");
+		}
+	}
+
+	void NullCommandExecutor::ValidateResource(const CommandList& commands,
+											   ResourceHandle handle) noexcept {
+		Validate(handle <= commands.GetNumberOfResources(),
+				 "resource handle out of range.");
+	}
+
+	void NullCommandExecutor::Execute(const CommandList& commands) noexcept {
+		commands.ForEach([this, &commands](const CommandHeader& header) noexcept {
+			++m_nb_commands;
+
+			switch (header.m_type) {
+
+			case CommandType::BindShader: {
+				const auto& command = CastTo< BindShaderCommand >(header);
+				ValidateResource(commands, command.m_shader);
+				m_shaders[static_cast< size_t >(header.m_stage)]
+					= (g_null_resource_handle != command.m_shader) 
+					? BindingState::Bound : BindingState::Unbound;
+				break;
+			}
+			case CommandType::BindConstantBuffer: {
+				const auto& command = CastTo< BindConstantBufferCommand >(header);
+				ValidateResource(commands, command.m_buffer);
+				Validate(command.m_slot
+						 < D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT,
+						 "constant buffer slot out of range.");
+				// Constant buffer offsets and sizes are multiples of 16
+				// shader constants.
+				Validate(0u == command.m_first_constant % 16u
+						 && 0u == command.m_nb_constants % 16u,
+						 "misaligned constant buffer range.");
+				break;
+			}
+			case CommandType::BindSRVs: {
+				const auto& command = CastTo< BindSRVsCommand >(header);
+				Validate(command.m_slot + command.m_nb_views
+						 <= D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT,
+						 "SRV slot out of range.");
+				const auto handles = GetSRVs(command);
+				for (U32 i = 0u; i < command.m_nb_views; ++i) {
+					ValidateResource(commands, handles[i]);
+				}
+				break;
+			}
+			case CommandType::BindSampler: {
+				const auto& command = CastTo< BindSamplerCommand >(header);
+				ValidateResource(commands, command.m_sampler);
+				Validate(command.m_slot < D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT,
+						 "sampler slot out of range.");
+				break;
+			}
+			case CommandType::BindVertexBuffer: {
+				const auto& command = CastTo< BindVertexBufferCommand >(header);
+				ValidateResource(commands, command.m_buffer);
+				Validate(command.m_slot
+						 < D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT,
+						 "vertex buffer slot out of range.");
+				Validate(0u != command.m_stride,
+						 "vertex buffer without stride.");
+				break;
+			}
+			case CommandType::BindIndexBuffer: {
+				const auto& command = CastTo< BindIndexBufferCommand >(header);
+				ValidateResource(commands, command.m_buffer);
+				Validate(DXGI_FORMAT_R16_UINT == command.m_format
+						 || DXGI_FORMAT_R32_UINT == command.m_format,
+						 "invalid index format.");
+				m_index_buffer = BindingState::Bound;
+				break;
+			}
+			case CommandType::BindPrimitiveTopology: {
+				const auto& command = CastTo< BindPrimitiveTopologyCommand >(header);
+				m_topology = (D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED != command.m_topology)
+					         ? BindingState::Bound : BindingState::Unbound;
+				break;
+			}
+			case CommandType::BindInputLayout: {
+				const auto& command = CastTo< BindInputLayoutCommand >(header);
+				ValidateResource(commands, command.m_input_layout);
+				m_input_layout = (g_null_resource_handle != command.m_input_layout) 
+					           ? BindingState::Bound : BindingState::Unbound;
+				break;
+			}
+			case CommandType::Draw: {
+				const auto& command = CastTo< DrawCommand >(header);
+				++m_nb_draws;
+				ValidateDraw(false);
+				Validate(0u != command.m_nb_vertices
+						 && 0u != command.m_nb_instances,
+						 "empty draw.");
+				break;
+			}
+			case CommandType::DrawIndexed: {
+				const auto& command = CastTo< DrawIndexedCommand >(header);
+				++m_nb_draws;
+				ValidateDraw(true);
+				Validate(0u != command.m_nb_indices
+						 && 0u != command.m_nb_instances,
+						 "empty draw.");
+				break;
+			}
+			case CommandType::Dispatch: {
+				const auto& command = CastTo< DispatchCommand >(header);
+				++m_nb_dispatches;
+				const auto cs = m_shaders[static_cast< size_t >(ShaderStage::CS)];
+				Validate(BindingState::Unbound != cs,
+						 "dispatch without compute shader.");
+				Validate(0u != command.m_nb_thread_groups_x
+						 && 0u != command.m_nb_thread_groups_y
+						 && 0u != command.m_nb_thread_groups_z,
+						 "empty dispatch.");
+				Validate(command.m_nb_thread_groups_x
+						 <= D3D11_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION
+						 && command.m_nb_thread_groups_y
+						 <= D3D11_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION
+						 && command.m_nb_thread_groups_z
+						 <= D3D11_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION,
+						 "too many thread groups.");
+				break;
+			}
+
+			}
+		});
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,366 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command_list.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// D3D11CommandExecutor
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of D3D11 command executors replaying command lists on a D3D11
+	 device context.
+	 */
+	class D3D11CommandExecutor {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a D3D11 command executor.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @throws		Exception
+						Failed to obtain a device context supporting constant
+						buffer offsets.
+		 */
+		explicit D3D11CommandExecutor(ID3D11DeviceContext& device_context);
+
+		/**
+		 Constructs a D3D11 command executor from the given D3D11 command
+		 executor.
+
+		 @param[in]		executor
+						A reference to the D3D11 command executor to copy.
+		 */
+		D3D11CommandExecutor(const D3D11CommandExecutor& executor) = delete;
+
+		/**
+		 Constructs a D3D11 command executor by moving the given D3D11
+		 command executor.
+
+		 @param[in]		executor
+						A reference to the D3D11 command executor to move.
+		 */
+		D3D11CommandExecutor(D3D11CommandExecutor&& executor) noexcept;
+
+		/**
+		 Destructs this D3D11 command executor.
+		 */
+		~D3D11CommandExecutor();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given D3D11 command executor to this D3D11 command
+		 executor.
+
+		 @param[in]		executor
+						A reference to the D3D11 command executor to copy.
+		 @return		A reference to the copy of the given D3D11 command
+						executor (i.e. this D3D11 command executor).
+		 */
+		D3D11CommandExecutor& operator=(
+			const D3D11CommandExecutor& executor) = delete;
+
+		/**
+		 Moves the given D3D11 command executor to this D3D11 command
+		 executor.
+
+		 @param[in]		executor
+						A reference to the D3D11 command executor to move.
+		 @return		A reference to the moved D3D11 command executor (i.e.
+						this D3D11 command executor).
+		 */
+		D3D11CommandExecutor& operator=(
+			D3D11CommandExecutor&& executor) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Executes the given command list.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 */
+		void Execute(const CommandList& commands) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the device context (supporting constant buffer offsets)
+		 of this D3D11 command executor.
+		 */
+		ComPtr< ID3D11DeviceContext1 > m_device_context;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// NullCommandExecutor
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of null command executors validating and counting the commands
+	 of command lists without issuing them to a device.
+
+	 A null command executor never resolves the resource handles of the
+	 commands and can thus execute command lists without a device. A null
+	 command executor tracks the bound state across the executed command
+	 lists like a device context. State which was never bound through
+	 a command list is unknown and not validated. Each violation is reported
+	 as a warning and counted.
+	 */
+	class NullCommandExecutor {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a null command executor.
+		 */
+		NullCommandExecutor() noexcept;
+
+		/**
+		 Constructs a null command executor from the given null command
+		 executor.
+
+		 @param[in]		executor
+						A reference to the null command executor to copy.
+		 */
+		NullCommandExecutor(const NullCommandExecutor& executor) noexcept;
+
+		/**
+		 Constructs a null command executor by moving the given null command
+		 executor.
+
+		 @param[in]		executor
+						A reference to the null command executor to move.
+		 */
+		NullCommandExecutor(NullCommandExecutor&& executor) noexcept;
+
+		/**
+		 Destructs this null command executor.
+		 */
+		~NullCommandExecutor();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given null command executor to this null command
+		 executor.
+
+		 @param[in]		executor
+						A reference to the null command executor to copy.
+		 @return		A reference to the copy of the given null command
+						executor (i.e. this null command executor).
+		 */
+		NullCommandExecutor& operator=(
+			const NullCommandExecutor& executor) noexcept;
+
+		/**
+		 Moves the given null command executor to this null command executor.
+
+		 @param[in]		executor
+						A reference to the null command executor to move.
+		 @return		A reference to the moved null command executor (i.e.
+						this null command executor).
+		 */
+		NullCommandExecutor& operator=(
+			NullCommandExecutor&& executor) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Executes (i.e. validates and counts) the given command list.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 */
+		void Execute(const CommandList& commands) noexcept;
+
+		/**
+		 Resets the counters and the tracked state of this null command
+		 executor.
+		 */
+		void Reset() noexcept;
+
+		/**
+		 Returns the number of executed commands of this null command
+		 executor.
+
+		 @return		The number of executed commands of this null command
+						executor.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfCommands() const noexcept {
+			return m_nb_commands;
+		}
+
+		/**
+		 Returns the number of executed draw commands of this null command
+		 executor.
+
+		 @return		The number of executed draw commands of this null
+						command executor.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfDraws() const noexcept {
+			return m_nb_draws;
+		}
+
+		/**
+		 Returns the number of executed dispatch commands of this null command
+		 executor.
+
+		 @return		The number of executed dispatch commands of this null
+						command executor.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfDispatches() const noexcept {
+			return m_nb_dispatches;
+		}
+
+		/**
+		 Returns the number of detected errors of this null command executor.
+
+		 @return		The number of detected errors of this null command
+						executor.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfErrors() const noexcept {
+			return m_nb_errors;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the different tracked binding states.
+		 */
+		enum class BindingState : U8 {
+			Unknown = 0,
+			Unbound,
+			Bound
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Validates the given condition.
+
+		 @param[in]		condition
+						The condition.
+		 @param[in]		message
+						The message to report if @a condition is @c false.
+		 */
+		void Validate(bool condition, const_zstring message) noexcept;
+
+		/**
+		 Validates the given resource handle.
+
+		 @param[in]		commands
+						A reference to the command list containing the
+						resource handle.
+		 @param[in]		handle
+						The resource handle.
+		 */
+		void ValidateResource(const CommandList& commands,
+							  ResourceHandle handle) noexcept;
+
+		/**
+		 Validates the binding state of the input assembler stage and the
+		 vertex shader stage for drawing.
+
+		 @param[in]		indexed
+						@c true for indexed draws. @c false otherwise.
+		 */
+		void ValidateDraw(bool indexed) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The binding states of the shaders of this null command executor
+		 (indexed by shader stage).
+		 */
+		BindingState m_shaders[6];
+
+		/**
+		 The binding state of the input layout of this null command executor.
+		 */
+		BindingState m_input_layout;
+
+		/**
+		 The binding state of the primitive topology of this null command
+		 executor.
+		 */
+		BindingState m_topology;
+
+		/**
+		 The binding state of the index buffer of this null command executor.
+		 */
+		BindingState m_index_buffer;
+
+		/**
+		 The number of executed commands of this null command executor.
+		 */
+		size_t m_nb_commands;
+
+		/**
+		 The number of executed draw commands of this null command executor.
+		 */
+		size_t m_nb_draws;
+
+		/**
+		 The number of executed dispatch commands of this null command
+		 executor.
+		 */
+		size_t m_nb_dispatches;
+
+		/**
+		 The number of detected errors of this null command executor.
+		 */
+		size_t m_nb_errors;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command_list.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Offsets the given resource handle.
+
+		 @param[in,out]	handle
+						A reference to the resource handle.
+		 @param[in]		offset
+						The offset.
+		 */
+		inline void Offset(ResourceHandle& handle, 
+						   ResourceHandle offset) noexcept {
+
+			if (g_null_resource_handle != handle) {
+				handle += offset;
+			}
+		}
+
+		/**
+		 Offsets the resource handles of the given command.
+
+		 @param[in,out]	header
+						A reference to the header of the command.
+		 @param[in]		offset
+						The offset.
+		 */
+		void OffsetResourceHandles(CommandHeader& header, 
+								   ResourceHandle offset) noexcept {
+
+			switch (header.m_type) {
+
+			case CommandType::BindShader: {
+				auto& command = reinterpret_cast< BindShaderCommand& >(header);
+				Offset(command.m_shader, offset);
+				break;
+			}
+			case CommandType::BindConstantBuffer: {
+				auto& command 
+					= reinterpret_cast< BindConstantBufferCommand& >(header);
+				Offset(command.m_buffer, offset);
+				break;
+			}
+			case CommandType::BindSRVs: {
+				auto& command = reinterpret_cast< BindSRVsCommand& >(header);
+				const auto handles = GetSRVs(command);
+				for (U32 i = 0u; i < command.m_nb_views; ++i) {
+					Offset(handles[i], offset);
+				}
+				break;
+			}
+			case CommandType::BindSampler: {
+				auto& command = reinterpret_cast< BindSamplerCommand& >(header);
+				Offset(command.m_sampler, offset);
+				break;
+			}
+			case CommandType::BindVertexBuffer: {
+				auto& command 
+					= reinterpret_cast< BindVertexBufferCommand& >(header);
+				Offset(command.m_buffer, offset);
+				break;
+			}
+			case CommandType::BindIndexBuffer: {
+				auto& command 
+					= reinterpret_cast< BindIndexBufferCommand& >(header);
+				Offset(command.m_buffer, offset);
+				break;
+			}
+			case CommandType::BindInputLayout: {
+				auto& command 
+					= reinterpret_cast< BindInputLayoutCommand& >(header);
+				Offset(command.m_input_layout, offset);
+				break;
+			}
+			default: {
+				break;
+			}
+
+			}
+		}
+	}
+
+	CommandList::CommandList() noexcept
+		: m_buffer(),
+		m_nb_commands(0u),
+		m_resources() {}
+
+	CommandList::CommandList(const CommandList& commands) = default;
+
+	CommandList::CommandList(CommandList&& commands) noexcept = default;
+
+	CommandList::~CommandList() = default;
+
+	CommandList& CommandList::operator=(const CommandList& commands) = default;
+
+	CommandList& CommandList::operator=(CommandList&& commands) noexcept = default;
+
+	void CommandList::Clear() noexcept {
+		m_buffer.clear();
+		m_nb_commands = 0u;
+		m_resources.clear();
+	}
+
+	void CommandList::Append(const CommandList& commands) {
+		const auto offset = static_cast< ResourceHandle >(m_resources.size());
+		const auto first  = m_buffer.size();
+
+		m_buffer.insert(m_buffer.end(), 
+						commands.m_buffer.cbegin(), commands.m_buffer.cend());
+		m_nb_commands += commands.m_nb_commands;
+		m_resources.insert(m_resources.end(), 
+						   commands.m_resources.cbegin(), 
+						   commands.m_resources.cend());
+
+		if (0u == offset) {
+			return;
+		}
+
+		// Remap the resource handles of the appended commands to the 
+		// resource table of this command list.
+		auto* word = m_buffer.data() + first;
+		const auto* end = m_buffer.data() + m_buffer.size();
+		while (word != end) {
+			auto& header = *reinterpret_cast< CommandHeader* >(word);
+			OffsetResourceHandles(header, offset);
+			word += header.m_size;
+		}
+	}
+
+	[[nodiscard]]
+	ResourceHandle CommandList::AddResource(ID3D11DeviceChild* resource) {
+		if (nullptr == resource) {
+			return g_null_resource_handle;
+		}
+
+		m_resources.push_back(resource);
+		return static_cast< ResourceHandle >(m_resources.size());
+	}
+
+	void CommandList::BindVertexBuffer(U32 slot,
+									   ID3D11Buffer& buffer,
+									   U32 stride,
+									   U32 offset) {
+
+		auto command = Allocate< BindVertexBufferCommand >(
+			CommandType::BindVertexBuffer);
+		command->m_slot   = slot;
+		command->m_stride = stride;
+		command->m_offset = offset;
+		command->m_buffer = AddResource(&buffer);
+	}
+
+	void CommandList::BindIndexBuffer(ID3D11Buffer& buffer,
+									  DXGI_FORMAT format,
+									  U32 offset) {
+
+		auto command = Allocate< BindIndexBufferCommand >(
+			CommandType::BindIndexBuffer);
+		command->m_format = format;
+		command->m_offset = offset;
+		command->m_buffer = AddResource(&buffer);
+	}
+
+	void CommandList::BindPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) {
+		auto command = Allocate< BindPrimitiveTopologyCommand >(
+			CommandType::BindPrimitiveTopology);
+		command->m_topology = topology;
+	}
+
+	void CommandList::BindInputLayout(ID3D11InputLayout& input_layout) {
+		auto command = Allocate< BindInputLayoutCommand >(
+			CommandType::BindInputLayout);
+		command->m_input_layout = AddResource(&input_layout);
+	}
+
+	void CommandList::Draw(U32 nb_vertices, U32 vertex_start) {
+		DrawInstanced(nb_vertices, 1u, vertex_start);
+	}
+
+	void CommandList::DrawInstanced(U32 nb_vertices_per_instance,
+									U32 nb_instances,
+									U32 vertex_start,
+									U32 instance_start) {
+
+		auto command = Allocate< DrawCommand >(CommandType::Draw);
+		command->m_nb_vertices    = nb_vertices_per_instance;
+		command->m_nb_instances   = nb_instances;
+		command->m_vertex_start   = vertex_start;
+		command->m_instance_start = instance_start;
+	}
+
+	void CommandList::DrawIndexed(U32 nb_indices,
+								  U32 index_start,
+								  U32 index_offset) {
+
+		DrawIndexedInstanced(nb_indices, 1u, index_start, index_offset);
+	}
+
+	void CommandList::DrawIndexedInstanced(U32 nb_indices_per_instance,
+										   U32 nb_instances,
+										   U32 index_start,
+										   U32 index_offset,
+										   U32 instance_start) {
+
+		auto command = Allocate< DrawIndexedCommand >(CommandType::DrawIndexed);
+		command->m_nb_indices     = nb_indices_per_instance;
+		command->m_nb_instances   = nb_instances;
+		command->m_index_start    = index_start;
+		command->m_index_offset   = index_offset;
+		command->m_instance_start = instance_start;
+	}
+
+	void CommandList::Dispatch(U32 nb_thread_groups_x,
+							   U32 nb_thread_groups_y,
+							   U32 nb_thread_groups_z) {
+
+		auto command = Allocate< DispatchCommand >(CommandType::Dispatch);
+		command->m_nb_thread_groups_x = nb_thread_groups_x;
+		command->m_nb_thread_groups_y = nb_thread_groups_y;
+		command->m_nb_thread_groups_z = nb_thread_groups_z;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,767 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\pipeline.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// Commands
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different command types.
+	 */
+	enum class CommandType : U8 {
+		BindShader = 0,
+		BindConstantBuffer,
+		BindSRVs,
+		BindSampler,
+		BindVertexBuffer,
+		BindIndexBuffer,
+		BindPrimitiveTopology,
+		BindInputLayout,
+		Draw,
+		DrawIndexed,
+		Dispatch
+	};
+
+	/**
+	 An enumeration of the different shader stages.
+	 */
+	enum class ShaderStage : U8 {
+		VS = 0,
+		HS,
+		DS,
+		GS,
+		PS,
+		CS
+	};
+
+	/**
+	 Returns the shader stage of the given pipeline stage.
+
+	 @tparam		PipelineStageT
+					The pipeline stage type.
+	 @return		The shader stage of the given pipeline stage.
+	 */
+	template< typename PipelineStageT >
+	[[nodiscard]]
+	constexpr ShaderStage GetShaderStage() noexcept;
+
+	/**
+	 The type of resource handles.
+
+	 Commands refer to resources (i.e. shaders, buffers, views, samplers and
+	 input layouts) by handle instead of by pointer. A resource handle indexes
+	 the resource table of the command list containing the command and is
+	 only resolved by a command executor.
+	 */
+	using ResourceHandle = U32;
+
+	/**
+	 The resource handle corresponding to no resource.
+	 */
+	constexpr ResourceHandle g_null_resource_handle = 0u;
+
+	/**
+	 A struct of command headers.
+
+	 Each command packet starts with a command header.
+	 */
+	struct CommandHeader {
+
+	public:
+
+		/**
+		 The type of the command.
+		 */
+		CommandType m_type;
+
+		/**
+		 The shader stage of the command (if applicable).
+		 */
+		ShaderStage m_stage;
+
+		/**
+		 The size (in words) of the command packet including this command
+		 header.
+		 */
+		U16 m_size;
+	};
+
+	/**
+	 A struct of commands for binding a shader to a shader stage.
+	 */
+	struct BindShaderCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		/**
+		 The handle of the shader (of the type matching the shader stage).
+		 */
+		ResourceHandle m_shader;
+	};
+
+	/**
+	 A struct of commands for binding (a range of) a constant buffer to a
+	 shader stage.
+	 */
+	struct BindConstantBufferCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		U32 m_slot;
+
+		/**
+		 The offset (in shader constants) of the range.
+		 */
+		U32 m_first_constant;
+
+		/**
+		 The number of shader constants of the range. Zero binds the complete
+		 constant buffer.
+		 */
+		U32 m_nb_constants;
+
+		ResourceHandle m_buffer;
+	};
+
+	/**
+	 A struct of commands for binding an array of shader resource views to a
+	 shader stage. The handles of the shader resource views are stored
+	 directly after this command.
+	 */
+	struct BindSRVsCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		U32 m_slot;
+
+		U32 m_nb_views;
+	};
+
+	/**
+	 Returns the number of words needed to store the given number of bytes.
+
+	 @param[in]		size
+					The size (in bytes).
+	 @return		The number of words needed to store @a size bytes.
+	 */
+	[[nodiscard]]
+	constexpr size_t GetNumberOfWords(size_t size) noexcept {
+		return (size + sizeof(U64) - 1u) / sizeof(U64);
+	}
+
+	/**
+	 Returns the shader resource view handles stored after the given command.
+
+	 @param[in]		command
+					A reference to the command.
+	 @return		A pointer to the array of shader resource view handles of
+					the given command.
+	 */
+	[[nodiscard]]
+	inline ResourceHandle* GetSRVs(BindSRVsCommand& command) noexcept {
+		return reinterpret_cast< ResourceHandle* >(
+			reinterpret_cast< U64* >(&command)
+			+ GetNumberOfWords(sizeof(BindSRVsCommand)));
+	}
+
+	/**
+	 Returns the shader resource view handles stored after the given command.
+
+	 @param[in]		command
+					A reference to the command.
+	 @return		A pointer to the array of shader resource view handles of
+					the given command.
+	 */
+	[[nodiscard]]
+	inline const ResourceHandle* GetSRVs(const BindSRVsCommand& command) noexcept {
+		return reinterpret_cast< const ResourceHandle* >(
+			reinterpret_cast< const U64* >(&command)
+			+ GetNumberOfWords(sizeof(BindSRVsCommand)));
+	}
+
+	/**
+	 A struct of commands for binding a sampler to a shader stage.
+	 */
+	struct BindSamplerCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		U32 m_slot;
+
+		ResourceHandle m_sampler;
+	};
+
+	/**
+	 A struct of commands for binding a vertex buffer to the input assembler
+	 stage.
+	 */
+	struct BindVertexBufferCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		U32 m_slot;
+
+		U32 m_stride;
+
+		U32 m_offset;
+
+		ResourceHandle m_buffer;
+	};
+
+	/**
+	 A struct of commands for binding an index buffer to the input assembler
+	 stage.
+	 */
+	struct BindIndexBufferCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		DXGI_FORMAT m_format;
+
+		U32 m_offset;
+
+		ResourceHandle m_buffer;
+	};
+
+	/**
+	 A struct of commands for binding a primitive topology to the input
+	 assembler stage.
+	 */
+	struct BindPrimitiveTopologyCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		D3D11_PRIMITIVE_TOPOLOGY m_topology;
+	};
+
+	/**
+	 A struct of commands for binding an input layout to the input assembler
+	 stage.
+	 */
+	struct BindInputLayoutCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		ResourceHandle m_input_layout;
+	};
+
+	/**
+	 A struct of commands for drawing (instances of) non-indexed primitives.
+	 */
+	struct DrawCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		U32 m_nb_vertices;
+
+		U32 m_nb_instances;
+
+		U32 m_vertex_start;
+
+		U32 m_instance_start;
+	};
+
+	/**
+	 A struct of commands for drawing (instances of) indexed primitives.
+	 */
+	struct DrawIndexedCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		U32 m_nb_indices;
+
+		U32 m_nb_instances;
+
+		U32 m_index_start;
+
+		U32 m_index_offset;
+
+		U32 m_instance_start;
+	};
+
+	/**
+	 A struct of commands for dispatching compute shader thread groups.
+	 */
+	struct DispatchCommand {
+
+	public:
+
+		CommandHeader m_header;
+
+		U32 m_nb_thread_groups_x;
+
+		U32 m_nb_thread_groups_y;
+
+		U32 m_nb_thread_groups_z;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// CommandList
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of command lists.
+
+	 A command list records compact command packets into a linear buffer
+	 instead of issuing them to a device context. A command list does not
+	 touch any device or device context while recording: different threads
+	 can record into different command lists concurrently, after which the
+	 command lists are appended in order. The recorded command lists are
+	 replayed afterwards by a command executor (e.g.,
+	 @c D3D11CommandExecutor or @c NullCommandExecutor).
+
+	 The command packets only contain resource handles. The resources
+	 themselves are stored in the resource table of the command list, which
+	 is only accessed by command executors issuing commands to a device.
+	 The recorded resources are not reference counted: they must outlive the
+	 execution of the command list.
+	 */
+	class CommandList {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a command list.
+		 */
+		CommandList() noexcept;
+
+		/**
+		 Constructs a command list from the given command list.
+
+		 @param[in]		commands
+						A reference to the command list to copy.
+		 */
+		CommandList(const CommandList& commands);
+
+		/**
+		 Constructs a command list by moving the given command list.
+
+		 @param[in]		commands
+						A reference to the command list to move.
+		 */
+		CommandList(CommandList&& commands) noexcept;
+
+		/**
+		 Destructs this command list.
+		 */
+		~CommandList();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given command list to this command list.
+
+		 @param[in]		commands
+						A reference to the command list to copy.
+		 @return		A reference to the copy of the given command list (i.e.
+						this command list).
+		 */
+		CommandList& operator=(const CommandList& commands);
+
+		/**
+		 Moves the given command list to this command list.
+
+		 @param[in]		commands
+						A reference to the command list to move.
+		 @return		A reference to the moved command list (i.e. this
+						command list).
+		 */
+		CommandList& operator=(CommandList&& commands) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Clears this command list. The memory of this command list is retained
+		 for recording the next commands.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Appends the commands of the given command list to this command list.
+
+		 @param[in]		commands
+						A reference to the command list to append.
+		 */
+		void Append(const CommandList& commands);
+
+		/**
+		 Checks whether this command list is empty.
+
+		 @return		@c true if this command list is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return 0u == m_nb_commands;
+		}
+
+		/**
+		 Returns the number of commands of this command list.
+
+		 @return		The number of commands of this command list.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfCommands() const noexcept {
+			return m_nb_commands;
+		}
+
+		/**
+		 Returns the size (in bytes) of the commands of this command list.
+
+		 @return		The size (in bytes) of the commands of this command
+						list.
+		 */
+		[[nodiscard]]
+		size_t GetSize() const noexcept {
+			return m_buffer.size() * sizeof(U64);
+		}
+
+		/**
+		 Returns the number of resources of the resource table of this
+		 command list.
+
+		 @return		The number of resources of the resource table of this
+						command list.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfResources() const noexcept {
+			return m_resources.size();
+		}
+
+		/**
+		 Returns the resource of the given resource handle.
+
+		 @pre			@a handle <= @c GetNumberOfResources().
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		handle
+						The resource handle.
+		 @return		A pointer to the resource of the given resource
+						handle. @c nullptr if @a handle is the null resource
+						handle.
+		 */
+		template< typename ResourceT >
+		[[nodiscard]]
+		ResourceT* GetResource(ResourceHandle handle) const noexcept;
+
+		/**
+		 Calls the given visitor for each command of this command list (in
+		 recording order).
+
+		 @tparam		VisitorT
+						The visitor type.
+		 @param[in]		visitor
+						The visitor which is called with a reference to the
+						header of each command.
+		 */
+		template< typename VisitorT >
+		void ForEach(VisitorT&& visitor) const;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Shaders
+		//---------------------------------------------------------------------
+
+		/**
+		 Records binding a shader to the given pipeline stage.
+
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @tparam		ShaderT
+						The shader type.
+		 @param[in]		shader
+						A pointer to the shader.
+		 */
+		template< typename PipelineStageT, typename ShaderT >
+		void BindShader(ShaderT* shader);
+
+		/**
+		 Records binding a constant buffer to the given pipeline stage.
+
+		 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the constant buffer to.
+		 @param[in]		buffer
+						A pointer to the constant buffer.
+		 */
+		template< typename PipelineStageT >
+		void BindConstantBuffer(U32 slot, ID3D11Buffer* buffer);
+
+		/**
+		 Records binding a range of a constant buffer to the given pipeline
+		 stage.
+
+		 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the constant buffer to.
+		 @param[in]		buffer
+						A pointer to the constant buffer.
+		 @param[in]		first_constant
+						The offset (in shader constants) of the range.
+		 @param[in]		nb_constants
+						The number of shader constants of the range.
+		 */
+		template< typename PipelineStageT >
+		void BindConstantBuffer(U32 slot,
+								ID3D11Buffer* buffer,
+								U32 first_constant,
+								U32 nb_constants);
+
+		/**
+		 Records binding a shader resource view to the given pipeline stage.
+
+		 @pre			@a slot < @c D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the shader resource view to.
+		 @param[in]		srv
+						A pointer to the shader resource view.
+		 */
+		template< typename PipelineStageT >
+		void BindSRV(U32 slot, ID3D11ShaderResourceView* srv) {
+			BindSRVs< PipelineStageT >(slot, 1u, &srv);
+		}
+
+		/**
+		 Records binding an array of shader resource views to the given
+		 pipeline stage.
+
+		 @pre			@a slot < @c D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT.
+		 @pre			@a nb_views <= @c D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT
+						- @a slot.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		slot
+						The index into the device's zero-based array to begin
+						setting shader resource views to.
+		 @param[in]		nb_views
+						The number of shader resource views.
+		 @param[in]		srvs
+						A pointer to an array of shader resource views.
+		 */
+		template< typename PipelineStageT >
+		void BindSRVs(U32 slot,
+					  U32 nb_views,
+					  ID3D11ShaderResourceView* const* srvs);
+
+		/**
+		 Records binding a sampler to the given pipeline stage.
+
+		 @pre			@a slot < @c D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the sampler to.
+		 @param[in]		sampler
+						A pointer to the sampler.
+		 */
+		template< typename PipelineStageT >
+		void BindSampler(U32 slot, ID3D11SamplerState* sampler);
+
+		//---------------------------------------------------------------------
+		// Member Methods: Input Assembler
+		//---------------------------------------------------------------------
+
+		/**
+		 Records binding a vertex buffer to the input assembler stage.
+
+		 @param[in]		slot
+						The input slot.
+		 @param[in]		buffer
+						A reference to the vertex buffer.
+		 @param[in]		stride
+						The vertex stride (in bytes).
+		 @param[in]		offset
+						The offset (in bytes) of the first vertex.
+		 */
+		void BindVertexBuffer(U32 slot,
+							  ID3D11Buffer& buffer,
+							  U32 stride,
+							  U32 offset = 0u);
+
+		/**
+		 Records binding an index buffer to the input assembler stage.
+
+		 @param[in]		buffer
+						A reference to the index buffer.
+		 @param[in]		format
+						The format of the indices.
+		 @param[in]		offset
+						The offset (in bytes) of the first index.
+		 */
+		void BindIndexBuffer(ID3D11Buffer& buffer,
+							 DXGI_FORMAT format,
+							 U32 offset = 0u);
+
+		/**
+		 Records binding a primitive topology to the input assembler stage.
+
+		 @param[in]		topology
+						The primitive topology.
+		 */
+		void BindPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology);
+
+		/**
+		 Records binding an input layout to the input assembler stage.
+
+		 @param[in]		input_layout
+						A reference to the input layout.
+		 */
+		void BindInputLayout(ID3D11InputLayout& input_layout);
+
+		//---------------------------------------------------------------------
+		// Member Methods: Drawing and Dispatching
+		//---------------------------------------------------------------------
+
+		void Draw(U32 nb_vertices, U32 vertex_start);
+
+		void DrawInstanced(U32 nb_vertices_per_instance,
+						   U32 nb_instances,
+						   U32 vertex_start,
+						   U32 instance_start = 0u);
+
+		void DrawIndexed(U32 nb_indices,
+						 U32 index_start,
+						 U32 index_offset = 0u);
+
+		void DrawIndexedInstanced(U32 nb_indices_per_instance,
+								  U32 nb_instances,
+								  U32 index_start,
+								  U32 index_offset = 0u,
+								  U32 instance_start = 0u);
+
+		void Dispatch(U32 nb_thread_groups_x,
+					  U32 nb_thread_groups_y,
+					  U32 nb_thread_groups_z);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Allocates a command packet in this command list.
+
+		 @tparam		CommandT
+						The command type.
+		 @param[in]		type
+						The command type.
+		 @param[in]		stage
+						The shader stage.
+		 @param[in]		payload_size
+						The size (in bytes) of the data stored directly after
+						the command.
+		 @return		A pointer to the command.
+		 */
+		template< typename CommandT >
+		[[nodiscard]]
+		CommandT* Allocate(CommandType type,
+						   ShaderStage stage = ShaderStage::VS,
+						   size_t payload_size = 0u);
+
+		/**
+		 Adds the given resource to the resource table of this command list.
+
+		 @param[in]		resource
+						A pointer to the resource.
+		 @return		The handle of the given resource. The null resource
+						handle if @a resource is @c nullptr.
+		 */
+		[[nodiscard]]
+		ResourceHandle AddResource(ID3D11DeviceChild* resource);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (word-aligned) command packets of this command list.
+		 */
+		std::vector< U64 > m_buffer;
+
+		/**
+		 The number of commands of this command list.
+		 */
+		size_t m_nb_commands;
+
+		/**
+		 The resource table of this command list. The resource handle i
+		 refers to the resource at index i - 1.
+		 */
+		std::vector< ID3D11DeviceChild* > m_resources;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command_list.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <type_traits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename PipelineStageT >
+	[[nodiscard]]
+	constexpr ShaderStage GetShaderStage() noexcept {
+		if constexpr (std::is_same_v< Pipeline::VS, PipelineStageT >) {
+			return ShaderStage::VS;
+		}
+		else if constexpr (std::is_same_v< Pipeline::HS, PipelineStageT >) {
+			return ShaderStage::HS;
+		}
+		else if constexpr (std::is_same_v< Pipeline::DS, PipelineStageT >) {
+			return ShaderStage::DS;
+		}
+		else if constexpr (std::is_same_v< Pipeline::GS, PipelineStageT >) {
+			return ShaderStage::GS;
+		}
+		else if constexpr (std::is_same_v< Pipeline::PS, PipelineStageT >) {
+			return ShaderStage::PS;
+		}
+		else {
+			static_assert(std::is_same_v< Pipeline::CS, PipelineStageT >);
+			return ShaderStage::CS;
+		}
+	}
+
+	template< typename ResourceT >
+	[[nodiscard]]
+	inline ResourceT* CommandList
+		::GetResource(ResourceHandle handle) const noexcept {
+
+		return (g_null_resource_handle == handle) 
+			? nullptr : static_cast< ResourceT* >(m_resources[handle - 1u]);
+	}
+
+	template< typename VisitorT >
+	void CommandList::ForEach(VisitorT&& visitor) const {
+		const auto* word = m_buffer.data();
+		const auto* end  = word + m_buffer.size();
+		while (word != end) {
+			const auto& header = *reinterpret_cast< const CommandHeader* >(word);
+			visitor(header);
+			word += header.m_size;
+		}
+	}
+
+	template< typename PipelineStageT, typename ShaderT >
+	void CommandList::BindShader(ShaderT* shader) {
+		static_assert(std::is_base_of_v< ID3D11DeviceChild, ShaderT >);
+
+		auto command = Allocate< BindShaderCommand >(
+			CommandType::BindShader, GetShaderStage< PipelineStageT >());
+		command->m_shader = AddResource(shader);
+	}
+
+	template< typename PipelineStageT >
+	void CommandList::BindConstantBuffer(U32 slot, ID3D11Buffer* buffer) {
+		BindConstantBuffer< PipelineStageT >(slot, buffer, 0u, 0u);
+	}
+
+	template< typename PipelineStageT >
+	void CommandList::BindConstantBuffer(U32 slot,
+										 ID3D11Buffer* buffer,
+										 U32 first_constant,
+										 U32 nb_constants) {
+
+		auto command = Allocate< BindConstantBufferCommand >(
+			CommandType::BindConstantBuffer, GetShaderStage< PipelineStageT >());
+		command->m_slot           = slot;
+		command->m_first_constant = first_constant;
+		command->m_nb_constants   = nb_constants;
+		command->m_buffer         = AddResource(buffer);
+	}
+
+	template< typename PipelineStageT >
+	void CommandList::BindSRVs(U32 slot,
+							   U32 nb_views,
+							   ID3D11ShaderResourceView* const* srvs) {
+
+		const auto payload_size = nb_views * sizeof(ResourceHandle);
+		auto command = Allocate< BindSRVsCommand >(
+			CommandType::BindSRVs, GetShaderStage< PipelineStageT >(),
+			payload_size);
+		command->m_slot     = slot;
+		command->m_nb_views = nb_views;
+		
+		const auto handles = GetSRVs(*command);
+		for (U32 i = 0u; i < nb_views; ++i) {
+			handles[i] = AddResource(srvs[i]);
+		}
+	}
+
+	template< typename PipelineStageT >
+	void CommandList::BindSampler(U32 slot, ID3D11SamplerState* sampler) {
+		auto command = Allocate< BindSamplerCommand >(
+			CommandType::BindSampler, GetShaderStage< PipelineStageT >());
+		command->m_slot    = slot;
+		command->m_sampler = AddResource(sampler);
+	}
+
+	template< typename CommandT >
+	[[nodiscard]]
+	CommandT* CommandList::Allocate(CommandType type,
+									ShaderStage stage,
+									size_t payload_size) {
+
+		static_assert(std::is_trivially_copyable_v< CommandT >);
+		static_assert(std::is_standard_layout_v< CommandT >);
+		static_assert(alignof(CommandT) <= alignof(U64));
+
+		const auto nb_words = GetNumberOfWords(sizeof(CommandT))
+			                + GetNumberOfWords(payload_size);
+		const auto offset   = m_buffer.size();
+		m_buffer.resize(offset + nb_words);
+		++m_nb_commands;
+
+		auto command = new(m_buffer.data() + offset) CommandT();
+		command->m_header.m_type  = type;
+		command->m_header.m_stage = stage;
+		command->m_header.m_size  = static_cast< U16 >(nb_words);
+		return command;
+	}
+}
\ No newline at end of file
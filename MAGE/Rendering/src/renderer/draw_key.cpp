@@ -0,0 +1,116 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\draw_key.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Combines the given hash value with the given pointer.
+
+		 @param[in]		hash
+						The hash value.
+		 @param[in]		ptr
+						The pointer.
+		 @return		The combined hash value.
+		 */
+		[[nodiscard]]
+		inline U64 HashCombine(U64 hash, const void* ptr) noexcept {
+			hash ^= static_cast< U64 >(reinterpret_cast< std::uintptr_t >(ptr));
+			hash *= 0x9E3779B97F4A7C15ull;
+			return hash ^ (hash >> 32u);
+		}
+
+		/**
+		 Returns the given number of most significant bits of the given hash
+		 value.
+
+		 @param[in]		hash
+						The hash value.
+		 @param[in]		nb_bits
+						The number of bits.
+		 @return		The given number of most significant bits of the given
+						hash value.
+		 */
+		[[nodiscard]]
+		inline U64 FoldHash(U64 hash, U32 nb_bits) noexcept {
+			return (hash * 0x9E3779B97F4A7C15ull) >> (64u - nb_bits);
+		}
+
+		/**
+		 Quantizes the given depth.
+
+		 The IEEE 754 representation of a non-negative float preserves its
+		 order, so the most significant bits can be used directly without
+		 knowing the depth range of the view.
+
+		 @param[in]		depth
+						The depth.
+		 @param[in]		nb_bits
+						The number of bits.
+		 @return		The quantized depth.
+		 */
+		[[nodiscard]]
+		inline U64 QuantizeDepth(F32 depth, U32 nb_bits) noexcept {
+			const F32 clamped_depth = std::max(depth, 0.0f);
+			U32 bits;
+			std::memcpy(&bits, &clamped_depth, sizeof(bits));
+			return static_cast< U64 >(bits >> (32u - nb_bits));
+		}
+	}
+
+	U64 MakeDrawKey(DrawPass pass,
+					U32 permutation,
+					const Model& model,
+					U32 lod,
+					F32 depth) noexcept {
+
+		const auto& material = model.GetMaterial();
+
+		U64 textures = 0ull;
+		textures = HashCombine(textures, material.GetBaseColorSRV());
+		textures = HashCombine(textures, material.GetMaterialSRV());
+		textures = HashCombine(textures, material.GetNormalSRV());
+		const U64 mesh = HashCombine(0ull, model.GetMesh()) ^ lod;
+
+		const U64 pass_bits        = static_cast< U64 >(pass) & 0xFull;
+		const U64 permutation_bits = static_cast< U64 >(permutation) & 0xFull;
+
+		if (DrawPass::Transparent == pass) {
+			// Back-to-front
+			const U64 depth_bits = 0xFFFFFFull - QuantizeDepth(depth, 24u);
+			return (pass_bits               << 60u)
+				 | (depth_bits              << 36u)
+				 | (permutation_bits        << 32u)
+				 | (FoldHash(textures, 20u) << 12u)
+				 |  FoldHash(mesh, 12u);
+		}
+
+		// Front-to-back
+		const U64 depth_bits = QuantizeDepth(depth, 16u);
+		return (pass_bits               << 60u)
+			 | (permutation_bits        << 56u)
+			 | (FoldHash(textures, 24u) << 32u)
+			 | (FoldHash(mesh, 16u)     << 16u)
+			 |  depth_bits;
+	}
+}
\ No newline at end of file
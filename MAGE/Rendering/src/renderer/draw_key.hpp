@@ -0,0 +1,113 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\model\model.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 An enumeration of the different draw passes of a view.
+
+	 This contains:
+	 @c Solid,
+	 @c Emissive,
+	 @c Opaque,
+	 @c OpaqueTSNM,
+	 @c Transparent,
+	 @c DepthOpaque and
+	 @c DepthTransparent.
+	 */
+	enum class DrawPass : U8 {
+		Solid = 0,
+		Emissive,
+		Opaque,
+		OpaqueTSNM,
+		Transparent,
+		DepthOpaque,
+		DepthTransparent,
+		Count
+	};
+
+	/**
+	 A struct of model draws.
+	 */
+	struct ModelDraw {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the model of this model draw.
+		 */
+		const Model* m_model;
+
+		/**
+		 The level of detail of the model of this model draw.
+		 */
+		U32 m_lod;
+	};
+
+	/**
+	 Returns the 64-bit draw sort key of the given model.
+
+	 Sorting draws by increasing key groups the draws by pass first. Within
+	 the opaque passes, draws are grouped by shader permutation, material
+	 textures and mesh, and finally sorted front-to-back:
+
+	 | pass (4) | permutation (4) | textures (24) | mesh (16) | depth (16) |
+
+	 Within the transparent pass, draws are sorted back-to-front first, and
+	 only grouped by shader permutation, material textures and mesh for
+	 equal quantized depths:
+
+	 | pass (4) | inverted depth (24) | permutation (4) | textures (20) | mesh (12) |
+
+	 The textures and mesh fields contain hashes, so unrelated draws may
+	 share the same field values. The mesh field also contains the level of
+	 detail, so instances of the same level of detail are grouped. This only
+	 affects the grouping, not the correctness of the draws.
+
+	 @param[in]		pass
+					The draw pass.
+	 @param[in]		permutation
+					The shader permutation within the given draw pass (ranges
+					from 0 to 15).
+	 @param[in]		model
+					A reference to the model.
+	 @param[in]		lod
+					The level of detail of the model.
+	 @param[in]		depth
+					The view-space depth of the model.
+	 @return		The 64-bit draw sort key of the given model.
+	 */
+	[[nodiscard]]
+	U64 MakeDrawKey(DrawPass pass,
+					U32 permutation,
+					const Model& model,
+					U32 lod,
+					F32 depth) noexcept;
+
+	/**
+	 Returns the draw pass of the given 64-bit draw sort key.
+
+	 @param[in]		key
+					The 64-bit draw sort key.
+	 @return		The draw pass of the given 64-bit draw sort key.
+	 */
+	[[nodiscard]]
+	constexpr DrawPass GetDrawPass(U64 key) noexcept {
+		return static_cast< DrawPass >(key >> 60u);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\draw_lists.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Returns the object-to-view transformation matrix of the given model.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		world_to_view
+						The world-to-view transformation matrix.
+		 @return		The object-to-view transformation matrix of the given
+						model.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetObjectToView(const Model& model, 
+												   FXMMATRIX world_to_view) noexcept {
+
+			const auto& transform = model.GetOwner()->GetTransform();
+			return transform.GetObjectToWorldMatrix() * world_to_view;
+		}
+
+		/**
+		 Returns the view-space depth of the given model.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		object_to_view
+						The object-to-view transformation matrix of the given
+						model.
+		 @return		The view-space depth of the centroid of the AABB of
+						the given model.
+		 */
+		[[nodiscard]]
+		F32 XM_CALLCONV GetViewDepth(const Model& model, 
+									 FXMMATRIX object_to_view) noexcept {
+
+			const auto p_view = XMVector3TransformCoord(
+				model.GetAABB().Centroid(), object_to_view);
+			return XMVectorGetZ(p_view);
+		}
+	}
+
+	DrawLists::DrawLists()
+		: m_lists(),
+		m_draws() {}
+
+	DrawLists::DrawLists(DrawLists&& lists) noexcept = default;
+
+	DrawLists::~DrawLists() = default;
+
+	DrawLists& DrawLists::operator=(DrawLists&& lists) noexcept = default;
+
+	void XM_CALLCONV DrawLists::Build(const std::vector< const Model* >& models,
+									  FXMMATRIX world_to_view, 
+									  CXMMATRIX view_to_projection, 
+									  F32 lod_bias) {
+		m_draws.clear();
+
+		for (const auto model : models) {
+			const auto& material       = model->GetMaterial();
+			const auto  alpha          = material.GetBaseColor()[3];
+			const auto  object_to_view = GetObjectToView(*model, world_to_view);
+			const auto  depth          = GetViewDepth(*model, object_to_view);
+			const auto  lod            = static_cast< U32 >(model->SelectLOD(
+				object_to_view, view_to_projection, lod_bias));
+			const ModelDraw draw       = { model, lod };
+
+			// The permutation of the (opaque and transparent) forward shaders.
+			const U32 permutation = material.IsEmissive() ? 0u
+				                  : (nullptr == material.GetNormalSRV() ? 1u : 2u);
+
+			m_draws.emplace_back(
+				MakeDrawKey(DrawPass::Solid, 0u, *model, lod, depth), draw);
+
+			// Opaque fragments
+			if (TRANSPARENCY_THRESHOLD <= alpha) {
+				const DrawPass pass = (0u == permutation) ? DrawPass::Emissive
+					                : (1u == permutation) ? DrawPass::Opaque
+					                                      : DrawPass::OpaqueTSNM;
+				m_draws.emplace_back(
+					MakeDrawKey(pass, 0u, *model, lod, depth), draw);
+			}
+
+			// Transparent fragments
+			if (!material.IsTransparant()) {
+				m_draws.emplace_back(
+					MakeDrawKey(DrawPass::DepthOpaque, 0u, *model, lod, depth), draw);
+			}
+			else if (TRANSPARENCY_SHADOW_THRESHOLD <= alpha) {
+				m_draws.emplace_back(
+					MakeDrawKey(DrawPass::DepthTransparent, 0u, *model, lod, depth), draw);
+				m_draws.emplace_back(
+					MakeDrawKey(DrawPass::Transparent, permutation, *model, lod, depth), draw);
+			}
+		}
+
+		SortAndDistribute();
+	}
+
+	void XM_CALLCONV DrawLists::BuildOccluders(const std::vector< const Model* >& models,
+											   FXMMATRIX world_to_view, 
+											   CXMMATRIX view_to_projection, 
+											   F32 lod_bias) {
+		m_draws.clear();
+
+		for (const auto model : models) {
+			if (!model->OccludesLight()) {
+				continue;
+			}
+
+			const auto& material       = model->GetMaterial();
+			const auto  object_to_view = GetObjectToView(*model, world_to_view);
+			const auto  depth          = GetViewDepth(*model, object_to_view);
+			const auto  lod            = static_cast< U32 >(model->SelectLOD(
+				object_to_view, view_to_projection, lod_bias));
+			const ModelDraw draw       = { model, lod };
+
+			if (!material.IsTransparant()) {
+				m_draws.emplace_back(
+					MakeDrawKey(DrawPass::DepthOpaque, 0u, *model, lod, depth), draw);
+			}
+			else if (TRANSPARENCY_SHADOW_THRESHOLD <= material.GetBaseColor()[3]) {
+				m_draws.emplace_back(
+					MakeDrawKey(DrawPass::DepthTransparent, 0u, *model, lod, depth), draw);
+			}
+		}
+
+		SortAndDistribute();
+	}
+
+	void DrawLists::SortAndDistribute() {
+		std::sort(m_draws.begin(), m_draws.end(),
+				  [](const auto& lhs, const auto& rhs) noexcept {
+					  return lhs.first < rhs.first;
+				  });
+
+		for (auto& list : m_lists) {
+			list.clear();
+		}
+		for (const auto& [key, draw] : m_draws) {
+			m_lists[static_cast< size_t >(GetDrawPass(key))].push_back(draw);
+		}
+	}
+}
\ No newline at end of file
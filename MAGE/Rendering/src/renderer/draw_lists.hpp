@@ -0,0 +1,264 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\draw_key.hpp"
+#include "scene\rendering_world.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of draw lists.
+
+	 Draw lists bucket the visible models of a single view once, so the
+	 passes rendering that view do not need to filter the models
+	 themselves. All draws of a view are sorted once by their 64-bit draw
+	 sort key (see @c MakeDrawKey): opaque models are grouped by material
+	 and mesh within each shader permutation, transparent models are sorted
+	 back-to-front.
+	 */
+	class DrawLists {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The level of detail bias for the light occluding models of shadow 
+		 maps.
+		 */
+		static constexpr F32 s_occluder_lod_bias = 1.0f;
+
+		/**
+		 The level of detail bias for the voxelized models.
+		 */
+		static constexpr F32 s_voxelization_lod_bias = 1.0f;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs draw lists.
+		 */
+		DrawLists();
+
+		/**
+		 Constructs draw lists from the given draw lists.
+
+		 @param[in]		lists
+						A reference to the draw lists to copy.
+		 */
+		DrawLists(const DrawLists& lists) = delete;
+
+		/**
+		 Constructs draw lists by moving the given draw lists.
+
+		 @param[in]		lists
+						A reference to the draw lists to move.
+		 */
+		DrawLists(DrawLists&& lists) noexcept;
+
+		/**
+		 Destructs these draw lists.
+		 */
+		~DrawLists();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given draw lists to these draw lists.
+
+		 @param[in]		lists
+						A reference to the draw lists to copy.
+		 @return		A reference to the copy of the given draw lists (i.e.
+						these draw lists).
+		 */
+		DrawLists& operator=(const DrawLists& lists) = delete;
+
+		/**
+		 Moves the given draw lists to these draw lists.
+
+		 @param[in]		lists
+						A reference to the draw lists to move.
+		 @return		A reference to the moved draw lists (i.e. these draw
+						lists).
+		 */
+		DrawLists& operator=(DrawLists&& lists) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds these draw lists from the given visible models.
+
+		 @param[in]		models
+						A reference to a vector containing the visible models.
+		 @param[in]		world_to_view
+						The world-to-view transformation matrix used for
+						sorting the transparent models back-to-front.
+		 @param[in]		view_to_projection
+						The view-to-projection transformation matrix used for
+						selecting the levels of detail of the models.
+		 @param[in]		lod_bias
+						The level of detail bias.
+		 */
+		void XM_CALLCONV Build(const std::vector< const Model* >& models,
+							   FXMMATRIX world_to_view, 
+							   CXMMATRIX view_to_projection, 
+							   F32 lod_bias = 0.0f);
+
+		/**
+		 Builds the depth draw lists of these draw lists from the light
+		 occluding models of the given visible models.
+
+		 The other draw lists of these draw lists are cleared.
+
+		 @param[in]		models
+						A reference to a vector containing the visible models.
+		 @param[in]		world_to_view
+						The world-to-view transformation matrix used for
+						sorting the models front-to-back.
+		 @param[in]		view_to_projection
+						The view-to-projection transformation matrix used for
+						selecting the levels of detail of the models.
+		 @param[in]		lod_bias
+						The level of detail bias.
+		 */
+		void XM_CALLCONV BuildOccluders(const std::vector< const Model* >& models,
+										FXMMATRIX world_to_view, 
+										CXMMATRIX view_to_projection, 
+										F32 lod_bias = s_occluder_lod_bias);
+
+		/**
+		 Returns all visible models of these draw lists.
+
+		 @return		A reference to a vector containing the draws of all 
+						visible models of these draw lists sorted by material.
+		 */
+		[[nodiscard]]
+		const std::vector< ModelDraw >& GetModels() const noexcept {
+			return GetList(DrawPass::Solid);
+		}
+
+		/**
+		 Returns the opaque emissive models of these draw lists.
+
+		 @return		A reference to a vector containing the draws of the
+						opaque emissive models of these draw lists.
+		 */
+		[[nodiscard]]
+		const std::vector< ModelDraw >& GetEmissiveModels() const noexcept {
+			return GetList(DrawPass::Emissive);
+		}
+
+		/**
+		 Returns the opaque, non-emissive models of these draw lists.
+
+		 @param[in]		tsnm
+						@c true if the models with tangent space normal
+						mapping need to be returned. @c false otherwise.
+		 @return		A reference to a vector containing the draws of the
+						opaque, non-emissive models of these draw lists.
+		 */
+		[[nodiscard]]
+		const std::vector< ModelDraw >& GetOpaqueModels(
+			bool tsnm) const noexcept {
+
+			return GetList(tsnm ? DrawPass::OpaqueTSNM : DrawPass::Opaque);
+		}
+
+		/**
+		 Returns the transparent models of these draw lists.
+
+		 @return		A reference to a vector containing the draws of the
+						transparent models of these draw lists sorted 
+						back-to-front.
+		 */
+		[[nodiscard]]
+		const std::vector< ModelDraw >& GetTransparentModels() const noexcept {
+			return GetList(DrawPass::Transparent);
+		}
+
+		/**
+		 Returns the models of these draw lists which need to be rendered
+		 with the opaque depth shaders.
+
+		 @return		A reference to a vector containing the draws of the 
+						models of these draw lists which need to be rendered 
+						with the opaque depth shaders.
+		 */
+		[[nodiscard]]
+		const std::vector< ModelDraw >& GetDepthOpaqueModels() const noexcept {
+			return GetList(DrawPass::DepthOpaque);
+		}
+
+		/**
+		 Returns the models of these draw lists which need to be rendered
+		 with the transparent depth shaders.
+
+		 @return		A reference to a vector containing the draws of the 
+						models of these draw lists which need to be rendered 
+						with the transparent depth shaders.
+		 */
+		[[nodiscard]]
+		const std::vector< ModelDraw >& GetDepthTransparentModels() const noexcept {
+			return GetList(DrawPass::DepthTransparent);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the draw list of the given draw pass.
+
+		 @param[in]		pass
+						The draw pass.
+		 @return		A reference to a vector containing the model draws of
+						the draw list of the given draw pass.
+		 */
+		[[nodiscard]]
+		const std::vector< ModelDraw >& GetList(DrawPass pass) const noexcept {
+			return m_lists[static_cast< size_t >(pass)];
+		}
+
+		/**
+		 Sorts the keyed draws of these draw lists and distributes them over
+		 the draw lists of these draw lists.
+		 */
+		void SortAndDistribute();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 An array containing the draw lists of these draw lists, one for 
+		 each draw pass.
+		 */
+		std::vector< ModelDraw > m_lists[
+			static_cast< size_t >(DrawPass::Count)];
+
+		/**
+		 A vector containing the 64-bit draw sort keys and model draws of the
+		 draws of these draw lists.
+		 */
+		std::vector< std::pair< U64, ModelDraw > > m_draws;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,496 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\light_clusters.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		constexpr size_t g_nb_tiles_x = LIGHT_CLUSTER_GRID_X;
+		constexpr size_t g_nb_tiles_y = LIGHT_CLUSTER_GRID_Y;
+		constexpr size_t g_nb_slices  = LIGHT_CLUSTER_GRID_Z;
+
+		constexpr size_t g_nb_clusters_per_slice = g_nb_tiles_x * g_nb_tiles_y;
+		constexpr size_t g_nb_clusters = g_nb_clusters_per_slice * g_nb_slices;
+
+		constexpr size_t g_omni_lights    = 0u;
+		constexpr size_t g_spot_lights    = 1u;
+		constexpr size_t g_sm_omni_lights = 2u;
+		constexpr size_t g_sm_spot_lights = 3u;
+
+		/**
+		 The minimum ratio of the near z to the far z of the slices. This keeps
+		 the exponentially distributed slices finite for projections with a
+		 near plane at (or behind) the camera.
+		 */
+		constexpr F32 g_min_near_far_ratio = 1e-4f;
+
+		/**
+		 Returns a bitmask containing the sign bits of the four components of
+		 the given comparison result.
+
+		 @param[in]		control
+						The comparison result.
+		 @return		A bitmask containing the sign bits of the four
+						components of @a control.
+		 */
+		[[nodiscard]]
+		inline U32 XM_CALLCONV GetMask(FXMVECTOR control) noexcept {
+			#if defined(_XM_SSE_INTRINSICS_)
+			return static_cast< U32 >(_mm_movemask_ps(control));
+			#else  // _XM_SSE_INTRINSICS_
+			return   (XMVectorGetIntX(control) & 1u)
+				   | ((XMVectorGetIntY(control) & 1u) << 1u)
+				   | ((XMVectorGetIntZ(control) & 1u) << 2u)
+				   | ((XMVectorGetIntW(control) & 1u) << 3u);
+			#endif // _XM_SSE_INTRINSICS_
+		}
+
+		/**
+		 Returns the offset and number of the lights of the given light type
+		 of the given light cluster buffer.
+
+		 @param[in]		buffer
+						A reference to the light cluster buffer.
+		 @param[in]		type
+						The light type.
+		 @return		A reference to the offset and number of the lights of
+						the given light type of the given light cluster buffer.
+		 */
+		[[nodiscard]]
+		inline U32x2& GetLights(LightClusterBuffer& buffer, size_t type) noexcept {
+			switch (type) {
+
+			case g_omni_lights:
+				return buffer.m_omni_lights;
+			case g_spot_lights:
+				return buffer.m_spot_lights;
+			case g_sm_omni_lights:
+				return buffer.m_sm_omni_lights;
+			default:
+				return buffer.m_sm_spot_lights;
+			}
+		}
+
+		/**
+		 Returns the point of the given line at the given camera-space z
+		 coordinate.
+
+		 @param[in]		p_near
+						The point of the line on the near plane expressed in
+						camera space.
+		 @param[in]		p_far
+						The point of the line on the far plane expressed in
+						camera space.
+		 @param[in]		z
+						The camera-space z coordinate.
+		 @return		The point of the given line at the given camera-space
+						z coordinate.
+		 */
+		[[nodiscard]]
+		inline const XMVECTOR XM_CALLCONV GetPoint(FXMVECTOR p_near,
+												   FXMVECTOR p_far,
+												   F32 z) noexcept {
+			const auto z_near = XMVectorGetZ(p_near);
+			const auto z_far  = XMVectorGetZ(p_far);
+			return XMVectorLerp(p_near, p_far, (z - z_near) / (z_far - z_near));
+		}
+	}
+
+	LightClusters::LightClusters(ID3D11Device& device, JobSystem& job_system)
+		: m_job_system(job_system),
+		m_world_lights(),
+		m_camera_lights(),
+		m_nb_lights{},
+		m_camera_to_projection{},
+		m_froxels(g_nb_clusters),
+		m_slice_z(g_nb_slices + 1u, 0.0f),
+		m_slices(g_nb_slices),
+		m_z_scale(0.0f),
+		m_z_bias(0.0f),
+		m_cluster_data(g_nb_clusters),
+		m_light_index_data(),
+		m_clusters(device, g_nb_clusters),
+		m_light_indices(device, 64u) {}
+
+	LightClusters::LightClusters(LightClusters&& clusters) noexcept = default;
+
+	LightClusters::~LightClusters() = default;
+
+	LightClusters& LightClusters
+		::operator=(LightClusters&& clusters) noexcept = default;
+
+	void LightClusters::Clear() noexcept {
+		for (size_t type = 0u; type < s_nb_light_types; ++type) {
+			m_world_lights[type].clear();
+			m_nb_lights[type] = 0u;
+		}
+	}
+
+	[[nodiscard]]
+	std::pair< LightClusters::LightBlock&, size_t > LightClusters
+		::AddLight(size_t type) {
+
+		auto& blocks = m_world_lights[type];
+		const auto lane = m_nb_lights[type] & 3u;
+		if (0u == lane) {
+			blocks.emplace_back();
+		}
+
+		++m_nb_lights[type];
+
+		return { blocks.back(), lane };
+	}
+
+	void XM_CALLCONV LightClusters::AddOmniLight(FXMVECTOR p_world,
+												 F32 range,
+												 bool shadow_mapped) {
+
+		auto [block, lane]
+			= AddLight(shadow_mapped ? g_sm_omni_lights : g_omni_lights);
+
+		block.m_p_x[lane]       = XMVectorGetX(p_world);
+		block.m_p_y[lane]       = XMVectorGetY(p_world);
+		block.m_p_z[lane]       = XMVectorGetZ(p_world);
+		block.m_range[lane]     = range;
+		block.m_d_x[lane]       = 0.0f;
+		block.m_d_y[lane]       = 0.0f;
+		block.m_d_z[lane]       = 0.0f;
+		block.m_cos_umbra[lane] = -1.0f;
+		block.m_sin_umbra[lane] = 0.0f;
+	}
+
+	void XM_CALLCONV LightClusters::AddSpotLight(FXMVECTOR p_world,
+												 FXMVECTOR d_world,
+												 F32 range,
+												 F32 cos_umbra,
+												 bool shadow_mapped) {
+
+		auto [block, lane]
+			= AddLight(shadow_mapped ? g_sm_spot_lights : g_spot_lights);
+
+		block.m_p_x[lane]       = XMVectorGetX(p_world);
+		block.m_p_y[lane]       = XMVectorGetY(p_world);
+		block.m_p_z[lane]       = XMVectorGetZ(p_world);
+		block.m_range[lane]     = range;
+		block.m_d_x[lane]       = XMVectorGetX(d_world);
+		block.m_d_y[lane]       = XMVectorGetY(d_world);
+		block.m_d_z[lane]       = XMVectorGetZ(d_world);
+		block.m_cos_umbra[lane] = cos_umbra;
+		block.m_sin_umbra[lane] = std::sqrt(std::max(1.0f - cos_umbra * cos_umbra,
+													 0.0f));
+	}
+
+	void XM_CALLCONV LightClusters::Update(ID3D11DeviceContext& device_context,
+										   FXMMATRIX world_to_camera,
+										   CXMMATRIX camera_to_projection) {
+
+		// The froxels only change if the projection changes.
+		const bool cached
+			=  XMVector4Equal(camera_to_projection.r[0], m_camera_to_projection.r[0])
+			&& XMVector4Equal(camera_to_projection.r[1], m_camera_to_projection.r[1])
+			&& XMVector4Equal(camera_to_projection.r[2], m_camera_to_projection.r[2])
+			&& XMVector4Equal(camera_to_projection.r[3], m_camera_to_projection.r[3]);
+		if (!cached) {
+			SetupFroxels(camera_to_projection);
+			m_camera_to_projection = camera_to_projection;
+		}
+
+		TransformLights(world_to_camera);
+
+		// Assign the lights to the froxels of each slice in parallel.
+		m_job_system.get().ParallelFor(0u, g_nb_slices,
+			[this](size_t first, size_t last) {
+
+			for (auto index = first; index < last; ++index) {
+				AssignLights(index);
+			}
+		});
+
+		// Concatenate the light index lists of the slices.
+		m_light_index_data.clear();
+		for (size_t index = 0u; index < g_nb_slices; ++index) {
+			const auto& slice  = m_slices[index];
+			const auto  base   = static_cast< U32 >(m_light_index_data.size());
+			const auto  first  = m_cluster_data.begin()
+				               + index * g_nb_clusters_per_slice;
+
+			std::for_each(first, first + g_nb_clusters_per_slice,
+				[base](LightClusterBuffer& buffer) noexcept {
+					buffer.m_omni_lights[0u]    += base;
+					buffer.m_spot_lights[0u]    += base;
+					buffer.m_sm_omni_lights[0u] += base;
+					buffer.m_sm_spot_lights[0u] += base;
+				});
+
+			m_light_index_data.insert(m_light_index_data.end(),
+									  slice.m_light_indices.cbegin(),
+									  slice.m_light_indices.cend());
+		}
+
+		// Update the buffers.
+		m_clusters.UpdateData(device_context, m_cluster_data);
+		m_light_indices.UpdateData(device_context, m_light_index_data);
+	}
+
+	void XM_CALLCONV LightClusters::SetupFroxels(FXMMATRIX camera_to_projection) {
+		const auto projection_to_camera
+			= XMMatrixInverse(nullptr, camera_to_projection);
+
+		// Obtain the near and far z of the view frustum.
+		const auto p_near = XMVector3TransformCoord(
+			XMVectorSet(0.0f, 0.0f, Z_NEAR, 1.0f), projection_to_camera);
+		const auto p_far  = XMVector3TransformCoord(
+			XMVectorSet(0.0f, 0.0f, Z_FAR,  1.0f), projection_to_camera);
+		const auto z_far  = XMVectorGetZ(p_far);
+		const auto z_near = std::max(XMVectorGetZ(p_near),
+									 z_far * g_min_near_far_ratio);
+
+		// Distribute the slices exponentially between the near and far z:
+		// slice = log2(z) * scale + bias.
+		const auto log2_ratio = std::log2(z_far / z_near);
+		m_z_scale = g_nb_slices / log2_ratio;
+		m_z_bias  = -std::log2(z_near) * m_z_scale;
+
+		// The first slice also contains the positions in front of the near z.
+		m_slice_z[0u] = 0.0f;
+		for (size_t k = 1u; k <= g_nb_slices; ++k) {
+			m_slice_z[k] = std::exp2((k - m_z_bias) / m_z_scale);
+		}
+
+		// Obtain the lines through the corners of the tiles.
+		XMVECTOR p_near_corners[(g_nb_tiles_x + 1u) * (g_nb_tiles_y + 1u)];
+		XMVECTOR p_far_corners[ (g_nb_tiles_x + 1u) * (g_nb_tiles_y + 1u)];
+		for (size_t j = 0u, corner = 0u; j <= g_nb_tiles_y; ++j) {
+			for (size_t i = 0u; i <= g_nb_tiles_x; ++i, ++corner) {
+				const auto x = -1.0f + (2.0f * i) / g_nb_tiles_x;
+				const auto y =  1.0f - (2.0f * j) / g_nb_tiles_y;
+				p_near_corners[corner] = XMVector3TransformCoord(
+					XMVectorSet(x, y, Z_NEAR, 1.0f), projection_to_camera);
+				p_far_corners[corner]  = XMVector3TransformCoord(
+					XMVectorSet(x, y, Z_FAR,  1.0f), projection_to_camera);
+			}
+		}
+
+		// Compute the AABBs and bounding spheres of the froxels.
+		auto froxel = m_froxels.begin();
+		for (size_t k = 0u; k < g_nb_slices; ++k) {
+			const F32 z[] = { m_slice_z[k], m_slice_z[k + 1u] };
+
+			for (size_t j = 0u; j < g_nb_tiles_y; ++j) {
+				for (size_t i = 0u; i < g_nb_tiles_x; ++i, ++froxel) {
+					const size_t corners[] = {
+						 j       * (g_nb_tiles_x + 1u) + i,
+						 j       * (g_nb_tiles_x + 1u) + i + 1u,
+						(j + 1u) * (g_nb_tiles_x + 1u) + i,
+						(j + 1u) * (g_nb_tiles_x + 1u) + i + 1u
+					};
+
+					auto p_min = g_XMInfinity.v;
+					auto p_max = g_XMNegInfinity.v;
+					for (const auto corner : corners) {
+						for (const auto z_corner : z) {
+							const auto p = GetPoint(p_near_corners[corner],
+													p_far_corners[corner],
+													z_corner);
+							p_min = XMVectorMin(p_min, p);
+							p_max = XMVectorMax(p_max, p);
+						}
+					}
+
+					const auto center = 0.5f * (p_min + p_max);
+					const auto radius = XMVector3Length(0.5f * (p_max - p_min));
+					froxel->m_min    = p_min;
+					froxel->m_max    = p_max;
+					froxel->m_sphere = XMVectorSelect(radius, center,
+													  g_XMSelect1110);
+				}
+			}
+		}
+	}
+
+	void XM_CALLCONV LightClusters::TransformLights(FXMMATRIX world_to_camera) {
+		// Splat the matrix components once.
+		XMVECTOR r_x[4];
+		XMVECTOR r_y[4];
+		XMVECTOR r_z[4];
+		for (size_t i = 0u; i < 4u; ++i) {
+			r_x[i] = XMVectorSplatX(world_to_camera.r[i]);
+			r_y[i] = XMVectorSplatY(world_to_camera.r[i]);
+			r_z[i] = XMVectorSplatZ(world_to_camera.r[i]);
+		}
+
+		for (size_t type = 0u; type < s_nb_light_types; ++type) {
+			const auto& world_blocks  = m_world_lights[type];
+			auto&       camera_blocks = m_camera_lights[type];
+			camera_blocks.resize(world_blocks.size());
+
+			for (size_t i = 0u; i < world_blocks.size(); ++i) {
+				const auto& src = world_blocks[i];
+				auto&       dst = camera_blocks[i];
+
+				const auto p_x = XMLoad(src.m_p_x);
+				const auto p_y = XMLoad(src.m_p_y);
+				const auto p_z = XMLoad(src.m_p_z);
+				const auto d_x = XMLoad(src.m_d_x);
+				const auto d_y = XMLoad(src.m_d_y);
+				const auto d_z = XMLoad(src.m_d_z);
+
+				// p' = p_x r0 + p_y r1 + p_z r2 + r3
+				dst.m_p_x = XMStore< F32x4A >(XMVectorMultiplyAdd(p_z, r_x[2],
+					XMVectorMultiplyAdd(p_y, r_x[1],
+					XMVectorMultiplyAdd(p_x, r_x[0], r_x[3]))));
+				dst.m_p_y = XMStore< F32x4A >(XMVectorMultiplyAdd(p_z, r_y[2],
+					XMVectorMultiplyAdd(p_y, r_y[1],
+					XMVectorMultiplyAdd(p_x, r_y[0], r_y[3]))));
+				dst.m_p_z = XMStore< F32x4A >(XMVectorMultiplyAdd(p_z, r_z[2],
+					XMVectorMultiplyAdd(p_y, r_z[1],
+					XMVectorMultiplyAdd(p_x, r_z[0], r_z[3]))));
+
+				// d' = d_x r0 + d_y r1 + d_z r2
+				dst.m_d_x = XMStore< F32x4A >(XMVectorMultiplyAdd(d_z, r_x[2],
+					XMVectorMultiplyAdd(d_y, r_x[1], d_x * r_x[0])));
+				dst.m_d_y = XMStore< F32x4A >(XMVectorMultiplyAdd(d_z, r_y[2],
+					XMVectorMultiplyAdd(d_y, r_y[1], d_x * r_y[0])));
+				dst.m_d_z = XMStore< F32x4A >(XMVectorMultiplyAdd(d_z, r_z[2],
+					XMVectorMultiplyAdd(d_y, r_z[1], d_x * r_z[0])));
+
+				dst.m_range     = src.m_range;
+				dst.m_cos_umbra = src.m_cos_umbra;
+				dst.m_sin_umbra = src.m_sin_umbra;
+			}
+		}
+	}
+
+	void LightClusters::AssignLights(size_t index) {
+		auto& slice = m_slices[index];
+		slice.m_light_indices.clear();
+
+		// Select the lights overlapping the slice along the z axis.
+		const auto z_min = XMVectorReplicate(m_slice_z[index]);
+		const auto z_max = XMVectorReplicate(m_slice_z[index + 1u]);
+		for (size_t type = 0u; type < s_nb_light_types; ++type) {
+			const auto& blocks = m_camera_lights[type];
+			auto&       masks  = slice.m_masks[type];
+			masks.clear();
+
+			for (size_t i = 0u; i < blocks.size(); ++i) {
+				const auto p_z   = XMLoad(blocks[i].m_p_z);
+				const auto range = XMLoad(blocks[i].m_range);
+				const auto outside = XMVectorOrInt(
+					XMVectorLess(p_z + range, z_min),
+					XMVectorGreater(p_z - range, z_max));
+
+				const auto count = std::min(m_nb_lights[type] - 4u * i, size_t(4u));
+				masks.push_back(~GetMask(outside) & ((1u << count) - 1u));
+			}
+		}
+
+		const auto first = index * g_nb_clusters_per_slice;
+		for (size_t i = 0u; i < g_nb_clusters_per_slice; ++i) {
+			const auto& froxel  = m_froxels[first + i];
+			auto&       cluster = m_cluster_data[first + i];
+
+			// Splat the froxel components once per froxel.
+			const auto min_x = XMVectorSplatX(froxel.m_min);
+			const auto min_y = XMVectorSplatY(froxel.m_min);
+			const auto min_z = XMVectorSplatZ(froxel.m_min);
+			const auto max_x = XMVectorSplatX(froxel.m_max);
+			const auto max_y = XMVectorSplatY(froxel.m_max);
+			const auto max_z = XMVectorSplatZ(froxel.m_max);
+			const auto c_x   = XMVectorSplatX(froxel.m_sphere);
+			const auto c_y   = XMVectorSplatY(froxel.m_sphere);
+			const auto c_z   = XMVectorSplatZ(froxel.m_sphere);
+			const auto r     = XMVectorSplatW(froxel.m_sphere);
+
+			for (size_t type = 0u; type < s_nb_light_types; ++type) {
+				const auto& blocks = m_camera_lights[type];
+				const auto& masks  = slice.m_masks[type];
+				const bool  cone   = (g_spot_lights    == type)
+					              || (g_sm_spot_lights == type);
+				const auto  offset = slice.m_light_indices.size();
+
+				for (size_t j = 0u; j < blocks.size(); ++j) {
+					if (0u == masks[j]) {
+						continue;
+					}
+
+					const auto& block = blocks[j];
+					const auto p_x   = XMLoad(block.m_p_x);
+					const auto p_y   = XMLoad(block.m_p_y);
+					const auto p_z   = XMLoad(block.m_p_z);
+					const auto range = XMLoad(block.m_range);
+
+					// Test the bounding spheres of the lights against the
+					// AABB of the froxel.
+					const auto e_x = XMVectorMax(XMVectorMax(min_x - p_x, p_x - max_x), g_XMZero);
+					const auto e_y = XMVectorMax(XMVectorMax(min_y - p_y, p_y - max_y), g_XMZero);
+					const auto e_z = XMVectorMax(XMVectorMax(min_z - p_z, p_z - max_z), g_XMZero);
+					const auto sqr_distance = XMVectorMultiplyAdd(e_z, e_z,
+						XMVectorMultiplyAdd(e_y, e_y, e_x * e_x));
+					auto hit = XMVectorLessOrEqual(sqr_distance, range * range);
+
+					if (cone) {
+						// Test the cones of the lights against the bounding
+						// sphere of the froxel.
+						const auto d_x = XMLoad(block.m_d_x);
+						const auto d_y = XMLoad(block.m_d_y);
+						const auto d_z = XMLoad(block.m_d_z);
+						const auto v_x = c_x - p_x;
+						const auto v_y = c_y - p_y;
+						const auto v_z = c_z - p_z;
+
+						const auto sqr_v  = XMVectorMultiplyAdd(v_z, v_z,
+							XMVectorMultiplyAdd(v_y, v_y, v_x * v_x));
+						const auto v_d    = XMVectorMultiplyAdd(v_z, d_z,
+							XMVectorMultiplyAdd(v_y, d_y, v_x * d_x));
+						const auto v_perp = XMVectorSqrt(XMVectorMax(
+							sqr_v - v_d * v_d, g_XMZero));
+						const auto distance = XMLoad(block.m_cos_umbra) * v_perp
+							                - XMLoad(block.m_sin_umbra) * v_d;
+
+						const auto culled = XMVectorOrInt(
+							XMVectorGreater(distance, r), XMVectorOrInt(
+							XMVectorGreater(v_d, r + range),
+							XMVectorLess(v_d, -r)));
+						hit = XMVectorAndCInt(hit, culled);
+					}
+
+					// Append the indices of the overlapping lights.
+					const auto lanes = GetMask(hit) & masks[j];
+					for (U32 lane = 0u; lane < 4u; ++lane) {
+						if (lanes & (1u << lane)) {
+							slice.m_light_indices.push_back(
+								static_cast< U32 >(4u * j + lane));
+						}
+					}
+				}
+
+				auto& lights = GetLights(cluster, type);
+				lights[0u] = static_cast< U32 >(offset);
+				lights[1u] = static_cast< U32 >(slice.m_light_indices.size() - offset);
+			}
+		}
+	}
+}
\ No newline at end of file
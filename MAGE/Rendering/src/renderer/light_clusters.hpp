@@ -0,0 +1,438 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\structured_buffer.hpp"
+#include "renderer\buffer\light_buffer.hpp"
+#include "parallel\job_system.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of light clusters.
+
+	 Light clusters slice the view frustum into froxels: a grid of screen
+	 tiles along the x and y axis and exponentially distributed depth slices
+	 along the z axis. The bounding spheres of the omni lights and the cones
+	 of the spotlights are tested against the froxels (four lights at a time,
+	 one depth slice per job), resulting in a compact light index list per
+	 froxel. The shaders only iterate the lights of the froxel containing
+	 the shaded position.
+	 */
+	class LightClusters {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs light clusters.
+
+		 @param[in]		device
+						A reference to the device.
+		 @param[in]		job_system
+						A reference to the job system.
+		 */
+		explicit LightClusters(ID3D11Device& device, JobSystem& job_system);
+
+		/**
+		 Constructs light clusters from the given light clusters.
+
+		 @param[in]		clusters
+						A reference to the light clusters to copy.
+		 */
+		LightClusters(const LightClusters& clusters) = delete;
+
+		/**
+		 Constructs light clusters by moving the given light clusters.
+
+		 @param[in]		clusters
+						A reference to the light clusters to move.
+		 */
+		LightClusters(LightClusters&& clusters) noexcept;
+
+		/**
+		 Destructs these light clusters.
+		 */
+		~LightClusters();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given light clusters to these light clusters.
+
+		 @param[in]		clusters
+						A reference to the light clusters to copy.
+		 @return		A reference to the copy of the given light clusters
+						(i.e. these light clusters).
+		 */
+		LightClusters& operator=(const LightClusters& clusters) = delete;
+
+		/**
+		 Moves the given light clusters to these light clusters.
+
+		 @param[in]		clusters
+						A reference to the light clusters to move.
+		 @return		A reference to the moved light clusters (i.e. these
+						light clusters).
+		 */
+		LightClusters& operator=(LightClusters&& clusters) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Removes all lights from these light clusters.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Adds an omni light to these light clusters. The omni lights must be
+		 added in the order of the (shadow mapped) omni light buffer.
+
+		 @param[in]		p_world
+						The position of the omni light expressed in world
+						space.
+		 @param[in]		range
+						The range of the omni light expressed in world space.
+		 @param[in]		shadow_mapped
+						@c true if the omni light is shadow mapped. @c false
+						otherwise.
+		 */
+		void XM_CALLCONV AddOmniLight(FXMVECTOR p_world,
+									  F32 range,
+									  bool shadow_mapped);
+
+		/**
+		 Adds a spotlight to these light clusters. The spotlights must be
+		 added in the order of the (shadow mapped) spotlight buffer.
+
+		 @param[in]		p_world
+						The position of the spotlight expressed in world
+						space.
+		 @param[in]		d_world
+						The (normalized) direction of the spotlight expressed
+						in world space.
+		 @param[in]		range
+						The range of the spotlight expressed in world space.
+		 @param[in]		cos_umbra
+						The cosine of the umbra angle of the spotlight.
+		 @param[in]		shadow_mapped
+						@c true if the spotlight is shadow mapped. @c false
+						otherwise.
+		 */
+		void XM_CALLCONV AddSpotLight(FXMVECTOR p_world,
+									  FXMVECTOR d_world,
+									  F32 range,
+									  F32 cos_umbra,
+									  bool shadow_mapped);
+
+		/**
+		 Assigns the lights of these light clusters to the froxels of the
+		 given camera and updates the light cluster and light index buffers.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @throws		Exception
+						Failed to update the buffers.
+		 */
+		void XM_CALLCONV Update(ID3D11DeviceContext& device_context,
+								FXMMATRIX world_to_camera,
+								CXMMATRIX camera_to_projection);
+
+		/**
+		 Returns the scale of the (base-2) logarithm of the camera-space z
+		 coordinate to obtain the slice of these light clusters.
+
+		 @return		The scale of the (base-2) logarithm of the
+						camera-space z coordinate to obtain the slice of these
+						light clusters.
+		 */
+		[[nodiscard]]
+		F32 GetZScale() const noexcept {
+			return m_z_scale;
+		}
+
+		/**
+		 Returns the bias of the (base-2) logarithm of the camera-space z
+		 coordinate to obtain the slice of these light clusters.
+
+		 @return		The bias of the (base-2) logarithm of the
+						camera-space z coordinate to obtain the slice of these
+						light clusters.
+		 */
+		[[nodiscard]]
+		F32 GetZBias() const noexcept {
+			return m_z_bias;
+		}
+
+		/**
+		 Returns the shader resource view of the light cluster buffer of these
+		 light clusters.
+
+		 @return		A reference to the shader resource view of the light
+						cluster buffer of these light clusters.
+		 */
+		[[nodiscard]]
+		ID3D11ShaderResourceView& GetClusters() const noexcept {
+			return m_clusters.Get();
+		}
+
+		/**
+		 Returns the shader resource view of the light index buffer of these
+		 light clusters.
+
+		 @return		A reference to the shader resource view of the light
+						index buffer of these light clusters.
+		 */
+		[[nodiscard]]
+		ID3D11ShaderResourceView& GetLightIndices() const noexcept {
+			return m_light_indices.Get();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of blocks of four lights in SoA layout.
+		 */
+		struct alignas(16) LightBlock {
+
+			/**
+			 The x coordinates of the positions of the lights of this block.
+			 */
+			F32x4A m_p_x;
+
+			/**
+			 The y coordinates of the positions of the lights of this block.
+			 */
+			F32x4A m_p_y;
+
+			/**
+			 The z coordinates of the positions of the lights of this block.
+			 */
+			F32x4A m_p_z;
+
+			/**
+			 The ranges of the lights of this block.
+			 */
+			F32x4A m_range;
+
+			/**
+			 The x coordinates of the directions of the lights of this block.
+			 */
+			F32x4A m_d_x;
+
+			/**
+			 The y coordinates of the directions of the lights of this block.
+			 */
+			F32x4A m_d_y;
+
+			/**
+			 The z coordinates of the directions of the lights of this block.
+			 */
+			F32x4A m_d_z;
+
+			/**
+			 The cosines of the umbra angles of the lights of this block.
+			 */
+			F32x4A m_cos_umbra;
+
+			/**
+			 The sines of the umbra angles of the lights of this block.
+			 */
+			F32x4A m_sin_umbra;
+		};
+
+		/**
+		 A struct of froxels expressed in camera space.
+		 */
+		struct alignas(16) Froxel {
+
+			/**
+			 The minimum point of the AABB of this froxel.
+			 */
+			XMVECTOR m_min;
+
+			/**
+			 The maximum point of the AABB of this froxel.
+			 */
+			XMVECTOR m_max;
+
+			/**
+			 The bounding sphere (center and radius) of this froxel.
+			 */
+			XMVECTOR m_sphere;
+		};
+
+		/**
+		 A struct of slices of light clusters.
+		 */
+		struct Slice {
+
+			/**
+			 The masks of the light blocks overlapping this slice for each
+			 light type.
+			 */
+			std::vector< U32 > m_masks[4];
+
+			/**
+			 The light index list of this slice.
+			 */
+			std::vector< U32 > m_light_indices;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of light types (omni lights, spotlights, shadow mapped omni
+		 lights and shadow mapped spotlights) of light clusters.
+		 */
+		static constexpr size_t s_nb_light_types = 4u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds a light to the given light type.
+
+		 @param[in]		type
+						The light type.
+		 @return		A pair containing a reference to the light block and
+						the lane of the added light.
+		 */
+		[[nodiscard]]
+		std::pair< LightBlock&, size_t > AddLight(size_t type);
+
+		/**
+		 Computes the froxels of the given camera-to-projection transformation
+		 matrix.
+
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 */
+		void XM_CALLCONV SetupFroxels(FXMMATRIX camera_to_projection);
+
+		/**
+		 Transforms the lights of these light clusters to camera space.
+
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 */
+		void XM_CALLCONV TransformLights(FXMMATRIX world_to_camera);
+
+		/**
+		 Assigns the lights of these light clusters to the froxels of the
+		 given slice.
+
+		 @param[in]		index
+						The index of the slice.
+		 */
+		void AssignLights(size_t index);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the job system of these light clusters.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
+		/**
+		 The light blocks of these light clusters for each light type. The
+		 lights are expressed in world space until they are transformed to
+		 camera space.
+		 */
+		AlignedVector< LightBlock > m_world_lights[s_nb_light_types];
+
+		/**
+		 The light blocks of these light clusters for each light type
+		 expressed in camera space.
+		 */
+		AlignedVector< LightBlock > m_camera_lights[s_nb_light_types];
+
+		/**
+		 The number of lights of these light clusters for each light type.
+		 */
+		size_t m_nb_lights[s_nb_light_types];
+
+		/**
+		 The camera-to-projection transformation matrix of the froxels of
+		 these light clusters.
+		 */
+		XMMATRIX m_camera_to_projection;
+
+		/**
+		 The froxels of these light clusters.
+		 */
+		AlignedVector< Froxel > m_froxels;
+
+		/**
+		 The camera-space z coordinates of the boundaries of the slices of
+		 these light clusters.
+		 */
+		std::vector< F32 > m_slice_z;
+
+		/**
+		 The slices of these light clusters.
+		 */
+		std::vector< Slice > m_slices;
+
+		/**
+		 The scale of the (base-2) logarithm of the camera-space z coordinate
+		 to obtain the slice of these light clusters.
+		 */
+		F32 m_z_scale;
+
+		/**
+		 The bias of the (base-2) logarithm of the camera-space z coordinate
+		 to obtain the slice of these light clusters.
+		 */
+		F32 m_z_bias;
+
+		/**
+		 The light cluster data of these light clusters.
+		 */
+		std::vector< LightClusterBuffer > m_cluster_data;
+
+		/**
+		 The light index list of these light clusters.
+		 */
+		std::vector< U32 > m_light_index_data;
+
+		/**
+		 The light cluster buffer of these light clusters.
+		 */
+		StructuredBuffer< LightClusterBuffer > m_clusters;
+
+		/**
+		 The light index buffer of these light clusters.
+		 */
+		StructuredBuffer< U32 > m_light_indices;
+	};
+}
\ No newline at end of file
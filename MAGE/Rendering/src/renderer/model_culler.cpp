@@ -0,0 +1,55 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\model_culler.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	ModelCuller::ModelCuller()
+		: m_models(),
+		m_volumes(),
+		m_indices() {}
+
+	ModelCuller::ModelCuller(ModelCuller&& culler) noexcept = default;
+
+	ModelCuller::~ModelCuller() = default;
+
+	ModelCuller& ModelCuller::operator=(ModelCuller&& culler) noexcept = default;
+
+	void ModelCuller::Update(const World& world) {
+		m_models.clear();
+		m_volumes.clear();
+
+		world.ForEach< Model >([this](const Model& model) {
+			if (State::Active != model.GetState()) {
+				return;
+			}
+
+			const auto& transform       = model.GetOwner()->GetTransform();
+			const auto  object_to_world = transform.GetObjectToWorldMatrix();
+
+			m_volumes.Add(model.GetAABB(), object_to_world);
+			m_models.push_back(&model);
+		});
+	}
+
+	void XM_CALLCONV ModelCuller::Cull(FXMMATRIX world_to_projection,
+									   std::vector< const Model* >& models) {
+
+		const BoundingFrustum frustum(world_to_projection);
+		m_volumes.Cull(frustum, m_indices);
+
+		models.clear();
+		models.reserve(m_indices.size());
+		for (const auto index : m_indices) {
+			models.push_back(m_models[index]);
+		}
+	}
+}
\ No newline at end of file
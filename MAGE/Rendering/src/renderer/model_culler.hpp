@@ -0,0 +1,134 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\rendering_world.hpp"
+#include "geometry\bounding_volume_batch.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of model cullers.
+
+	 A model culler gathers the active models of a world together with their
+	 world-space AABBs once per frame, and culls them against the bounding
+	 frustum of each view (camera, light camera or voxel grid) in batches.
+	 */
+	class ModelCuller {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a model culler.
+		 */
+		ModelCuller();
+
+		/**
+		 Constructs a model culler from the given model culler.
+
+		 @param[in]		culler
+						A reference to the model culler to copy.
+		 */
+		ModelCuller(const ModelCuller& culler) = delete;
+
+		/**
+		 Constructs a model culler by moving the given model culler.
+
+		 @param[in]		culler
+						A reference to the model culler to move.
+		 */
+		ModelCuller(ModelCuller&& culler) noexcept;
+
+		/**
+		 Destructs this model culler.
+		 */
+		~ModelCuller();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given model culler to this model culler.
+
+		 @param[in]		culler
+						A reference to the model culler to copy.
+		 @return		A reference to the copy of the given model culler (i.e.
+						this model culler).
+		 */
+		ModelCuller& operator=(const ModelCuller& culler) = delete;
+
+		/**
+		 Moves the given model culler to this model culler.
+
+		 @param[in]		culler
+						A reference to the model culler to move.
+		 @return		A reference to the moved model culler (i.e. this model
+						culler).
+		 */
+		ModelCuller& operator=(ModelCuller&& culler) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Gathers the active models of the given world and their world-space
+		 AABBs.
+
+		 @pre			The transforms of the given world are resolved.
+		 @param[in]		world
+						A reference to the world.
+		 */
+		void Update(const World& world);
+
+		/**
+		 Culls the gathered models against the bounding frustum of the given
+		 world-to-projection transformation matrix.
+
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix.
+		 @param[out]	models
+						A reference to the vector which will contain the
+						visible models in world order. Any previous contents
+						are discarded.
+		 */
+		void XM_CALLCONV Cull(FXMMATRIX world_to_projection,
+							  std::vector< const Model* >& models);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing pointers to the active models of this model
+		 culler.
+		 */
+		std::vector< const Model* > m_models;
+
+		/**
+		 The world-space AABBs of the active models of this model culler.
+		 */
+		BoundingVolumeBatch m_volumes;
+
+		/**
+		 A vector containing the indices of the visible models of this model
+		 culler.
+		 */
+		std::vector< U32 > m_indices;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\parallel_command_recorder.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	ParallelCommandRecorder::ParallelCommandRecorder(JobSystem& job_system)
+		: m_job_system(job_system),
+		m_chunk_commands(),
+		m_commands() {}
+
+	ParallelCommandRecorder::ParallelCommandRecorder(
+		ParallelCommandRecorder&& recorder) noexcept = default;
+
+	ParallelCommandRecorder::~ParallelCommandRecorder() = default;
+
+	ParallelCommandRecorder& ParallelCommandRecorder
+		::operator=(ParallelCommandRecorder&& recorder) noexcept = default;
+}
\ No newline at end of file
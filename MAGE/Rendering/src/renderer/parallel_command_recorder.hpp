@@ -0,0 +1,162 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.hpp"
+#include "renderer\command_list.hpp"
+#include "renderer\pipeline_state_filter.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of parallel command recorders.
+
+	 A parallel command recorder splits a sequence of items (e.g., instance
+	 batches) into chunks of consecutive items. Each chunk is recorded by a
+	 job of a job system into its own command list with its own pipeline
+	 state filter. The command lists of the chunks are appended in order
+	 afterwards, such that the resulting command list is identical to
+	 recording all items sequentially (apart from the binds which are not
+	 filtered across chunk boundaries).
+	 */
+	class ParallelCommandRecorder {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a parallel command recorder.
+
+		 @param[in]		job_system
+						A reference to the job system.
+		 */
+		explicit ParallelCommandRecorder(JobSystem& job_system);
+
+		/**
+		 Constructs a parallel command recorder from the given parallel
+		 command recorder.
+
+		 @param[in]		recorder
+						A reference to the parallel command recorder to copy.
+		 */
+		ParallelCommandRecorder(const ParallelCommandRecorder& recorder) = delete;
+
+		/**
+		 Constructs a parallel command recorder by moving the given parallel
+		 command recorder.
+
+		 @param[in]		recorder
+						A reference to the parallel command recorder to move.
+		 */
+		ParallelCommandRecorder(ParallelCommandRecorder&& recorder) noexcept;
+
+		/**
+		 Destructs this parallel command recorder.
+		 */
+		~ParallelCommandRecorder();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given parallel command recorder to this parallel command
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the parallel command recorder to copy.
+		 @return		A reference to the copy of the given parallel command
+						recorder (i.e. this parallel command recorder).
+		 */
+		ParallelCommandRecorder& operator=(
+			const ParallelCommandRecorder& recorder) = delete;
+
+		/**
+		 Moves the given parallel command recorder to this parallel command
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the parallel command recorder to move.
+		 @return		A reference to the moved parallel command recorder
+						(i.e. this parallel command recorder).
+		 */
+		ParallelCommandRecorder& operator=(
+			ParallelCommandRecorder&& recorder) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given number of items in parallel.
+
+		 @pre			The given record function can be called concurrently
+						for different items.
+		 @tparam		RecordT
+						The record function type.
+		 @param[in]		nb_items
+						The number of items.
+		 @param[in]		record
+						The record function which is called with the index of
+						an item, a reference to a pipeline state filter and a
+						reference to a command list.
+		 @return		A reference to the command list containing the
+						commands of all items (in order). The command list
+						remains valid until the next call to @c Record.
+		 */
+		template< typename RecordT >
+		const CommandList& Record(size_t nb_items, const RecordT& record);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The minimum number of items per chunk.
+		 */
+		static constexpr size_t s_min_chunk_size = 16u;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the job system of this parallel command recorder.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
+		/**
+		 The command lists of the chunks of this parallel command recorder.
+		 Their memory is reused across records.
+		 */
+		std::vector< CommandList > m_chunk_commands;
+
+		/**
+		 The command list containing the commands of all chunks of this
+		 parallel command recorder. Its memory is reused across records.
+		 */
+		CommandList m_commands;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\parallel_command_recorder.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename RecordT >
+	const CommandList& ParallelCommandRecorder
+		::Record(size_t nb_items, const RecordT& record) {
+
+		m_commands.Clear();
+
+		auto& job_system = m_job_system.get();
+		const auto max_nb_chunks = 4u * job_system.GetNumberOfThreads();
+		const auto chunk_size    = std::max(
+			(nb_items + max_nb_chunks - 1u) / max_nb_chunks, s_min_chunk_size);
+		const auto nb_chunks     = (nb_items + chunk_size - 1u) / chunk_size;
+
+		// A single chunk is recorded directly.
+		if (nb_chunks <= 1u) {
+			PipelineStateFilter filter;
+			for (size_t item = 0u; item < nb_items; ++item) {
+				record(item, filter, m_commands);
+			}
+			return m_commands;
+		}
+
+		if (m_chunk_commands.size() < nb_chunks) {
+			m_chunk_commands.resize(nb_chunks);
+		}
+
+		job_system.ParallelFor(0u, nb_chunks, 
+			[this, nb_items, chunk_size, &record](size_t first, size_t last) {
+			
+			for (auto chunk = first; chunk < last; ++chunk) {
+				auto& commands = m_chunk_commands[chunk];
+				commands.Clear();
+
+				PipelineStateFilter filter;
+				const auto item_first = chunk * chunk_size;
+				const auto item_last  = std::min(item_first + chunk_size, 
+												 nb_items);
+				for (auto item = item_first; item < item_last; ++item) {
+					record(item, filter, commands);
+				}
+			}
+		}, 1u);
+
+		// Append the chunks in order.
+		for (size_t chunk = 0u; chunk < nb_chunks; ++chunk) {
+			m_commands.Append(m_chunk_commands[chunk]);
+		}
+
+		return m_commands;
+	}
+}
\ No newline at end of file
@@ -18,10 +18,11 @@ namespace mage::rendering {
 
 	DeferredPass::DeferredPass(ID3D11DeviceContext& device_context,
 							   StateManager& state_manager,
-							   ResourceManager& resource_manager)
+							   ResourceManager& resource_manager,
+							   ShaderPermutations& shader_permutations)
 		: m_device_context(device_context),
 		m_state_manager(state_manager), 
-		m_resource_manager(resource_manager),
+		m_shader_permutations(shader_permutations),
 		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)) {}
 
 	DeferredPass::DeferredPass(DeferredPass&& pass) noexcept = default;
@@ -57,9 +58,9 @@ namespace mage::rendering {
 		// Binds the fixed state.
 		BindFixedState();
 
-		const auto ps = CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+		const auto& ps = m_shader_permutations.get().GetDeferredMSAAPS(brdf, vct);
 		// PS: Bind the pixel shader.
-		ps->BindShader(m_device_context);
+		ps.BindShader(m_device_context);
 		
 		// Draw the fullscreen triangle.
 		Pipeline::Draw(m_device_context, 3u, 0u);
@@ -68,9 +69,9 @@ namespace mage::rendering {
 	void DeferredPass::Dispatch(const U32x2& viewport_size,
 								BRDF brdf, bool vct) {
 		
-		const auto cs = CreateDeferredCS(m_resource_manager, brdf, vct);
+		const auto& cs = m_shader_permutations.get().GetDeferredCS(brdf, vct);
 		// CS: Bind the compute shader.
-		cs->BindShader(m_device_context);
+		cs.BindShader(m_device_context);
 		
 		// Dispatch the pass.
 		const auto nb_groups_x = GetNumberOfGroups(viewport_size[0],
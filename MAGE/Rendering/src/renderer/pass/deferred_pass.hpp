@@ -6,6 +6,7 @@
 #pragma region
 
 #include "renderer\configuration.hpp"
+#include "renderer\shader_permutations.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
 
@@ -37,10 +38,13 @@ namespace mage::rendering {
 						A reference to the state manager.
 		 @param[in]		resource_manager
 						A reference to the resource manager.
+		 @param[in]		shader_permutations
+						A reference to the shader permutation table.
 		 */
 		explicit DeferredPass(ID3D11DeviceContext& device_context, 
 							  StateManager& state_manager, 
-							  ResourceManager& resource_manager);
+							  ResourceManager& resource_manager, 
+							  ShaderPermutations& shader_permutations);
 
 		/**
 		 Constructs a deferred pass from the given deferred shading pass.
@@ -145,9 +149,9 @@ namespace mage::rendering {
 		std::reference_wrapper< StateManager > m_state_manager;
 
 		/**
-		 A reference to the resource manager of this deferred pass.
+		 A reference to the shader permutation table of this deferred pass.
 		 */
-		std::reference_wrapper< ResourceManager > m_resource_manager;
+		std::reference_wrapper< ShaderPermutations > m_shader_permutations;
 
 		/**
 		 A pointer to the vertex shader of this deferred pass.
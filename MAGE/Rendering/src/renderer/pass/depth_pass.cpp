@@ -19,13 +19,20 @@ namespace mage::rendering {
 	DepthPass::DepthPass(ID3D11Device& device,
 						 ID3D11DeviceContext& device_context,
 						 StateManager& state_manager,
-						 ResourceManager& resource_manager)
+						 ResourceManager& resource_manager, 
+						 JobSystem& job_system)
 		: m_device_context(device_context),
 		m_state_manager(state_manager), 
-		m_opaque_vs(CreateDepthVS(resource_manager)),
-		m_transparent_vs(CreateDepthTransparentVS(resource_manager)),
+		m_opaque_vs(CreateDepthInstancedVS(resource_manager)),
+		m_opaque_quantized_vs(CreateDepthQuantizedInstancedVS(resource_manager)),
+		m_transparent_vs(CreateDepthTransparentInstancedVS(resource_manager)),
+		m_transparent_quantized_vs(
+			CreateDepthTransparentQuantizedInstancedVS(resource_manager)),
 		m_transparent_ps(CreateDepthTransparentPS(resource_manager)),
-		m_camera_buffer(device) {}
+		m_camera_buffer(device),
+		m_instance_buffer(device), 
+		m_recorder(job_system), 
+		m_executor(device_context) {}
 
 	DepthPass::DepthPass(DepthPass&& pass) noexcept = default;
 
@@ -34,15 +41,11 @@ namespace mage::rendering {
 	DepthPass& DepthPass::operator=(DepthPass&& pass) noexcept = default;
 
 	void DepthPass::BindOpaqueShaders() const noexcept {
-		// Bind the vertex shader.
-		m_opaque_vs->BindShader(m_device_context);
 		// Bind no pixel shader.
 		Pipeline::PS::BindShader(m_device_context, nullptr);
 	}
 
 	void DepthPass::BindTransparentShaders() const noexcept {
-		// Bind the vertex shader.
-		m_transparent_vs->BindShader(m_device_context);
 		// Bind the pixel shader.
 		m_transparent_ps->BindShader(m_device_context);
 	}
@@ -80,60 +83,18 @@ namespace mage::rendering {
 											 SLOT_CBUFFER_SECONDARY_CAMERA);
 	}
 
-	void XM_CALLCONV DepthPass::Render(const World& world, 
+	void XM_CALLCONV DepthPass::Render(const DrawLists& lists, 
 									   FXMMATRIX world_to_camera, 
 									   CXMMATRIX camera_to_projection) {
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
-		const auto world_to_projection = world_to_camera * camera_to_projection;
-
-		//---------------------------------------------------------------------
-		// All opaque models.
-		//---------------------------------------------------------------------
-
-		// Bind the shaders.
-		BindOpaqueShaders();
-
-		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| model.GetMaterial().IsTransparant()) {
-				return;
-			}
-			
-			RenderOpaque(model, world_to_projection);
+		// Update and bind the instances of all models.
+		m_instance_buffer.UpdateData(m_device_context, {
+			lists.GetDepthOpaqueModels(), 
+			lists.GetDepthTransparentModels()
 		});
-
-		//---------------------------------------------------------------------
-		// All transparent models.
-		//---------------------------------------------------------------------
-
-		// Bind the shaders.
-		BindTransparentShaders();
-
-		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			
-			const auto& material = model.GetMaterial();
-			
-			if (State::Active != model.GetState()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-			
-			RenderTransparent(model, world_to_projection);
-		});
-	}
-
-	void XM_CALLCONV DepthPass::RenderOccluders(const World& world, 
-												FXMMATRIX world_to_camera, 
-												CXMMATRIX camera_to_projection) {
-		// Bind the projection data.
-		BindCamera(world_to_camera, camera_to_projection);
-
-		const auto world_to_projection = world_to_camera * camera_to_projection;
+		m_instance_buffer.Bind(m_device_context);
 
 		//---------------------------------------------------------------------
 		// All opaque models.
@@ -142,16 +103,17 @@ namespace mage::rendering {
 		// Bind the shaders.
 		BindOpaqueShaders();
 
-		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
-				|| model.GetMaterial().IsTransparant()) {
-				return;
-			}
-			
-			RenderOpaque(model, world_to_projection);
-		});
+		// Record the opaque instance batches in parallel and execute them.
+		const auto opaque_batches = m_instance_buffer.GetBatches(0u);
+		const auto& opaque_commands = m_recorder.Record(
+			static_cast< size_t >(opaque_batches.size()), 
+			[this, opaque_batches](size_t index, 
+								   PipelineStateFilter& filter, 
+								   CommandList& commands) {
+				RecordOpaque(opaque_batches[static_cast< std::ptrdiff_t >(index)], 
+							 filter, commands);
+			});
+		m_executor.Execute(opaque_commands);
 
 		//---------------------------------------------------------------------
 		// All transparent models.
@@ -160,63 +122,58 @@ namespace mage::rendering {
 		// Bind the shaders.
 		BindTransparentShaders();
 
-		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			
-			const auto& material = model.GetMaterial();
-			
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-			
-			RenderTransparent(model, world_to_projection);
-		});
+		// Record the transparent instance batches in parallel and execute 
+		// them.
+		const auto transparent_batches = m_instance_buffer.GetBatches(1u);
+		const auto& transparent_commands = m_recorder.Record(
+			static_cast< size_t >(transparent_batches.size()), 
+			[this, transparent_batches](size_t index, 
+										PipelineStateFilter& filter, 
+										CommandList& commands) {
+				RecordTransparent(
+					transparent_batches[static_cast< std::ptrdiff_t >(index)], 
+					filter, commands);
+			});
+		m_executor.Execute(transparent_commands);
 	}
 
-	void XM_CALLCONV DepthPass::RenderOpaque(const Model& model,
-											 FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) { 
-			return;
-		}
+	void DepthPass::RecordOpaque(const InstanceBatch& batch, 
+								 PipelineStateFilter& filter, 
+								 CommandList& commands) const {
+		const auto& model = *batch.m_model;
+		const auto& mesh  = *model.GetMesh();
 
-		// Bind the constant buffer of the model.
-		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
+		// Bind the vertex shader matching the vertices of the mesh.
+		filter.BindShader(commands, mesh.IsQuantized() ? *m_opaque_quantized_vs 
+			                                           : *m_opaque_vs);
 		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
-		// Draw the model.
-		model.Draw(m_device_context);
+		filter.BindMesh(commands, mesh);
+		// Draw the instances.
+		model.DrawInstanced(commands, 
+							batch.m_start_instance, batch.m_nb_instances, 
+							batch.m_lod);
 	}
 
-	void XM_CALLCONV DepthPass::RenderTransparent(const Model& model,
-												  FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) { 
-			return;
-		}
-
-		// Bind the constant buffer of the model.
-		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
-		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
+	void DepthPass::RecordTransparent(const InstanceBatch& batch, 
+									  PipelineStateFilter& filter, 
+									  CommandList& commands) const {
+		const auto& model = *batch.m_model;
+		const auto& mesh  = *model.GetMesh();
+
+		// Bind the vertex shader matching the vertices of the mesh.
+		filter.BindShader(commands, mesh.IsQuantized() ? *m_transparent_quantized_vs 
+			                                           : *m_transparent_vs);
+		// Bind the constant buffer of the first model for the material 
+		// coefficients. The transforms are obtained from the instances.
+		model.BindBuffer< Pipeline::PS >(commands, SLOT_CBUFFER_MODEL);
 		// Bind the SRV of the model.
-		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_BASE_COLOR, 
-							  model.GetMaterial().GetBaseColorSRV());
+		ID3D11ShaderResourceView* const srv = model.GetMaterial().GetBaseColorSRV();
+		filter.BindPSSRVs(commands, SLOT_SRV_BASE_COLOR, 1u, &srv);
 		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
-		// Draw the model.
-		model.Draw(m_device_context);
+		filter.BindMesh(commands, mesh);
+		// Draw the instances.
+		model.DrawInstanced(commands, 
+							batch.m_start_instance, batch.m_nb_instances, 
+							batch.m_lod);
 	}
 }
\ No newline at end of file
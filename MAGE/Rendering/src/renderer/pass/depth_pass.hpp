@@ -5,6 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\buffer\instance_buffer.hpp"
+#include "renderer\command_executor.hpp"
+#include "renderer\draw_lists.hpp"
+#include "renderer\parallel_command_recorder.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
@@ -38,11 +42,15 @@ namespace mage::rendering {
 						A reference to the state manager.
 		 @param[in]		resource_manager
 						A reference to the resource manager.
+		 @param[in]		job_system
+						A reference to the job system for recording the 
+						instance batches.
 		 */
 		explicit DepthPass(ID3D11Device& device, 
 						   ID3D11DeviceContext& device_context, 
 						   StateManager& state_manager, 
-						   ResourceManager& resource_manager);
+						   ResourceManager& resource_manager, 
+						   JobSystem& job_system);
 
 		/**
 		 Constructs a depth pass from the given depth pass.
@@ -102,37 +110,21 @@ namespace mage::rendering {
 		void BindFixedState() const noexcept;
 
 		/**
-		 Renders the world.
+		 Renders the depth models of the given draw lists.
 
-		 @param[in]		world
-						A reference to the world.
+		 @param[in]		lists
+						A reference to the draw lists.
 		 @param[in]		world_to_camera
 						The world-to-camera transformation matrix.
 		 @param[in]		camera_to_projection
 						The camera-to-projection transformation matrix.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV Render(const World& world,
+		void XM_CALLCONV Render(const DrawLists& lists,
 								FXMMATRIX world_to_camera,
 								CXMMATRIX camera_to_projection);
 
-		/**
-		 Renders the occluders of the world.
-
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_camera
-						The world-to-camera transformation matrix.
-		 @param[in]		camera_to_projection
-						The camera-to-projection transformation matrix.
-		 @throws		Exception
-						Failed to render the world.
-		 */
-		void XM_CALLCONV RenderOccluders(const World& world,
-										 FXMMATRIX world_to_camera,
-										 CXMMATRIX camera_to_projection);
-
 	private:
 
 		//---------------------------------------------------------------------
@@ -140,12 +132,14 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Binds the shaders for opaque models.
+		 Binds the shaders for opaque models. The vertex shader depends on the
+		 mesh and is recorded per instance batch.
 		 */
 		void BindOpaqueShaders() const noexcept;
 		
 		/**
-		 Binds the shaders for transparent models.
+		 Binds the shaders for transparent models. The vertex shader depends 
+		 on the mesh and is recorded per instance batch.
 		 */
 		void BindTransparentShaders() const noexcept;
 
@@ -163,26 +157,38 @@ namespace mage::rendering {
 									CXMMATRIX camera_to_projection);
 
 		/**
-		 Renders the given opaque model.
-
-		 @param[in]		model
-						A reference to the opaque model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 Records rendering the given opaque instance batch. Different instance
+		 batches can be recorded concurrently.
+
+		 @pre			The instance buffer of this depth pass is bound when 
+						the given command list is executed.
+		 @param[in]		batch
+						A reference to the opaque instance batch.
+		 @param[in]		filter
+						A reference to the pipeline state filter.
+		 @param[in]		commands
+						A reference to the command list.
 		 */
-		void XM_CALLCONV RenderOpaque(const Model& model, 
-									  FXMMATRIX world_to_projection) const noexcept;
+		void RecordOpaque(const InstanceBatch& batch, 
+						  PipelineStateFilter& filter, 
+						  CommandList& commands) const;
 
 		/**
-		 Renders the given transparent model.
-
-		 @param[in]		model
-						A reference to the transparent model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 Records rendering the given transparent instance batch. Different 
+		 instance batches can be recorded concurrently.
+
+		 @pre			The instance buffer of this depth pass is bound when 
+						the given command list is executed.
+		 @param[in]		batch
+						A reference to the transparent instance batch.
+		 @param[in]		filter
+						A reference to the pipeline state filter.
+		 @param[in]		commands
+						A reference to the command list.
 		 */
-		void XM_CALLCONV RenderTransparent(const Model& model, 
-										   FXMMATRIX world_to_projection) const noexcept;
+		void RecordTransparent(const InstanceBatch& batch, 
+							   PipelineStateFilter& filter, 
+							   CommandList& commands) const;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -203,12 +209,24 @@ namespace mage::rendering {
 		 */
 		VertexShaderPtr m_opaque_vs;
 
+		/**
+		 A pointer to the vertex shader for quantized meshes of this depth 
+		 pass.
+		 */
+		VertexShaderPtr m_opaque_quantized_vs;
+
 		/**
 		 A pointer to the vertex shader for transparent models
 		 of this depth pass.
 		 */
 		VertexShaderPtr m_transparent_vs;
 
+		/**
+		 A pointer to the vertex shader for transparent models with quantized
+		 meshes of this depth pass.
+		 */
+		VertexShaderPtr m_transparent_quantized_vs;
+
 		/**
 		 A pointer to the pixel shader for transparent models
 		 of this depth pass.
@@ -219,5 +237,21 @@ namespace mage::rendering {
 		 The camera buffer of this depth pass.
 		 */
 		ConstantBuffer< SecondaryCameraBuffer > m_camera_buffer;
+
+		/**
+		 The instance buffer of this depth pass.
+		 */
+		InstanceBuffer m_instance_buffer;
+
+		/**
+		 The command recorder of this depth pass for recording the instance 
+		 batches in parallel.
+		 */
+		ParallelCommandRecorder m_recorder;
+
+		/**
+		 The command executor of this depth pass.
+		 */
+		D3D11CommandExecutor m_executor;
 	};
 }
\ No newline at end of file
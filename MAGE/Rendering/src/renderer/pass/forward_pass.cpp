@@ -20,13 +20,19 @@ namespace mage::rendering {
 	ForwardPass::ForwardPass(ID3D11Device& device,
 							 ID3D11DeviceContext& device_context,
 							 StateManager& state_manager,
-							 ResourceManager& resource_manager)
+							 ResourceManager& resource_manager,
+							 ShaderPermutations& shader_permutations, 
+							 JobSystem& job_system)
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
-		m_resource_manager(resource_manager),
-		m_vs(CreateTransformVS(resource_manager)),
+		m_shader_permutations(shader_permutations),
+		m_vs(CreateTransformInstancedVS(resource_manager)),
+		m_quantized_vs(CreateTransformQuantizedInstancedVS(resource_manager)),
 		m_uv(CreateReferenceTexture(resource_manager)),
-		m_color_buffer(device) {}
+		m_color_buffer(device),
+		m_instance_buffer(device), 
+		m_recorder(job_system), 
+		m_executor(device_context) {}
 
 	ForwardPass::ForwardPass(ForwardPass&& pass) noexcept = default;
 
@@ -35,8 +41,6 @@ namespace mage::rendering {
 	ForwardPass& ForwardPass::operator=(ForwardPass&& pass) noexcept = default;
 
 	void ForwardPass::BindFixedOpaqueState() const noexcept {
-		// VS: Bind the vertex shader.
-		m_vs->BindShader(m_device_context);
 		// HS: Bind the hull shader.
 		Pipeline::HS::BindShader(m_device_context, nullptr);
 		// DS: Bind the domain shader.
@@ -60,8 +64,6 @@ namespace mage::rendering {
 	}
 
 	void ForwardPass::BindFixedTransparentState() const noexcept {
-		// VS: Bind the vertex shader.
-		m_vs->BindShader(m_device_context);
 		// HS: Bind the hull shader.
 		Pipeline::HS::BindShader(m_device_context, nullptr);
 		// DS: Bind the domain shader.
@@ -85,8 +87,6 @@ namespace mage::rendering {
 	}
 
 	void ForwardPass::BindFixedWireframeState() const noexcept {
-		// VS: Bind the vertex shader.
-		m_vs->BindShader(m_device_context);
 		// HS: Bind the hull shader.
 		Pipeline::HS::BindShader(m_device_context, nullptr);
 		// DS: Bind the domain shader.
@@ -116,93 +116,68 @@ namespace mage::rendering {
 		m_color_buffer.Bind< Pipeline::PS >(m_device_context, SLOT_CBUFFER_COLOR);
 	}
 
-	void XM_CALLCONV ForwardPass::Render(const World& world, 
-										 FXMMATRIX world_to_projection, 
-										 BRDF brdf, bool vct) const {
+	void ForwardPass::Render(const DrawLists& lists, 
+							 BRDF brdf, bool vct) const {
+		PipelineStateFilter filter;
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
 		constexpr bool transparency = false;
+
+		// Update and bind the instances of all models.
+		m_instance_buffer.UpdateData(m_device_context, {
+			lists.GetEmissiveModels(), 
+			lists.GetOpaqueModels(false), 
+			lists.GetOpaqueModels(true)
+		});
+		m_instance_buffer.Bind(m_device_context);
 		
 		//---------------------------------------------------------------------
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager, 
-															  transparency);
+			const auto& ps = m_shader_permutations.get()
+				.GetForwardEmissivePS(transparency);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(m_instance_buffer.GetBatches(0u));
 
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager, 
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = m_shader_permutations.get()
+				.GetForwardPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(m_instance_buffer.GetBatches(1u));
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager, 
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = m_shader_permutations.get()
+				.GetForwardPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(m_instance_buffer.GetBatches(2u));
 	}
 
-	void XM_CALLCONV ForwardPass::RenderSolid(const World& world, 
-											  FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderSolid(const DrawLists& lists) const {
+		PipelineStateFilter filter;
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -210,79 +185,58 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardSolidPS(m_resource_manager);
+			const auto& ps = m_shader_permutations.get().GetForwardSolidPS();
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(lists.GetModels());
 	}
 
-	void XM_CALLCONV ForwardPass::RenderGBuffer(const World& world, 
-												FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderGBuffer(const DrawLists& lists) const {
+		PipelineStateFilter filter;
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
+
+		// Update and bind the instances of all models.
+		m_instance_buffer.UpdateData(m_device_context, {
+			lists.GetOpaqueModels(false), 
+			lists.GetOpaqueModels(true)
+		});
+		m_instance_buffer.Bind(m_device_context);
 		
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const auto& ps = m_shader_permutations.get().GetGBufferPS(tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(m_instance_buffer.GetBatches(0u));
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const auto& ps = m_shader_permutations.get().GetGBufferPS(tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(m_instance_buffer.GetBatches(1u));
 	}
 
-	void XM_CALLCONV ForwardPass::RenderEmissive(const World& world, 
-												 FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderEmissive(const DrawLists& lists) const {
+		PipelineStateFilter filter;
+
 		constexpr bool transparency = false;
 
 		// Bind the fixed opaque state.
@@ -292,119 +246,65 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager, 
-															  transparency);
+			const auto& ps = m_shader_permutations.get()
+				.GetForwardEmissivePS(transparency);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(lists.GetEmissiveModels());
 	}
 
-	void XM_CALLCONV ForwardPass::RenderTransparent(const World& world, 
-													FXMMATRIX world_to_projection, 
-													BRDF brdf, 
-													bool vct) const {
+	void ForwardPass::RenderTransparent(const DrawLists& lists, 
+										BRDF brdf, 
+										bool vct) const {
 		// Bind the fixed transparent state.
 		BindFixedTransparentState();
 
 		constexpr bool transparency = true;
-		
-		//---------------------------------------------------------------------
-		// All transparent emissive models.
-		//---------------------------------------------------------------------
-		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager, 
-															  transparency);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
 
-		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
-
-		//---------------------------------------------------------------------
-		// All transparent models with no TSNM.
-		//---------------------------------------------------------------------
-		{
-			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager, 
-													  brdf, transparency, vct, tsnm);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
-
-		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
-
-		//---------------------------------------------------------------------
-		// All transparent models with TSNM.
-		//---------------------------------------------------------------------
-		{
-			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager, 
-													  brdf, transparency, vct, tsnm);
-			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
-		}
-
-		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
+		// The transparent models are sorted back-to-front, so the pixel 
+		// shader is only rebound whenever the next model needs another one.
+		auto& permutations = m_shader_permutations.get();
+		const PixelShader* const pss[] = {
+			// All transparent emissive models.
+			&permutations.GetForwardEmissivePS(transparency),
+			// All transparent models with no TSNM.
+			&permutations.GetForwardPS(brdf, transparency, vct, false),
+			// All transparent models with TSNM.
+			&permutations.GetForwardPS(brdf, transparency, vct, true)
+		};
 
-			Render(model, world_to_projection);
-		});
+		// Update and bind the instances.
+		const auto& batches 
+			= m_instance_buffer.UpdateData(m_device_context, 
+										   lists.GetTransparentModels());
+		m_instance_buffer.Bind(m_device_context);
+
+		// Record the instance batches in parallel and execute them.
+		const auto& batch_commands = m_recorder.Record(batches.size(), 
+			[this, &batches, &pss](size_t index, 
+								   PipelineStateFilter& filter, 
+								   CommandList& commands) {
+
+				const auto& batch    = batches[index];
+				const auto& material = batch.m_model->GetMaterial();
+				const auto  ps_index = material.IsEmissive() ? 0u
+					                 : (nullptr == material.GetNormalSRV() ? 1u : 2u);
+
+				// PS: Bind the pixel shader.
+				filter.BindShader(commands, *pss[ps_index]);
+
+				Record(batch, filter, commands);
+			});
+		m_executor.Execute(batch_commands);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderFalseColor(const World& world, 
-												   FXMMATRIX world_to_projection, 
-												   FalseColor false_color) const {
+	void ForwardPass::RenderFalseColor(const DrawLists& lists, 
+									   FalseColor false_color) const {
+		PipelineStateFilter filter;
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -416,24 +316,19 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateFalseColorPS(m_resource_manager, 
-														 false_color);
+			const auto& ps = m_shader_permutations.get()
+				.GetFalseColorPS(false_color);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(lists.GetModels());
 	}
 
-	void XM_CALLCONV ForwardPass::RenderWireframe(const World& world, 
-												  FXMMATRIX world_to_projection) {
+	void ForwardPass::RenderWireframe(const DrawLists& lists) {
+		PipelineStateFilter filter;
+
 		// Bind the fixed opaque state.
 		BindFixedWireframeState();
 
@@ -445,39 +340,51 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateFalseColorPS(m_resource_manager, 
-														 FalseColor::ConstantColor);
+			const auto& ps = m_shader_permutations.get()
+				.GetFalseColorPS(FalseColor::ConstantColor);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(lists.GetModels());
 	}
 
-	void XM_CALLCONV ForwardPass::Render(const Model& model, 
-										 FXMMATRIX world_to_projection) const noexcept {
+	void ForwardPass::Render(const std::vector< ModelDraw >& draws) const {
+		// Update and bind the instances.
+		m_instance_buffer.UpdateData(m_device_context, draws);
+		m_instance_buffer.Bind(m_device_context);
 
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
+		Render(m_instance_buffer.GetBatches(0u));
+	}
 
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) { 
-			return;
-		}
+	void ForwardPass::Render(gsl::span< const InstanceBatch > batches) const {
+		// Record the instance batches in parallel and execute them.
+		const auto& batch_commands = m_recorder.Record(
+			static_cast< size_t >(batches.size()), 
+			[this, batches](size_t index, 
+							PipelineStateFilter& filter, 
+							CommandList& commands) {
+				Record(batches[static_cast< std::ptrdiff_t >(index)], 
+					   filter, commands);
+			});
+		m_executor.Execute(batch_commands);
+	}
+
+	void ForwardPass::Record(const InstanceBatch& batch, 
+							 PipelineStateFilter& filter, 
+							 CommandList& commands) const {
 
-		const auto& material             = model.GetMaterial();
+		const auto& model    = *batch.m_model;
+		const auto& mesh     = *model.GetMesh();
+		const auto& material = model.GetMaterial();
 
-		// Bind the constant buffer of the model.
-		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
-		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
+		// VS: Bind the vertex shader matching the vertices of the mesh.
+		filter.BindShader(commands, mesh.IsQuantized() ? *m_quantized_vs 
+			                                           : *m_vs);
+		// Bind the constant buffer of the first model for the material 
+		// coefficients. The transforms are obtained from the instances.
+		model.BindBuffer< Pipeline::PS >(commands, SLOT_CBUFFER_MODEL);
 		// Bind the SRVs of the model.
 		static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
 		static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
@@ -486,11 +393,13 @@ namespace mage::rendering {
 			material.GetMaterialSRV(),
 			material.GetNormalSRV()
 		};
-		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR, 
-							   static_cast< U32 >(std::size(srvs)), srvs);
+		filter.BindPSSRVs(commands, SLOT_SRV_BASE_COLOR, 
+						  static_cast< U32 >(std::size(srvs)), srvs);
 		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
-		// Draw the model.
-		model.Draw(m_device_context);
+		filter.BindMesh(commands, mesh);
+		// Draw the instances.
+		model.DrawInstanced(commands, 
+							batch.m_start_instance, batch.m_nb_instances, 
+							batch.m_lod);
 	}
 }
\ No newline at end of file
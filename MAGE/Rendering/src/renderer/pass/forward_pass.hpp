@@ -5,7 +5,12 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\buffer\instance_buffer.hpp"
 #include "renderer\configuration.hpp"
+#include "renderer\command_executor.hpp"
+#include "renderer\draw_lists.hpp"
+#include "renderer\parallel_command_recorder.hpp"
+#include "renderer\shader_permutations.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
@@ -39,11 +44,18 @@ namespace mage::rendering {
 						A reference to the state manager.
 		 @param[in]		resource_manager
 						A reference to the resource manager.
+		 @param[in]		shader_permutations
+						A reference to the shader permutation table.
+		 @param[in]		job_system
+						A reference to the job system for recording the 
+						instance batches.
 		 */
 		explicit ForwardPass(ID3D11Device& device, 
 							 ID3D11DeviceContext& device_context, 
 							 StateManager& state_manager, 
-							 ResourceManager& resource_manager);
+							 ResourceManager& resource_manager, 
+							 ShaderPermutations& shader_permutations, 
+							 JobSystem& job_system);
 
 		/**
 		 Constructs a forward pass from the given variable shading 
@@ -97,110 +109,88 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the given world.
+		 Renders the opaque models of the given draw lists.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		lists
+						A reference to the draw lists.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
 						@c true if voxel cone tracing should be enabled. @c false 
 						otherwise.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV Render(const World& world,
-								FXMMATRIX world_to_projection,
-								BRDF brdf, bool vct) const;
+		void Render(const DrawLists& lists, BRDF brdf, bool vct) const;
 
 		/**
-		 Renders the given world as solid.
+		 Renders the models of the given draw lists as solid.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		lists
+						A reference to the draw lists.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV RenderSolid(const World& world, 
-									 FXMMATRIX world_to_projection) const;
+		void RenderSolid(const DrawLists& lists) const;
 
 		/**
-		 Renders the given world to a GBuffer.
+		 Renders the opaque models of the given draw lists to a GBuffer.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		lists
+						A reference to the draw lists.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV RenderGBuffer(const World& world, 
-									   FXMMATRIX world_to_projection) const;
+		void RenderGBuffer(const DrawLists& lists) const;
 
 		/**
-		 Renders the emissive models of the given world.
+		 Renders the opaque emissive models of the given draw lists.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		lists
+						A reference to the draw lists.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV RenderEmissive(const World& world,
-										FXMMATRIX world_to_projection) const;
+		void RenderEmissive(const DrawLists& lists) const;
 
 		/**
-		 Renders the transparent models of the given world.
+		 Renders the transparent models of the given draw lists back-to-front.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		lists
+						A reference to the draw lists.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
 						@c true if voxel cone tracing should be enabled. @c false 
 						otherwise.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV RenderTransparent(const World& world,
-										   FXMMATRIX world_to_projection,
-										   BRDF brdf, bool vct) const;
+		void RenderTransparent(const DrawLists& lists, 
+							   BRDF brdf, bool vct) const;
 		
 		/**
-		 Renders the given world as a false color.
+		 Renders the models of the given draw lists as a false color.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		lists
+						A reference to the draw lists.
 		 @param[in]		false_color
 						The false color.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color) const;
+		void RenderFalseColor(const DrawLists& lists,
+							  FalseColor false_color) const;
 
 		/**
-		 Renders the given world as a wireframe.
+		 Renders the models of the given draw lists as a wireframe.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		lists
+						A reference to the draw lists.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV RenderWireframe(const World& world, 
-										 FXMMATRIX world_to_projection);
+		void RenderWireframe(const DrawLists& lists);
 
 	private:
 
@@ -209,7 +199,8 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Binds the fixed opaque state of this forward pass.
+		 Binds the fixed opaque state of this forward pass. The vertex shader 
+		 depends on the mesh and is bound per instance batch.
 		 */
 		void BindFixedOpaqueState() const noexcept;
 
@@ -234,15 +225,51 @@ namespace mage::rendering {
 		void BindColor(const RGBA& color);
 
 		/**
-		 Renders the given model.
+		 Renders the given model draws.
 
-		 @param[in]		model
-						A reference to the model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 Consecutive models sharing the same mesh, submesh, level of detail 
+		 and material are drawn with a single instanced draw call. The 
+		 instance batches are recorded in parallel.
+
+		 @pre			The pixel shader is bound.
+		 @param[in]		draws
+						A reference to a vector containing the model draws.
+		 @throws		Exception
+						Failed to update the instances.
+		 */
+		void Render(const std::vector< ModelDraw >& draws) const;
+
+		/**
+		 Renders the given instance batches.
+
+		 The instance batches are recorded in parallel.
+
+		 @pre			The pixel shader is bound.
+		 @pre			The instance buffer of this forward pass contains and 
+						binds the instances of the given instance batches.
+		 @param[in]		batches
+						The instance batches.
+		 @throws		Exception
+						Failed to render the instance batches.
+		 */
+		void Render(gsl::span< const InstanceBatch > batches) const;
+
+		/**
+		 Records rendering the given instance batch. Different instance 
+		 batches can be recorded concurrently.
+
+		 @pre			The instance buffer of this forward pass is bound when
+						the given command list is executed.
+		 @param[in]		batch
+						A reference to the instance batch.
+		 @param[in]		filter
+						A reference to the pipeline state filter.
+		 @param[in]		commands
+						A reference to the command list.
 		 */
-		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+		void Record(const InstanceBatch& batch, 
+					PipelineStateFilter& filter, 
+					CommandList& commands) const;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -259,15 +286,21 @@ namespace mage::rendering {
 		std::reference_wrapper< StateManager > m_state_manager;
 
 		/**
-		 A reference to the resource manager of this forward pass.
+		 A reference to the shader permutation table of this forward pass.
 		 */
-		std::reference_wrapper< ResourceManager > m_resource_manager;
+		std::reference_wrapper< ShaderPermutations > m_shader_permutations;
 
 		/**
 		 A pointer to the vertex shader of this forward pass.
 		 */
 		VertexShaderPtr m_vs;
 
+		/**
+		 A pointer to the vertex shader for quantized meshes of this forward 
+		 pass.
+		 */
+		VertexShaderPtr m_quantized_vs;
+
 		/**
 		 A pointer to the UV reference texture of this forward pass. 
 		 */
@@ -277,5 +310,21 @@ namespace mage::rendering {
 		 The color buffer of this forward pass.
 		 */
 		ConstantBuffer< RGBA > m_color_buffer;
+
+		/**
+		 The instance buffer of this forward pass.
+		 */
+		mutable InstanceBuffer m_instance_buffer;
+
+		/**
+		 The command recorder of this forward pass for recording the instance 
+		 batches in parallel.
+		 */
+		mutable ParallelCommandRecorder m_recorder;
+
+		/**
+		 The command executor of this forward pass.
+		 */
+		D3D11CommandExecutor m_executor;
 	};
 }
\ No newline at end of file
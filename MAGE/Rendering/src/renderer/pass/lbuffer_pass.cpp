@@ -15,11 +15,138 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 Combines the given hash value with the bytes of the given data.
+
+		 @tparam		T
+						The data type.
+		 @param[in]		hash
+						The hash value.
+		 @param[in]		data
+						A pointer to the data elements.
+		 @param[in]		count
+						The number of data elements.
+		 @return		The combined hash value.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		U64 HashCombine(U64 hash, const T* data, size_t count) noexcept {
+			static_assert(std::is_trivially_copyable_v< T >);
+
+			// FNV-1a
+			const auto bytes = reinterpret_cast< const U8* >(data);
+			for (size_t i = 0u; i < count * sizeof(T); ++i) {
+				hash ^= bytes[i];
+				hash *= 0x100000001B3ull;
+			}
+			return hash;
+		}
+
+		/**
+		 Returns the version of the given occluders.
+
+		 The version is independent of the order of the occluders and changes
+		 if an occluder is added, removed or moved.
+
+		 @param[in]		occluders
+						A reference to a vector containing the occluders.
+		 @return		The version of the given occluders.
+		 */
+		[[nodiscard]]
+		U64 GetOccludersVersion(const std::vector< const Model* >& occluders) noexcept {
+			U64 version = occluders.size();
+			for (const auto model : occluders) {
+				const auto& transform = model->GetOwner()->GetTransform();
+				U64 hash = static_cast< U64 >(reinterpret_cast< std::uintptr_t >(model));
+				hash ^= transform.GetVersion() + (model->OccludesLight() ? 1u : 0u);
+				hash *= 0x9E3779B97F4A7C15ull;
+				version += hash ^ (hash >> 32u);
+			}
+			return version;
+		}
+
+		/**
+		 Prepares the given shadow map infos for the given number of shadow
+		 maps.
+
+		 @param[in,out]	infos
+						A reference to the vector containing the shadow map
+						infos.
+		 @param[in]		nb_shadow_maps
+						The number of shadow maps.
+		 @param[in]		invalidate
+						@c true if all cached shadow maps must be invalidated.
+						@c false otherwise.
+		 */
+		template< typename InfoT >
+		void SetupShadowMapInfos(AlignedVector< InfoT >& infos, 
+								 size_t nb_shadow_maps, 
+								 bool invalidate) {
+			if (invalidate) {
+				infos.clear();
+			}
+
+			infos.resize(nb_shadow_maps, InfoT{ XMMatrixIdentity(), 0u, false });
+		}
+
+		[[nodiscard]]
+		inline const AABB& GetBoundingVolume(const DirectionalLight& light) noexcept {
+			return light.GetAABB();
+		}
+
+		[[nodiscard]]
+		inline const BoundingSphere& GetBoundingVolume(const OmniLight& light) noexcept {
+			return light.GetBoundingSphere();
+		}
+
+		[[nodiscard]]
+		inline const AABB& GetBoundingVolume(const SpotLight& light) noexcept {
+			return light.GetAABB();
+		}
+
+		template< typename LightT, typename ActionT >
+		void ForEachVisible(const World& world, 
+							const BoundingFrustum& frustum, 
+							FrameMemoryArena& frame_memory, 
+							BoundingVolumeBatch& volumes, 
+							std::vector< U32 >& indices, 
+							ActionT&& action) {
+
+			ArenaVector< const LightT* > lights(
+				frame_memory.GetAllocator< const LightT* >());
+			volumes.clear();
+
+			// Gather the active lights and their world-space bounding volumes.
+			world.ForEach< LightT >([&lights, &volumes](const LightT& light) {
+				if (State::Active != light.GetState()) {
+					return;
+				}
+
+				const auto& transform = light.GetOwner()->GetTransform();
+				volumes.Add(GetBoundingVolume(light), 
+							transform.GetObjectToWorldMatrix());
+				lights.push_back(&light);
+			});
+
+			// Cull the lights against the view frustum.
+			volumes.Cull(frustum, indices);
+
+			for (const auto index : indices) {
+				action(*lights[index]);
+			}
+		}
+	}
+
 	LBufferPass::LBufferPass(ID3D11Device& device,
 							 ID3D11DeviceContext& device_context,
 							 StateManager& state_manager,
-							 ResourceManager& resource_manager)
+							 ResourceManager& resource_manager,
+							 FrameMemoryArena& frame_memory, 
+							 JobSystem& job_system)
 		: m_device_context(device_context),
+		m_frame_memory(frame_memory),
 		m_light_buffer(device),
 		m_directional_lights(device, 3u),
 		m_omni_lights(device, 32u),
@@ -27,16 +154,27 @@ namespace mage::rendering {
 		m_sm_directional_lights(device, 1u),
 		m_sm_omni_lights(device, 1u),
 		m_sm_spot_lights(device, 1u),
+		m_light_clusters(device, job_system), 
 		m_directional_sms(MakeUnique< ShadowMapBuffer >(device, 1u)),
 		m_omni_sms(MakeUnique< ShadowCubeMapBuffer >(device, 1u)),
 		m_spot_sms(MakeUnique< ShadowMapBuffer >(device, 1u)),
 		m_directional_light_cameras(),
 		m_omni_light_cameras(),
 		m_spot_light_cameras(), 
+		m_directional_sm_infos(),
+		m_omni_sm_infos(),
+		m_spot_sm_infos(),
+		m_light_volumes(), 
+		m_visible_lights(), 
+		m_occluders(), 
+		m_occluder_lists(), 
 		m_depth_pass(MakeUnique< DepthPass >(device, 
 											 device_context,
 											 state_manager, 
-											 resource_manager)) {}
+											 resource_manager, 
+											 job_system)),
+		m_lights_hash(0u),
+		m_version(0u) {}
 
 	LBufferPass::LBufferPass(LBufferPass&& buffer) noexcept = default;
 	
@@ -46,23 +184,39 @@ namespace mage::rendering {
 
 	void XM_CALLCONV LBufferPass
 		::Render(const World& world, 
-				 FXMMATRIX world_to_projection) {
+				 ModelCuller& culler, 
+				 FXMMATRIX world_to_camera, 
+				 CXMMATRIX camera_to_projection) {
+
+		const BoundingFrustum frustum(world_to_camera * camera_to_projection);
+
+		const auto lights_hash = m_lights_hash;
+		m_lights_hash = 0xCBF29CE484222325ull;
 
 		// Process the lights.
-		ProcessDirectionalLights(world, world_to_projection);
-		ProcessOmniLights(world, world_to_projection);
-		ProcessSpotLights(world, world_to_projection);
+		m_light_clusters.Clear();
+		ProcessDirectionalLights(world, frustum);
+		ProcessOmniLights(world, frustum);
+		ProcessSpotLights(world, frustum);
+
+		// Assign the omni lights and spotlights to the light clusters.
+		m_light_clusters.Update(m_device_context, 
+								world_to_camera, camera_to_projection);
 		
 		// Unbind the shadow map SRVs.
 		UnbindShadowMaps();
 		// Setup the shadow maps.
 		SetupShadowMaps();
 		// Render the shadow maps.
-		RenderShadowMaps(world);
+		const bool shadow_maps_changed = RenderShadowMaps(culler);
 
 		// Process the lights' data.
 		ProcessLightsData(world);
 
+		if (shadow_maps_changed || lights_hash != m_lights_hash) {
+			++m_version;
+		}
+
 		// Bind the LBuffer.
 		BindLBuffer();
 	}
@@ -116,6 +270,16 @@ namespace mage::rendering {
 							   static_cast< U32 >(std::size(srvs)), srvs);
 		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_LIGHTS, 
 							   static_cast< U32 >(std::size(srvs)), srvs);
+
+		// Bind the light cluster SRVs.
+		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_LIGHT_INDEX_LIST, 
+							  &m_light_clusters.GetLightIndices());
+		Pipeline::CS::BindSRV(m_device_context, SLOT_SRV_LIGHT_INDEX_LIST, 
+							  &m_light_clusters.GetLightIndices());
+		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_LIGHT_CLUSTERS, 
+							  &m_light_clusters.GetClusters());
+		Pipeline::CS::BindSRV(m_device_context, SLOT_SRV_LIGHT_CLUSTERS, 
+							  &m_light_clusters.GetClusters());
 	}
 
 	void LBufferPass::ProcessLightsData(const World& world) {
@@ -137,38 +301,33 @@ namespace mage::rendering {
 		buffer.m_nb_sm_directional_lights = static_cast< U32 >(m_sm_directional_lights.size());
 		buffer.m_nb_sm_omni_lights        = static_cast< U32 >(m_sm_omni_lights.size());
 		buffer.m_nb_sm_spot_lights        = static_cast< U32 >(m_sm_spot_lights.size());
+		buffer.m_light_cluster_z_scale    = m_light_clusters.GetZScale();
+		buffer.m_light_cluster_z_bias     = m_light_clusters.GetZBias();
 
 		// Update the light buffer.
 		m_light_buffer.UpdateData(m_device_context, buffer);
+		m_lights_hash = HashCombine(m_lights_hash, &buffer, 1u);
 	}
 
-	void XM_CALLCONV LBufferPass
-		::ProcessDirectionalLights(const World& world, 
-								   FXMMATRIX world_to_projection) {
+	void LBufferPass::ProcessDirectionalLights(const World& world, 
+											   const BoundingFrustum& frustum) {
+
+		auto& frame_memory = m_frame_memory.get();
 
-		AlignedVector< DirectionalLightBuffer > lights;
+		ArenaVector< DirectionalLightBuffer > lights(
+			frame_memory.GetAllocator< DirectionalLightBuffer >());
 		lights.reserve(m_directional_lights.size());
 
-		AlignedVector< DirectionalLightBuffer > sm_lights;
+		ArenaVector< DirectionalLightBuffer > sm_lights(
+			frame_memory.GetAllocator< DirectionalLightBuffer >());
 		sm_lights.reserve(m_sm_directional_lights.size());
 		m_directional_light_cameras.clear();
 
 		// Process the directional lights.
-		world.ForEach< DirectionalLight >([this, &lights, &sm_lights, world_to_projection]
-		(const DirectionalLight& light) {
+		ForEachVisible< DirectionalLight >(world, frustum, frame_memory, m_light_volumes, m_visible_lights, 
+			[this, &lights, &sm_lights](const DirectionalLight& light) {
 
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
-
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
-				return;
-			}
+			const auto& transform = light.GetOwner()->GetTransform();
 
 			const auto  neg_d               = -transform.GetWorldAxisZ();
 			const auto world_to_light       = transform.GetWorldToObjectMatrix();
@@ -202,22 +361,27 @@ namespace mage::rendering {
 		// Update the buffers for directional lights.
 		m_directional_lights.UpdateData(m_device_context, lights);
 		m_sm_directional_lights.UpdateData(m_device_context, sm_lights);
+		m_lights_hash = HashCombine(m_lights_hash, lights.data(), lights.size());
+		m_lights_hash = HashCombine(m_lights_hash, sm_lights.data(), sm_lights.size());
 	}
 
-	void XM_CALLCONV LBufferPass
-		::ProcessOmniLights(const World& world, 
-							FXMMATRIX world_to_projection) {
+	void LBufferPass::ProcessOmniLights(const World& world, 
+										const BoundingFrustum& frustum) {
 		
-		AlignedVector< OmniLightBuffer > lights;
+		auto& frame_memory = m_frame_memory.get();
+
+		ArenaVector< OmniLightBuffer > lights(
+			frame_memory.GetAllocator< OmniLightBuffer >());
 		lights.reserve(m_omni_lights.size());
 
-		AlignedVector< ShadowMappedOmniLightBuffer > sm_lights;
+		ArenaVector< ShadowMappedOmniLightBuffer > sm_lights(
+			frame_memory.GetAllocator< ShadowMappedOmniLightBuffer >());
 		sm_lights.reserve(m_sm_omni_lights.size());
 		m_omni_light_cameras.clear();
 
 		// Process the omni lights.
-		world.ForEach< OmniLight >([this, &lights, &sm_lights, world_to_projection]
-		(const OmniLight& light) {
+		ForEachVisible< OmniLight >(world, frustum, frame_memory, m_light_volumes, m_visible_lights, 
+			[this, &lights, &sm_lights](const OmniLight& light) {
 			
 			static const XMMATRIX rotations[6] = {
 				XMMatrixRotationY(-XM_PIDIV2), // Look: +x
@@ -228,22 +392,14 @@ namespace mage::rendering {
 				XMMatrixRotationY(XM_PI),      // Look: -z
 			};
 
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
-
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetBoundingSphere())) {
-				return;
-			}
+			const auto& transform = light.GetOwner()->GetTransform();
 
 			const auto p     = transform.GetWorldOrigin();
 			const auto range = light.GetWorldRange();
 
+			// Add the omni light to the light clusters.
+			m_light_clusters.AddOmniLight(p, range, light.UseShadows());
+
 			if (light.UseShadows()) {
 				// Create six omni light cameras.
 				const auto world_to_light       = transform.GetWorldToObjectMatrix();
@@ -285,40 +441,39 @@ namespace mage::rendering {
 		// Update the buffers for omni lights.
 		m_omni_lights.UpdateData(m_device_context, lights);
 		m_sm_omni_lights.UpdateData(m_device_context, sm_lights);
+		m_lights_hash = HashCombine(m_lights_hash, lights.data(), lights.size());
+		m_lights_hash = HashCombine(m_lights_hash, sm_lights.data(), sm_lights.size());
 	}
 
-	void XM_CALLCONV LBufferPass
-		::ProcessSpotLights(const World& world, 
-							FXMMATRIX world_to_projection) {
+	void LBufferPass::ProcessSpotLights(const World& world, 
+										const BoundingFrustum& frustum) {
 		
-		AlignedVector< SpotLightBuffer > lights;
+		auto& frame_memory = m_frame_memory.get();
+
+		ArenaVector< SpotLightBuffer > lights(
+			frame_memory.GetAllocator< SpotLightBuffer >());
 		lights.reserve(m_spot_lights.size());
 
-		AlignedVector< ShadowMappedSpotLightBuffer > sm_lights;
+		ArenaVector< ShadowMappedSpotLightBuffer > sm_lights(
+			frame_memory.GetAllocator< ShadowMappedSpotLightBuffer >());
 		sm_lights.reserve(m_sm_spot_lights.size());
 		m_spot_light_cameras.clear();
 
 		// Process the spotlights.
-		world.ForEach< SpotLight >([this, &lights, &sm_lights, world_to_projection]
-		(const SpotLight& light) {
+		ForEachVisible< SpotLight >(world, frustum, frame_memory, m_light_volumes, m_visible_lights, 
+			[this, &lights, &sm_lights](const SpotLight& light) {
 			
-			if (State::Active != light.GetState()) {
-				return;
-			}
-
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
-
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
-				return;
-			}
+			const auto& transform = light.GetOwner()->GetTransform();
 
 			const auto p     =  transform.GetWorldOrigin();
 			const auto neg_d = -transform.GetWorldAxisZ();
 			const auto range =  light.GetWorldRange();
 
+			// Add the spotlight to the light clusters.
+			m_light_clusters.AddSpotLight(p, -neg_d, range, 
+										  light.GetEndAngularCutoff(), 
+										  light.UseShadows());
+
 			if (light.UseShadows()) {
 				const auto world_to_light       = transform.GetWorldToObjectMatrix();
 				const auto light_to_lprojection = light.GetLightToProjectionMatrix();
@@ -363,6 +518,8 @@ namespace mage::rendering {
 		// Update the buffers for spotlights.
 		m_spot_lights.UpdateData(m_device_context, lights);
 		m_sm_spot_lights.UpdateData(m_device_context, sm_lights);
+		m_lights_hash = HashCombine(m_lights_hash, lights.data(), lights.size());
+		m_lights_hash = HashCombine(m_lights_hash, sm_lights.data(), sm_lights.size());
 	}
 
 	void LBufferPass::SetupShadowMaps() {
@@ -371,14 +528,18 @@ namespace mage::rendering {
 			const auto nb_requested = m_sm_directional_lights.size();
 			const auto nb_available = m_directional_sms->GetNumberOfShadowMaps();
 
-			if (nb_available < nb_requested) {
+			const bool reallocate = (nb_available < nb_requested);
+			if (reallocate) {
 				ComPtr< ID3D11Device > device;
 				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
 				m_directional_sms = MakeUnique< ShadowMapBuffer >(*device.Get(), 
 																  nb_requested);
 			}
 
-			m_directional_sms->ClearDSVs(m_device_context);
+			// Cached shadow maps do not survive a reallocation.
+			SetupShadowMapInfos(m_directional_sm_infos, 
+								m_directional_sms->GetNumberOfShadowMaps(), 
+								reallocate);
 		}
 
 		// Setup the shadow maps for the omni lights.
@@ -386,14 +547,18 @@ namespace mage::rendering {
 			const auto nb_requested = m_sm_omni_lights.size();
 			const auto nb_available = m_omni_sms->GetNumberOfShadowCubeMaps();
 
-			if (nb_available < nb_requested) {
+			const bool reallocate = (nb_available < nb_requested);
+			if (reallocate) {
 				ComPtr< ID3D11Device > device;
 				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
 				m_omni_sms = MakeUnique< ShadowCubeMapBuffer >(*device.Get(), 
 															   nb_requested);
 			}
 
-			m_omni_sms->ClearDSVs(m_device_context);
+			// Cached shadow maps do not survive a reallocation.
+			SetupShadowMapInfos(m_omni_sm_infos, 
+								m_omni_sms->GetNumberOfShadowMaps(), 
+								reallocate);
 		}
 
 		// Setup the shadow maps for the spotlights.
@@ -401,18 +566,25 @@ namespace mage::rendering {
 			const auto nb_requested = m_sm_spot_lights.size();
 			const auto nb_available = m_spot_sms->GetNumberOfShadowMaps();
 
-			if (nb_available < nb_requested) {
+			const bool reallocate = (nb_available < nb_requested);
+			if (reallocate) {
 				ComPtr< ID3D11Device > device;
 				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
 				m_spot_sms = MakeUnique< ShadowMapBuffer >(*device.Get(), 
 														   nb_requested);
 			}
 
-			m_spot_sms->ClearDSVs(m_device_context);
+			// Cached shadow maps do not survive a reallocation.
+			SetupShadowMapInfos(m_spot_sm_infos, 
+								m_spot_sms->GetNumberOfShadowMaps(), 
+								reallocate);
 		}
 	}
 
-	void XM_CALLCONV LBufferPass::RenderShadowMaps(const World& world) {
+	[[nodiscard]]
+	bool LBufferPass::RenderShadowMaps(ModelCuller& culler) {
+		bool rendered = false;
+
 		// Bind the fixed state.
 		m_depth_pass->BindFixedState();
 
@@ -425,13 +597,28 @@ namespace mage::rendering {
 
 			size_t i = 0;
 			for (const auto& camera : m_directional_light_cameras) {
-				// Bind the DSV.
-				m_directional_sms->BindDSV(m_device_context, i++);
+				const auto index = i++;
+
+				// Cull the occluders against the light frustum and reuse the 
+				// cached shadow map if nothing changed.
+				if (!UpdateShadowMapInfo(camera, culler, m_directional_sm_infos[index])) {
+					continue;
+				}
+
+				rendered = true;
+
+				// Bind and clear the DSV.
+				m_directional_sms->BindDSV(m_device_context, index);
+				m_directional_sms->ClearDSV(m_device_context, index);
+
+				m_occluder_lists.BuildOccluders(m_occluders, 
+												camera.world_to_light, 
+												camera.light_to_projection);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world, 
-											  camera.world_to_light, 
-											  camera.light_to_projection);
+				m_depth_pass->Render(m_occluder_lists, 
+									 camera.world_to_light, 
+									 camera.light_to_projection);
 			}
 		}
 
@@ -444,13 +631,28 @@ namespace mage::rendering {
 
 			size_t i = 0;
 			for (const auto& camera : m_omni_light_cameras) {
-				// Bind the DSV.
-				m_omni_sms->BindDSV(m_device_context, i++);
+				const auto index = i++;
+
+				// Cull the occluders against the light frustum and reuse the 
+				// cached shadow map if nothing changed.
+				if (!UpdateShadowMapInfo(camera, culler, m_omni_sm_infos[index])) {
+					continue;
+				}
+
+				rendered = true;
+
+				// Bind and clear the DSV.
+				m_omni_sms->BindDSV(m_device_context, index);
+				m_omni_sms->ClearDSV(m_device_context, index);
+
+				m_occluder_lists.BuildOccluders(m_occluders, 
+												camera.world_to_light, 
+												camera.light_to_projection);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
+				m_depth_pass->Render(m_occluder_lists, 
+									 camera.world_to_light, 
+									 camera.light_to_projection);
 			}
 		}
 
@@ -463,14 +665,58 @@ namespace mage::rendering {
 
 			size_t i = 0;
 			for (const auto& camera : m_spot_light_cameras) {
-				// Bind the DSV.
-				m_spot_sms->BindDSV(m_device_context, i++);
+				const auto index = i++;
+
+				// Cull the occluders against the light frustum and reuse the 
+				// cached shadow map if nothing changed.
+				if (!UpdateShadowMapInfo(camera, culler, m_spot_sm_infos[index])) {
+					continue;
+				}
+
+				rendered = true;
+
+				// Bind and clear the DSV.
+				m_spot_sms->BindDSV(m_device_context, index);
+				m_spot_sms->ClearDSV(m_device_context, index);
+
+				m_occluder_lists.BuildOccluders(m_occluders, 
+												camera.world_to_light, 
+												camera.light_to_projection);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
+				m_depth_pass->Render(m_occluder_lists, 
+									 camera.world_to_light, 
+									 camera.light_to_projection);
 			}
 		}
+
+		return rendered;
+	}
+
+	[[nodiscard]]
+	bool LBufferPass::UpdateShadowMapInfo(const LightCameraInfo& camera,
+										  ModelCuller& culler,
+										  ShadowMapInfo& info) {
+
+		const auto world_to_projection = camera.world_to_light 
+			                           * camera.light_to_projection;
+		
+		culler.Cull(world_to_projection, m_occluders);
+		const auto occluders = GetOccludersVersion(m_occluders);
+
+		const bool cached = info.valid
+			&& (occluders == info.occluders)
+			&& XMVector4Equal(world_to_projection.r[0], info.world_to_projection.r[0])
+			&& XMVector4Equal(world_to_projection.r[1], info.world_to_projection.r[1])
+			&& XMVector4Equal(world_to_projection.r[2], info.world_to_projection.r[2])
+			&& XMVector4Equal(world_to_projection.r[3], info.world_to_projection.r[3]);
+		if (cached) {
+			return false;
+		}
+
+		info.world_to_projection = world_to_projection;
+		info.occluders           = occluders;
+		info.valid               = true;
+		return true;
 	}
 }
\ No newline at end of file
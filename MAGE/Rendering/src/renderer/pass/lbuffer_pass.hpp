@@ -9,6 +9,9 @@
 #include "renderer\buffer\light_buffer.hpp"
 #include "renderer\buffer\shadow_map_buffer.hpp"
 #include "renderer\pass\depth_pass.hpp"
+#include "renderer\model_culler.hpp"
+#include "renderer\light_clusters.hpp"
+#include "memory\frame_memory_arena.hpp"
 
 #pragma endregion
 
@@ -36,11 +39,17 @@ namespace mage::rendering {
 						A reference to the state manager.
 		 @param[in]		resource_manager
 						A reference to the resource manager.
+		 @param[in]		frame_memory
+						A reference to the frame memory arena.
+		 @param[in]		job_system
+						A reference to the job system.
 		 */
 		explicit LBufferPass(ID3D11Device& device, 
 							 ID3D11DeviceContext& device_context, 
 							 StateManager& state_manager, 
-							 ResourceManager& resource_manager);
+							 ResourceManager& resource_manager, 
+							 FrameMemoryArena& frame_memory, 
+							 JobSystem& job_system);
 		LBufferPass(const LBufferPass& buffer) = delete;
 		LBufferPass(LBufferPass&& buffer) noexcept;
 		~LBufferPass();
@@ -57,7 +66,22 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection);
+								ModelCuller& culler,
+			                    FXMMATRIX world_to_camera, 
+			                    CXMMATRIX camera_to_projection);
+
+		/**
+		 Returns the version of the lighting of this LBuffer pass.
+
+		 The version changes each time the light data or a shadow map of this
+		 LBuffer pass changes.
+
+		 @return		The version of the lighting of this LBuffer pass.
+		 */
+		[[nodiscard]]
+		U64 GetVersion() const noexcept {
+			return m_version;
+		}
 		
 	private:
 
@@ -70,16 +94,47 @@ namespace mage::rendering {
 
 		void ProcessLightsData(const World& world);
 
-		void XM_CALLCONV ProcessDirectionalLights(const World& world, 
-												  FXMMATRIX world_to_projection);
-		void XM_CALLCONV ProcessOmniLights(const World& world, 
-										   FXMMATRIX world_to_projection);
-		void XM_CALLCONV ProcessSpotLights(const World& world, 
-										   FXMMATRIX world_to_projection);
+		void ProcessDirectionalLights(const World& world, 
+									  const BoundingFrustum& frustum);
+		void ProcessOmniLights(const World& world, 
+							   const BoundingFrustum& frustum);
+		void ProcessSpotLights(const World& world, 
+							   const BoundingFrustum& frustum);
 
 		void SetupShadowMaps();
 
-		void XM_CALLCONV RenderShadowMaps(const World& world);
+		/**
+		 Renders the shadow maps which are not cached.
+
+		 @param[in]		culler
+						A reference to the model culler.
+		 @return		@c true if at least one shadow map was rendered.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool RenderShadowMaps(ModelCuller& culler);
+
+		struct LightCameraInfo;
+		struct ShadowMapInfo;
+
+		/**
+		 Culls the occluders against the given light camera and updates the
+		 given shadow map info.
+
+		 @param[in]		camera
+						A reference to the light camera info.
+		 @param[in]		culler
+						A reference to the model culler.
+		 @param[in,out]	info
+						A reference to the info of the shadow map of the
+						given light camera.
+		 @return		@c true if the shadow map needs to be rendered.
+						@c false if the cached shadow map is still valid.
+		 */
+		[[nodiscard]]
+		bool UpdateShadowMapInfo(const LightCameraInfo& camera,
+								 ModelCuller& culler,
+								 ShadowMapInfo& info);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -90,6 +145,12 @@ namespace mage::rendering {
 		 */
 		std::reference_wrapper< ID3D11DeviceContext > m_device_context;
 
+		/**
+		 A reference to the frame memory arena of this LBuffer pass. The light 
+		 buffers gathered each frame are allocated on this memory arena.
+		 */
+		std::reference_wrapper< FrameMemoryArena > m_frame_memory;
+
 		ConstantBuffer< LightBuffer > m_light_buffer;
 		StructuredBuffer< DirectionalLightBuffer > m_directional_lights;
 		StructuredBuffer< OmniLightBuffer > m_omni_lights;
@@ -98,6 +159,12 @@ namespace mage::rendering {
 		StructuredBuffer< ShadowMappedOmniLightBuffer > m_sm_omni_lights;
 		StructuredBuffer< ShadowMappedSpotLightBuffer > m_sm_spot_lights;
 
+		/**
+		 The light clusters of this LBuffer pass assigning the omni lights and 
+		 spotlights to the froxels of the view frustum.
+		 */
+		LightClusters m_light_clusters;
+
 		UniquePtr< ShadowMapBuffer > m_directional_sms;
 		UniquePtr< ShadowCubeMapBuffer > m_omni_sms;
 		UniquePtr< ShadowMapBuffer > m_spot_sms;
@@ -111,6 +178,35 @@ namespace mage::rendering {
 		AlignedVector< LightCameraInfo > m_omni_light_cameras;
 		AlignedVector< LightCameraInfo > m_spot_light_cameras;
 
+		/**
+		 A struct containing the key of a cached shadow map: the light camera
+		 and the occluders the shadow map was last rendered with.
+		 */
+		struct alignas(16) ShadowMapInfo {
+			XMMATRIX world_to_projection;
+			U64 occluders;
+			bool valid;
+		};
+
+		AlignedVector< ShadowMapInfo > m_directional_sm_infos;
+		AlignedVector< ShadowMapInfo > m_omni_sm_infos;
+		AlignedVector< ShadowMapInfo > m_spot_sm_infos;
+
+		BoundingVolumeBatch m_light_volumes;
+		std::vector< U32 > m_visible_lights;
+		std::vector< const Model* > m_occluders;
+		DrawLists m_occluder_lists;
+
 		UniquePtr< DepthPass > m_depth_pass;
+
+		/**
+		 The hash of the light data of this LBuffer pass.
+		 */
+		U64 m_lights_hash;
+
+		/**
+		 The version of the lighting of this LBuffer pass.
+		 */
+		U64 m_version;
 	};
 }
\ No newline at end of file
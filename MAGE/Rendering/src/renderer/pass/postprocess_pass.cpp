@@ -18,10 +18,11 @@ namespace mage::rendering {
 
 	PostProcessPass::PostProcessPass(ID3D11DeviceContext& device_context, 
 									 StateManager& state_manager, 
-									 ResourceManager& resource_manager)
+									 ResourceManager& resource_manager, 
+									 ShaderPermutations& shader_permutations)
 		: m_device_context(device_context), 
 		m_state_manager(state_manager), 
-		m_resource_manager(resource_manager), 
+		m_shader_permutations(shader_permutations), 
 		m_dof_cs(CreateDepthOfFieldCS(resource_manager)) {}
 
 	PostProcessPass::PostProcessPass(PostProcessPass&& pass) noexcept = default;
@@ -47,9 +48,9 @@ namespace mage::rendering {
 									  ToneMapping tone_mapping) const noexcept {
 
 		// CS: Bind the compute shader.
-		const auto cs = CreateLowDynamicRangeCS(m_resource_manager, 
-												tone_mapping);
-		cs->BindShader(m_device_context);
+		const auto& cs = m_shader_permutations.get()
+			.GetLowDynamicRangeCS(tone_mapping);
+		cs.BindShader(m_device_context);
 
 		// Dispatch the pass.
 		const auto nb_groups_x = GetNumberOfGroups(viewport_size[0],
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "renderer\configuration.hpp"
+#include "renderer\shader_permutations.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
 
@@ -36,10 +37,13 @@ namespace mage::rendering {
 						A reference to the state manager.
 		 @param[in]		resource_manager
 						A reference to the resource manager.
+		 @param[in]		shader_permutations
+						A reference to the shader permutation table.
 		 */
 		explicit PostProcessPass(ID3D11DeviceContext& device_context, 
 								 StateManager& state_manager, 
-								 ResourceManager& resource_manager);
+								 ResourceManager& resource_manager, 
+								 ShaderPermutations& shader_permutations);
 
 		/**
 		 Constructs a post-process pass from the given post-process pass.
@@ -127,9 +131,9 @@ namespace mage::rendering {
 		std::reference_wrapper< StateManager > m_state_manager;
 
 		/**
-		 A reference to the resource manager of this post-process pass.
+		 A reference to the shader permutation table of this post-process pass.
 		 */
-		std::reference_wrapper< ResourceManager > m_resource_manager;
+		std::reference_wrapper< ShaderPermutations > m_shader_permutations;
 
 		/**
 		 A pointer to the compute shader of this post-process pass.
@@ -20,15 +20,20 @@ namespace mage::rendering {
 	VoxelizationPass::VoxelizationPass(ID3D11Device& device,
 									   ID3D11DeviceContext& device_context,
 									   StateManager& state_manager,
-									   ResourceManager& resource_manager)
+									   ResourceManager& resource_manager,
+									   ShaderPermutations& shader_permutations)
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
-		m_resource_manager(resource_manager),
+		m_shader_permutations(shader_permutations),
 		m_rs(),
 		m_vs(CreateVoxelizationVS(resource_manager)),
+		m_quantized_vs(CreateVoxelizationQuantizedVS(resource_manager)),
 		m_gs(CreateVoxelizationGS(resource_manager)),
 		m_cs(CreateVoxelizationCS(resource_manager)),
-		m_voxel_grid(MakeUnique< VoxelGrid >(device, 1u)) {
+		m_voxel_grid(MakeUnique< VoxelGrid >(device, 1u)),
+		m_brick_mask(device, 1u),
+		m_dirty_bricks(device, 2u),
+		m_dirty_brick_data() {
 
 		SetupRasterizerState(device);
 	}
@@ -76,8 +81,6 @@ namespace mage::rendering {
 	}
 
 	void VoxelizationPass::BindFixedState() const noexcept {
-		// VS: Bind the vertex shader.
-		m_vs->BindShader(m_device_context);
 		// HS: Bind the hull shader.
 		Pipeline::HS::BindShader(m_device_context, nullptr);
 		// DS: Bind the domain shader.
@@ -94,22 +97,40 @@ namespace mage::rendering {
 								   BlendStateID::Opaque);
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const World& world,
-											  FXMMATRIX world_to_projection,
-											  size_t resolution) {
+	void VoxelizationPass::Render(const VoxelBrickGrid& bricks, 
+								  const DrawLists& lists, 
+								  size_t resolution) {
 		SetupVoxelGrid(resolution);
 
+		if (!bricks.HasDirtyBricks()) {
+			// Reuse the voxel texture of the previous voxelization.
+			m_voxel_grid->BindVoxelTexture(m_device_context);
+			return;
+		}
+
+		// Update the dirty bricks.
+		const auto& dirty_bricks = bricks.GetDirtyBricks();
+		m_dirty_brick_data.clear();
+		m_dirty_brick_data.push_back(static_cast< U32 >(dirty_bricks.size()));
+		m_dirty_brick_data.insert(m_dirty_brick_data.end(), 
+								  dirty_bricks.cbegin(), dirty_bricks.cend());
+		m_dirty_bricks.UpdateData(m_device_context, m_dirty_brick_data);
+		m_brick_mask.UpdateData(m_device_context, bricks.GetDirtyBrickMask());
+
 		m_voxel_grid->BindBeginVoxelizationBuffer(m_device_context);
-		Render(world, world_to_projection);
+		m_brick_mask.Bind< Pipeline::PS >(m_device_context, 
+										  SLOT_SRV_VOXEL_BRICK_MASK);
+		Render(lists);
 		m_voxel_grid->BindEndVoxelizationBuffer(m_device_context);
 
 		m_voxel_grid->BindBeginVoxelizationTexture(m_device_context);
-		Dispatch();
+		Dispatch(dirty_bricks.size());
 		m_voxel_grid->BindEndVoxelizationTexture(m_device_context);
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const World& world,
-											  FXMMATRIX world_to_projection) const {
+	void VoxelizationPass::Render(const DrawLists& lists) const {
+		PipelineStateFilter filter;
+
 		// Bind the fixed opaque state.
 		BindFixedState();
 
@@ -119,92 +140,57 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateVoxelizationEmissivePS(m_resource_manager);
+			const auto& ps = m_shader_permutations.get().GetVoxelizationEmissivePS();
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		for (const auto& draw : lists.GetEmissiveModels()) {
+			Render(draw, filter);
+		}
 
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager, 
-														   tsnm);
+			const auto& ps = m_shader_permutations.get().GetVoxelizationPS(tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		for (const auto& draw : lists.GetOpaqueModels(false)) {
+			Render(draw, filter);
+		}
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager, 
-														   tsnm);
+			const auto& ps = m_shader_permutations.get().GetVoxelizationPS(tsnm);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			filter.BindShader(m_device_context, ps);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		for (const auto& draw : lists.GetOpaqueModels(true)) {
+			Render(draw, filter);
+		}
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const Model& model, 
-											  FXMMATRIX world_to_projection) const noexcept {
+	void VoxelizationPass::Render(const ModelDraw& draw, 
+								  PipelineStateFilter& filter) const noexcept {
 
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) { 
-			return;
-		}
-
-		const auto& material             = model.GetMaterial();
+		const auto& model    = *draw.m_model;
+		const auto& mesh     = *model.GetMesh();
+		const auto& material = model.GetMaterial();
 
+		// VS: Bind the vertex shader matching the vertices of the mesh.
+		filter.BindShader(m_device_context, mesh.IsQuantized() ? *m_quantized_vs 
+			                                                   : *m_vs);
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
@@ -216,22 +202,30 @@ namespace mage::rendering {
 			material.GetMaterialSRV(),
 			material.GetNormalSRV()
 		};
-		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR, 
-							   static_cast< U32 >(std::size(srvs)), srvs);
+		filter.BindPSSRVs(m_device_context, SLOT_SRV_BASE_COLOR, 
+						  static_cast< U32 >(std::size(srvs)), srvs);
 		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
+		filter.BindMesh(m_device_context, mesh);
 		// Draw the model.
-		model.Draw(m_device_context);
+		model.Draw(m_device_context, draw.m_lod);
 	}
 
-	void VoxelizationPass::Dispatch() const noexcept {
+	void VoxelizationPass::Dispatch(size_t nb_bricks) const noexcept {
+		static_assert(MAX_NB_GROUPS_PER_DIMENSION 
+					  == D3D11_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION);
+
 		// CS: Bind the compute shader.
 		m_cs->BindShader(m_device_context);
-
-		// Dispatch.
-		const auto nb_groups = GetNumberOfGroups(
-			static_cast< U32 >(m_voxel_grid->GetResolution()), 
-			GROUP_SIZE_3D_DEFAULT);
-		Pipeline::Dispatch(m_device_context, nb_groups, nb_groups, nb_groups);
+		// CS: Bind the dirty bricks.
+		m_dirty_bricks.Bind< Pipeline::CS >(m_device_context, 
+											SLOT_SRV_VOXEL_DIRTY_BRICKS);
+
+		// Dispatch one thread group per dirty brick.
+		const auto nb_groups   = static_cast< U32 >(nb_bricks);
+		const auto nb_groups_x = std::min(nb_groups, 
+										  static_cast< U32 >(MAX_NB_GROUPS_PER_DIMENSION));
+		const auto nb_groups_y = (nb_groups + MAX_NB_GROUPS_PER_DIMENSION - 1u) 
+			                   / MAX_NB_GROUPS_PER_DIMENSION;
+		Pipeline::Dispatch(m_device_context, nb_groups_x, nb_groups_y, 1u);
 	}
-}
+}
\ No newline at end of file
@@ -5,7 +5,12 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\buffer\structured_buffer.hpp"
 #include "renderer\buffer\voxel_grid.hpp"
+#include "renderer\draw_lists.hpp"
+#include "renderer\voxel_brick_grid.hpp"
+#include "renderer\pipeline_state_filter.hpp"
+#include "renderer\shader_permutations.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
@@ -40,11 +45,14 @@ namespace mage::rendering {
 						A reference to the state manager.
 		 @param[in]		resource_manager
 						A reference to the resource manager.
+		 @param[in]		shader_permutations
+						A reference to the shader permutation table.
 		 */
 		explicit VoxelizationPass(ID3D11Device& device, 
 								  ID3D11DeviceContext& device_context, 
 								  StateManager& state_manager, 
-								  ResourceManager& resource_manager);
+								  ResourceManager& resource_manager, 
+								  ShaderPermutations& shader_permutations);
 
 		/**
 		 Constructs a voxelization pass from the given voxelization 
@@ -98,20 +106,25 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the world.
+		 Revoxelizes the dirty bricks of the voxel grid.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 The voxels of the other bricks keep their radiance of the previous
+		 voxelization.
+
+		 @param[in]		bricks
+						A reference to the voxel brick grid of the voxel 
+						grid.
+		 @param[in]		lists
+						A reference to the draw lists of the models 
+						overlapping the dirty bricks.
 		 @param[in]		resolution
 						The resolution of the regular voxel grid.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection,
-								size_t resolution);
+		void Render(const VoxelBrickGrid& bricks, 
+					const DrawLists& lists, 
+					size_t resolution);
 
 	private:
 
@@ -137,33 +150,33 @@ namespace mage::rendering {
 		void BindFixedState() const noexcept;
 
 		/**
-		 Renders the given world.
+		 Renders the opaque models of the given draw lists.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		lists
+						A reference to the draw lists of the voxel grid.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the models.
 		 */
-		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection) const;
+		void Render(const DrawLists& lists) const;
 
 		/**
-		 Renders the given model.
+		 Renders the given model draw.
 
-		 @param[in]		model
-						A reference to the model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		draw
+						A reference to the model draw.
+		 @param[in]		filter
+						A reference to the pipeline state filter.
 		 */
-		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+		void Render(const ModelDraw& draw, 
+					PipelineStateFilter& filter) const noexcept;
 
 		/**
 		 Dispatches this voxelization pass.
+
+		 @param[in]		nb_bricks
+						The number of dirty bricks.
 		 */
-		void Dispatch() const noexcept;
+		void Dispatch(size_t nb_bricks) const noexcept;
 			
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -180,9 +193,9 @@ namespace mage::rendering {
 		std::reference_wrapper< StateManager > m_state_manager;
 
 		/**
-		 A reference to the resource manager of this voxelization pass.
+		 A reference to the shader permutation table of this voxelization pass.
 		 */
-		std::reference_wrapper< ResourceManager > m_resource_manager;
+		std::reference_wrapper< ShaderPermutations > m_shader_permutations;
 
 		/**
 		 A pointer to the rasterizer state of this voxelization pass.
@@ -194,6 +207,12 @@ namespace mage::rendering {
 		 */
 		VertexShaderPtr m_vs;
 
+		/**
+		 A pointer to the vertex shader for quantized meshes of this 
+		 voxelization pass.
+		 */
+		VertexShaderPtr m_quantized_vs;
+
 		/**
 		 A pointer to the geometry shader of this voxelization pass.
 		 */
@@ -208,5 +227,22 @@ namespace mage::rendering {
 		 The voxel grid of this voxelization pass. 
 		 */
 		UniquePtr< VoxelGrid > m_voxel_grid;
+
+		/**
+		 The dirty brick mask of this voxelization pass.
+		 */
+		StructuredBuffer< U32 > m_brick_mask;
+
+		/**
+		 The dirty bricks of this voxelization pass (prefixed by their 
+		 number).
+		 */
+		StructuredBuffer< U32 > m_dirty_bricks;
+
+		/**
+		 A vector containing the data of the dirty bricks of this 
+		 voxelization pass.
+		 */
+		AlignedVector< U32 > m_dirty_brick_data;
 	};
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
+#include "type\atomic_types.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
@@ -133,6 +134,7 @@ namespace mage::rendering {
 						   U32 map_flags, 
 						   D3D11_MAPPED_SUBRESOURCE& mapped_resource) noexcept {
 
+			++s_nb_maps;
 			return device_context.Map(&resource, 
 									  subresource, 
 									  map_type, 
@@ -521,6 +523,36 @@ namespace mage::rendering {
 				device_context.VSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
+			/**
+			 Binds a range of a constant buffer to the vertex shader stage.
+			 
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @param[in]		device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset (in shader constants) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot, 
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+					
+				device_context.VSSetConstantBuffers1(slot, 1u, &buffer,
+													   &first_constant, 
+													   &nb_constants);
+			}
+			
 			/**
 			 Binds a shader resource view to the vertex shader stage.
 			 
@@ -727,6 +759,36 @@ namespace mage::rendering {
 				device_context.HSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
+			/**
+			 Binds a range of a constant buffer to the hull shader stage.
+			 
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @param[in]		device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset (in shader constants) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot, 
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+					
+				device_context.HSSetConstantBuffers1(slot, 1u, &buffer,
+													   &first_constant, 
+													   &nb_constants);
+			}
+			
 			/**
 			 Binds a shader resource view to the hull shader stage.
 			 
@@ -945,6 +1007,36 @@ namespace mage::rendering {
 				device_context.DSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
+			/**
+			 Binds a range of a constant buffer to the domain shader stage.
+			 
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @param[in]		device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset (in shader constants) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot, 
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+					
+				device_context.DSSetConstantBuffers1(slot, 1u, &buffer,
+													   &first_constant, 
+													   &nb_constants);
+			}
+			
 			/**
 			 Binds a shader resource view to the domain shader stage.
 			 
@@ -1151,6 +1243,36 @@ namespace mage::rendering {
 				device_context.GSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
+			/**
+			 Binds a range of a constant buffer to the geometry shader stage.
+			 
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @param[in]		device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset (in shader constants) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot, 
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+					
+				device_context.GSSetConstantBuffers1(slot, 1u, &buffer,
+													   &first_constant, 
+													   &nb_constants);
+			}
+			
 			/**
 			 Binds a shader resource view to the geometry shader stage.
 			 
@@ -1427,6 +1549,36 @@ namespace mage::rendering {
 				device_context.PSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
+			/**
+			 Binds a range of a constant buffer to the pixel shader stage.
+			 
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @param[in]		device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset (in shader constants) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot, 
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+					
+				device_context.PSSetConstantBuffers1(slot, 1u, &buffer,
+													   &first_constant, 
+													   &nb_constants);
+			}
+			
 			/**
 			 Binds a shader resource view to the pixel shader stage.
 			 
@@ -1816,6 +1968,36 @@ namespace mage::rendering {
 				device_context.CSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
+			/**
+			 Binds a range of a constant buffer to the compute shader stage.
+			 
+			 @pre			@a slot < @c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT.
+			 @pre			@a first_constant and @a nb_constants are multiples 
+							of 16.
+			 @param[in]		device_context
+							A reference to the device context.
+			 @param[in]		slot
+							The index into the device's zero-based array to set 
+							the constant buffer to (ranges from 0 to 
+							@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+			 @param[in]		buffer
+							A pointer to the constant buffer.
+			 @param[in]		first_constant
+							The offset (in shader constants) of the range.
+			 @param[in]		nb_constants
+							The number of shader constants of the range.
+			 */
+			static void BindConstantBuffer(ID3D11DeviceContext1& device_context,
+				                           U32 slot, 
+				                           ID3D11Buffer* buffer,
+				                           U32 first_constant,
+				                           U32 nb_constants) noexcept {
+					
+				device_context.CSSetConstantBuffers1(slot, 1u, &buffer,
+													   &first_constant, 
+													   &nb_constants);
+			}
+			
 			/**
 			 Binds a shader resource view to the compute shader stage.
 			 
@@ -2000,6 +2182,32 @@ namespace mage::rendering {
 		 */
 		static U32 s_nb_draws;
 
+		/**
+		 The number of skipped redundant shader binds. Binds are also skipped
+		 while recording command lists on other threads.
+		 */
+		static AtomicU32 s_nb_skipped_shader_binds;
+
+		/**
+		 The number of skipped redundant SRV binds.
+		 */
+		static AtomicU32 s_nb_skipped_srv_binds;
+
+		/**
+		 The number of skipped redundant vertex and index buffer binds.
+		 */
+		static AtomicU32 s_nb_skipped_buffer_binds;
+
+		/**
+		 The number of resource mappings.
+		 */
+		static U32 s_nb_maps;
+
+		/**
+		 The number of bytes copied into mapped resources.
+		 */
+		static U32 s_nb_mapped_bytes;
+
 	private:
 
 		//---------------------------------------------------------------------
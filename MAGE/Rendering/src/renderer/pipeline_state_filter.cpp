@@ -0,0 +1,186 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\pipeline_state_filter.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	PipelineStateFilter::PipelineStateFilter() noexcept
+		: m_vs(nullptr),
+		m_ps(nullptr),
+		m_mesh(nullptr),
+		m_ps_srvs{},
+		m_ps_srvs_known() {}
+
+	PipelineStateFilter::PipelineStateFilter(
+		const PipelineStateFilter& filter) noexcept = default;
+
+	PipelineStateFilter::PipelineStateFilter(
+		PipelineStateFilter&& filter) noexcept = default;
+
+	PipelineStateFilter::~PipelineStateFilter() = default;
+
+	PipelineStateFilter& PipelineStateFilter
+		::operator=(const PipelineStateFilter& filter) noexcept = default;
+
+	PipelineStateFilter& PipelineStateFilter
+		::operator=(PipelineStateFilter&& filter) noexcept = default;
+
+	void PipelineStateFilter::Reset() noexcept {
+		m_vs   = nullptr;
+		m_ps   = nullptr;
+		m_mesh = nullptr;
+		m_ps_srvs_known.reset();
+	}
+
+	void PipelineStateFilter::BindShader(ID3D11DeviceContext& device_context,
+										 const VertexShader& shader) noexcept {
+		if (&shader == m_vs) {
+			++Pipeline::s_nb_skipped_shader_binds;
+			return;
+		}
+
+		m_vs = &shader;
+		shader.BindShader(device_context);
+	}
+
+	void PipelineStateFilter::BindShader(CommandList& commands,
+										 const VertexShader& shader) {
+		if (&shader == m_vs) {
+			++Pipeline::s_nb_skipped_shader_binds;
+			return;
+		}
+
+		m_vs = &shader;
+		shader.BindShader(commands);
+	}
+
+	void PipelineStateFilter::BindShader(ID3D11DeviceContext& device_context,
+										 const PixelShader& shader) noexcept {
+		if (&shader == m_ps) {
+			++Pipeline::s_nb_skipped_shader_binds;
+			return;
+		}
+
+		m_ps = &shader;
+		shader.BindShader(device_context);
+	}
+
+	void PipelineStateFilter::BindShader(CommandList& commands,
+										 const PixelShader& shader) {
+		if (&shader == m_ps) {
+			++Pipeline::s_nb_skipped_shader_binds;
+			return;
+		}
+
+		m_ps = &shader;
+		shader.BindShader(commands);
+	}
+
+	namespace {
+
+		void BindPSSRVs(ID3D11DeviceContext& device_context,
+						U32 slot,
+						U32 nb_views,
+						ID3D11ShaderResourceView* const* srvs) noexcept {
+
+			Pipeline::PS::BindSRVs(device_context, slot, nb_views, srvs);
+		}
+
+		void BindPSSRVs(CommandList& commands,
+						U32 slot,
+						U32 nb_views,
+						ID3D11ShaderResourceView* const* srvs) {
+
+			commands.BindSRVs< Pipeline::PS >(slot, nb_views, srvs);
+		}
+	}
+
+	void PipelineStateFilter::BindPSSRVs(ID3D11DeviceContext& device_context,
+										 U32 slot,
+										 U32 nb_views,
+										 ID3D11ShaderResourceView* const* srvs) noexcept {
+
+		BindPSSRVsTo(device_context, slot, nb_views, srvs);
+	}
+
+	void PipelineStateFilter::BindPSSRVs(CommandList& commands,
+										 U32 slot,
+										 U32 nb_views,
+										 ID3D11ShaderResourceView* const* srvs) {
+
+		BindPSSRVsTo(commands, slot, nb_views, srvs);
+	}
+
+	void PipelineStateFilter::BindMesh(ID3D11DeviceContext& device_context,
+									   const Mesh& mesh) noexcept {
+		BindMeshTo(device_context, mesh);
+	}
+
+	void PipelineStateFilter::BindMesh(CommandList& commands, const Mesh& mesh) {
+		BindMeshTo(commands, mesh);
+	}
+
+	template< typename TargetT >
+	void PipelineStateFilter::BindPSSRVsTo(TargetT& target,
+										   U32 slot,
+										   U32 nb_views,
+										   ID3D11ShaderResourceView* const* srvs) {
+		// Find the first and last SRV which differ from the bound ones.
+		U32 first = nb_views;
+		U32 last  = 0u;
+		for (U32 i = 0u; i < nb_views; ++i) {
+			const auto index = slot + i;
+			if (m_ps_srvs_known[index] && srvs[i] == m_ps_srvs[index]) {
+				continue;
+			}
+
+			first = std::min(first, i);
+			last  = i;
+		}
+
+		if (nb_views == first) {
+			Pipeline::s_nb_skipped_srv_binds += nb_views;
+			return;
+		}
+
+		// Bind the contiguous range of SRVs containing all differing SRVs.
+		const auto nb_bound_views = last - first + 1u;
+		Pipeline::s_nb_skipped_srv_binds += nb_views - nb_bound_views;
+		mage::rendering::BindPSSRVs(target, slot + first,
+									nb_bound_views, srvs + first);
+
+		for (U32 i = first; i <= last; ++i) {
+			const auto index = slot + i;
+			m_ps_srvs[index] = srvs[i];
+			m_ps_srvs_known.set(index);
+		}
+	}
+
+	template< typename TargetT >
+	void PipelineStateFilter::BindMeshTo(TargetT& target, const Mesh& mesh) {
+		if (&mesh == m_mesh) {
+			++Pipeline::s_nb_skipped_buffer_binds;
+			return;
+		}
+
+		m_mesh = &mesh;
+		mesh.BindMesh(target);
+	}
+}
\ No newline at end of file
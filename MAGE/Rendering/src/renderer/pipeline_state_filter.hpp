@@ -0,0 +1,292 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\mesh.hpp"
+#include "resource\shader\shader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <bitset>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of pipeline state filters.
+
+	 A pipeline state filter sits in front of the @c Pipeline and skips
+	 rebinding shaders, pixel shader SRVs and meshes (i.e. vertex buffers,
+	 index buffers and primitive topologies) which are already bound. The
+	 skipped binds are counted in the @c Pipeline.
+
+	 A pipeline state filter only knows about the state bound through it.
+	 It must be reset whenever that state is bound directly to the
+	 @c Pipeline.
+	 */
+	class PipelineStateFilter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a pipeline state filter.
+		 */
+		PipelineStateFilter() noexcept;
+
+		/**
+		 Constructs a pipeline state filter from the given pipeline state
+		 filter.
+
+		 @param[in]		filter
+						A reference to the pipeline state filter to copy.
+		 */
+		PipelineStateFilter(const PipelineStateFilter& filter) noexcept;
+
+		/**
+		 Constructs a pipeline state filter by moving the given pipeline
+		 state filter.
+
+		 @param[in]		filter
+						A reference to the pipeline state filter to move.
+		 */
+		PipelineStateFilter(PipelineStateFilter&& filter) noexcept;
+
+		/**
+		 Destructs this pipeline state filter.
+		 */
+		~PipelineStateFilter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given pipeline state filter to this pipeline state
+		 filter.
+
+		 @param[in]		filter
+						A reference to the pipeline state filter to copy.
+		 @return		A reference to the copy of the given pipeline state
+						filter (i.e. this pipeline state filter).
+		 */
+		PipelineStateFilter& operator=(const PipelineStateFilter& filter) noexcept;
+
+		/**
+		 Moves the given pipeline state filter to this pipeline state
+		 filter.
+
+		 @param[in]		filter
+						A reference to the pipeline state filter to move.
+		 @return		A reference to the moved pipeline state filter (i.e.
+						this pipeline state filter).
+		 */
+		PipelineStateFilter& operator=(PipelineStateFilter&& filter) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Resets this pipeline state filter.
+
+		 All state is considered unknown afterwards.
+		 */
+		void Reset() noexcept;
+
+		/**
+		 Binds the given vertex shader if it is not already bound.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		shader
+						A reference to the vertex shader.
+		 */
+		void BindShader(ID3D11DeviceContext& device_context,
+						const VertexShader& shader) noexcept;
+
+		/**
+		 Records binding the given vertex shader if it is not already bound.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		shader
+						A reference to the vertex shader.
+		 */
+		void BindShader(CommandList& commands, const VertexShader& shader);
+
+		/**
+		 Binds the given pixel shader if it is not already bound.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		shader
+						A reference to the pixel shader.
+		 */
+		void BindShader(ID3D11DeviceContext& device_context,
+						const PixelShader& shader) noexcept;
+
+		/**
+		 Records binding the given pixel shader if it is not already bound.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		shader
+						A reference to the pixel shader.
+		 */
+		void BindShader(CommandList& commands, const PixelShader& shader);
+
+		/**
+		 Binds the given SRVs to the pixel shader stage, skipping the SRVs
+		 which are already bound.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the shader resources to (ranges from 0 to
+						@c D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT - 1).
+		 @param[in]		nb_views
+						The number of shader resources to set. Up to a maximum
+						of @c D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT -
+						@a slot shader resources can be set.
+		 @param[in]		srvs
+						A pointer to an array of shader resource views.
+		 */
+		void BindPSSRVs(ID3D11DeviceContext& device_context,
+						U32 slot,
+						U32 nb_views,
+						ID3D11ShaderResourceView* const* srvs) noexcept;
+
+		/**
+		 Records binding the given SRVs to the pixel shader stage, skipping
+		 the SRVs which are already bound.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the shader resources to (ranges from 0 to
+						@c D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT - 1).
+		 @param[in]		nb_views
+						The number of shader resources to set. Up to a maximum
+						of @c D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT -
+						@a slot shader resources can be set.
+		 @param[in]		srvs
+						A pointer to an array of shader resource views.
+		 */
+		void BindPSSRVs(CommandList& commands,
+						U32 slot,
+						U32 nb_views,
+						ID3D11ShaderResourceView* const* srvs);
+
+		/**
+		 Binds the given mesh if it is not already bound.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		mesh
+						A reference to the mesh.
+		 */
+		void BindMesh(ID3D11DeviceContext& device_context,
+					  const Mesh& mesh) noexcept;
+
+		/**
+		 Records binding the given mesh if it is not already bound.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		mesh
+						A reference to the mesh.
+		 */
+		void BindMesh(CommandList& commands, const Mesh& mesh);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Binds the given SRVs to the pixel shader stage, skipping the SRVs
+		 which are already bound.
+
+		 @tparam		TargetT
+						The target type (a device context or a command list).
+		 @param[in]		target
+						A reference to the target.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the shader resources to.
+		 @param[in]		nb_views
+						The number of shader resources to set.
+		 @param[in]		srvs
+						A pointer to an array of shader resource views.
+		 */
+		template< typename TargetT >
+		void BindPSSRVsTo(TargetT& target,
+						  U32 slot,
+						  U32 nb_views,
+						  ID3D11ShaderResourceView* const* srvs);
+
+		/**
+		 Binds the given mesh if it is not already bound.
+
+		 @tparam		TargetT
+						The target type (a device context or a command list).
+		 @param[in]		target
+						A reference to the target.
+		 @param[in]		mesh
+						A reference to the mesh.
+		 */
+		template< typename TargetT >
+		void BindMeshTo(TargetT& target, const Mesh& mesh);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the bound vertex shader of this pipeline state filter.
+		 */
+		const VertexShader* m_vs;
+
+		/**
+		 A pointer to the bound pixel shader of this pipeline state filter.
+		 */
+		const PixelShader* m_ps;
+
+		/**
+		 A pointer to the bound mesh of this pipeline state filter.
+		 */
+		const Mesh* m_mesh;
+
+		/**
+		 An array containing pointers to the bound pixel shader SRVs of this
+		 pipeline state filter.
+		 */
+		ID3D11ShaderResourceView* m_ps_srvs[
+			D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+
+		/**
+		 A bitset indicating which pixel shader SRVs of this pipeline state
+		 filter are known.
+		 */
+		std::bitset< D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT > m_ps_srvs_known;
+	};
+}
\ No newline at end of file
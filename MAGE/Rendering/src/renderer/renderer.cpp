@@ -4,7 +4,11 @@
 #pragma region
 
 #include "renderer\renderer.hpp"
+#include "renderer\draw_lists.hpp"
+#include "renderer\model_culler.hpp"
+#include "renderer\voxel_brick_grid.hpp"
 #include "renderer\output_manager.hpp"
+#include "renderer\shader_permutations.hpp"
 #include "renderer\pass\aa_pass.hpp"
 #include "renderer\pass\back_buffer_pass.hpp"
 #include "renderer\pass\bounding_volume_pass.hpp"
@@ -17,6 +21,7 @@
 #include "renderer\pass\sprite_pass.hpp"
 #include "renderer\pass\voxelization_pass.hpp"
 #include "renderer\pass\voxel_grid_pass.hpp"
+#include "renderer\buffer\upload_buffer.hpp"
 #include "renderer\buffer\world_buffer.hpp"
 #include "imgui_impl_dx11.h"
 
@@ -59,12 +64,18 @@ namespace mage::rendering {
 						A reference to the swap chain.
 		 @param[in]		resource_manager
 						A pointer to the resource manager.
+		 @param[in]		frame_memory
+						A reference to the frame memory arena.
+		 @param[in]		job_system
+						A reference to the job system.
 		 */
 		explicit Impl(ID3D11Device& device, 
 					  ID3D11DeviceContext& device_context, 
 					  DisplayConfiguration& display_configuration, 
 					  SwapChain& swap_chain,
-					  ResourceManager& resource_manager);
+					  ResourceManager& resource_manager,
+					  FrameMemoryArena& frame_memory, 
+					  JobSystem& job_system);
 
 		/**
 		 Constructs a renderer from the given renderer.
@@ -122,6 +133,14 @@ namespace mage::rendering {
 		 */
 		void BindPersistentState();
 
+		/**
+		 Creates all shader permutations used by the passes of this renderer.
+
+		 @throws		Exception
+						Failed to create a shader.
+		 */
+		void PrewarmShaders();
+
 		/**
 		 Renders the given world.
 
@@ -134,6 +153,25 @@ namespace mage::rendering {
 		 */
 		void Render(const World& world, const GameTime& time);
 
+		/**
+		 Submits the uploads of this renderer of the last rendered frame. 
+		 Only uploads of a deferred device context are submitted; other 
+		 uploads are applied immediately.
+
+		 @pre			The previously submitted uploads are executed.
+		 */
+		void SubmitUploads() noexcept;
+
+		/**
+		 Executes the submitted uploads of this renderer. This must be called 
+		 before executing the command list of the frame of the submitted 
+		 uploads.
+
+		 @param[in]		device_context
+						A reference to the immediate device context.
+		 */
+		void ExecuteUploads(ID3D11DeviceContext& device_context) noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -144,31 +182,36 @@ namespace mage::rendering {
 
 		void UpdateBuffers(const World& world, const GameTime& time);
 
+		void UpdateModelBuffers(const World& world);
+
 		void UpdateWorldBuffer(const GameTime& time);
 		
 		void Render(const World& world, const Camera& camera);
 		
 		void XM_CALLCONV RenderForward(const World& world, 
 									   const Camera& camera, 
-									   FXMMATRIX world_to_projection);
+									   FXMMATRIX world_to_camera, 
+									   CXMMATRIX camera_to_projection);
 		
 		void XM_CALLCONV RenderDeferred(const World& world, 
 										const Camera& camera, 
-										FXMMATRIX world_to_projection);
+										FXMMATRIX world_to_camera, 
+										CXMMATRIX camera_to_projection);
 		
 		void XM_CALLCONV RenderSolid(const World& world, 
 									 const Camera& camera, 
-									 FXMMATRIX world_to_projection);
+									 FXMMATRIX world_to_camera, 
+									 CXMMATRIX camera_to_projection);
 
-		void XM_CALLCONV RenderFalseColor(const World& world, 
-										  const Camera& camera,
-										  FXMMATRIX world_to_projection, 
-										  FalseColor false_color);
+		void RenderFalseColor(const Camera& camera, FalseColor false_color);
 		
 		void XM_CALLCONV RenderVoxelGrid(const World& world, 
 										 const Camera& camera, 
-										 FXMMATRIX world_to_projection);
+										 FXMMATRIX world_to_camera, 
+										 CXMMATRIX camera_to_projection);
 		
+		void RenderVoxelization();
+
 		void RenderAA(const Camera& camera);
 		
 		void RenderPostProcessing(const Camera& camera);
@@ -197,6 +240,16 @@ namespace mage::rendering {
 		 */
 		std::reference_wrapper< ResourceManager > m_resource_manager;
 
+		/**
+		 A reference to the frame memory arena of this renderer.
+		 */
+		std::reference_wrapper< FrameMemoryArena > m_frame_memory;
+
+		/**
+		 A reference to the job system of this renderer.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
 		/**
 		 A pointer to the output manager of this rendering manager.
 		 */
@@ -207,6 +260,11 @@ namespace mage::rendering {
 		 */
 		UniquePtr< StateManager > m_state_manager;
 
+		/**
+		 A pointer to the shader permutation table of this renderer.
+		 */
+		UniquePtr< ShaderPermutations > m_shader_permutations;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Buffers
 		//---------------------------------------------------------------------
@@ -216,6 +274,58 @@ namespace mage::rendering {
 		 */
 		ConstantBuffer< WorldBuffer > m_world_buffer;
 
+		/**
+		 A pointer to the upload buffer of the model buffers of this renderer.
+		 If upload buffers are not supported, each model uploads its buffer 
+		 to its own constant buffer instead.
+		 */
+		UniquePtr< UploadBuffer > m_model_upload_buffer;
+
+		/**
+		 A vector containing the models whose buffer needs to be uploaded 
+		 in the current frame of this renderer.
+		 */
+		std::vector< const Model* > m_uploaded_models;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Culling
+		//---------------------------------------------------------------------
+
+		/**
+		 The model culler of this renderer.
+		 */
+		ModelCuller m_model_culler;
+
+		/**
+		 A vector containing the models which are visible to the current 
+		 camera of this renderer.
+		 */
+		std::vector< const Model* > m_visible_models;
+
+		/**
+		 The draw lists of the models which are visible to the current 
+		 camera of this renderer.
+		 */
+		DrawLists m_draw_lists;
+
+		/**
+		 A vector containing the models which are visible to the voxel grid 
+		 of this renderer.
+		 */
+		std::vector< const Model* > m_voxelized_models;
+
+		/**
+		 The draw lists of the models which are visible to the voxel grid 
+		 of this renderer.
+		 */
+		DrawLists m_voxelized_draw_lists;
+
+		/**
+		 The voxel brick grid tracking the dirty bricks of the voxel grid of 
+		 this renderer.
+		 */
+		VoxelBrickGrid m_voxel_bricks;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Render Passes
 		//---------------------------------------------------------------------
@@ -285,16 +395,30 @@ namespace mage::rendering {
 						 ID3D11DeviceContext& device_context, 
 						 DisplayConfiguration& display_configuration, 
 						 SwapChain& swap_chain, 
-						 ResourceManager& resource_manager)
+						 ResourceManager& resource_manager, 
+						 FrameMemoryArena& frame_memory, 
+						 JobSystem& job_system)
 		: m_display_configuration(display_configuration), 
 		m_device(device), 
 		m_device_context(device_context), 
 		m_resource_manager(resource_manager), 
+		m_frame_memory(frame_memory), 
+		m_job_system(job_system), 
 		m_output_manager(MakeUnique< OutputManager >(device, 
 													 display_configuration, 
 													 swap_chain)), 
 		m_state_manager(MakeUnique< StateManager >(device)), 
+		m_shader_permutations(MakeUnique< ShaderPermutations >(resource_manager)), 
 		m_world_buffer(device),
+		m_model_upload_buffer(UploadBuffer::IsSupported(device) 
+			? MakeUnique< UploadBuffer >(device, device_context) : nullptr),
+		m_uploaded_models(),
+		m_model_culler(), 
+		m_visible_models(), 
+		m_draw_lists(), 
+		m_voxelized_models(), 
+		m_voxelized_draw_lists(), 
+		m_voxel_bricks(), 
 		m_aa_pass(), 
 		m_back_buffer_pass(), 
 		m_bounding_volume_pass(), 
@@ -333,26 +457,33 @@ namespace mage::rendering {
 																  m_resource_manager);
 		m_deferred_pass = MakeUnique< DeferredPass >(m_device_context,
 													 *m_state_manager.get(),
-													 m_resource_manager);
+													 m_resource_manager,
+													 *m_shader_permutations.get());
 
 		m_depth_pass = MakeUnique< DepthPass >(m_device,
 											   m_device_context,
 											   *m_state_manager.get(),
-											   m_resource_manager);
+											   m_resource_manager,
+											   m_job_system);
 
 		m_forward_pass = MakeUnique< ForwardPass >(m_device,
 												   m_device_context,
 												   *m_state_manager.get(),
-												   m_resource_manager);
+												   m_resource_manager,
+												   *m_shader_permutations.get(),
+												   m_job_system);
 
 		m_lbuffer_pass = MakeUnique< LBufferPass >(m_device,
 												   m_device_context,
 												   *m_state_manager.get(),
-												   m_resource_manager);
+												   m_resource_manager,
+												   m_frame_memory,
+												   m_job_system);
 
 		m_postprocess_pass = MakeUnique< PostProcessPass >(m_device_context,
 														   *m_state_manager.get(),
-														   m_resource_manager);
+														   m_resource_manager,
+														   *m_shader_permutations.get());
 
 		m_sky_pass = MakeUnique< SkyPass >(m_device_context,
 										   *m_state_manager.get(),
@@ -370,16 +501,37 @@ namespace mage::rendering {
 		m_voxelization_pass = MakeUnique< VoxelizationPass >(m_device,
 															 m_device_context,
 															 *m_state_manager.get(),
-															 m_resource_manager);
+															 m_resource_manager,
+															 *m_shader_permutations.get());
 	}
 
 	void Renderer::Impl::BindPersistentState() {
 		m_state_manager->BindPersistentState(m_device_context);
 	}
 
+	void Renderer::Impl::PrewarmShaders() {
+		m_shader_permutations->Prewarm();
+	}
+
+	void Renderer::Impl::SubmitUploads() noexcept {
+		if (m_model_upload_buffer) {
+			m_model_upload_buffer->SubmitStagedAllocations();
+		}
+	}
+
+	void Renderer::Impl::ExecuteUploads(
+		ID3D11DeviceContext& device_context) noexcept {
+
+		if (m_model_upload_buffer) {
+			m_model_upload_buffer->ExecuteStagedAllocations(device_context);
+		}
+	}
+
 	void Renderer::Impl::Render(const World& world, const GameTime& time) {
 		// Update the buffers.
 		UpdateBuffers(world, time);
+		// Gather the models and their world-space AABBs for culling.
+		m_model_culler.Update(world);
 
 		// Bind the world buffer.
 		m_world_buffer.Bind< Pipeline >(m_device_context, SLOT_CBUFFER_WORLD);
@@ -434,11 +586,66 @@ namespace mage::rendering {
 		});
 
 		// Update the buffer of each model.
-		world.ForEach< Model >([this](const Model& model) {
+		UpdateModelBuffers(world);
+	}
+
+	void Renderer::Impl::UpdateModelBuffers(const World& world) {
+		constexpr auto allocation_size 
+			= UploadBuffer::GetAllocationSize(sizeof(ModelBuffer));
+
+		if (!m_model_upload_buffer) {
+			// Fallback: map the constant buffer of each changed model.
+			world.ForEach< Model >([this](const Model& model) {
+				if (State::Active == model.GetState() 
+					&& model.UpdateBufferData()) {
+					model.UploadBufferData(m_device, m_device_context);
+				}
+			});
+			return;
+		}
+
+		auto& upload_buffer = *m_model_upload_buffer;
+
+		// Collect the models whose buffer data changed or whose buffer was 
+		// invalidated by a wrap-around of the upload buffer.
+		m_uploaded_models.clear();
+		world.ForEach< Model >([this, &upload_buffer](const Model& model) {
 			if (State::Active == model.GetState()) {
-				model.UpdateBuffer(m_device_context);
+				const bool changed = model.UpdateBufferData();
+				if (changed || !model.HasValidBuffer(upload_buffer)) {
+					m_uploaded_models.push_back(&model);
+				}
 			}
 		});
+
+		if (m_uploaded_models.empty()) {
+			return;
+		}
+
+		// The upload buffer of a deferred device context is staged and only 
+		// copied on the immediate device context, so it wraps around only if 
+		// it is full as well.
+		if (!upload_buffer.CanAllocate(
+				m_uploaded_models.size() * allocation_size)) {
+			
+			// Wrap around: the buffers of all models become invalid.
+			m_uploaded_models.clear();
+			world.ForEach< Model >([this](const Model& model) {
+				if (State::Active == model.GetState()) {
+					m_uploaded_models.push_back(&model);
+				}
+			});
+
+			upload_buffer.Reset(m_device_context, 
+								m_uploaded_models.size() * allocation_size);
+		}
+
+		// Upload the buffer data of the collected models with a single map.
+		upload_buffer.Map(m_device_context);
+		for (const auto model : m_uploaded_models) {
+			model->UploadBufferData(upload_buffer);
+		}
+		upload_buffer.Unmap(m_device_context);
 	}
 
 	void Renderer::Impl::UpdateWorldBuffer(const GameTime& time) {
@@ -504,6 +711,12 @@ namespace mage::rendering {
 
 		const auto  render_mode          = camera.GetSettings().GetRenderMode();
 
+		// Cull the models against the view frustum of the camera.
+		m_model_culler.Cull(world_to_projection, m_visible_models);
+		// Bucket and sort the visible models once for all passes.
+		m_draw_lists.Build(m_visible_models, 
+						   world_to_camera, camera_to_projection);
+
 		m_output_manager->BindBeginViewport(m_device_context);
 
 		//---------------------------------------------------------------------
@@ -512,108 +725,95 @@ namespace mage::rendering {
 		switch (render_mode) {
 
 		case RenderMode::Forward: {
-			RenderForward(world, camera, world_to_projection);
+			RenderForward(world, camera, 
+			              world_to_camera, camera_to_projection);
 			break;
 		}
 		
 		case RenderMode::Deferred: {
-			RenderDeferred(world, camera, world_to_projection);
+			RenderDeferred(world, camera, 
+			               world_to_camera, camera_to_projection);
 			break;
 		}
 		
 		case RenderMode::Solid: {
-			RenderSolid(world, camera, world_to_projection);
+			RenderSolid(world, camera, 
+			            world_to_camera, camera_to_projection);
 			break;
 		}
 		
 		case RenderMode::VoxelGrid: {
-			RenderVoxelGrid(world, camera, world_to_projection);
+			RenderVoxelGrid(world, camera, 
+			                world_to_camera, camera_to_projection);
 			break;
 		}
 
 		case RenderMode::FalseColor_BaseColor: {
-			RenderFalseColor(world, camera, world_to_projection, 
-							 FalseColor::BaseColor);
+			RenderFalseColor(camera, FalseColor::BaseColor);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorCoefficient);
+			RenderFalseColor(camera, FalseColor::BaseColorCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorTexture);
+			RenderFalseColor(camera, FalseColor::BaseColorTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Material: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Material);
+			RenderFalseColor(camera, FalseColor::Material);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialCoefficient);
+			RenderFalseColor(camera, FalseColor::MaterialCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialTexture);
+			RenderFalseColor(camera, FalseColor::MaterialTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Roughness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Roughness);
+			RenderFalseColor(camera, FalseColor::Roughness);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessCoefficient);
+			RenderFalseColor(camera, FalseColor::RoughnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessTexture);
+			RenderFalseColor(camera, FalseColor::RoughnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Metalness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Metalness);
+			RenderFalseColor(camera, FalseColor::Metalness);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessCoefficient);
+			RenderFalseColor(camera, FalseColor::MetalnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessTexture);
+			RenderFalseColor(camera, FalseColor::MetalnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_ShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::ShadingNormal);
+			RenderFalseColor(camera, FalseColor::ShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_TSNMShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::TSNMShadingNormal);
+			RenderFalseColor(camera, FalseColor::TSNMShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_Depth: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Depth);
+			RenderFalseColor(camera, FalseColor::Depth);
 			break;
 		}
 		case RenderMode::FalseColor_Distance: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Distance);
+			RenderFalseColor(camera, FalseColor::Distance);
 			break;
 		}
 		case RenderMode::FalseColor_UV: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::UV);
+			RenderFalseColor(camera, FalseColor::UV);
 			break;
 		}
 
@@ -633,7 +833,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		const auto& settings = camera.GetSettings();
 		if (settings.ContainsRenderLayer(RenderLayer::Wireframe)) {
-			m_forward_pass->RenderWireframe(world, world_to_projection);
+			m_forward_pass->RenderWireframe(m_draw_lists);
 		}
 		if (settings.ContainsRenderLayer(RenderLayer::AABB)) {
 			m_bounding_volume_pass->Render(world, world_to_projection);
@@ -654,28 +854,19 @@ namespace mage::rendering {
 
 	void XM_CALLCONV Renderer::Impl::RenderForward(const World& world,
 												   const Camera& camera,
-												   FXMMATRIX world_to_projection) {
+												   FXMMATRIX world_to_camera, 
+												   CXMMATRIX camera_to_projection) {
 
 		const auto vct = camera.GetSettings().GetVoxelizationSettings().UsesVCT();
 
 		//---------------------------------------------------------------------
 		// LBuffer + Voxelization
 		//---------------------------------------------------------------------
+		// TODO: world_to_camera + world_to_voxel for culling
+		m_lbuffer_pass->Render(world, m_model_culler, 
+		                       world_to_camera, camera_to_projection);
 		if (vct) {
-			const auto world_to_voxel
-				= VoxelizationSettings::GetWorldToVoxelMatrix();
-
-			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
-
-			const auto voxel_grid_resolution
-				= VoxelizationSettings::GetVoxelGridResolution();
-
-			m_voxelization_pass->Render(world, world_to_voxel,
-										voxel_grid_resolution);
-		}
-		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			RenderVoxelization();
 		}
 
 		const Viewport viewport(camera.GetViewport(),
@@ -687,16 +878,14 @@ namespace mage::rendering {
 		// Depth
 		//---------------------------------------------------------------------
 		if (vct) {
-			const auto& transform            = camera.GetOwner()->GetTransform();
-			const auto  world_to_camera      = transform.GetWorldToObjectMatrix();
-			const auto  camera_to_projection = camera.GetCameraToProjectionMatrix();
-			m_depth_pass->Render(world, world_to_camera, camera_to_projection);
+			m_depth_pass->Render(m_draw_lists, 
+								 world_to_camera, camera_to_projection);
 		}
 
 		//---------------------------------------------------------------------
 		// Forward: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->Render(world, world_to_projection,
+		m_forward_pass->Render(m_draw_lists, 
 							   camera.GetSettings().GetBRDF(), vct);
 
 		//---------------------------------------------------------------------
@@ -707,34 +896,25 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
+		m_forward_pass->RenderTransparent(m_draw_lists, 
 										  camera.GetSettings().GetBRDF(), vct);
 	}
 
 	void XM_CALLCONV Renderer::Impl::RenderDeferred(const World& world, 
 													const Camera& camera, 
-													FXMMATRIX world_to_projection) {
+													FXMMATRIX world_to_camera, 
+													CXMMATRIX camera_to_projection) {
 
 		const auto vct = camera.GetSettings().GetVoxelizationSettings().UsesVCT();
 
 		//---------------------------------------------------------------------
 		// LBuffer + Voxelization
 		//---------------------------------------------------------------------
+		// TODO: world_to_camera + world_to_voxel for culling
+		m_lbuffer_pass->Render(world, m_model_culler, 
+		                       world_to_camera, camera_to_projection);
 		if (vct) {
-			const auto world_to_voxel
-				= VoxelizationSettings::GetWorldToVoxelMatrix();
-
-			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
-
-			const auto voxel_grid_resolution
-				= VoxelizationSettings::GetVoxelGridResolution();
-			
-			m_voxelization_pass->Render(world, world_to_voxel,
-										voxel_grid_resolution);
-		}
-		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			RenderVoxelization();
 		}
 
 		const Viewport viewport(camera.GetViewport(),
@@ -745,7 +925,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// GBuffer: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderGBuffer(world, world_to_projection);
+		m_forward_pass->RenderGBuffer(m_draw_lists);
 
 		m_output_manager->BindEndGBuffer(m_device_context);
 		m_output_manager->BindBeginDeferred(m_device_context);
@@ -767,7 +947,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: emissive fragments.
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderEmissive(world, world_to_projection);
+		m_forward_pass->RenderEmissive(m_draw_lists);
 
 		//---------------------------------------------------------------------
 		// Perform a sky pass.
@@ -777,18 +957,20 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection, 
+		m_forward_pass->RenderTransparent(m_draw_lists, 
 										  camera.GetSettings().GetBRDF(), vct);
 	}
 
 	void XM_CALLCONV Renderer::Impl::RenderSolid(const World& world, 
 												 const Camera& camera, 
-												 FXMMATRIX world_to_projection) {
+												 FXMMATRIX world_to_camera, 
+												 CXMMATRIX camera_to_projection) {
 
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, m_model_culler, 
+		                       world_to_camera, camera_to_projection);
 
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -798,13 +980,11 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderSolid(world, world_to_projection);
+		m_forward_pass->RenderSolid(m_draw_lists);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderFalseColor(const World& world, 
-													  const Camera& camera, 
-													  FXMMATRIX world_to_projection, 
-													  FalseColor false_color) {
+	void Renderer::Impl::RenderFalseColor(const Camera& camera, 
+										  FalseColor false_color) {
 		
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -814,29 +994,25 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderFalseColor(world, world_to_projection, false_color);
+		m_forward_pass->RenderFalseColor(m_draw_lists, false_color);
 	}
 
 	void XM_CALLCONV Renderer::Impl::RenderVoxelGrid(const World& world, 
 													 const Camera& camera, 
-													 FXMMATRIX world_to_projection) {
+													 FXMMATRIX world_to_camera, 
+													 CXMMATRIX camera_to_projection) {
 
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, m_model_culler, 
+		                       world_to_camera, camera_to_projection);
 
 		//---------------------------------------------------------------------
 		// Voxelization
 		//---------------------------------------------------------------------
-		const auto world_to_voxel
-			= VoxelizationSettings::GetWorldToVoxelMatrix();
-		const auto voxel_grid_resolution
-			= VoxelizationSettings::GetVoxelGridResolution();
-		m_voxelization_pass->Render(world, world_to_voxel,
-									voxel_grid_resolution);
+		RenderVoxelization();
 
-	
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
@@ -845,7 +1021,30 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Voxel Grid
 		//---------------------------------------------------------------------
-		m_voxel_grid_pass->Render(voxel_grid_resolution);
+		m_voxel_grid_pass->Render(
+			VoxelizationSettings::GetVoxelGridResolution());
+	}
+
+	void Renderer::Impl::RenderVoxelization() {
+		const auto world_to_voxel
+			= VoxelizationSettings::GetWorldToVoxelMatrix();
+		const auto voxel_grid_resolution
+			= VoxelizationSettings::GetVoxelGridResolution();
+
+		m_model_culler.Cull(world_to_voxel, m_voxelized_models);
+		// Only the models overlapping dirty bricks are revoxelized.
+		m_voxel_bricks.Update(m_voxelized_models, 
+		                      VoxelizationSettings::GetVoxelGridCenter(), 
+		                      VoxelizationSettings::GetVoxelSize(), 
+		                      voxel_grid_resolution, 
+		                      m_lbuffer_pass->GetVersion());
+		m_voxelized_draw_lists.Build(m_voxel_bricks.GetDirtyModels(), 
+		                             world_to_voxel, 
+		                             XMMatrixIdentity(), 
+		                             DrawLists::s_voxelization_lod_bias);
+		m_voxelization_pass->Render(m_voxel_bricks, 
+		                            m_voxelized_draw_lists, 
+		                            voxel_grid_resolution);
 	}
 
 	void Renderer::Impl::RenderPostProcessing(const Camera& camera) {
@@ -930,12 +1129,16 @@ namespace mage::rendering {
 					   ID3D11DeviceContext& device_context,
 					   DisplayConfiguration& display_configuration,
 					   SwapChain& swap_chain,
-					   ResourceManager& resource_manager)
+					   ResourceManager& resource_manager,
+					   FrameMemoryArena& frame_memory,
+					   JobSystem& job_system)
 		: m_impl(MakeUnique< Impl >(device,
 									device_context,
 									display_configuration,
 									swap_chain,
-									resource_manager)) {}
+									resource_manager,
+									frame_memory,
+									job_system)) {}
 
 	Renderer::Renderer(Renderer&& renderer) noexcept = default;
 
@@ -947,9 +1150,21 @@ namespace mage::rendering {
 		m_impl->BindPersistentState();
 	}
 
+	void Renderer::PrewarmShaders() {
+		m_impl->PrewarmShaders();
+	}
+
 	void Renderer::Render(const World& world, const GameTime& time) {
 		m_impl->Render(world, time);
 	}
 
+	void Renderer::SubmitUploads() noexcept {
+		m_impl->SubmitUploads();
+	}
+
+	void Renderer::ExecuteUploads(ID3D11DeviceContext& device_context) noexcept {
+		m_impl->ExecuteUploads(device_context);
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
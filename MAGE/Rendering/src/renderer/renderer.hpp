@@ -6,6 +6,8 @@
 #pragma region
 
 #include "renderer\swap_chain.hpp"
+#include "memory\frame_memory_arena.hpp"
+#include "parallel\job_system.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
 #include "system\game_timer.hpp"
@@ -41,12 +43,18 @@ namespace mage::rendering {
 						A reference to the swap chain.
 		 @param[in]		resource_manager
 						A pointer to the resource manager.
+		 @param[in]		frame_memory
+						A reference to the frame memory arena.
+		 @param[in]		job_system
+						A reference to the job system.
 		 */
 		explicit Renderer(ID3D11Device& device,
 						  ID3D11DeviceContext& device_context,
 						  DisplayConfiguration& display_configuration,
 						  SwapChain& swap_chain,
-						  ResourceManager& resource_manager);
+						  ResourceManager& resource_manager,
+						  FrameMemoryArena& frame_memory,
+						  JobSystem& job_system);
 
 		/**
 		 Constructs a renderer from the given renderer.
@@ -104,6 +112,14 @@ namespace mage::rendering {
 		 */
 		void BindPersistentState();
 
+		/**
+		 Creates all shader permutations used by the passes of this renderer.
+
+		 @throws		Exception
+						Failed to create a shader.
+		 */
+		void PrewarmShaders();
+
 		/**
 		 Renders the given world.
 
@@ -116,6 +132,25 @@ namespace mage::rendering {
 		 */
 		void Render(const World& world, const GameTime& time);
 
+		/**
+		 Submits the uploads of this renderer of the last rendered frame. 
+		 Only uploads of a deferred device context are submitted; other 
+		 uploads are applied immediately.
+
+		 @pre			The previously submitted uploads are executed.
+		 */
+		void SubmitUploads() noexcept;
+
+		/**
+		 Executes the submitted uploads of this renderer. This must be called 
+		 before executing the command list of the frame of the submitted 
+		 uploads.
+
+		 @param[in]		device_context
+						A reference to the immediate device context.
+		 */
+		void ExecuteUploads(ID3D11DeviceContext& device_context) noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
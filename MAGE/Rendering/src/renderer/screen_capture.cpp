@@ -0,0 +1,282 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\screen_capture.hpp"
+#include "loaders\texture_loader.hpp"
+#include "logging\error.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	ScreenCapture::ScreenCapture(ID3D11Device& device,
+								 ID3D11DeviceContext& device_context)
+		: m_device(device),
+		m_device_context(device_context),
+		m_slots{},
+		m_next_slot(0u),
+		m_frame(0u),
+		m_request_mutex(),
+		m_screenshot_fname(),
+		m_frame_prefix(),
+		m_frame_index(0u),
+		m_nb_dropped_frames(0u),
+		m_image_mutex(),
+		m_image_condition(),
+		m_images(),
+		m_buffers(),
+		m_terminate(false),
+		m_thread() {
+
+		m_thread = std::thread(&ScreenCapture::Encode, this);
+	}
+
+	ScreenCapture::~ScreenCapture() {
+		// Read back the pending captured frames in capture order.
+		for (size_t i = 0u; i < s_nb_slots; ++i) {
+			auto& slot = m_slots[(m_next_slot + i) % s_nb_slots];
+			if (slot.m_pending) {
+				ReadBack(slot, true);
+			}
+		}
+
+		{
+			const std::scoped_lock lock(m_image_mutex);
+			m_terminate = true;
+		}
+		m_image_condition.notify_one();
+
+		m_thread.join();
+	}
+
+	void ScreenCapture::RequestScreenShot(std::wstring fname) {
+		const std::scoped_lock lock(m_request_mutex);
+		m_screenshot_fname = std::move(fname);
+	}
+
+	void ScreenCapture::StartFrameCapture(std::wstring prefix) {
+		const std::scoped_lock lock(m_request_mutex);
+		m_frame_prefix      = std::move(prefix);
+		m_frame_index       = 0u;
+		m_nb_dropped_frames = 0u;
+	}
+
+	void ScreenCapture::StopFrameCapture() noexcept {
+		const std::scoped_lock lock(m_request_mutex);
+		if (0u != m_nb_dropped_frames) {
+			Warning("Frame capture dropped %u of %u frames.",
+					m_nb_dropped_frames, m_frame_index);
+		}
+
+		m_frame_prefix.clear();
+	}
+
+	[[nodiscard]]
+	bool ScreenCapture::IsCapturingFrames() const noexcept {
+		const std::scoped_lock lock(m_request_mutex);
+		return !m_frame_prefix.empty();
+	}
+
+	void ScreenCapture::Capture(DXGISwapChain& swap_chain) noexcept {
+		++m_frame;
+
+		// Read back the captured frames which are old enough.
+		for (auto& slot : m_slots) {
+			if (slot.m_pending && s_latency <= m_frame - slot.m_frame) {
+				ReadBack(slot, false);
+			}
+		}
+
+		auto fname = ConsumeRequest();
+		if (fname.empty()) {
+			return;
+		}
+
+		try {
+			ComPtr< ID3D11Texture2D > back_buffer;
+			{
+				// Access the only back buffer of the swap-chain.
+				const HRESULT result = swap_chain.GetBuffer(0u,
+															__uuidof(ID3D11Texture2D),
+															(void**)back_buffer.GetAddressOf());
+				ThrowIfFailed(result,
+							  "Back buffer texture creation failed: %08X.", result);
+			}
+
+			// The ring of slots is full if the next slot is still pending.
+			auto& slot = m_slots[m_next_slot];
+			if (slot.m_pending) {
+				ReadBack(slot, true);
+			}
+
+			CopyToSlot(slot, *back_buffer.Get());
+			slot.m_fname   = std::move(fname);
+			slot.m_frame   = m_frame;
+			slot.m_pending = true;
+
+			m_next_slot = (m_next_slot + 1u) % s_nb_slots;
+		}
+		catch (const std::exception& e) {
+			Warning("Screen capture failed: %s", e.what());
+		}
+	}
+
+	[[nodiscard]]
+	const std::wstring ScreenCapture::ConsumeRequest() {
+		const std::scoped_lock lock(m_request_mutex);
+
+		if (!m_screenshot_fname.empty()) {
+			std::wstring fname;
+			fname.swap(m_screenshot_fname);
+			return fname;
+		}
+
+		if (m_frame_prefix.empty()) {
+			return {};
+		}
+
+		wchar_t suffix[16];
+		_snwprintf_s(suffix, std::size(suffix), L"-%06u.png", m_frame_index++);
+		return m_frame_prefix + suffix;
+	}
+
+	void ScreenCapture::CopyToSlot(Slot& slot, ID3D11Texture2D& back_buffer) {
+		D3D11_TEXTURE2D_DESC desc;
+		back_buffer.GetDesc(&desc);
+
+		// (Re)create the staging texture if the back buffer changed.
+		bool compatible = (nullptr != slot.m_texture);
+		if (compatible) {
+			D3D11_TEXTURE2D_DESC texture_desc;
+			slot.m_texture->GetDesc(&texture_desc);
+			compatible = (desc.Width  == texture_desc.Width)
+				      && (desc.Height == texture_desc.Height)
+				      && (desc.Format == texture_desc.Format);
+		}
+
+		if (!compatible) {
+			desc.MipLevels      = 1u;
+			desc.ArraySize      = 1u;
+			desc.Usage          = D3D11_USAGE_STAGING;
+			desc.BindFlags      = 0u;
+			desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+			desc.MiscFlags      = 0u;
+
+			const HRESULT result = m_device.get().CreateTexture2D(
+				&desc, nullptr, slot.m_texture.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result,
+						  "Staging texture creation failed: %08X.", result);
+		}
+
+		m_device_context.get().CopyResource(slot.m_texture.Get(), &back_buffer);
+	}
+
+	bool ScreenCapture::ReadBack(Slot& slot, bool wait) noexcept {
+		auto& device_context = m_device_context.get();
+
+		D3D11_MAPPED_SUBRESOURCE mapped_texture;
+		const HRESULT result = device_context.Map(
+			slot.m_texture.Get(), 0u, D3D11_MAP_READ,
+			wait ? 0u : D3D11_MAP_FLAG_DO_NOT_WAIT, &mapped_texture);
+		if (DXGI_ERROR_WAS_STILL_DRAWING == result) {
+			return false;
+		}
+
+		slot.m_pending = false;
+
+		if (FAILED(result)) {
+			Warning("Staging texture mapping failed: %08X.", result);
+			return true;
+		}
+
+		D3D11_TEXTURE2D_DESC desc;
+		slot.m_texture->GetDesc(&desc);
+
+		Image image;
+		image.m_fname     = std::move(slot.m_fname);
+		image.m_format    = desc.Format;
+		image.m_width     = desc.Width;
+		image.m_height    = desc.Height;
+		image.m_row_pitch = mapped_texture.RowPitch;
+
+		{
+			const std::scoped_lock lock(m_image_mutex);
+
+			if (s_max_nb_images <= m_images.size()) {
+				device_context.Unmap(slot.m_texture.Get(), 0u);
+
+				const std::scoped_lock request_lock(m_request_mutex);
+				++m_nb_dropped_frames;
+				return true;
+			}
+
+			// Reuse a pixel buffer of an encoded image.
+			if (!m_buffers.empty()) {
+				image.m_data = std::move(m_buffers.back());
+				m_buffers.pop_back();
+			}
+		}
+
+		const auto size = static_cast< size_t >(mapped_texture.RowPitch) 
+			            * desc.Height;
+		image.m_data.resize(size);
+		memcpy(image.m_data.data(), mapped_texture.pData, size);
+
+		device_context.Unmap(slot.m_texture.Get(), 0u);
+
+		{
+			const std::scoped_lock lock(m_image_mutex);
+			m_images.push_back(std::move(image));
+		}
+		m_image_condition.notify_one();
+
+		return true;
+	}
+
+	void ScreenCapture::Encode() noexcept {
+		// WIC is a COM component.
+		const HRESULT result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+		while (true) {
+			Image image;
+			{
+				std::unique_lock lock(m_image_mutex);
+				m_image_condition.wait(lock, [this]() noexcept {
+					return !m_images.empty() || m_terminate;
+				});
+
+				if (m_images.empty()) {
+					break;
+				}
+
+				image = std::move(m_images.front());
+				m_images.pop_front();
+			}
+
+			try {
+				loader::ExportImageToFile(image.m_fname,
+										  image.m_format,
+										  image.m_width,
+										  image.m_height,
+										  image.m_row_pitch,
+										  NotNull< const U8* >(image.m_data.data()));
+			}
+			catch (const std::exception& e) {
+				Warning("Screen capture encoding failed: %s", e.what());
+			}
+
+			const std::scoped_lock lock(m_image_mutex);
+			m_buffers.push_back(std::move(image.m_data));
+		}
+
+		if (SUCCEEDED(result)) {
+			CoUninitialize();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,378 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "direct3d11.hpp"
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of screen captures.
+
+	 A screen capture copies the back buffer into one of a small ring of
+	 staging textures right before presenting. The staging textures are only
+	 mapped a few frames later (i.e. once the GPU finished the copy), and the
+	 pixels are handed to a background encoder thread. Capturing thus neither
+	 stalls the pipeline nor the thread presenting the frames, which allows
+	 capturing continuous frame sequences.
+	 */
+	class ScreenCapture {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a screen capture.
+
+		 @param[in]		device
+						A reference to the device.
+		 @param[in]		device_context
+						A reference to the device context.
+		 */
+		explicit ScreenCapture(ID3D11Device& device,
+							   ID3D11DeviceContext& device_context);
+
+		/**
+		 Constructs a screen capture from the given screen capture.
+
+		 @param[in]		capture
+						A reference to the screen capture to copy.
+		 */
+		ScreenCapture(const ScreenCapture& capture) = delete;
+
+		/**
+		 Constructs a screen capture by moving the given screen capture.
+
+		 @param[in]		capture
+						A reference to the screen capture to move.
+		 */
+		ScreenCapture(ScreenCapture&& capture) = delete;
+
+		/**
+		 Destructs this screen capture. All pending captures are encoded
+		 first.
+		 */
+		~ScreenCapture();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given screen capture to this screen capture.
+
+		 @param[in]		capture
+						A reference to the screen capture to copy.
+		 @return		A reference to the copy of the given screen capture
+						(i.e. this screen capture).
+		 */
+		ScreenCapture& operator=(const ScreenCapture& capture) = delete;
+
+		/**
+		 Moves the given screen capture to this screen capture.
+
+		 @param[in]		capture
+						A reference to the screen capture to move.
+		 @return		A reference to the moved screen capture (i.e. this
+						screen capture).
+		 */
+		ScreenCapture& operator=(ScreenCapture&& capture) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Requests a screenshot of the next presented frame. This method can be
+		 called from any thread.
+
+		 @param[in]		fname
+						The filename.
+		 */
+		void RequestScreenShot(std::wstring fname);
+
+		/**
+		 Starts capturing all presented frames. This method can be called from
+		 any thread.
+
+		 @param[in]		prefix
+						The filename prefix of the captured frames. The
+						frames are saved as "<prefix>-<frame>.png".
+		 */
+		void StartFrameCapture(std::wstring prefix);
+
+		/**
+		 Stops capturing all presented frames. This method can be called from
+		 any thread.
+		 */
+		void StopFrameCapture() noexcept;
+
+		/**
+		 Checks whether this screen capture captures all presented frames.
+
+		 @return		@c true if this screen capture captures all presented
+						frames. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsCapturingFrames() const noexcept;
+
+		/**
+		 Captures the back buffer of the given swap chain (if requested) and
+		 reads back the previously captured frames which are available.
+
+		 Call this method on the thread presenting the frames right before
+		 presenting.
+
+		 @param[in]		swap_chain
+						A reference to the swap chain.
+		 */
+		void Capture(DXGISwapChain& swap_chain) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of staging slots containing a captured frame which is not
+		 read back yet.
+		 */
+		struct Slot {
+
+			/**
+			 A pointer to the staging texture of this slot.
+			 */
+			ComPtr< ID3D11Texture2D > m_texture;
+
+			/**
+			 The filename of the captured frame of this slot.
+			 */
+			std::wstring m_fname;
+
+			/**
+			 The index of the frame in which this slot was captured.
+			 */
+			U64 m_frame;
+
+			/**
+			 A flag indicating whether this slot contains a captured frame
+			 which is not read back yet.
+			 */
+			bool m_pending;
+		};
+
+		/**
+		 A struct of images waiting to be encoded.
+		 */
+		struct Image {
+
+			/**
+			 The filename of this image.
+			 */
+			std::wstring m_fname;
+
+			/**
+			 The pixel format of this image.
+			 */
+			DXGI_FORMAT m_format;
+
+			/**
+			 The width in pixels of this image.
+			 */
+			U32 m_width;
+
+			/**
+			 The height in pixels of this image.
+			 */
+			U32 m_height;
+
+			/**
+			 The size in bytes of a row of this image.
+			 */
+			U32 m_row_pitch;
+
+			/**
+			 The pixels of this image.
+			 */
+			std::vector< U8 > m_data;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of staging slots of screen captures.
+		 */
+		static constexpr size_t s_nb_slots = 3u;
+
+		/**
+		 The number of frames after which a captured frame is read back.
+		 */
+		static constexpr U64 s_latency = 2u;
+
+		/**
+		 The maximum number of images waiting to be encoded. Additional
+		 captured frames are dropped.
+		 */
+		static constexpr size_t s_max_nb_images = 8u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the filename of the frame to capture (if any).
+
+		 @return		The filename of the frame to capture. The filename is
+						empty if the frame does not need to be captured.
+		 */
+		[[nodiscard]]
+		const std::wstring ConsumeRequest();
+
+		/**
+		 Copies the given back buffer to the given slot.
+
+		 @param[in]		slot
+						A reference to the slot.
+		 @param[in]		back_buffer
+						A reference to the back buffer.
+		 @throws		Exception
+						Failed to create the staging texture.
+		 */
+		void CopyToSlot(Slot& slot, ID3D11Texture2D& back_buffer);
+
+		/**
+		 Reads back the captured frame of the given slot and hands it to the
+		 encoder thread.
+
+		 @param[in]		slot
+						A reference to the slot.
+		 @param[in]		wait
+						@c true if this method may wait for the GPU to finish
+						the copy. @c false otherwise.
+		 @return		@c true if the captured frame is read back. @c false
+						if the GPU did not finish the copy yet.
+		 */
+		bool ReadBack(Slot& slot, bool wait) noexcept;
+
+		/**
+		 Encodes the captured frames on the encoder thread until this screen
+		 capture terminates.
+		 */
+		void Encode() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the device of this screen capture.
+		 */
+		std::reference_wrapper< ID3D11Device > m_device;
+
+		/**
+		 A reference to the device context of this screen capture.
+		 */
+		std::reference_wrapper< ID3D11DeviceContext > m_device_context;
+
+		/**
+		 The staging slots of this screen capture.
+		 */
+		Slot m_slots[s_nb_slots];
+
+		/**
+		 The index of the next staging slot of this screen capture.
+		 */
+		size_t m_next_slot;
+
+		/**
+		 The index of the current frame of this screen capture.
+		 */
+		U64 m_frame;
+
+		/**
+		 The mutex guarding the requests of this screen capture.
+		 */
+		mutable std::mutex m_request_mutex;
+
+		/**
+		 The filename of the requested screenshot of this screen capture.
+		 */
+		std::wstring m_screenshot_fname;
+
+		/**
+		 The filename prefix of the captured frames of this screen capture.
+		 The prefix is empty if no frames are captured.
+		 */
+		std::wstring m_frame_prefix;
+
+		/**
+		 The index of the next captured frame of this screen capture.
+		 */
+		U32 m_frame_index;
+
+		/**
+		 The number of captured frames of this screen capture which were
+		 dropped because the encoder thread fell behind.
+		 */
+		U32 m_nb_dropped_frames;
+
+		/**
+		 The mutex guarding the images of this screen capture.
+		 */
+		std::mutex m_image_mutex;
+
+		/**
+		 The condition variable signaled when an image is added or when this
+		 screen capture terminates.
+		 */
+		std::condition_variable m_image_condition;
+
+		/**
+		 The images of this screen capture waiting to be encoded.
+		 */
+		std::deque< Image > m_images;
+
+		/**
+		 The pixel buffers of this screen capture available for reuse.
+		 */
+		std::vector< std::vector< U8 > > m_buffers;
+
+		/**
+		 A flag indicating whether this screen capture terminates.
+		 */
+		bool m_terminate;
+
+		/**
+		 The encoder thread of this screen capture.
+		 */
+		std::thread m_thread;
+	};
+}
\ No newline at end of file
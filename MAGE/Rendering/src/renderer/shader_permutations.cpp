@@ -0,0 +1,256 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\shader_permutations.hpp"
+#include "resource\shader\shader_factory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		//---------------------------------------------------------------------
+		// Permutation Counts
+		//---------------------------------------------------------------------
+
+		constexpr size_t g_nb_brdfs
+			= static_cast< size_t >(BRDF::Frostbite) + 1u;
+		constexpr size_t g_nb_false_colors
+			= static_cast< size_t >(FalseColor::UV) + 1u;
+		constexpr size_t g_nb_tone_mappings
+			= static_cast< size_t >(ToneMapping::Uncharted) + 1u;
+
+		//---------------------------------------------------------------------
+		// Pixel Shader Permutations
+		//---------------------------------------------------------------------
+
+		// [BRDF:2][transparency:1][VCT:1][TSNM:1]
+		constexpr size_t g_forward_ps_offset
+			= 0u;
+		// [transparency:1]
+		constexpr size_t g_forward_emissive_ps_offset
+			= g_forward_ps_offset + (g_nb_brdfs << 3u);
+		constexpr size_t g_forward_solid_ps_offset
+			= g_forward_emissive_ps_offset + 2u;
+		// [TSNM:1]
+		constexpr size_t g_gbuffer_ps_offset
+			= g_forward_solid_ps_offset + 1u;
+		// [BRDF:2][VCT:1]
+		constexpr size_t g_deferred_msaa_ps_offset
+			= g_gbuffer_ps_offset + 2u;
+		// [false color]
+		constexpr size_t g_false_color_ps_offset
+			= g_deferred_msaa_ps_offset + (g_nb_brdfs << 1u);
+		// [TSNM:1]
+		constexpr size_t g_voxelization_ps_offset
+			= g_false_color_ps_offset + g_nb_false_colors;
+		constexpr size_t g_voxelization_emissive_ps_offset
+			= g_voxelization_ps_offset + 2u;
+		constexpr size_t g_nb_pss
+			= g_voxelization_emissive_ps_offset + 1u;
+
+		//---------------------------------------------------------------------
+		// Compute Shader Permutations
+		//---------------------------------------------------------------------
+
+		// [BRDF:2][VCT:1]
+		constexpr size_t g_deferred_cs_offset
+			= 0u;
+		// [tone mapping]
+		constexpr size_t g_ldr_cs_offset
+			= g_deferred_cs_offset + (g_nb_brdfs << 1u);
+		constexpr size_t g_nb_css
+			= g_ldr_cs_offset + g_nb_tone_mappings;
+
+		/**
+		 Returns the shader of the given table entry. The shader is created
+		 first if the entry is still empty.
+
+		 @tparam		ShaderPtrT
+						The shader pointer type.
+		 @tparam		FactoryT
+						The factory type.
+		 @param[in,out]	shader
+						A reference to the table entry.
+		 @param[in]		factory
+						The factory creating the shader.
+		 @return		A reference to the shader of the given table entry.
+		 @throws		Exception
+						Failed to create the shader.
+		 */
+		template< typename ShaderPtrT, typename FactoryT >
+		[[nodiscard]]
+		inline const auto& GetOrCreate(ShaderPtrT& shader,
+									   const FactoryT& factory) {
+			if (nullptr == shader) {
+				shader = factory();
+			}
+
+			return *shader;
+		}
+	}
+
+	ShaderPermutations::ShaderPermutations(ResourceManager& resource_manager) noexcept
+		: m_resource_manager(resource_manager),
+		m_pss{},
+		m_css{} {
+
+		static_assert(g_nb_pss == ShaderPermutations::s_nb_pss);
+		static_assert(g_nb_css == ShaderPermutations::s_nb_css);
+	}
+
+	ShaderPermutations::ShaderPermutations(
+		ShaderPermutations&& permutations) noexcept = default;
+
+	ShaderPermutations::~ShaderPermutations() = default;
+
+	ShaderPermutations& ShaderPermutations
+		::operator=(ShaderPermutations&& permutations) noexcept = default;
+
+	void ShaderPermutations::Prewarm() {
+		for (size_t i = 0u; i < g_nb_brdfs; ++i) {
+			const auto brdf = static_cast< BRDF >(i);
+			for (const auto vct : { false, true }) {
+				for (const auto transparency : { false, true }) {
+					for (const auto tsnm : { false, true }) {
+						(void)GetForwardPS(brdf, transparency, vct, tsnm);
+					}
+				}
+
+				(void)GetDeferredMSAAPS(brdf, vct);
+				(void)GetDeferredCS(brdf, vct);
+			}
+		}
+
+		for (const auto flag : { false, true }) {
+			(void)GetForwardEmissivePS(flag);
+			(void)GetGBufferPS(flag);
+			(void)GetVoxelizationPS(flag);
+		}
+
+		(void)GetForwardSolidPS();
+		(void)GetVoxelizationEmissivePS();
+
+		for (size_t i = 0u; i < g_nb_false_colors; ++i) {
+			(void)GetFalseColorPS(static_cast< FalseColor >(i));
+		}
+
+		for (size_t i = 0u; i < g_nb_tone_mappings; ++i) {
+			(void)GetLowDynamicRangeCS(static_cast< ToneMapping >(i));
+		}
+	}
+
+	[[nodiscard]]
+	const PixelShader& ShaderPermutations::GetForwardEmissivePS(bool transparency) {
+		const auto index = g_forward_emissive_ps_offset
+			             + static_cast< size_t >(transparency);
+
+		return GetOrCreate(m_pss[index], [this, transparency]() {
+			return CreateForwardEmissivePS(m_resource_manager, transparency);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ShaderPermutations::GetForwardPS(BRDF brdf,
+														bool transparency,
+														bool vct,
+														bool tsnm) {
+
+		const auto index = g_forward_ps_offset
+			             + (static_cast< size_t >(brdf)         << 3u
+			             |  static_cast< size_t >(transparency) << 2u
+			             |  static_cast< size_t >(vct)          << 1u
+			             |  static_cast< size_t >(tsnm));
+
+		return GetOrCreate(m_pss[index], [this, brdf, transparency, vct, tsnm]() {
+			return CreateForwardPS(m_resource_manager,
+								   brdf, transparency, vct, tsnm);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ShaderPermutations::GetForwardSolidPS() {
+		return GetOrCreate(m_pss[g_forward_solid_ps_offset], [this]() {
+			return CreateForwardSolidPS(m_resource_manager);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ShaderPermutations::GetGBufferPS(bool tsnm) {
+		const auto index = g_gbuffer_ps_offset
+			             + static_cast< size_t >(tsnm);
+
+		return GetOrCreate(m_pss[index], [this, tsnm]() {
+			return CreateGBufferPS(m_resource_manager, tsnm);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ShaderPermutations::GetDeferredMSAAPS(BRDF brdf,
+															 bool vct) {
+
+		const auto index = g_deferred_msaa_ps_offset
+			             + (static_cast< size_t >(brdf) << 1u
+			             |  static_cast< size_t >(vct));
+
+		return GetOrCreate(m_pss[index], [this, brdf, vct]() {
+			return CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+		});
+	}
+
+	[[nodiscard]]
+	const ComputeShader& ShaderPermutations::GetDeferredCS(BRDF brdf,
+														   bool vct) {
+
+		const auto index = g_deferred_cs_offset
+			             + (static_cast< size_t >(brdf) << 1u
+			             |  static_cast< size_t >(vct));
+
+		return GetOrCreate(m_css[index], [this, brdf, vct]() {
+			return CreateDeferredCS(m_resource_manager, brdf, vct);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ShaderPermutations::GetFalseColorPS(FalseColor false_color) {
+		const auto index = g_false_color_ps_offset
+			             + static_cast< size_t >(false_color);
+
+		return GetOrCreate(m_pss[index], [this, false_color]() {
+			return CreateFalseColorPS(m_resource_manager, false_color);
+		});
+	}
+
+	[[nodiscard]]
+	const ComputeShader& ShaderPermutations::GetLowDynamicRangeCS(ToneMapping tone_mapping) {
+		const auto index = g_ldr_cs_offset
+			             + static_cast< size_t >(tone_mapping);
+
+		return GetOrCreate(m_css[index], [this, tone_mapping]() {
+			return CreateLowDynamicRangeCS(m_resource_manager, tone_mapping);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ShaderPermutations::GetVoxelizationEmissivePS() {
+		return GetOrCreate(m_pss[g_voxelization_emissive_ps_offset], [this]() {
+			return CreateVoxelizationEmissivePS(m_resource_manager);
+		});
+	}
+
+	[[nodiscard]]
+	const PixelShader& ShaderPermutations::GetVoxelizationPS(bool tsnm) {
+		const auto index = g_voxelization_ps_offset
+			             + static_cast< size_t >(tsnm);
+
+		return GetOrCreate(m_pss[index], [this, tsnm]() {
+			return CreateVoxelizationPS(m_resource_manager, tsnm);
+		});
+	}
+}
\ No newline at end of file
@@ -0,0 +1,283 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\configuration.hpp"
+#include "resource\rendering_resource_manager.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of shader permutation tables.
+
+	 A shader permutation table resolves each (BRDF, transparency, VCT, TSNM,
+	 MSAA, false color, tone mapping) permutation of the pass shaders at most
+	 once through the resource manager and stores the resulting shader in a
+	 dense table indexed by the bitmask of the permutation. Permutations are
+	 resolved on first use or all at once by prewarming the table.
+	 */
+	class ShaderPermutations {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shader permutation table.
+
+		 @param[in]		resource_manager
+						A reference to the resource manager.
+		 */
+		explicit ShaderPermutations(ResourceManager& resource_manager) noexcept;
+
+		/**
+		 Constructs a shader permutation table from the given shader
+		 permutation table.
+
+		 @param[in]		permutations
+						A reference to the shader permutation table to copy.
+		 */
+		ShaderPermutations(const ShaderPermutations& permutations) = delete;
+
+		/**
+		 Constructs a shader permutation table by moving the given shader
+		 permutation table.
+
+		 @param[in]		permutations
+						A reference to the shader permutation table to move.
+		 */
+		ShaderPermutations(ShaderPermutations&& permutations) noexcept;
+
+		/**
+		 Destructs this shader permutation table.
+		 */
+		~ShaderPermutations();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shader permutation table to this shader permutation
+		 table.
+
+		 @param[in]		permutations
+						A reference to the shader permutation table to copy.
+		 @return		A reference to the copy of the given shader permutation
+						table (i.e. this shader permutation table).
+		 */
+		ShaderPermutations& operator=(
+			const ShaderPermutations& permutations) = delete;
+
+		/**
+		 Moves the given shader permutation table to this shader permutation
+		 table.
+
+		 @param[in]		permutations
+						A reference to the shader permutation table to move.
+		 @return		A reference to the moved shader permutation table (i.e.
+						this shader permutation table).
+		 */
+		ShaderPermutations& operator=(
+			ShaderPermutations&& permutations) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Resolves all permutations of this shader permutation table.
+
+		 @throws		Exception
+						Failed to create a shader.
+		 */
+		void Prewarm();
+
+		/**
+		 Returns the forward emissive pixel shader.
+
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @return		A reference to the forward emissive pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetForwardEmissivePS(bool transparency);
+
+		/**
+		 Returns the forward pixel shader matching the given BRDF.
+
+		 @param[in]		brdf
+						The BRDF function.
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @param[in]		vct
+						@c true if voxel cone tracing should be enabled. @c false
+						otherwise.
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the forward pixel shader matching the
+						given BRDF.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetForwardPS(BRDF brdf,
+										bool transparency,
+										bool vct,
+										bool tsnm);
+
+		/**
+		 Returns the forward solid pixel shader.
+
+		 @return		A reference to the forward solid pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetForwardSolidPS();
+
+		/**
+		 Returns the GBuffer pixel shader.
+
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the GBuffer pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetGBufferPS(bool tsnm);
+
+		/**
+		 Returns the deferred MSAA pixel shader matching the given BRDF.
+
+		 @param[in]		brdf
+						The BRDF function.
+		 @param[in]		vct
+						@c true if voxel cone tracing should be enabled. @c false
+						otherwise.
+		 @return		A reference to the deferred MSAA pixel shader matching
+						the given BRDF.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetDeferredMSAAPS(BRDF brdf, bool vct);
+
+		/**
+		 Returns the deferred compute shader matching the given BRDF.
+
+		 @param[in]		brdf
+						The BRDF function.
+		 @param[in]		vct
+						@c true if voxel cone tracing should be enabled. @c false
+						otherwise.
+		 @return		A reference to the deferred compute shader matching the
+						given BRDF.
+		 @throws		Exception
+						Failed to create the compute shader.
+		 */
+		[[nodiscard]]
+		const ComputeShader& GetDeferredCS(BRDF brdf, bool vct);
+
+		/**
+		 Returns the false color pixel shader.
+
+		 @param[in]		false_color
+						The false color.
+		 @return		A reference to the false color pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetFalseColorPS(FalseColor false_color);
+
+		/**
+		 Returns the low-dynamic-range compute shader.
+
+		 @param[in]		tone_mapping
+						The tone mapping function.
+		 @return		A reference to the low-dynamic-range compute shader.
+		 @throws		Exception
+						Failed to create the compute shader.
+		 */
+		[[nodiscard]]
+		const ComputeShader& GetLowDynamicRangeCS(ToneMapping tone_mapping);
+
+		/**
+		 Returns the voxelization emissive pixel shader.
+
+		 @return		A reference to the voxelization emissive pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetVoxelizationEmissivePS();
+
+		/**
+		 Returns the voxelization pixel shader.
+
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the voxelization pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		[[nodiscard]]
+		const PixelShader& GetVoxelizationPS(bool tsnm);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of pixel shader permutations.
+		 */
+		static constexpr size_t s_nb_pss = 67u;
+
+		/**
+		 The number of compute shader permutations.
+		 */
+		static constexpr size_t s_nb_css = 13u;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the resource manager of this shader permutation table.
+		 */
+		std::reference_wrapper< ResourceManager > m_resource_manager;
+
+		/**
+		 The pixel shaders of this shader permutation table indexed by
+		 permutation.
+		 */
+		PixelShaderPtr m_pss[s_nb_pss];
+
+		/**
+		 The compute shaders of this shader permutation table indexed by
+		 permutation.
+		 */
+		ComputeShaderPtr m_css[s_nb_css];
+	};
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "renderer\swap_chain.hpp"
 #include "renderer\pipeline.hpp"
+#include "renderer\screen_capture.hpp"
 #include "loaders\texture_loader.hpp"
 #include "exception\exception.hpp"
 
@@ -208,6 +209,45 @@ namespace mage::rendering {
 		 */
 		void TakeScreenShot(const std::wstring& fname) const;
 
+		/**
+		 Requests an asynchronous screenshot of the next presented back buffer 
+		 of this swap chain.
+
+		 @param[in]		fname
+						The filename.
+		 */
+		void RequestScreenShot(std::wstring fname) const {
+			m_screen_capture->RequestScreenShot(std::move(fname));
+		}
+
+		/**
+		 Starts capturing all presented back buffers of this swap chain.
+
+		 @param[in]		prefix
+						The filename prefix of the captured frames.
+		 */
+		void StartFrameCapture(std::wstring prefix) const {
+			m_screen_capture->StartFrameCapture(std::move(prefix));
+		}
+
+		/**
+		 Stops capturing all presented back buffers of this swap chain.
+		 */
+		void StopFrameCapture() const noexcept {
+			m_screen_capture->StopFrameCapture();
+		}
+
+		/**
+		 Checks whether this swap chain captures all presented back buffers.
+
+		 @return		@c true if this swap chain captures all presented back 
+						buffers. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsCapturingFrames() const noexcept {
+			return m_screen_capture->IsCapturingFrames();
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -316,6 +356,11 @@ namespace mage::rendering {
 		 chain.
 		 */
 		ComPtr< ID3D11RenderTargetView > m_rtv;
+
+		/**
+		 A pointer to the screen capture of this swap chain.
+		 */
+		UniquePtr< ScreenCapture > m_screen_capture;
 	};
 
 	SwapChain::Impl::Impl(ID3D11Device& device,
@@ -327,7 +372,8 @@ namespace mage::rendering {
 		m_device(device), 
 		m_device_context(device_context), 
 		m_swap_chain(), 
-		m_rtv() {
+		m_rtv(), 
+		m_screen_capture(MakeUnique< ScreenCapture >(device, device_context)) {
 
 		// Setup the swap chain.
 		SetupSwapChain();
@@ -462,6 +508,10 @@ namespace mage::rendering {
 		// Present the back buffer to the front buffer.
 		const U32 sync_interval = (m_display_configuration.IsVSynced()) 
 			                      ? 1u : 0u;
+
+		// Capture the back buffer (if requested).
+		m_screen_capture->Capture(*m_swap_chain.Get());
+
 		m_swap_chain->Present(sync_interval, 0u);
 	}
 
@@ -562,5 +612,22 @@ namespace mage::rendering {
 		m_impl->TakeScreenShot(fname);
 	}
 
+	void SwapChain::RequestScreenShot(std::wstring fname) const {
+		m_impl->RequestScreenShot(std::move(fname));
+	}
+
+	void SwapChain::StartFrameCapture(std::wstring prefix) const {
+		m_impl->StartFrameCapture(std::move(prefix));
+	}
+
+	void SwapChain::StopFrameCapture() const noexcept {
+		m_impl->StopFrameCapture();
+	}
+
+	[[nodiscard]]
+	bool SwapChain::IsCapturingFrames() const noexcept {
+		return m_impl->IsCapturingFrames();
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
@@ -187,6 +187,43 @@ namespace mage::rendering {
 		 */
 		void TakeScreenShot(const std::wstring& fname) const;
 
+		/**
+		 Requests a screenshot of the next presented back buffer of this swap 
+		 chain. Unlike {@link mage::rendering::SwapChain::TakeScreenShot}, 
+		 the back buffer is read back a few frames later and encoded on a 
+		 background thread. This method can be called from any thread.
+
+		 @param[in]		fname
+						The filename.
+		 */
+		void RequestScreenShot(std::wstring fname) const;
+
+		/**
+		 Starts capturing all presented back buffers of this swap chain (e.g., 
+		 for benchmark recordings). The frames are read back and encoded 
+		 asynchronously. This method can be called from any thread.
+
+		 @param[in]		prefix
+						The filename prefix of the captured frames. The 
+						frames are saved as "<prefix>-<frame>.png".
+		 */
+		void StartFrameCapture(std::wstring prefix) const;
+
+		/**
+		 Stops capturing all presented back buffers of this swap chain. This 
+		 method can be called from any thread.
+		 */
+		void StopFrameCapture() const noexcept;
+
+		/**
+		 Checks whether this swap chain captures all presented back buffers.
+
+		 @return		@c true if this swap chain captures all presented back 
+						buffers. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsCapturingFrames() const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
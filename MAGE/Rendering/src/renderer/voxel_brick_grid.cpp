@@ -0,0 +1,293 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\voxel_brick_grid.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Converts the given voxel index bounds to the corresponding brick
+		 index bounds.
+
+		 @param[in]		first
+						The minimum (inclusive) voxel index.
+		 @param[in]		last
+						The maximum (inclusive) voxel index.
+		 @param[in]		resolution
+						The resolution (in voxels) of the voxel grid.
+		 @param[out]	min
+						The minimum (inclusive) brick index.
+		 @param[out]	max
+						The maximum (inclusive) brick index.
+		 @return		@c true if the given voxel index bounds overlap the
+						voxel grid. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool ToBrickBounds(F32 first, F32 last, U32 resolution,
+						   U32& min, U32& max) noexcept {
+
+			const auto r = static_cast< F32 >(resolution);
+			if (last < 0.0f || r <= first) {
+				return false;
+			}
+
+			min = static_cast< U32 >(std::max(first, 0.0f))     / VOXEL_BRICK_RESOLUTION;
+			max = static_cast< U32 >(std::min(last,  r - 1.0f)) / VOXEL_BRICK_RESOLUTION;
+			return true;
+		}
+	}
+
+	VoxelBrickGrid::VoxelBrickGrid() noexcept
+		: m_center(),
+		m_voxel_size(0.0f),
+		m_resolution(0u),
+		m_brick_resolution(0u),
+		m_lighting_version(0u),
+		m_valid(false),
+		m_entries(),
+		m_next_entries(),
+		m_dirty_mask(),
+		m_dirty_bricks(),
+		m_brick_model_offsets(1u, 0u),
+		m_brick_models(),
+		m_dirty_models() {}
+
+	VoxelBrickGrid::VoxelBrickGrid(const VoxelBrickGrid& grid) = default;
+
+	VoxelBrickGrid::VoxelBrickGrid(VoxelBrickGrid&& grid) noexcept = default;
+
+	VoxelBrickGrid::~VoxelBrickGrid() = default;
+
+	VoxelBrickGrid& VoxelBrickGrid::operator=(const VoxelBrickGrid& grid) = default;
+
+	VoxelBrickGrid& VoxelBrickGrid::operator=(VoxelBrickGrid&& grid) noexcept = default;
+
+	void VoxelBrickGrid::Update(const std::vector< const Model* >& models,
+								const Point3& center,
+								F32 voxel_size,
+								U32 resolution,
+								U64 lighting_version) {
+
+		// A different voxel grid or a different lighting invalidates all
+		// bricks.
+		const bool invalidate = !m_valid
+			                  || (center           != m_center)
+			                  || (voxel_size       != m_voxel_size)
+			                  || (resolution       != m_resolution)
+			                  || (lighting_version != m_lighting_version);
+
+		m_center           = center;
+		m_voxel_size       = voxel_size;
+		m_resolution       = resolution;
+		m_brick_resolution = (resolution + VOXEL_BRICK_RESOLUTION - 1u)
+			               / VOXEL_BRICK_RESOLUTION;
+		m_lighting_version = lighting_version;
+		m_valid            = true;
+
+		const auto nb_bricks = GetNumberOfBricks();
+		m_dirty_mask.assign((nb_bricks + 31u) / 32u, 0u);
+		m_dirty_bricks.clear();
+
+		// Create the entries of the models.
+		m_next_entries.clear();
+		m_next_entries.reserve(models.size());
+		for (const auto model : models) {
+			Entry entry;
+			if (CreateEntry(*model, entry)) {
+				m_next_entries.push_back(entry);
+			}
+		}
+
+		const std::less< const Model* > less;
+		std::sort(m_next_entries.begin(), m_next_entries.end(),
+				  [&less](const Entry& lhs, const Entry& rhs) noexcept {
+			return less(lhs.m_model, rhs.m_model);
+		});
+
+		if (invalidate) {
+			m_dirty_bricks.resize(nb_bricks);
+			std::iota(m_dirty_bricks.begin(), m_dirty_bricks.end(), 0u);
+			std::fill(m_dirty_mask.begin(), m_dirty_mask.end(), 0xFFFFFFFFu);
+		}
+		else {
+			// Merge the previous and the next entries (both sorted by model):
+			// the bricks of added, removed and changed models become dirty.
+			auto prev = m_entries.cbegin();
+			auto next = m_next_entries.cbegin();
+			while (prev != m_entries.cend() || next != m_next_entries.cend()) {
+				if (next == m_next_entries.cend()
+					|| (prev != m_entries.cend() && less(prev->m_model, next->m_model))) {
+					// The model was removed.
+					MarkDirty(*prev++);
+				}
+				else if (prev == m_entries.cend()
+						 || less(next->m_model, prev->m_model)) {
+					// The model was added.
+					MarkDirty(*next++);
+				}
+				else {
+					if (prev->m_version != next->m_version
+						|| prev->m_min  != next->m_min
+						|| prev->m_max  != next->m_max) {
+						// The model was moved.
+						MarkDirty(*prev);
+						MarkDirty(*next);
+					}
+
+					++prev;
+					++next;
+				}
+			}
+
+			std::sort(m_dirty_bricks.begin(), m_dirty_bricks.end());
+		}
+
+		m_entries.swap(m_next_entries);
+
+		BuildModelLists();
+	}
+
+	[[nodiscard]]
+	bool VoxelBrickGrid::CreateEntry(const Model& model,
+									 Entry& entry) const noexcept {
+
+		const auto& transform       = model.GetOwner()->GetTransform();
+		const auto  object_to_world = transform.GetObjectToWorldMatrix();
+		const auto& aabb            = model.GetAABB();
+
+		// Transform the centroid and the extents: the extents of the
+		// world-space AABB are the absolute values of the rotated extents.
+		const auto centroid = XMVector3TransformCoord(aabb.Centroid(),
+													  object_to_world);
+		const auto e        = aabb.Radius();
+		const auto extents  = XMVectorSplatX(e) * XMVectorAbs(object_to_world.r[0])
+			                + XMVectorSplatY(e) * XMVectorAbs(object_to_world.r[1])
+			                + XMVectorSplatZ(e) * XMVectorAbs(object_to_world.r[2]);
+
+		if (XMVector3IsNaN(extents) || XMVector3IsInfinite(extents)) {
+			return false;
+		}
+
+		// [m_world] -> [voxels]
+		const auto r         = static_cast< F32 >(m_resolution);
+		const auto inv_size  = 1.0f / m_voxel_size;
+		const auto p_center  = XMLoad(m_center);
+		const auto p_min     = XMStore< F32x3 >(XMVectorFloor(
+			(centroid - extents - p_center) * inv_size + XMVectorReplicate(0.5f * r)));
+		const auto p_max     = XMStore< F32x3 >(XMVectorFloor(
+			(centroid + extents - p_center) * inv_size + XMVectorReplicate(0.5f * r)));
+
+		// The voxel indices use [0,R)x(R,0]x[0,R) (see WorldToVoxelIndex).
+		// The bounds are enlarged by one voxel, since the rasterized
+		// positions may slightly exceed the bounding volume.
+		const bool overlaps
+			=  ToBrickBounds(p_min[0] - 1.0f,     p_max[0] + 1.0f,     m_resolution,
+							 entry.m_min[0], entry.m_max[0])
+			&& ToBrickBounds(r - p_max[1] - 1.0f, r - p_min[1] + 1.0f, m_resolution,
+							 entry.m_min[1], entry.m_max[1])
+			&& ToBrickBounds(p_min[2] - 1.0f,     p_max[2] + 1.0f,     m_resolution,
+							 entry.m_min[2], entry.m_max[2]);
+
+		entry.m_model   = &model;
+		entry.m_version = transform.GetVersion();
+		return overlaps;
+	}
+
+	void VoxelBrickGrid::MarkDirty(const Entry& entry) {
+		const auto r = m_brick_resolution;
+		for (auto z = entry.m_min[2]; z <= entry.m_max[2]; ++z) {
+			for (auto y = entry.m_min[1]; y <= entry.m_max[1]; ++y) {
+				for (auto x = entry.m_min[0]; x <= entry.m_max[0]; ++x) {
+					MarkDirty(x + r * (y + r * z));
+				}
+			}
+		}
+	}
+
+	void VoxelBrickGrid::MarkDirty(U32 brick) {
+		auto& mask = m_dirty_mask[brick >> 5u];
+		const auto bit = 1u << (brick & 31u);
+		if (0u == (mask & bit)) {
+			mask |= bit;
+			m_dirty_bricks.push_back(brick);
+		}
+	}
+
+	void VoxelBrickGrid::BuildModelLists() {
+		const auto r = m_brick_resolution;
+
+		m_brick_model_offsets.assign(m_dirty_bricks.size() + 1u, 0u);
+		m_brick_models.clear();
+		m_dirty_models.clear();
+
+		// Calls the given action for each dirty brick overlapped by the given
+		// entry with the index of the brick into the dirty bricks.
+		const auto for_each_dirty_brick = [this, r](const Entry& entry,
+													auto&& action) {
+			for (auto z = entry.m_min[2]; z <= entry.m_max[2]; ++z) {
+				for (auto y = entry.m_min[1]; y <= entry.m_max[1]; ++y) {
+					for (auto x = entry.m_min[0]; x <= entry.m_max[0]; ++x) {
+						const U32 brick = x + r * (y + r * z);
+						if (!IsDirty(brick)) {
+							continue;
+						}
+
+						const auto it = std::lower_bound(m_dirty_bricks.cbegin(),
+														 m_dirty_bricks.cend(),
+														 brick);
+						action(static_cast< size_t >(it - m_dirty_bricks.cbegin()));
+					}
+				}
+			}
+		};
+
+		// Count the models of each dirty brick.
+		for (const auto& entry : m_entries) {
+			bool dirty = false;
+			for_each_dirty_brick(entry, [this, &dirty](size_t index) noexcept {
+				++m_brick_model_offsets[index + 1u];
+				dirty = true;
+			});
+
+			if (dirty) {
+				m_dirty_models.push_back(entry.m_model);
+			}
+		}
+
+		std::partial_sum(m_brick_model_offsets.cbegin(),
+						 m_brick_model_offsets.cend(),
+						 m_brick_model_offsets.begin());
+		m_brick_models.resize(m_brick_model_offsets.back());
+
+		// Distribute the models over the dirty bricks.
+		std::vector< U32 > offsets(m_brick_model_offsets.cbegin(),
+								   m_brick_model_offsets.cend() - 1);
+		for (const auto& entry : m_entries) {
+			for_each_dirty_brick(entry, [this, &entry, &offsets](size_t index) noexcept {
+				m_brick_models[offsets[index]++] = entry.m_model;
+			});
+		}
+	}
+}
\ No newline at end of file
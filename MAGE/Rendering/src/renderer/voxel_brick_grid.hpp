@@ -0,0 +1,377 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\rendering_world.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of voxel brick grids.
+
+	 A voxel brick grid partitions a voxel grid in bricks of
+	 @c VOXEL_BRICK_RESOLUTION^3 voxels and tracks which bricks need to be
+	 revoxelized. A brick becomes dirty if a model overlapping the brick
+	 before or after the update was added, removed or moved. All bricks
+	 become dirty if the voxel grid (center, voxel size, resolution) or the
+	 lighting changes.
+
+	 A voxel brick grid only uses the bounding volumes and the transforms of
+	 the models: it does not touch any device or device context.
+	 */
+	class VoxelBrickGrid {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a voxel brick grid.
+		 */
+		VoxelBrickGrid() noexcept;
+
+		/**
+		 Constructs a voxel brick grid from the given voxel brick grid.
+
+		 @param[in]		grid
+						A reference to the voxel brick grid to copy.
+		 */
+		VoxelBrickGrid(const VoxelBrickGrid& grid);
+
+		/**
+		 Constructs a voxel brick grid by moving the given voxel brick grid.
+
+		 @param[in]		grid
+						A reference to the voxel brick grid to move.
+		 */
+		VoxelBrickGrid(VoxelBrickGrid&& grid) noexcept;
+
+		/**
+		 Destructs this voxel brick grid.
+		 */
+		~VoxelBrickGrid();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given voxel brick grid to this voxel brick grid.
+
+		 @param[in]		grid
+						A reference to the voxel brick grid to copy.
+		 @return		A reference to the copy of the given voxel brick grid
+						(i.e. this voxel brick grid).
+		 */
+		VoxelBrickGrid& operator=(const VoxelBrickGrid& grid);
+
+		/**
+		 Moves the given voxel brick grid to this voxel brick grid.
+
+		 @param[in]		grid
+						A reference to the voxel brick grid to move.
+		 @return		A reference to the moved voxel brick grid (i.e. this
+						voxel brick grid).
+		 */
+		VoxelBrickGrid& operator=(VoxelBrickGrid&& grid) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the dirty bricks of this voxel brick grid.
+
+		 @param[in]		models
+						A reference to a vector containing the models which
+						are visible to the voxel grid.
+		 @param[in]		center
+						The center of the voxel grid expressed in world
+						space.
+		 @param[in]		voxel_size
+						The size of a voxel expressed in world space.
+		 @param[in]		resolution
+						The resolution (in voxels) of the voxel grid.
+		 @param[in]		lighting_version
+						The version of the lighting used for voxelizing the
+						models.
+		 */
+		void Update(const std::vector< const Model* >& models,
+					const Point3& center,
+					F32 voxel_size,
+					U32 resolution,
+					U64 lighting_version);
+
+		/**
+		 Invalidates all bricks of this voxel brick grid. All bricks will be
+		 dirty after the next update.
+		 */
+		void Invalidate() noexcept {
+			m_valid = false;
+		}
+
+		/**
+		 Returns the resolution (in bricks) of this voxel brick grid.
+
+		 @return		The resolution (in bricks) of this voxel brick grid.
+		 */
+		[[nodiscard]]
+		U32 GetResolution() const noexcept {
+			return m_brick_resolution;
+		}
+
+		/**
+		 Returns the number of bricks of this voxel brick grid.
+
+		 @return		The number of bricks of this voxel brick grid.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfBricks() const noexcept {
+			return static_cast< size_t >(m_brick_resolution)
+				 * static_cast< size_t >(m_brick_resolution)
+				 * static_cast< size_t >(m_brick_resolution);
+		}
+
+		/**
+		 Checks whether this voxel brick grid has dirty bricks.
+
+		 @return		@c true if this voxel brick grid has dirty bricks.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasDirtyBricks() const noexcept {
+			return !m_dirty_bricks.empty();
+		}
+
+		/**
+		 Returns the (flattened) indices of the dirty bricks of this voxel
+		 brick grid.
+
+		 @return		A reference to a vector containing the (flattened)
+						indices of the dirty bricks of this voxel brick grid.
+		 */
+		[[nodiscard]]
+		const std::vector< U32 >& GetDirtyBricks() const noexcept {
+			return m_dirty_bricks;
+		}
+
+		/**
+		 Returns the dirty brick mask of this voxel brick grid. Bit @c i%32 of
+		 element @c i/32 is set if the brick with (flattened) index @c i is
+		 dirty.
+
+		 @return		A reference to a vector containing the dirty brick mask
+						of this voxel brick grid.
+		 */
+		[[nodiscard]]
+		const AlignedVector< U32 >& GetDirtyBrickMask() const noexcept {
+			return m_dirty_mask;
+		}
+
+		/**
+		 Checks whether the brick with the given (flattened) index is dirty.
+
+		 @pre			@a brick < @c GetNumberOfBricks().
+		 @param[in]		brick
+						The (flattened) index of the brick.
+		 @return		@c true if the brick is dirty. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDirty(size_t brick) const noexcept {
+			return 0u != (m_dirty_mask[brick >> 5u] & (1u << (brick & 31u)));
+		}
+
+		/**
+		 Returns the models overlapping at least one dirty brick of this voxel
+		 brick grid (i.e. the models which need to be revoxelized).
+
+		 @return		A reference to a vector containing the models
+						overlapping at least one dirty brick of this voxel
+						brick grid.
+		 */
+		[[nodiscard]]
+		const std::vector< const Model* >& GetDirtyModels() const noexcept {
+			return m_dirty_models;
+		}
+
+		/**
+		 Returns the models overlapping the given dirty brick of this voxel
+		 brick grid.
+
+		 @pre			@a index < @c GetDirtyBricks().size().
+		 @param[in]		index
+						The index into the dirty bricks of this voxel brick
+						grid.
+		 @return		The models overlapping the given dirty brick.
+		 */
+		[[nodiscard]]
+		gsl::span< const Model* const > GetModels(size_t index) const noexcept {
+			const auto begin = m_brick_model_offsets[index];
+			const auto end   = m_brick_model_offsets[index + 1u];
+			return { m_brick_models.data() + begin,
+				     static_cast< std::ptrdiff_t >(end - begin) };
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of model entries.
+		 */
+		struct Entry {
+
+		public:
+
+			/**
+			 A pointer to the model of this entry. The model is only used as
+			 a key and never dereferenced after the update of this entry.
+			 */
+			const Model* m_model;
+
+			/**
+			 The version of the model of this entry.
+			 */
+			U64 m_version;
+
+			/**
+			 The minimum (inclusive) brick index of this entry.
+			 */
+			U32x3 m_min;
+
+			/**
+			 The maximum (inclusive) brick index of this entry.
+			 */
+			U32x3 m_max;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Creates an entry for the given model.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[out]	entry
+						A reference to the entry.
+		 @return		@c true if the given model overlaps the voxel grid.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool CreateEntry(const Model& model, Entry& entry) const noexcept;
+
+		/**
+		 Marks the bricks overlapped by the given entry as dirty.
+
+		 @param[in]		entry
+						A reference to the entry.
+		 */
+		void MarkDirty(const Entry& entry);
+
+		/**
+		 Marks the brick with the given (flattened) index as dirty.
+
+		 @param[in]		brick
+						The (flattened) index of the brick.
+		 */
+		void MarkDirty(U32 brick);
+
+		/**
+		 Builds the model lists of the dirty bricks of this voxel brick grid.
+		 */
+		void BuildModelLists();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The center of the voxel grid of this voxel brick grid expressed in
+		 world space.
+		 */
+		Point3 m_center;
+
+		/**
+		 The size of a voxel of this voxel brick grid expressed in world
+		 space.
+		 */
+		F32 m_voxel_size;
+
+		/**
+		 The resolution (in voxels) of this voxel brick grid.
+		 */
+		U32 m_resolution;
+
+		/**
+		 The resolution (in bricks) of this voxel brick grid.
+		 */
+		U32 m_brick_resolution;
+
+		/**
+		 The version of the lighting of this voxel brick grid.
+		 */
+		U64 m_lighting_version;
+
+		/**
+		 A flag indicating whether the bricks of this voxel brick grid are
+		 valid.
+		 */
+		bool m_valid;
+
+		/**
+		 A vector containing the entries of this voxel brick grid (sorted by
+		 model).
+		 */
+		std::vector< Entry > m_entries;
+
+		/**
+		 A vector containing the entries of the next update of this voxel
+		 brick grid.
+		 */
+		std::vector< Entry > m_next_entries;
+
+		/**
+		 A vector containing the dirty brick mask of this voxel brick grid.
+		 */
+		AlignedVector< U32 > m_dirty_mask;
+
+		/**
+		 A vector containing the (flattened) indices of the dirty bricks of
+		 this voxel brick grid.
+		 */
+		std::vector< U32 > m_dirty_bricks;
+
+		/**
+		 A vector containing the offsets of the model lists of the dirty
+		 bricks of this voxel brick grid into @c m_brick_models.
+		 */
+		std::vector< U32 > m_brick_model_offsets;
+
+		/**
+		 A vector containing the model lists of the dirty bricks of this
+		 voxel brick grid.
+		 */
+		std::vector< const Model* > m_brick_models;
+
+		/**
+		 A vector containing the models overlapping at least one dirty brick
+		 of this voxel brick grid.
+		 */
+		std::vector< const Model* > m_dirty_models;
+	};
+}
\ No newline at end of file
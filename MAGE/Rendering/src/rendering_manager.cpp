@@ -16,6 +16,19 @@
 namespace mage::rendering {
 
 	U32 Pipeline::s_nb_draws = 0u;
+	AtomicU32 Pipeline::s_nb_skipped_shader_binds(0u);
+	AtomicU32 Pipeline::s_nb_skipped_srv_binds(0u);
+	AtomicU32 Pipeline::s_nb_skipped_buffer_binds(0u);
+	U32 Pipeline::s_nb_maps = 0u;
+	U32 Pipeline::s_nb_mapped_bytes = 0u;
+
+	namespace {
+
+		/**
+		 The maximum block size in bytes of the frame memory arena.
+		 */
+		constexpr size_t g_frame_memory_block_size = 64u * 1024u;
+	}
 
 	//-------------------------------------------------------------------------
 	// Manager::Impl
@@ -40,9 +53,16 @@ namespace mage::rendering {
 						The main window handle.
 		 @param[in]		display_configuration
 						The display configuration.
+		 @param[in]		job_system
+						A reference to the job system.
+		 @param[in]		pipelined
+						A flag indicating whether frames are drawn to frame 
+						snapshots which are presented on another thread.
 		 */
 		explicit Impl(NotNull< HWND > window, 
-					  DisplayConfiguration display_configuration);
+					  DisplayConfiguration display_configuration, 
+					  JobSystem& job_system, 
+					  bool pipelined);
 
 		/**
 		 Constructs a rendering manager from the given rendering manager.
@@ -159,6 +179,15 @@ namespace mage::rendering {
 		 */
 		void BindPersistentState();
 
+		/**
+		 Creates all shader permutations used by the renderer of this 
+		 rendering manager.
+
+		 @throws		Exception
+						Failed to create a shader.
+		 */
+		void PrewarmShaders();
+
 		/**
 		 Updates this rendering manager.
 		 */
@@ -173,6 +202,31 @@ namespace mage::rendering {
 						Failed to render the world of this rendering manager.
 		 */
 		void Render(const GameTime& time);
+
+		/**
+		 Draws the world of this rendering manager to the back buffer without 
+		 presenting it.
+
+		 @param[in]		time
+						A reference to the game time.
+		 @throws		Exception
+						Failed to render the world of this rendering manager.
+		 */
+		void Draw(const GameTime& time);
+
+		/**
+		 Submits the last drawn frame snapshot of this rendering manager for 
+		 presentation.
+
+		 @pre			No frame of this rendering manager is being presented.
+		 */
+		void SubmitFrame() noexcept;
+
+		/**
+		 Presents the back buffer of this rendering manager. If this rendering 
+		 manager is pipelined, the submitted frame snapshot is executed first.
+		 */
+		void Present() noexcept;
 		
 	private:
 
@@ -204,6 +258,21 @@ namespace mage::rendering {
 		 */
 		void SetupDevice();
 
+		/**
+		 Returns the device context of this rendering manager used for 
+		 drawing.
+
+		 @return		A reference to the deferred device context of this 
+						rendering manager if this rendering manager is 
+						pipelined. A reference to the immediate device context 
+						of this rendering manager otherwise.
+		 */
+		[[nodiscard]]
+		D3D11DeviceContext& GetDrawDeviceContext() const noexcept {
+			return m_deferred_device_context ? *m_deferred_device_context.Get()
+				                             : *m_device_context.Get();
+		}
+
 		//---------------------------------------------------------------------
 		// Member Variables: Display Configuration
 		//---------------------------------------------------------------------
@@ -237,6 +306,31 @@ namespace mage::rendering {
 		 */
 		ComPtr< D3D11DeviceContext > m_device_context;
 
+		/**
+		 A pointer to the deferred device context of this rendering manager 
+		 for drawing frame snapshots. @c nullptr if this rendering manager is 
+		 not pipelined.
+		 */
+		ComPtr< D3D11DeviceContext > m_deferred_device_context;
+
+		/**
+		 A pointer to the frame snapshot drawn last by this rendering manager. 
+		 Only accessed by the drawing thread.
+		 */
+		ComPtr< ID3D11CommandList > m_drawn_frame;
+
+		/**
+		 A pointer to the frame snapshot of this rendering manager submitted 
+		 for presentation. Only accessed by the presenting thread while a 
+		 frame is being presented.
+		 */
+		ComPtr< ID3D11CommandList > m_submitted_frame;
+
+		/**
+		 A flag indicating whether this rendering manager is pipelined.
+		 */
+		bool m_pipelined;
+
 		/**
 		 A pointer to the swap chain of this rendering manager.
 		 */
@@ -247,6 +341,16 @@ namespace mage::rendering {
 		 */
 		UniquePtr< ResourceManager > m_resource_manager;
 
+		/**
+		 A pointer to the frame memory arena of this rendering manager.
+		 */
+		UniquePtr< FrameMemoryArena > m_frame_memory;
+
+		/**
+		 A reference to the job system of this rendering manager.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
 		/**
 		 A pointer to the world of this rendering manager.
 		 */
@@ -259,15 +363,23 @@ namespace mage::rendering {
 	};
 
 	Manager::Impl::Impl(NotNull< HWND > window, 
-						DisplayConfiguration configuration)
+						DisplayConfiguration configuration, 
+						JobSystem& job_system, 
+						bool pipelined)
 		: m_window(std::move(window)),
 		m_display_configuration(
 			MakeUnique< DisplayConfiguration >(std::move(configuration))),
 		m_feature_level(),
 		m_device(), 
 		m_device_context(), 
+		m_deferred_device_context(), 
+		m_drawn_frame(), 
+		m_submitted_frame(), 
+		m_pipelined(pipelined), 
 		m_swap_chain(), 
 		m_resource_manager(), 
+		m_frame_memory(), 
+		m_job_system(job_system), 
 		m_world(), 
 		m_renderer() {
 
@@ -291,7 +403,11 @@ namespace mage::rendering {
 			                                   *m_display_configuration);
 
 		// Setup the resource manager.
-		m_resource_manager = MakeUnique< ResourceManager >(*m_device.Get());
+		m_resource_manager = MakeUnique< ResourceManager >(*m_device.Get(), 
+														 m_job_system);
+
+		// Setup the frame memory arena.
+		m_frame_memory = MakeUnique< FrameMemoryArena >(g_frame_memory_block_size);
 
 		// Setup the world.
 		m_world = MakeUnique< World >(*m_device.Get(), 
@@ -300,15 +416,17 @@ namespace mage::rendering {
 		
 		// Setup the renderer.
 		m_renderer = MakeUnique< Renderer >(*m_device.Get(), 
-											*m_device_context.Get(), 
+											GetDrawDeviceContext(), 
 											*m_display_configuration, 
 											*m_swap_chain, 
-											*m_resource_manager);
+											*m_resource_manager, 
+											*m_frame_memory, 
+											m_job_system);
 
 		// Setup ImGui.
 		ImGui::CreateContext();
 		ImGui_ImplWin32_Init(m_window);
-		ImGui_ImplDX11_Init(m_device.Get(), m_device_context.Get());
+		ImGui_ImplDX11_Init(m_device.Get(), &GetDrawDeviceContext());
 		ImGui::StyleColorsDark();
 	}
 
@@ -318,10 +436,17 @@ namespace mage::rendering {
 		ImGui_ImplWin32_Shutdown();
 		ImGui::DestroyContext();
 
+		// Release the frame snapshots.
+		m_drawn_frame.Reset();
+		m_submitted_frame.Reset();
+
 		// Uninitialize the swap chain.
 		m_swap_chain.reset();
 
 		// Reset any device context to the default settings. 
+		if (m_deferred_device_context) {
+			m_deferred_device_context->ClearState();
+		}
 		if (m_device_context) {
 			m_device_context->ClearState();
 		}
@@ -364,12 +489,38 @@ namespace mage::rendering {
 			ThrowIfFailed(result, 
 						  "D3D11DeviceContext creation failed: %08X.", result);
 		}
+
+		if (!m_pipelined) {
+			return;
+		}
+
+		ComPtr< ID3D11DeviceContext > deferred_device_context;
+		{
+			// Get the deferred ID3D11DeviceContext.
+			const HRESULT result = m_device->CreateDeferredContext(
+				0u, deferred_device_context.GetAddressOf());
+			ThrowIfFailed(result, 
+						  "Deferred ID3D11DeviceContext creation failed: %08X.", 
+						  result);
+		}
+		{
+			// Get the deferred D3D11DeviceContext.
+			const HRESULT result 
+				= deferred_device_context.As(&m_deferred_device_context);
+			ThrowIfFailed(result, 
+						  "Deferred D3D11DeviceContext creation failed: %08X.", 
+						  result);
+		}
 	}
 
 	void Manager::Impl::BindPersistentState() {
 		m_renderer->BindPersistentState();
 	}
 
+	void Manager::Impl::PrewarmShaders() {
+		m_renderer->PrewarmShaders();
+	}
+
 	void Manager::Impl::Update() {
 		ImGui_ImplDX11_NewFrame();
 		ImGui_ImplWin32_NewFrame();
@@ -377,10 +528,57 @@ namespace mage::rendering {
 	}
 
 	void Manager::Impl::Render(const GameTime& time) {
-		m_swap_chain->Clear();
+		Draw(time);
+		Present();
+	}
+
+	void Manager::Impl::Draw(const GameTime& time) {
+		if (m_deferred_device_context) {
+			// Each frame snapshot starts from the default state.
+			m_renderer->BindPersistentState();
+			Pipeline::OM::ClearRTV(*m_deferred_device_context.Get(), 
+								   &m_swap_chain->GetRTV());
+		}
+		else {
+			m_swap_chain->Clear();
+		}
+
 		Pipeline::s_nb_draws = 0u;
+		Pipeline::s_nb_skipped_shader_binds = 0u;
+		Pipeline::s_nb_skipped_srv_binds = 0u;
+		Pipeline::s_nb_skipped_buffer_binds = 0u;
+		Pipeline::s_nb_maps = 0u;
+		Pipeline::s_nb_mapped_bytes = 0u;
+		g_nb_aligned_allocations = 0u;
+		m_frame_memory->NextFrame();
 		m_renderer->Render(GetWorld(), time);
-		
+
+		if (m_deferred_device_context) {
+			// Snapshot the frame. The state of the deferred device context is 
+			// reset to the default state.
+			const HRESULT result = m_deferred_device_context->FinishCommandList(
+				FALSE, m_drawn_frame.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "Command list creation failed: %08X.", result);
+		}
+	}
+
+	void Manager::Impl::SubmitFrame() noexcept {
+		m_submitted_frame = std::move(m_drawn_frame);
+		m_renderer->SubmitUploads();
+	}
+
+	void Manager::Impl::Present() noexcept {
+		if (m_submitted_frame) {
+			// Upload the buffer data which changed while drawing the frame 
+			// snapshot.
+			m_renderer->ExecuteUploads(*m_device_context.Get());
+			// Execute the frame snapshot and release it (and thus its 
+			// references to the back buffer) afterwards. The state of the 
+			// immediate device context is reset to the default state.
+			m_device_context->ExecuteCommandList(m_submitted_frame.Get(), FALSE);
+			m_submitted_frame.Reset();
+		}
+
 		m_swap_chain->Present();
 	}
 
@@ -392,9 +590,13 @@ namespace mage::rendering {
 	#pragma region
 
 	Manager::Manager(NotNull< HWND > window, 
-					 DisplayConfiguration configuration) 
+					 DisplayConfiguration configuration, 
+					 JobSystem& job_system, 
+					 bool pipelined) 
 		: m_impl(MakeUnique< Impl >(std::move(window), 
-									std::move(configuration))) {}
+									std::move(configuration), 
+									job_system, 
+									pipelined)) {}
 
 	Manager::Manager(Manager&& manager) noexcept = default;
 
@@ -431,6 +633,10 @@ namespace mage::rendering {
 		m_impl->BindPersistentState();
 	}
 
+	void Manager::PrewarmShaders() {
+		m_impl->PrewarmShaders();
+	}
+
 	void Manager::Update() {
 		m_impl->Update();
 	}
@@ -439,5 +645,17 @@ namespace mage::rendering {
 		m_impl->Render(time);
 	}
 
+	void Manager::Draw(const GameTime& time) {
+		m_impl->Draw(time);
+	}
+
+	void Manager::SubmitFrame() noexcept {
+		m_impl->SubmitFrame();
+	}
+
+	void Manager::Present() noexcept {
+		m_impl->Present();
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
 #include "system\game_timer.hpp"
+#include "parallel\job_system.hpp"
 
 #pragma endregion
 
@@ -35,9 +36,16 @@ namespace mage::rendering {
 						The main window handle.
 		 @param[in]		configuration
 						The display configuration.
+		 @param[in]		job_system
+						A reference to the job system.
+		 @param[in]		pipelined
+						A flag indicating whether frames are drawn to frame 
+						snapshots which are presented on another thread.
 		 */
 		explicit Manager(NotNull< HWND > window, 
-						 DisplayConfiguration configuration);
+						 DisplayConfiguration configuration, 
+						 JobSystem& job_system, 
+						 bool pipelined = false);
 
 		/**
 		 Constructs a rendering manager from the given rendering manager.
@@ -142,6 +150,15 @@ namespace mage::rendering {
 		 */
 		void BindPersistentState();
 
+		/**
+		 Creates all shader permutations used by the renderer of this 
+		 rendering manager.
+
+		 @throws		Exception
+						Failed to create a shader.
+		 */
+		void PrewarmShaders();
+
 		/**
 		 Updates this rendering manager.
 		 */
@@ -157,6 +174,43 @@ namespace mage::rendering {
 		 */
 		void Render(const GameTime& time);
 
+		/**
+		 Draws the world of this rendering manager to the back buffer without 
+		 presenting it.
+
+		 If this rendering manager is pipelined, the world is drawn to a frame 
+		 snapshot (i.e. a command list of a deferred device context) instead, 
+		 which is only executed when presenting. The snapshot captures all the 
+		 per-frame data (i.e. the visible models, their transforms and the 
+		 material, camera and light buffers), so that the world may change 
+		 while the snapshot is presented.
+
+		 @param[in]		time
+						A reference to the game time.
+		 @throws		Exception
+						Failed to render the world of this rendering manager.
+		 */
+		void Draw(const GameTime& time);
+
+		/**
+		 Submits the last drawn frame snapshot of this rendering manager for 
+		 presentation.
+
+		 @pre			No frame of this rendering manager is being presented.
+		 */
+		void SubmitFrame() noexcept;
+
+		/**
+		 Presents the back buffer of this rendering manager. If this rendering 
+		 manager is pipelined, the submitted frame snapshot is executed first.
+
+		 Presenting may block until the GPU catches up or until the next 
+		 vertical blank. It may be called from another thread than the thread 
+		 drawing, as long as it does not overlap with submitting a frame or 
+		 with other uses of the immediate device context or the swap chain.
+		 */
+		void Present() noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -14,14 +14,16 @@ namespace mage::rendering {
 
 	Mesh::Mesh(size_t vertex_size, 
 		       DXGI_FORMAT index_format, 
-		       D3D11_PRIMITIVE_TOPOLOGY primitive_topology)
+		       D3D11_PRIMITIVE_TOPOLOGY primitive_topology, 
+		       bool quantized)
 		: m_vertex_buffer(), 
 		m_index_buffer(),
 		m_nb_vertices(0u), 
 		m_nb_indices(0u), 
 		m_vertex_size(vertex_size), 
 		m_index_format(index_format),
-		m_primitive_topology(primitive_topology) {}
+		m_primitive_topology(primitive_topology), 
+		m_quantized(quantized) {}
 
 	Mesh::Mesh(Mesh&& mesh) noexcept = default;
 
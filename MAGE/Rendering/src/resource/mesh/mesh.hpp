@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pipeline.hpp"
+#include "renderer\command_list.hpp"
 
 #pragma endregion
 
@@ -129,6 +129,18 @@ namespace mage::rendering {
 		D3D11_PRIMITIVE_TOPOLOGY GetPrimitiveTopology() const noexcept {
 			return m_primitive_topology;
 		}
+
+		/**
+		 Checks whether the vertices of this mesh are quantized.
+
+		 @return		@c true if the vertices of this mesh are 
+						@c QuantizedVertexPositionNormalTexture vertices. 
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsQuantized() const noexcept {
+			return m_quantized;
+		}
 		
 		/**
 		 Binds this mesh.
@@ -166,6 +178,34 @@ namespace mage::rendering {
 				                          m_index_format);
 			Pipeline::IA::BindPrimitiveTopology(device_context, topology);
 		}
+
+		/**
+		 Records binding this mesh.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 */
+		void BindMesh(CommandList& commands) const {
+			BindMesh(commands, m_primitive_topology);
+		}
+
+		/**
+		 Records binding this mesh with given primitive topology.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		topology
+						The primitive topology.
+		 */
+		void BindMesh(CommandList& commands, 
+			          D3D11_PRIMITIVE_TOPOLOGY topology) const {
+
+			commands.BindVertexBuffer(0u, 
+				                      *m_vertex_buffer.Get(), 
+				                      static_cast< U32 >(m_vertex_size));
+			commands.BindIndexBuffer(*m_index_buffer.Get(), m_index_format);
+			commands.BindPrimitiveTopology(topology);
+		}
 		
 		/**
 		 Draws this complete mesh.
@@ -198,6 +238,61 @@ namespace mage::rendering {
 				                  static_cast< U32 >(start_index));
 		}
 
+		/**
+		 Draws instances of a submesh of this mesh.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		start_index
+						The start index.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @param[in]		start_instance
+						The start instance.
+		 @param[in]		nb_instances
+						The number of instances.
+		 */
+		void DrawInstanced(ID3D11DeviceContext& device_context,
+			               size_t start_index, 
+			               size_t nb_indices,
+			               U32 start_instance,
+			               U32 nb_instances) const noexcept {
+
+			Pipeline::DrawIndexedInstanced(device_context,
+				                           static_cast< U32 >(nb_indices),
+				                           nb_instances,
+				                           static_cast< U32 >(start_index),
+				                           0u,
+				                           start_instance);
+		}
+
+		/**
+		 Records drawing instances of a submesh of this mesh.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		start_index
+						The start index.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @param[in]		start_instance
+						The start instance.
+		 @param[in]		nb_instances
+						The number of instances.
+		 */
+		void DrawInstanced(CommandList& commands,
+			               size_t start_index, 
+			               size_t nb_indices,
+			               U32 start_instance,
+			               U32 nb_instances) const {
+
+			commands.DrawIndexedInstanced(static_cast< U32 >(nb_indices),
+				                          nb_instances,
+				                          static_cast< U32 >(start_index),
+				                          0u,
+				                          start_instance);
+		}
+
 	protected:
 
 		//---------------------------------------------------------------------
@@ -213,10 +308,13 @@ namespace mage::rendering {
 						The index format.
 		 @param[in]		primitive_topology
 						The primitive topology.
+		 @param[in]		quantized
+						A flag indicating whether the vertices are quantized.
 		 */
 		explicit Mesh(size_t vertex_size, 
 			          DXGI_FORMAT index_format, 
-			          D3D11_PRIMITIVE_TOPOLOGY primitive_topology);
+			          D3D11_PRIMITIVE_TOPOLOGY primitive_topology, 
+			          bool quantized = false);
 
 		/**
 		 Constructs a mesh from the given mesh.
@@ -302,6 +400,11 @@ namespace mage::rendering {
 		 The primitive topology of this mesh.
 		 */
 		D3D11_PRIMITIVE_TOPOLOGY m_primitive_topology;
+
+		/**
+		 A flag indicating whether the vertices of this mesh are quantized.
+		 */
+		bool m_quantized;
 	};
 
 	#pragma endregion
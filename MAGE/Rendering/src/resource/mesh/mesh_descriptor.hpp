@@ -41,12 +41,44 @@ namespace mage::rendering {
 						A flag indicating whether the face vertices should be 
 						defined in clockwise order or not (i.e. 
 						counterclockwise order).
+		 @param[in]		parallel_import
+						A flag indicating whether the mesh should be imported 
+						in parallel (if supported by the file format).
+		 @param[in]		optimize_vertex_cache
+						A flag indicating whether the triangles and vertices 
+						of the mesh should be reordered for the 
+						post-transform vertex cache and the vertex fetches.
+		 @param[in]		optimize_overdraw
+						A flag indicating whether the triangles of the mesh 
+						should additionally be reordered to reduce overdraw.
+		 @param[in]		quantize_vertices
+						A flag indicating whether the vertices of the mesh 
+						should be quantized when exported.
+		 @param[in]		nb_lods
+						The maximum number of coarser levels of detail to 
+						generate for each model part of the mesh.
+		 @param[in]		cook
+						A flag indicating whether the imported model should be 
+						cooked (i.e. exported as CMDL file next to the 
+						imported file).
 		 */
 		constexpr explicit MeshDescriptor(
-			bool invert_handedness = false, 
-			bool clockwise_order   = true) noexcept
+			bool invert_handedness     = false, 
+			bool clockwise_order       = true,
+			bool parallel_import       = false, 
+			bool optimize_vertex_cache = false, 
+			bool optimize_overdraw     = false, 
+			bool quantize_vertices     = false, 
+			size_t nb_lods             = 0u, 
+			bool cook                  = false) noexcept
 			: m_invert_handedness(invert_handedness), 
-			m_clockwise_order(clockwise_order) {}
+			m_clockwise_order(clockwise_order), 
+			m_parallel_import(parallel_import), 
+			m_optimize_vertex_cache(optimize_vertex_cache), 
+			m_optimize_overdraw(optimize_overdraw), 
+			m_quantize_vertices(quantize_vertices), 
+			m_nb_lods(nb_lods), 
+			m_cook(cook) {}
 		
 		/**
 		 Constructs a mesh descriptor from the given mesh descriptor.
@@ -122,6 +154,82 @@ namespace mage::rendering {
 			return m_clockwise_order;
 		}
 
+		/**
+		 Checks whether the mesh should be imported in parallel according to 
+		 this mesh descriptor.
+
+		 @return		@c true if the mesh should be imported in parallel. 
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool ParallelImport() const noexcept {
+			return m_parallel_import;
+		}
+
+		/**
+		 Checks whether the triangles and vertices of the mesh should be 
+		 reordered for the post-transform vertex cache and the vertex fetches 
+		 according to this mesh descriptor.
+
+		 @return		@c true if the triangles and vertices of the mesh 
+						should be reordered for the post-transform vertex 
+						cache and the vertex fetches. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool VertexCacheOptimization() const noexcept {
+			return m_optimize_vertex_cache;
+		}
+
+		/**
+		 Checks whether the triangles of the mesh should additionally be 
+		 reordered to reduce overdraw according to this mesh descriptor.
+
+		 @return		@c true if the triangles of the mesh should 
+						additionally be reordered to reduce overdraw. 
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool OverdrawOptimization() const noexcept {
+			return m_optimize_overdraw;
+		}
+
+		/**
+		 Checks whether the vertices of the mesh should be quantized when 
+		 exported according to this mesh descriptor.
+
+		 @return		@c true if the vertices of the mesh should be 
+						quantized when exported. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool VertexQuantization() const noexcept {
+			return m_quantize_vertices;
+		}
+
+		/**
+		 Returns the maximum number of coarser levels of detail to generate 
+		 for each model part of the mesh according to this mesh descriptor.
+
+		 @return		The maximum number of coarser levels of detail to 
+						generate for each model part of the mesh.
+		 */
+		[[nodiscard]]
+		constexpr size_t GetNumberOfLODs() const noexcept {
+			return m_nb_lods;
+		}
+
+		/**
+		 Checks whether the imported model should be cooked (i.e. exported as
+		 CMDL file next to the imported file) according to this mesh 
+		 descriptor.
+
+		 @return		@c true if the imported model should be cooked. 
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool Cook() const noexcept {
+			return m_cook;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -140,5 +248,44 @@ namespace mage::rendering {
 		 descriptor.
 		 */
 		bool m_clockwise_order;
+
+		/**
+		 A flag indicating whether the mesh should be imported in parallel or 
+		 not for this mesh descriptor.
+		 */
+		bool m_parallel_import;
+
+		/**
+		 A flag indicating whether the triangles and vertices of the mesh 
+		 should be reordered for the post-transform vertex cache and the 
+		 vertex fetches for this mesh descriptor.
+		 */
+		bool m_optimize_vertex_cache;
+
+		/**
+		 A flag indicating whether the triangles of the mesh should 
+		 additionally be reordered to reduce overdraw for this mesh 
+		 descriptor.
+		 */
+		bool m_optimize_overdraw;
+
+		/**
+		 A flag indicating whether the vertices of the mesh should be 
+		 quantized when exported for this mesh descriptor.
+		 */
+		bool m_quantize_vertices;
+
+		/**
+		 The maximum number of coarser levels of detail to generate for each 
+		 model part of the mesh for this mesh descriptor.
+		 */
+		size_t m_nb_lods;
+
+		/**
+		 A flag indicating whether the imported model should be cooked (i.e. 
+		 exported as CMDL file next to the imported file) for this mesh 
+		 descriptor.
+		 */
+		bool m_cook;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,135 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of vertex cache statistics of a triangle list.
+	 */
+	struct VertexCacheStatistics {
+
+		/**
+		 The average cache miss ratio (i.e. the number of transformed vertices
+		 per triangle). The ratio is at least 0.5 and at most 3.
+		 */
+		F32 m_acmr = 0.0f;
+
+		/**
+		 The average transform to vertex ratio (i.e. the number of transformed
+		 vertices per referenced vertex). The ratio is at least 1 and at most
+		 6.
+		 */
+		F32 m_atvr = 0.0f;
+	};
+
+	/**
+	 Computes the vertex cache statistics of the given triangle list by
+	 simulating a FIFO post-transform vertex cache.
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		indices
+					The indices of the triangle list.
+	 @param[in]		cache_size
+					The size of the simulated post-transform vertex cache.
+	 @return		The vertex cache statistics of the given triangle list.
+	 */
+	template< typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics
+		ComputeVertexCacheStatistics(gsl::span< const IndexT > indices,
+									 size_t cache_size = 16u);
+
+	/**
+	 Reorders the triangles of the given triangle list to maximize the hits of
+	 the post-transform vertex cache.
+
+	 This is Tom Forsyth's linear-speed vertex cache optimization: triangles
+	 are greedily emitted in order of the scores of their vertices, which
+	 favor vertices in the (simulated LRU) cache and vertices with few
+	 remaining triangles.
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 */
+	template< typename IndexT >
+	void OptimizeVertexCache(gsl::span< IndexT > indices);
+
+	/**
+	 Reorders the triangles of the given vertex cache optimized triangle list
+	 to reduce overdraw.
+
+	 The triangle list is split into clusters at the triangles which (nearly)
+	 flush the vertex cache. The clusters are sorted front-to-back from the
+	 outside in (i.e. clusters facing away from the centroid of the triangle
+	 list come first), which keeps the cache hits within each cluster.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 @param[in]		vertices
+					The vertices of the triangle list.
+	 @param[in]		threshold
+					The maximum allowed ratio of the average cache miss
+					ratio of a cluster to the average cache miss ratio of
+					its enclosing run of triangles. Larger thresholds
+					result in more and smaller clusters, trading vertex
+					cache hits for less overdraw.
+	 */
+	template< typename VertexT, typename IndexT >
+	void OptimizeOverdraw(gsl::span< IndexT > indices,
+						  gsl::span< const VertexT > vertices,
+						  F32 threshold = 1.05f);
+
+	/**
+	 Reorders the vertices of the given triangle list in order of first use by
+	 the indices to improve the locality of the vertex fetches. Unreferenced
+	 vertices are removed.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	vertices
+					A reference to the vertices of the triangle list.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 */
+	template< typename VertexT, typename IndexT >
+	void OptimizeVertexFetch(std::vector< VertexT >& vertices,
+							 gsl::span< IndexT > indices);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\mesh_optimizer.tpp"
+
+#pragma endregion
\ No newline at end of file
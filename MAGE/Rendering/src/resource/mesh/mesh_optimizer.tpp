@@ -0,0 +1,432 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection\vector.hpp"
+#include "math_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace details {
+
+		/**
+		 Returns the range of the given indices.
+
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		indices
+						The indices.
+		 @return		A pair containing the minimum index and the maximum
+						index plus one of the given indices.
+		 */
+		template< typename IndexT >
+		[[nodiscard]]
+		inline const std::pair< size_t, size_t >
+			GetIndexRange(gsl::span< const IndexT > indices) noexcept {
+
+			using std::empty;
+			if (empty(indices)) {
+				return { 0u, 0u };
+			}
+
+			const auto [min, max] = std::minmax_element(indices.begin(),
+														indices.end());
+			return { static_cast< size_t >(*min),
+					 static_cast< size_t >(*max) + 1u };
+		}
+
+		/**
+		 Computes the score of a vertex for Forsyth's vertex cache
+		 optimization.
+
+		 @param[in]		cache_position
+						The position of the vertex in the LRU cache or the
+						cache size if the vertex is not cached.
+		 @param[in]		nb_triangles
+						The number of triangles of the vertex which are not
+						emitted yet.
+		 @param[in]		cache_size
+						The size of the LRU cache.
+		 @return		The score of the vertex.
+		 */
+		[[nodiscard]]
+		inline F32 GetVertexCacheScore(size_t cache_position,
+									   size_t nb_triangles,
+									   size_t cache_size) noexcept {
+
+			if (0u == nb_triangles) {
+				return -1.0f;
+			}
+
+			auto score = 0.0f;
+			if (cache_position < 3u) {
+				// The vertices of the last emitted triangle get a fixed score
+				// to avoid favoring strips over more cache friendly fans.
+				score = 0.75f;
+			}
+			else if (cache_position < cache_size) {
+				const auto scale = 1.0f / static_cast< F32 >(cache_size - 3u);
+				score = std::pow(1.0f - (cache_position - 3u) * scale, 1.5f);
+			}
+
+			// Favor vertices with few remaining triangles to avoid leaving
+			// isolated triangles behind.
+			return score + 2.0f / std::sqrt(static_cast< F32 >(nb_triangles));
+		}
+	}
+
+	template< typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics
+		ComputeVertexCacheStatistics(gsl::span< const IndexT > indices,
+									 size_t cache_size) {
+
+		const auto nb_triangles = indices.size() / 3u;
+		if (0u == nb_triangles) {
+			return {};
+		}
+
+		const auto [first, last] = details::GetIndexRange(indices);
+
+		// A vertex is cached if less than cache_size vertices were
+		// transformed since its last transformation.
+		std::vector< size_t > timestamps(last - first, 0u);
+		auto   timestamp   = cache_size + 1u;
+		size_t nb_misses   = 0u;
+		size_t nb_vertices = 0u;
+		for (const auto index : indices) {
+			auto& vertex_timestamp = timestamps[index - first];
+			if (0u == vertex_timestamp) {
+				++nb_vertices;
+			}
+			if (cache_size < timestamp - vertex_timestamp) {
+				vertex_timestamp = timestamp++;
+				++nb_misses;
+			}
+		}
+
+		VertexCacheStatistics statistics;
+		statistics.m_acmr = static_cast< F32 >(nb_misses) / nb_triangles;
+		statistics.m_atvr = static_cast< F32 >(nb_misses) / nb_vertices;
+		return statistics;
+	}
+
+	template< typename IndexT >
+	void OptimizeVertexCache(gsl::span< IndexT > indices) {
+		constexpr size_t cache_size = 32u;
+		constexpr auto no_triangle  = std::numeric_limits< size_t >::max();
+
+		const auto nb_triangles = indices.size() / 3u;
+		if (nb_triangles < 2u) {
+			return;
+		}
+
+		const auto range
+			= details::GetIndexRange(gsl::span< const IndexT >(indices));
+		const auto first       = range.first;
+		const auto nb_vertices = range.second - range.first;
+		const auto vertex = [&indices, first](size_t i) noexcept {
+			return static_cast< size_t >(indices[i]) - first;
+		};
+
+		// Build the triangle adjacency of the vertices. The triangles of a
+		// vertex which are not emitted yet are kept in front of its range.
+		std::vector< U32 > nb_vertex_triangles(nb_vertices, 0u);
+		for (size_t i = 0u; i < 3u * nb_triangles; ++i) {
+			++nb_vertex_triangles[vertex(i)];
+		}
+
+		std::vector< U32 > offsets(nb_vertices + 1u, 0u);
+		std::partial_sum(nb_vertex_triangles.cbegin(),
+						 nb_vertex_triangles.cend(),
+						 offsets.begin() + 1u);
+
+		std::vector< U32 > adjacency(offsets.back());
+		{
+			std::vector< U32 > ends(offsets.cbegin(), offsets.cend() - 1u);
+			for (size_t i = 0u; i < 3u * nb_triangles; ++i) {
+				adjacency[ends[vertex(i)]++] = static_cast< U32 >(i / 3u);
+			}
+		}
+
+		// Compute the initial scores.
+		std::vector< size_t > cache_positions(nb_vertices, cache_size);
+		std::vector< F32 > vertex_scores(nb_vertices);
+		for (size_t v = 0u; v < nb_vertices; ++v) {
+			vertex_scores[v] = details::GetVertexCacheScore(
+				cache_size, nb_vertex_triangles[v], cache_size);
+		}
+
+		std::vector< F32 > triangle_scores(nb_triangles, 0.0f);
+		for (size_t i = 0u; i < 3u * nb_triangles; ++i) {
+			triangle_scores[i / 3u] += vertex_scores[vertex(i)];
+		}
+
+		std::vector< bool > emitted(nb_triangles, false);
+		std::vector< IndexT > output;
+		output.reserve(3u * nb_triangles);
+
+		size_t cache[cache_size + 3u];
+		size_t cache_count = 0u;
+
+		auto best = static_cast< size_t >(std::distance(
+			triangle_scores.cbegin(),
+			std::max_element(triangle_scores.cbegin(), triangle_scores.cend())));
+		size_t next = 0u;
+
+		for (size_t n = 0u; n < nb_triangles; ++n) {
+			// Continue with the next triangle in input order if no cached
+			// vertex has triangles left.
+			if (no_triangle == best) {
+				while (emitted[next]) {
+					++next;
+				}
+				best = next;
+			}
+
+			const auto triangle = best;
+			emitted[triangle] = true;
+
+			size_t new_cache[cache_size + 3u];
+			size_t new_cache_count = 0u;
+
+			for (size_t k = 0u; k < 3u; ++k) {
+				const auto v = vertex(3u * triangle + k);
+				output.push_back(indices[3u * triangle + k]);
+
+				// Remove the emitted triangle from the vertex adjacency.
+				const auto begin = adjacency.begin() + offsets[v];
+				const auto end   = begin + nb_vertex_triangles[v];
+				std::iter_swap(std::find(begin, end, static_cast< U32 >(triangle)),
+							   end - 1);
+				--nb_vertex_triangles[v];
+
+				// Move the vertex to the front of the LRU cache.
+				if (std::find(new_cache, new_cache + new_cache_count, v)
+					== new_cache + new_cache_count) {
+					new_cache[new_cache_count++] = v;
+				}
+			}
+
+			for (size_t i = 0u; i < cache_count; ++i) {
+				const auto v = cache[i];
+				if (std::find(new_cache, new_cache + new_cache_count, v)
+					== new_cache + new_cache_count) {
+					new_cache[new_cache_count++] = v;
+				}
+			}
+
+			// Update the scores of the vertices which were or are cached and
+			// of their triangles which are not emitted yet.
+			for (size_t i = 0u; i < new_cache_count; ++i) {
+				const auto v = new_cache[i];
+				cache_positions[v] = std::min(i, cache_size);
+
+				const auto score = details::GetVertexCacheScore(
+					cache_positions[v], nb_vertex_triangles[v], cache_size);
+				const auto delta = score - vertex_scores[v];
+				vertex_scores[v] = score;
+
+				const auto begin = adjacency.cbegin() + offsets[v];
+				const auto end   = begin + nb_vertex_triangles[v];
+				for (auto it = begin; it != end; ++it) {
+					triangle_scores[*it] += delta;
+				}
+			}
+
+			cache_count = std::min(new_cache_count, cache_size);
+			std::copy(new_cache, new_cache + cache_count, cache);
+
+			// Select the best triangle of the cached vertices.
+			best = no_triangle;
+			auto best_score = -std::numeric_limits< F32 >::infinity();
+			for (size_t i = 0u; i < cache_count; ++i) {
+				const auto v     = cache[i];
+				const auto begin = adjacency.cbegin() + offsets[v];
+				const auto end   = begin + nb_vertex_triangles[v];
+				for (auto it = begin; it != end; ++it) {
+					if (best_score < triangle_scores[*it]) {
+						best_score = triangle_scores[*it];
+						best       = *it;
+					}
+				}
+			}
+		}
+
+		std::copy(output.cbegin(), output.cend(), indices.begin());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OptimizeOverdraw(gsl::span< IndexT > indices,
+						  gsl::span< const VertexT > vertices,
+						  F32 threshold) {
+
+		constexpr size_t cache_size = 16u;
+
+		const auto nb_triangles = indices.size() / 3u;
+		if (nb_triangles < 2u) {
+			return;
+		}
+
+		const auto range
+			= details::GetIndexRange(gsl::span< const IndexT >(indices));
+		const auto first = range.first;
+
+		// Simulate a FIFO post-transform vertex cache.
+		std::vector< size_t > timestamps(range.second - range.first, 0u);
+		size_t timestamp = cache_size + 1u;
+		const auto count_misses = [&](size_t triangle) noexcept {
+			size_t nb_misses = 0u;
+			for (size_t k = 0u; k < 3u; ++k) {
+				auto& vertex_timestamp
+					= timestamps[indices[3u * triangle + k] - first];
+				if (cache_size < timestamp - vertex_timestamp) {
+					vertex_timestamp = timestamp++;
+					++nb_misses;
+				}
+			}
+			return nb_misses;
+		};
+		const auto flush = [&timestamp]() noexcept {
+			timestamp += cache_size + 1u;
+		};
+
+		// Split the triangles at the triangles which miss all their vertices
+		// (i.e. the hard boundaries of the vertex cache optimization).
+		std::vector< size_t > hard_clusters;
+		for (size_t t = 0u; t < nb_triangles; ++t) {
+			if (3u == count_misses(t) || 0u == t) {
+				hard_clusters.push_back(t);
+			}
+		}
+		hard_clusters.push_back(nb_triangles);
+
+		// Split the hard clusters further as soon as the cache miss ratio of
+		// the split cluster is close enough to the one of the hard cluster.
+		std::vector< size_t > clusters;
+		for (size_t c = 0u; c + 1u < hard_clusters.size(); ++c) {
+			const auto begin = hard_clusters[c];
+			const auto end   = hard_clusters[c + 1u];
+
+			flush();
+			size_t nb_misses = 0u;
+			for (auto t = begin; t < end; ++t) {
+				nb_misses += count_misses(t);
+			}
+			const auto max_acmr = threshold * nb_misses / (end - begin);
+
+			flush();
+			clusters.push_back(begin);
+			nb_misses = 0u;
+			for (auto t = begin, start = begin; t + 1u < end; ++t) {
+				nb_misses += count_misses(t);
+				if (nb_misses <= max_acmr * (t + 1u - start)) {
+					clusters.push_back(t + 1u);
+					start     = t + 1u;
+					nb_misses = 0u;
+					flush();
+				}
+			}
+		}
+		clusters.push_back(nb_triangles);
+
+		// Compute the area-weighted centroids and normals of the clusters.
+		const auto nb_clusters = clusters.size() - 1u;
+		AlignedVector< XMVECTOR > centroids(nb_clusters);
+		AlignedVector< XMVECTOR > normals(nb_clusters);
+		auto mesh_centroid = XMVectorZero();
+		auto mesh_area     = XMVectorZero();
+		for (size_t c = 0u; c < nb_clusters; ++c) {
+			auto centroid = XMVectorZero();
+			auto normal   = XMVectorZero();
+			auto area     = XMVectorZero();
+			for (auto t = clusters[c]; t < clusters[c + 1u]; ++t) {
+				const auto p0 = XMLoad(vertices[indices[3u * t     ]].m_p);
+				const auto p1 = XMLoad(vertices[indices[3u * t + 1u]].m_p);
+				const auto p2 = XMLoad(vertices[indices[3u * t + 2u]].m_p);
+
+				const auto n = XMVector3Cross(p1 - p0, p2 - p0);
+				const auto a = XMVector3Length(n);
+				centroid = XMVectorMultiplyAdd(a, (p0 + p1 + p2) / 3.0f,
+											   centroid);
+				normal  += n;
+				area    += a;
+			}
+
+			mesh_centroid += centroid;
+			mesh_area     += area;
+			centroids[c]   = centroid / XMVectorMax(area, g_XMEpsilon);
+			normals[c]     = XMVector3Normalize(normal);
+		}
+		mesh_centroid /= XMVectorMax(mesh_area, g_XMEpsilon);
+
+		// Sort the clusters front-to-back from the outside in.
+		std::vector< F32 > keys(nb_clusters);
+		for (size_t c = 0u; c < nb_clusters; ++c) {
+			keys[c] = XMVectorGetX(XMVector3Dot(centroids[c] - mesh_centroid,
+												normals[c]));
+		}
+
+		std::vector< size_t > order(nb_clusters);
+		std::iota(order.begin(), order.end(), size_t(0u));
+		std::stable_sort(order.begin(), order.end(),
+						 [&keys](size_t lhs, size_t rhs) noexcept {
+							 return keys[lhs] > keys[rhs];
+						 });
+
+		std::vector< IndexT > output;
+		output.reserve(3u * nb_triangles);
+		for (const auto c : order) {
+			output.insert(output.end(),
+						  indices.begin() + 3u * clusters[c],
+						  indices.begin() + 3u * clusters[c + 1u]);
+		}
+
+		std::copy(output.cbegin(), output.cend(), indices.begin());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OptimizeVertexFetch(std::vector< VertexT >& vertices,
+							 gsl::span< IndexT > indices) {
+
+		// The sentinel must not be a valid new index of IndexT (e.g., 65535 
+		// for 65536 referenced vertices with 16-bit indices).
+		constexpr auto unused = std::numeric_limits< size_t >::max();
+
+		std::vector< size_t > remap(vertices.size(), unused);
+		std::vector< VertexT > output;
+		output.reserve(vertices.size());
+
+		for (auto& index : indices) {
+			auto& new_index = remap[index];
+			if (unused == new_index) {
+				new_index = output.size();
+				output.push_back(vertices[index]);
+			}
+
+			index = static_cast< IndexT >(new_index);
+		}
+
+		vertices = std::move(output);
+	}
+}
\ No newline at end of file
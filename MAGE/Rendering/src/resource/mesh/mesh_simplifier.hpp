@@ -0,0 +1,69 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Simplifies the given triangle list to at most the given number of 
+	 indices.
+
+	 This is a vertex clustering simplification: the referenced vertices are 
+	 clustered in a uniform grid and each triangle is remapped to the 
+	 representative vertices (i.e. the vertices closest to the centroid) of 
+	 the cells of its vertices. Triangles collapsing onto fewer than three 
+	 cells are removed. The finest grid resolution resulting in at most the 
+	 given number of indices is used. 
+
+	 The simplified triangle list only refers to existing vertices, so it can 
+	 share the vertex buffer of the given triangle list.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		indices
+					The indices of the triangle list.
+	 @param[in]		vertices
+					The vertices of the triangle list.
+	 @param[in]		target_nb_indices
+					The maximum number of indices of the simplified triangle 
+					list.
+	 @return		A vector containing the indices of the simplified 
+					triangle list. The vector is empty if the triangle list 
+					cannot be simplified.
+	 */
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	std::vector< IndexT > SimplifyMesh(gsl::span< const IndexT > indices,
+									   gsl::span< const VertexT > vertices,
+									   size_t target_nb_indices);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\mesh_simplifier.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection\vector.hpp"
+#include "math_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace details {
+
+		/**
+		 The maximum grid resolution (i.e. number of cells along the largest 
+		 dimension of the AABB) for the vertex clustering simplification.
+		 */
+		constexpr U32 g_max_cluster_resolution = 1024u;
+
+		/**
+		 Simplifies the given triangle list by clustering its vertices in a 
+		 uniform grid.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		indices
+						The indices of the triangle list.
+		 @param[in]		vertices
+						The vertices of the triangle list.
+		 @param[in]		first_vertex
+						The minimum index of the given indices.
+		 @param[in]		last_vertex
+						The maximum index plus one of the given indices.
+		 @param[in]		p_min
+						The minimum point of the AABB of the vertices.
+		 @param[in]		inv_cell_size
+						The inverse of the size of a cell of the grid.
+		 @param[out]	output
+						A reference to a vector for storing the indices of 
+						the simplified triangle list.
+		 */
+		template< typename VertexT, typename IndexT >
+		void XM_CALLCONV ClusterVertices(gsl::span< const IndexT > indices,
+										 gsl::span< const VertexT > vertices,
+										 size_t first_vertex, 
+										 size_t last_vertex, 
+										 FXMVECTOR p_min,
+										 F32 inv_cell_size,
+										 std::vector< IndexT >& output) {
+
+			const auto nb_vertices = last_vertex - first_vertex;
+			constexpr U64 max_cell = (1ull << 21u) - 1ull;
+
+			// Assign the vertices to the cells of the grid.
+			std::unordered_map< U64, U32 > cells;
+			std::vector< U32 > vertex_cells(nb_vertices);
+			AlignedVector< XMVECTOR > centroids;
+			std::vector< U32 > counts;
+			for (size_t i = 0u; i < nb_vertices; ++i) {
+				const auto p = XMLoad(vertices[first_vertex + i].m_p);
+				const auto [x, y, z] = XMStore< F32x3 >(XMVectorFloor(
+					(p - p_min) * inv_cell_size));
+				const auto key 
+					= (std::min(static_cast< U64 >(x), max_cell) << 42u)
+					| (std::min(static_cast< U64 >(y), max_cell) << 21u)
+					|  std::min(static_cast< U64 >(z), max_cell);
+
+				const auto cell = static_cast< U32 >(counts.size());
+				const auto [it, inserted] = cells.try_emplace(key, cell);
+				if (inserted) {
+					centroids.push_back(XMVectorZero());
+					counts.push_back(0u);
+				}
+
+				vertex_cells[i] = it->second;
+				centroids[it->second] += p;
+				++counts[it->second];
+			}
+
+			// Select the vertex closest to the centroid of each cell.
+			std::vector< IndexT > representatives(counts.size());
+			std::vector< F32 > distances(counts.size(), 
+										 std::numeric_limits< F32 >::max());
+			for (size_t i = 0u; i < nb_vertices; ++i) {
+				const auto cell     = vertex_cells[i];
+				const auto centroid = centroids[cell] 
+					                / static_cast< F32 >(counts[cell]);
+				const auto p        = XMLoad(vertices[first_vertex + i].m_p);
+				const auto distance = XMVectorGetX(
+					XMVector3LengthSq(p - centroid));
+				
+				if (distance < distances[cell]) {
+					distances[cell]       = distance;
+					representatives[cell] = static_cast< IndexT >(first_vertex + i);
+				}
+			}
+
+			// Remap the triangles and remove the collapsed triangles.
+			output.clear();
+			for (size_t i = 0u; i + 2u < indices.size(); i += 3u) {
+				const auto c0 = vertex_cells[indices[i]      - first_vertex];
+				const auto c1 = vertex_cells[indices[i + 1u] - first_vertex];
+				const auto c2 = vertex_cells[indices[i + 2u] - first_vertex];
+				if (c0 == c1 || c1 == c2 || c2 == c0) {
+					continue;
+				}
+
+				output.push_back(representatives[c0]);
+				output.push_back(representatives[c1]);
+				output.push_back(representatives[c2]);
+			}
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	std::vector< IndexT > SimplifyMesh(gsl::span< const IndexT > indices,
+									   gsl::span< const VertexT > vertices,
+									   size_t target_nb_indices) {
+		
+		using std::empty;
+		if (empty(indices)) {
+			return {};
+		}
+
+		const auto [min_it, max_it] = std::minmax_element(indices.begin(), 
+														  indices.end());
+		const size_t first_vertex = *min_it;
+		const size_t last_vertex  = static_cast< size_t >(*max_it) + 1u;
+
+		auto p_min = XMLoad(vertices[first_vertex].m_p);
+		auto p_max = p_min;
+		for (auto i = first_vertex + 1u; i < last_vertex; ++i) {
+			const auto p = XMLoad(vertices[i].m_p);
+			p_min = XMVectorMin(p_min, p);
+			p_max = XMVectorMax(p_max, p);
+		}
+
+		const auto [ex, ey, ez] = XMStore< F32x3 >(p_max - p_min);
+		const auto extent = std::max({ ex, ey, ez });
+		if (0.0f >= extent) {
+			return {};
+		}
+
+		// Binary search the finest grid resolution satisfying the target.
+		std::vector< IndexT > output;
+		std::vector< IndexT > candidate;
+		U32 low  = 1u;
+		U32 high = details::g_max_cluster_resolution;
+		while (low <= high) {
+			const auto resolution = low + (high - low) / 2u;
+			details::ClusterVertices(indices, vertices, 
+									 first_vertex, last_vertex, p_min, 
+									 static_cast< F32 >(resolution) / extent, 
+									 candidate);
+			
+			if (candidate.size() <= target_nb_indices) {
+				output.swap(candidate);
+				low = resolution + 1u;
+			}
+			else {
+				high = resolution - 1u;
+			}
+		}
+
+		return output;
+	}
+}
\ No newline at end of file
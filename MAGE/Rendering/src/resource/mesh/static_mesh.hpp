@@ -12,12 +12,6 @@
 //-----------------------------------------------------------------------------
 // System Includes
 //-----------------------------------------------------------------------------
-#pragma region
-
-#include <vector>
-
-#pragma endregion
-
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -26,6 +20,9 @@ namespace mage::rendering {
 	/**
 	 A class of static meshes.
 
+	 The vertices and indices are uploaded to the GPU at construction. Static 
+	 meshes do not keep a copy of them in system memory.
+
 	 @tparam		VertexT
 					The vertex type.
 	 @tparam		IndexT
@@ -46,9 +43,9 @@ namespace mage::rendering {
 		 @param[in]		device
 						A reference to the device.
 		 @param[in]		vertices
-						A vector containing the vertices.
+						A span containing the vertices.
 		 @param[in]		indices
-						A vector containing the indices.
+						A span containing the indices.
 		 @param[in]		primitive_topology
 						The primitive topology.
 		 @throws		Exception
@@ -57,8 +54,8 @@ namespace mage::rendering {
 						Failed to setup the index buffer of the static mesh.
 		 */
 		explicit StaticMesh(ID3D11Device& device,
-			                std::vector< VertexT > vertices,
-			                std::vector< IndexT >  indices,
+			                gsl::span< const VertexT > vertices,
+			                gsl::span< const IndexT >  indices,
 			                D3D11_PRIMITIVE_TOPOLOGY primitive_topology 
 			                = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -118,34 +115,26 @@ namespace mage::rendering {
 
 		 @param[in]		device
 						A reference to the device.
+		 @param[in]		vertices
+						A span containing the vertices.
 		 @throws		Exception
 						Failed to setup the vertex buffer of this static mesh.
 		 */
-		void SetupVertexBuffer(ID3D11Device& device);
+		void SetupVertexBuffer(ID3D11Device& device, 
+							   gsl::span< const VertexT > vertices);
 
 		/**
 		 Sets up the index buffer of this static mesh.
 
 		 @param[in]		device
 						A reference to the device.
+		 @param[in]		indices
+						A span containing the indices.
 		 @throws		Exception
 						Failed to setup the index buffer of this static mesh.
 		 */
-		void SetupIndexBuffer(ID3D11Device& device);
-
-		//---------------------------------------------------------------------
-		// Member Variables
-		//---------------------------------------------------------------------
-		
-		/**
-		 The vector containing the vertices of this static mesh.
-		 */
-		std::vector< VertexT > m_vertices;
-
-		/**
-		 The vector containing the indices of this static mesh.
-		 */
-		std::vector< IndexT > m_indices;
+		void SetupIndexBuffer(ID3D11Device& device, 
+							  gsl::span< const IndexT > indices);
 	};
 }
 
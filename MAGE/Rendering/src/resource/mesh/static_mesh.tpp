@@ -5,11 +5,21 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "resource\mesh\vertex.hpp"
 #include "renderer\factory.hpp"
 #include "exception\exception.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <type_traits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -18,17 +28,16 @@ namespace mage::rendering {
 	template< typename VertexT, typename IndexT >
 	StaticMesh< VertexT, IndexT >
 		::StaticMesh(ID3D11Device& device,
-		             std::vector< VertexT > vertices,
-		             std::vector< IndexT >  indices,
+		             gsl::span< const VertexT > vertices,
+		             gsl::span< const IndexT >  indices,
 		             D3D11_PRIMITIVE_TOPOLOGY primitive_topology)
 		: Mesh(sizeof(VertexT), 
 			   mage::rendering::GetIndexFormat< IndexT >(),
-			   primitive_topology),
-	    m_vertices(std::move(vertices)), 
-		m_indices(std::move(indices)) {
+			   primitive_topology, 
+			   std::is_same_v< VertexT, QuantizedVertexPositionNormalTexture >) {
 
-		SetupVertexBuffer(device);
-		SetupIndexBuffer(device);
+		SetupVertexBuffer(device, vertices);
+		SetupIndexBuffer(device, indices);
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -45,25 +54,27 @@ namespace mage::rendering {
 
 	template< typename VertexT, typename IndexT >
 	void StaticMesh< VertexT, IndexT >
-		::SetupVertexBuffer(ID3D11Device& device) {
+		::SetupVertexBuffer(ID3D11Device& device, 
+							gsl::span< const VertexT > vertices) {
 		
 		const HRESULT result = CreateStaticVertexBuffer(
 			device, NotNull< ID3D11Buffer** >(m_vertex_buffer.ReleaseAndGetAddressOf()),
-			gsl::make_span(static_cast< const std::vector< VertexT >& >(m_vertices)));
+			vertices);
 		ThrowIfFailed(result, "Vertex buffer creation failed: %08X.", result);
 
-		SetNumberOfVertices(m_vertices.size());
+		SetNumberOfVertices(static_cast< size_t >(vertices.size()));
 	}
 
 	template< typename VertexT, typename IndexT >
 	void StaticMesh< VertexT, IndexT >
-		::SetupIndexBuffer(ID3D11Device& device) {
+		::SetupIndexBuffer(ID3D11Device& device, 
+						   gsl::span< const IndexT > indices) {
 		
 		const HRESULT result = CreateStaticIndexBuffer(
 			device, NotNull< ID3D11Buffer** >(m_index_buffer.ReleaseAndGetAddressOf()),
-			gsl::make_span(static_cast< const std::vector< IndexT >& >(m_indices)));
+			indices);
 		ThrowIfFailed(result, "Index buffer creation failed: %08X.", result);
 
-		SetNumberOfIndices(m_indices.size());
+		SetNumberOfIndices(static_cast< size_t >(indices.size()));
 	}
 }
\ No newline at end of file
@@ -86,4 +86,13 @@ namespace mage::rendering {
 
 	static_assert(48 == sizeof(VertexPositionNormalColorTexture), 
 				  "Vertex struct/layout mismatch");
+
+	const D3D11_INPUT_ELEMENT_DESC QuantizedVertexPositionNormalTexture::s_input_element_descs[] = {
+		{ g_vertex_semantic_name_position, 0u, DXGI_FORMAT_R16G16B16A16_UNORM, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
+		{ g_vertex_semantic_name_normal,   0u, DXGI_FORMAT_R16G16_SNORM,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
+		{ g_vertex_semantic_name_texture,  0u, DXGI_FORMAT_R16G16_FLOAT,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u }
+	};
+
+	static_assert(16 == sizeof(QuantizedVertexPositionNormalTexture), 
+				  "Vertex struct/layout mismatch");
 }
\ No newline at end of file
@@ -1210,4 +1210,164 @@ namespace mage::rendering {
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[4];
 	};
+
+	/**
+	 A struct of quantized vertices containing position, normal and texture 
+	 coordinates.
+
+	 The position is stored as 16-bit normalized coordinates relative to an 
+	 AABB, the normal is octahedral encoded as 16-bit signed normalized 
+	 coordinates and the texture coordinates are stored as half floats. This 
+	 halves the size of a @c VertexPositionNormalTexture.
+	 */
+	struct QuantizedVertexPositionNormalTexture {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether vertices have a position.
+
+		 @return		@c true if vertices have a position. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasPosition() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a normal.
+
+		 @return		@c true if vertices have a normal. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasNormal() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a texture.
+
+		 @return		@c true if vertices have a texture. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasTexture() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a color.
+
+		 @return		@c true if vertices have a color. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasColor() noexcept {
+			return false;
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a vertex.
+		 */
+		constexpr QuantizedVertexPositionNormalTexture() noexcept = default;
+
+		/**
+		 Constructs a vertex.
+
+		 @param[in]		p
+						The quantized position of the vertex.
+		 @param[in]		n
+						The octahedral encoded normal of the vertex.
+		 @param[in]		tex
+						The half float texture coordinates of the vertex.
+		 */
+		constexpr explicit QuantizedVertexPositionNormalTexture(U16x4 p, 
+			                                                    S16x2 n, 
+			                                                    U16x2 tex) noexcept
+			: m_p(std::move(p)), 
+			m_n(std::move(n)), 
+			m_tex(std::move(tex)) {}
+
+		/**
+		 Constructs a vertex from the given vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to copy.
+		 */
+		constexpr QuantizedVertexPositionNormalTexture(
+			const QuantizedVertexPositionNormalTexture& vertex) noexcept = default;
+
+		/**
+		 Constructs a vertex by moving the given vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to move.
+		 */
+		constexpr QuantizedVertexPositionNormalTexture(
+			QuantizedVertexPositionNormalTexture&& vertex) noexcept = default;
+
+		/**
+		 Destructs this vertex.
+		 */
+		~QuantizedVertexPositionNormalTexture() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given vertex to this vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to copy.
+		 @return		A reference to the copy of the given vertex (i.e. this 
+						vertex).
+		 */
+		QuantizedVertexPositionNormalTexture& operator=(
+			const QuantizedVertexPositionNormalTexture& vertex) noexcept = default;
+
+		/**
+		 Moves the given vertex to this vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to move.
+		 @return		A reference to the moved vertex (i.e. this vertex).
+		 */
+		QuantizedVertexPositionNormalTexture& operator=(
+			QuantizedVertexPositionNormalTexture&& vertex) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The quantized position of this vertex. The w component is unused.
+		 */
+		U16x4 m_p;
+
+		/**
+		 The octahedral encoded normal of this vertex.
+		 */
+		S16x2 m_n;
+
+		/**
+		 The half float texture coordinates of this vertex.
+		 */
+		U16x2 m_tex;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The input element descriptors of a vertex.
+		 */
+		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[3];
+	};
 }
\ No newline at end of file
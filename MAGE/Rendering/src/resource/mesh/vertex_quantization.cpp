@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\vertex_quantization.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <DirectXPackedVector.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		constexpr F32 g_snorm16_max = 32767.0f;
+
+		constexpr F32 g_min_l1_norm = 1e-6f;
+
+		[[nodiscard]]
+		inline S16 EncodeSNorm16(F32 value) noexcept {
+			const auto clamped = std::clamp(value, -1.0f, 1.0f);
+			return static_cast< S16 >(std::round(clamped * g_snorm16_max));
+		}
+
+		[[nodiscard]]
+		inline F32 DecodeSNorm16(S16 value) noexcept {
+			return std::max(static_cast< F32 >(value) / g_snorm16_max, -1.0f);
+		}
+	}
+
+	[[nodiscard]]
+	const S16x2 XM_CALLCONV EncodeOctahedral(FXMVECTOR n) noexcept {
+		const auto [x, y, z] = XMStore< F32x3 >(n);
+		
+		// Degenerate (e.g. missing) normals are encoded as +Z. The negated 
+		// comparison also catches NaN normals.
+		const auto l1 = std::abs(x) + std::abs(y) + std::abs(z);
+		if (!(g_min_l1_norm <= l1)) {
+			return { S16(0), S16(0) };
+		}
+
+		// Project the normal onto the octahedron |x| + |y| + |z| = 1.
+		const auto inv_l1 = 1.0f / l1;
+		auto u = x * inv_l1;
+		auto v = y * inv_l1;
+
+		// Fold the lower hemisphere over the diagonals.
+		if (0.0f > z) {
+			const auto folded_u = (1.0f - std::abs(v)) * std::copysignf(1.0f, u);
+			const auto folded_v = (1.0f - std::abs(u)) * std::copysignf(1.0f, v);
+			u = folded_u;
+			v = folded_v;
+		}
+
+		return { EncodeSNorm16(u), EncodeSNorm16(v) };
+	}
+
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV DecodeOctahedral(const S16x2& n) noexcept {
+		auto u = DecodeSNorm16(n[0u]);
+		auto v = DecodeSNorm16(n[1u]);
+		const auto z = 1.0f - std::abs(u) - std::abs(v);
+
+		// Unfold the lower hemisphere.
+		const auto t = std::max(-z, 0.0f);
+		u += (0.0f <= u) ? -t : t;
+		v += (0.0f <= v) ? -t : t;
+
+		return XMVector3Normalize(XMVectorSet(u, v, z, 0.0f));
+	}
+
+	[[nodiscard]]
+	const U16x2 EncodeHalf(const UV& tex) noexcept {
+		using DirectX::PackedVector::XMConvertFloatToHalf;
+		return { XMConvertFloatToHalf(tex[0u]), 
+				 XMConvertFloatToHalf(tex[1u]) };
+	}
+
+	[[nodiscard]]
+	const UV DecodeHalf(const U16x2& tex) noexcept {
+		using DirectX::PackedVector::XMConvertHalfToFloat;
+		return UV(XMConvertHalfToFloat(tex[0u]), 
+				  XMConvertHalfToFloat(tex[1u]));
+	}
+}
\ No newline at end of file
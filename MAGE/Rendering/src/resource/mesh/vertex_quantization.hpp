@@ -0,0 +1,191 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\vertex.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of quantized vertex ranges.
+
+	 A quantized vertex range contains the dequantization parameters of a
+	 range of consecutive quantized vertices: the quantized positions are
+	 normalized coordinates relative to the AABB of the vertices of the range.
+	 */
+	struct QuantizedVertexRange {
+
+		/**
+		 The index of the first vertex of this quantized vertex range.
+		 */
+		U32 m_start_vertex;
+
+		/**
+		 The number of vertices of this quantized vertex range.
+		 */
+		U32 m_nb_vertices;
+
+		/**
+		 The minimum point of the AABB of the vertices of this quantized vertex
+		 range.
+		 */
+		F32x3 m_offset;
+
+		/**
+		 The size of the AABB of the vertices of this quantized vertex range.
+		 */
+		F32x3 m_scale;
+	};
+
+	static_assert(32 == sizeof(QuantizedVertexRange),
+				  "Quantized vertex range struct/layout mismatch");
+
+	/**
+	 Encodes the given normal with an octahedral mapping. A zero normal is 
+	 encoded as +Z.
+
+	 @param[in]		n
+					The (normalized) normal.
+	 @return		The octahedral encoded normal as 16-bit signed normalized
+					coordinates.
+	 */
+	[[nodiscard]]
+	const S16x2 XM_CALLCONV EncodeOctahedral(FXMVECTOR n) noexcept;
+
+	/**
+	 Decodes the given octahedral encoded normal.
+
+	 @param[in]		n
+					A reference to the octahedral encoded normal.
+	 @return		The decoded (normalized) normal.
+	 */
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV DecodeOctahedral(const S16x2& n) noexcept;
+
+	/**
+	 Encodes the given texture coordinates as half floats.
+
+	 @param[in]		tex
+					A reference to the texture coordinates.
+	 @return		The half float texture coordinates.
+	 */
+	[[nodiscard]]
+	const U16x2 EncodeHalf(const UV& tex) noexcept;
+
+	/**
+	 Decodes the given half float texture coordinates.
+
+	 @param[in]		tex
+					A reference to the half float texture coordinates.
+	 @return		The decoded texture coordinates.
+	 */
+	[[nodiscard]]
+	const UV DecodeHalf(const U16x2& tex) noexcept;
+
+	/**
+	 Splits the vertices of the given triangle list into quantized vertex 
+	 ranges.
+
+	 Each group of index ranges (e.g., the levels of detail of a model part) 
+	 obtains its own contiguous copy of the vertices referenced by its 
+	 indices, and its own quantized vertex range. Vertices shared by multiple
+	 groups are duplicated and unreferenced vertices are dropped. The indices
+	 keep their position, but refer to the split vertices.
+
+	 @pre			Each of the given indices belongs to exactly one group of
+					index ranges.
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		vertices
+					A span containing the vertices of the triangle list.
+	 @param[in]		indices
+					A span containing the indices of the triangle list.
+	 @param[in]		index_range_groups
+					A span containing the groups of index ranges (i.e. 
+					start index and number of indices) of the triangle list.
+	 @param[out]	split_vertices
+					A reference to a vector for storing the split vertices.
+	 @param[out]	split_indices
+					A reference to a vector for storing the indices referring
+					to the split vertices.
+	 @return		A vector containing the quantized vertex ranges sorted by
+					start vertex.
+	 @throws		Exception
+					The split vertices cannot be indexed with the index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	std::vector< QuantizedVertexRange >
+		SplitQuantizedVertexRanges(
+			gsl::span< const VertexT > vertices,
+			gsl::span< const IndexT > indices,
+			gsl::span< const std::vector< U32x2 > > index_range_groups,
+			std::vector< VertexT >& split_vertices, 
+			std::vector< IndexT >& split_indices);
+
+	/**
+	 Quantizes the given vertices.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @param[in]		vertices
+					A span containing the vertices.
+	 @param[in]		ranges
+					A span containing the quantized vertex ranges covering
+					the given vertices.
+	 @return		A vector containing the quantized vertices.
+	 */
+	template< typename VertexT >
+	[[nodiscard]]
+	std::vector< QuantizedVertexPositionNormalTexture >
+		QuantizeVertices(gsl::span< const VertexT > vertices,
+						 gsl::span< const QuantizedVertexRange > ranges);
+
+	/**
+	 Dequantizes the given quantized vertices.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @param[in]		vertices
+					A span containing the quantized vertices.
+	 @param[in]		ranges
+					A span containing the quantized vertex ranges covering
+					the given quantized vertices.
+	 @return		A vector containing the dequantized vertices.
+	 */
+	template< typename VertexT >
+	[[nodiscard]]
+	std::vector< VertexT >
+		DequantizeVertices(gsl::span< const QuantizedVertexPositionNormalTexture > vertices,
+						   gsl::span< const QuantizedVertexRange > ranges);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\vertex_quantization.tpp"
+
+#pragma endregion
\ No newline at end of file
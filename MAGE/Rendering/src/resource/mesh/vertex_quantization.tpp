@@ -0,0 +1,174 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	std::vector< QuantizedVertexRange >
+		SplitQuantizedVertexRanges(
+			gsl::span< const VertexT > vertices,
+			gsl::span< const IndexT > indices,
+			gsl::span< const std::vector< U32x2 > > index_range_groups,
+			std::vector< VertexT >& split_vertices, 
+			std::vector< IndexT >& split_indices) {
+
+		constexpr auto no_group = std::numeric_limits< size_t >::max();
+		constexpr auto max_vertices 
+			= size_t(std::numeric_limits< IndexT >::max()) + 1u;
+
+		split_vertices.clear();
+		split_vertices.reserve(vertices.size());
+		split_indices.assign(indices.begin(), indices.end());
+
+		// The group which last copied each vertex and the index of that copy.
+		std::vector< size_t > groups(vertices.size(), no_group);
+		std::vector< size_t > remap(vertices.size());
+
+		std::vector< QuantizedVertexRange > ranges;
+		ranges.reserve(index_range_groups.size());
+		for (size_t group = 0u; group < index_range_groups.size(); ++group) {
+			const auto first = split_vertices.size();
+
+			for (const auto& index_range : index_range_groups[group]) {
+				const size_t start = index_range[0u];
+				const size_t end   = start + index_range[1u];
+				for (auto i = start; i < end; ++i) {
+					const size_t vertex = indices[i];
+					if (group != groups[vertex]) {
+						groups[vertex] = group;
+						remap[vertex]  = split_vertices.size();
+						split_vertices.push_back(vertices[vertex]);
+					}
+					
+					split_indices[i] = static_cast< IndexT >(remap[vertex]);
+				}
+			}
+
+			ThrowIfFailed(split_vertices.size() <= max_vertices,
+						  "Too many split vertices for the index type: %zu.",
+						  split_vertices.size());
+
+			const auto last = split_vertices.size();
+			if (first == last) {
+				continue;
+			}
+
+			auto p_min = XMLoad(split_vertices[first].m_p);
+			auto p_max = p_min;
+			for (auto i = first + 1u; i < last; ++i) {
+				const auto p = XMLoad(split_vertices[i].m_p);
+				p_min = XMVectorMin(p_min, p);
+				p_max = XMVectorMax(p_max, p);
+			}
+
+			ranges.push_back({ static_cast< U32 >(first),
+							   static_cast< U32 >(last - first),
+							   XMStore< F32x3 >(p_min),
+							   XMStore< F32x3 >(p_max - p_min) });
+		}
+
+		return ranges;
+	}
+
+	template< typename VertexT >
+	[[nodiscard]]
+	std::vector< QuantizedVertexPositionNormalTexture >
+		QuantizeVertices(gsl::span< const VertexT > vertices,
+						 gsl::span< const QuantizedVertexRange > ranges) {
+
+		std::vector< QuantizedVertexPositionNormalTexture > output(vertices.size());
+
+		for (const auto& range : ranges) {
+			const auto offset = XMLoad(range.m_offset);
+			const auto scale  = XMLoad(range.m_scale);
+			// Flat AABB dimensions quantize to zero.
+			const auto inv_scale = XMVectorSelect(
+				XMVectorReciprocal(scale), XMVectorZero(),
+				XMVectorLessOrEqual(scale, XMVectorZero()));
+
+			const size_t first = range.m_start_vertex;
+			const size_t last  = first + range.m_nb_vertices;
+			for (auto i = first; i < last; ++i) {
+				const auto& vertex = vertices[i];
+				auto&       result = output[i];
+
+				const auto p = XMVectorRound(65535.0f * XMVectorSaturate(
+					(XMLoad(vertex.m_p) - offset) * inv_scale));
+				const auto [x, y, z] = XMStore< F32x3 >(p);
+				result.m_p = { static_cast< U16 >(x),
+							   static_cast< U16 >(y),
+							   static_cast< U16 >(z),
+							   U16(0u) };
+
+				if constexpr (VertexT::HasNormal()) {
+					result.m_n = EncodeOctahedral(XMLoad(vertex.m_n));
+				}
+				else {
+					result.m_n = EncodeOctahedral(g_XMIdentityR2);
+				}
+
+				if constexpr (VertexT::HasTexture()) {
+					result.m_tex = EncodeHalf(vertex.m_tex);
+				}
+				else {
+					result.m_tex = EncodeHalf(UV(0.0f, 0.0f));
+				}
+			}
+		}
+
+		return output;
+	}
+
+	template< typename VertexT >
+	[[nodiscard]]
+	std::vector< VertexT >
+		DequantizeVertices(gsl::span< const QuantizedVertexPositionNormalTexture > vertices,
+						   gsl::span< const QuantizedVertexRange > ranges) {
+
+		std::vector< VertexT > output(vertices.size());
+
+		for (const auto& range : ranges) {
+			const auto offset = XMLoad(range.m_offset);
+			const auto scale  = XMLoad(range.m_scale) * (1.0f / 65535.0f);
+
+			const size_t first = range.m_start_vertex;
+			const size_t last  = first + range.m_nb_vertices;
+			for (auto i = first; i < last; ++i) {
+				const auto& vertex = vertices[i];
+				auto&       result = output[i];
+
+				const auto q = XMVectorSet(static_cast< F32 >(vertex.m_p[0u]),
+										   static_cast< F32 >(vertex.m_p[1u]),
+										   static_cast< F32 >(vertex.m_p[2u]),
+										   0.0f);
+				const auto [x, y, z]
+					= XMStore< F32x3 >(XMVectorMultiplyAdd(q, scale, offset));
+				result.m_p = Point3(x, y, z);
+
+				if constexpr (VertexT::HasNormal()) {
+					const auto [nx, ny, nz]
+						= XMStore< F32x3 >(DecodeOctahedral(vertex.m_n));
+					result.m_n = Normal3(nx, ny, nz);
+				}
+
+				if constexpr (VertexT::HasTexture()) {
+					result.m_tex = DecodeHalf(vertex.m_tex);
+				}
+			}
+		}
+
+		return output;
+	}
+}
\ No newline at end of file
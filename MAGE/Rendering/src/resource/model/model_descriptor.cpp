@@ -32,6 +32,13 @@ namespace mage::rendering {
 		return nullptr;
 	}
 
+	[[nodiscard]]
+	const Material* ModelDescriptor
+		::GetMaterial(size_t index) const noexcept {
+		
+		return (index < m_materials.size()) ? &m_materials[index] : nullptr;
+	}
+
 	[[nodiscard]]
 	const ModelPart* ModelDescriptor
 		::GetModelPart(const std::string& name) const noexcept {
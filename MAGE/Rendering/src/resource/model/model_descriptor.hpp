@@ -131,6 +131,19 @@ namespace mage::rendering {
 		[[nodiscard]]
 		const Material* GetMaterial(const std::string& name) const noexcept;
 
+		/**
+		 Returns the material at the given index.
+
+		 @param[in]		index
+						The index of the material.
+		 @return		@c nullptr if this model descriptor contains no 
+						material at the given index @a index.
+		 @return		A pointer to the material of this model descriptor at 
+						the given index @a index.
+		 */
+		[[nodiscard]]
+		const Material* GetMaterial(size_t index) const noexcept;
+
 		/**
 		 Traverses all materials of this model descriptor.
 
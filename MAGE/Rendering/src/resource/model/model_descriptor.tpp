@@ -19,17 +19,51 @@ namespace mage::rendering {
 		ModelOutput< VertexT, IndexT > buffer;
 		loader::ImportModelFromFile(GetPath(), resource_manager, buffer, desc);
 
+		// Quantized vertices are only dequantized for exporting.
+		using std::empty;
+		if (buffer.IsQuantized() && empty(buffer.m_vertex_buffer) 
+			&& (export_as_MDL || desc.Cook())) {
+			buffer.m_vertex_buffer = DequantizeVertices< VertexT >(
+				buffer.m_mapped_quantized_vertex_buffer, 
+				buffer.m_mapped_vertex_ranges);
+		}
+
 		if (export_as_MDL) {
 			auto mdl_path = GetPath();
 			mdl_path.replace_extension(L".mdl");
 
-			loader::ExportModelToFile(mdl_path, buffer);
+			// An imported MDL file keeps its MSH file mapped and cannot be 
+			// exported onto itself.
+			if (mdl_path != GetPath()) {
+				loader::ExportModelToFile(mdl_path, buffer, desc);
+			}
 		}
 
-		m_mesh = MakeShared< StaticMesh< VertexT, IndexT > >(
-			               device, 
-			               std::move(buffer.m_vertex_buffer), 
-			               std::move(buffer.m_index_buffer));
+		if (desc.Cook()) {
+			auto cmdl_path = GetPath();
+			cmdl_path.replace_extension(L".cmdl");
+
+			// An imported CMDL file is mapped and cannot be exported onto 
+			// itself.
+			if (cmdl_path != GetPath()) {
+				loader::ExportModelToFile(cmdl_path, buffer, desc);
+			}
+		}
+
+		// Quantized vertices are decoded by the vertex shaders.
+		if (buffer.IsQuantized()) {
+			using QuantizedVertexT = QuantizedVertexPositionNormalTexture;
+			m_mesh = MakeShared< StaticMesh< QuantizedVertexT, IndexT > >(
+				               device, 
+				               buffer.m_mapped_quantized_vertex_buffer, 
+				               buffer.GetIndices());
+		}
+		else {
+			m_mesh = MakeShared< StaticMesh< VertexT, IndexT > >(
+				               device, 
+				               buffer.GetVertices(), 
+				               buffer.GetIndices());
+		}
 		m_materials   = std::move(buffer.m_material_buffer);
 		m_model_parts = std::move(buffer.m_model_parts);
 	}
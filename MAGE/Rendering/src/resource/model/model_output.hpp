@@ -8,7 +8,9 @@
 #include "transform\local_transform.hpp"
 #include "geometry\bounding_volume.hpp"
 #include "resource\model\material.hpp"
+#include "resource\mesh\vertex_quantization.hpp"
 #include "collection\vector.hpp"
+#include "io\mapped_file.hpp"
 
 #pragma endregion
 
@@ -43,6 +45,12 @@ namespace mage::rendering {
 		 */
 		static constexpr const_zstring s_default_material = "none";
 
+		/**
+		 The index for model parts which refer to their parent model part or
+		 material by name instead of by index.
+		 */
+		static constexpr U32 s_no_index = 0xFFFFFFFFu;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -56,9 +64,14 @@ namespace mage::rendering {
 			m_transform(),
 			m_start_index(0), 
 			m_nb_indices(0),
+			m_lods(),
+			m_position_offset(0.0f, 0.0f, 0.0f),
+			m_position_scale(1.0f, 1.0f, 1.0f),
 			m_child(s_default_child),
 			m_parent(s_default_parent),
-			m_material(s_default_material) {}
+			m_parent_index(s_no_index),
+			m_material(s_default_material),
+			m_material_index(s_no_index) {}
 		
 		/**
 		 Constructs a model part from the given model part.
@@ -128,7 +141,7 @@ namespace mage::rendering {
 		 */
 		[[nodiscard]]
 		bool HasDefaultParent() const noexcept {
-			return s_default_parent == m_parent;
+			return s_no_index == m_parent_index && s_default_parent == m_parent;
 		}
 
 		/**
@@ -140,7 +153,8 @@ namespace mage::rendering {
 		 */
 		[[nodiscard]]
 		bool HasDefaultMaterial() const noexcept {
-			return s_default_material == m_material;
+			return s_no_index == m_material_index 
+				&& s_default_material == m_material;
 		}
 
 		//---------------------------------------------------------------------
@@ -182,6 +196,25 @@ namespace mage::rendering {
 		 */
 		U32 m_nb_indices;
 
+		/**
+		 A vector containing the index ranges (i.e. start index and number of
+		 indices) of the coarser levels of detail of this model part in the 
+		 mesh of the corresponding model, ordered from fine to coarse.
+		 */
+		std::vector< U32x2 > m_lods;
+
+		/**
+		 The dequantization offset of the quantized vertex positions of this 
+		 model part in the mesh of the corresponding model.
+		 */
+		F32x3 m_position_offset;
+
+		/**
+		 The dequantization scale of the quantized vertex positions of this 
+		 model part in the mesh of the corresponding model.
+		 */
+		F32x3 m_position_scale;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Scene Graph
 		//---------------------------------------------------------------------
@@ -192,18 +225,34 @@ namespace mage::rendering {
 		std::string m_child;
 
 		/**
-		 The name of the parent model part of this model part.
+		 The name of the parent model part of this model part. The name is 
+		 only used if the parent model part is not referred to by index.
 		 */
 		std::string m_parent;
 
+		/**
+		 The index of the parent model part of this model part in the model 
+		 parts of the corresponding model, or @c s_no_index if the parent 
+		 model part is referred to by name.
+		 */
+		U32 m_parent_index;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Material
 		//---------------------------------------------------------------------
 
 		/**
-		 The name of the material of this model part.
+		 The name of the material of this model part. The name is only used if
+		 the material is not referred to by index.
 		 */
 		std::string m_material;
+
+		/**
+		 The index of the material of this model part in the materials of the
+		 corresponding model, or @c s_no_index if the material is referred to
+		 by name.
+		 */
+		U32 m_material_index;
 	};
 
 	/**
@@ -277,9 +326,54 @@ namespace mage::rendering {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Returns the vertices of this model output.
+
+		 @return		The mapped vertices of this model output if this model 
+						output has no vertex buffer. The vertex buffer of this 
+						model output otherwise.
+		 */
+		[[nodiscard]]
+		gsl::span< const VertexT > GetVertices() const noexcept {
+			using std::empty;
+			return empty(m_vertex_buffer) ? m_mapped_vertex_buffer 
+				                          : gsl::make_span(m_vertex_buffer);
+		}
+
+		/**
+		 Checks whether this model output has quantized vertices.
+
+		 @return		@c true if this model output has mapped quantized 
+						vertices. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsQuantized() const noexcept {
+			using std::empty;
+			return !empty(m_mapped_quantized_vertex_buffer);
+		}
+
+		/**
+		 Returns the indices of this model output.
+
+		 @return		The mapped indices of this model output if this model 
+						output has no index buffer. The index buffer of this 
+						model output otherwise.
+		 */
+		[[nodiscard]]
+		gsl::span< const IndexT > GetIndices() const noexcept {
+			using std::empty;
+			return empty(m_index_buffer) ? m_mapped_index_buffer 
+				                         : gsl::make_span(m_index_buffer);
+		}
+
 		/**
 		 Adds a model part.
 
+		 If this model output has quantized vertices, the dequantization 
+		 offset and scale of the given model part are set to these of the 
+		 quantized vertex range containing the vertices of the given model 
+		 part.
+
 		 @param[in]		model_part
 						The model part to add.
 		 @param[in]		create_bounding_volumes
@@ -327,6 +421,43 @@ namespace mage::rendering {
 		 */
 		void EndModelPart(bool create_bounding_volumes = true) noexcept;
 
+		/**
+		 Reorders the triangles of each model part of this model output for 
+		 the post-transform vertex cache (and optionally to reduce overdraw), 
+		 and reorders the vertices of this model output in order of first use. 
+		 The vertex cache statistics before and after are logged.
+
+		 This model output must have a vertex and index buffer (i.e. no 
+		 mapped vertices and indices). Otherwise, this method does nothing.
+
+		 @param[in]		optimize_overdraw
+						A flag indicating whether the triangles of each model 
+						part must additionally be reordered to reduce 
+						overdraw.
+		 */
+		void OptimizeMesh(bool optimize_overdraw = false);
+
+		/**
+		 Generates the coarser levels of detail of each model part of this 
+		 model output. Each level of detail targets the given fraction of the
+		 indices of the previous level of detail, is optimized for the 
+		 post-transform vertex cache and is appended to the index buffer of 
+		 this model output. The generation of coarser levels of detail of a 
+		 model part stops once a level of detail no longer reduces the number
+		 of indices sufficiently.
+
+		 This model output must have a vertex and index buffer (i.e. no 
+		 mapped vertices and indices). Otherwise, this method does nothing.
+
+		 @param[in]		nb_lods
+						The maximum number of coarser levels of detail to 
+						generate for each model part.
+		 @param[in]		reduction
+						The target fraction of the indices of the previous 
+						level of detail.
+		 */
+		void GenerateLODs(size_t nb_lods, F32 reduction = 0.5f);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -341,6 +472,36 @@ namespace mage::rendering {
 		 */
 		std::vector< IndexT > m_index_buffer;
 
+		/**
+		 The mapped file of this model output.
+		 */
+		MappedFile m_mapped_file;
+
+		/**
+		 A span containing the vertices of the mapped file of this model 
+		 output.
+		 */
+		gsl::span< const VertexT > m_mapped_vertex_buffer;
+
+		/**
+		 A span containing the quantized vertices of the mapped file of this 
+		 model output.
+		 */
+		gsl::span< const QuantizedVertexPositionNormalTexture > 
+			m_mapped_quantized_vertex_buffer;
+
+		/**
+		 A span containing the quantized vertex ranges of the mapped file of 
+		 this model output.
+		 */
+		gsl::span< const QuantizedVertexRange > m_mapped_vertex_ranges;
+
+		/**
+		 A span containing the indices of the mapped file of this model 
+		 output.
+		 */
+		gsl::span< const IndexT > m_mapped_index_buffer;
+
 		/**
 		 A vector containing the materials of this model output.
 		 */
@@ -364,6 +525,15 @@ namespace mage::rendering {
 						A reference to the model part.
 		 */
 		void SetupBoundingVolumes(ModelPart& model_part) noexcept;
+
+		/**
+		 Sets up the dequantization offset and scale of the given model part.
+
+		 @pre			This model output has quantized vertices.
+		 @param[in]		model_part
+						A reference to the model part.
+		 */
+		void SetupDequantization(ModelPart& model_part) noexcept;
 	};
 }
 
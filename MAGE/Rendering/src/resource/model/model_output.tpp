@@ -5,6 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "resource\mesh\mesh_optimizer.hpp"
+#include "resource\mesh\mesh_simplifier.hpp"
 #include "logging\error.hpp"
 
 #pragma endregion
@@ -20,6 +22,10 @@ namespace mage::rendering {
 		
 		m_model_parts.push_back(std::move(model_part));
 		
+		if (IsQuantized()) {
+			SetupDequantization(m_model_parts.back());
+		}
+
 		if (create_bounding_volumes) {
 			SetupBoundingVolumes(m_model_parts.back());
 		}
@@ -81,23 +87,164 @@ namespace mage::rendering {
 		}
 	}
 
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::OptimizeMesh(bool optimize_overdraw) {
+		
+		using std::empty;
+		if (empty(m_vertex_buffer) || empty(m_index_buffer)) {
+			return;
+		}
+
+		const auto before = ComputeVertexCacheStatistics(GetIndices());
+		
+		// The triangles are only reordered within each model part.
+		for (const auto& model_part : m_model_parts) {
+			const auto indices = gsl::make_span(m_index_buffer)
+				.subspan(model_part.m_start_index, model_part.m_nb_indices);
+			
+			OptimizeVertexCache(indices);
+			if (optimize_overdraw) {
+				OptimizeOverdraw(indices, GetVertices());
+			}
+		}
+
+		OptimizeVertexFetch(m_vertex_buffer, gsl::make_span(m_index_buffer));
+
+		const auto after = ComputeVertexCacheStatistics(GetIndices());
+		
+		Info("Mesh optimization: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f.", 
+			 before.m_acmr, after.m_acmr, before.m_atvr, after.m_atvr);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::GenerateLODs(size_t nb_lods, F32 reduction) {
+		
+		using std::empty;
+		if (empty(m_vertex_buffer) || empty(m_index_buffer)) {
+			return;
+		}
+
+		const auto nb_indices = m_index_buffer.size();
+		
+		for (auto& model_part : m_model_parts) {
+			model_part.m_lods.clear();
+			
+			auto target = static_cast< F32 >(model_part.m_nb_indices);
+			auto previous = static_cast< size_t >(model_part.m_nb_indices);
+			
+			for (size_t lod = 0u; lod < nb_lods; ++lod) {
+				target *= reduction;
+				
+				// Simplify the finest level of detail for each level of 
+				// detail to avoid accumulating the simplification errors.
+				const auto indices = gsl::make_span(m_index_buffer)
+					.subspan(model_part.m_start_index, model_part.m_nb_indices);
+				auto lod_indices = SimplifyMesh(
+					gsl::span< const IndexT >(indices), GetVertices(), 
+					static_cast< size_t >(target));
+				
+				// Stop if the level of detail is empty or does not reduce 
+				// the number of indices of the previous level of detail by 
+				// at least a quarter.
+				if (empty(lod_indices) || 4u * lod_indices.size() > 3u * previous) {
+					break;
+				}
+
+				OptimizeVertexCache(gsl::make_span(lod_indices));
+
+				const auto start_index = static_cast< U32 >(m_index_buffer.size());
+				const auto lod_size    = static_cast< U32 >(lod_indices.size());
+				m_index_buffer.insert(m_index_buffer.end(), 
+									  lod_indices.cbegin(), lod_indices.cend());
+				model_part.m_lods.push_back({ start_index, lod_size });
+				
+				previous = lod_indices.size();
+			}
+		}
+
+		Info("Level of detail generation: %zu -> %zu indices.", 
+			 nb_indices, m_index_buffer.size());
+	}
+
 	template< typename VertexT, typename IndexT >
 	void ModelOutput< VertexT, IndexT >
 		::SetupBoundingVolumes(ModelPart& model_part) noexcept {
 		
+		const auto indices  = GetIndices();
+		
 		const size_t start = model_part.m_start_index;
 		const size_t end   = start + model_part.m_nb_indices;
 		
+		if (IsQuantized()) {
+			const auto vertices = m_mapped_quantized_vertex_buffer;
+			const auto offset   = XMLoad(model_part.m_position_offset);
+			const auto scale    = XMLoad(model_part.m_position_scale) 
+				                * (1.0f / 65535.0f);
+			const auto position = [&](size_t i) noexcept {
+				const auto& p = vertices[indices[i]].m_p;
+				return XMVectorMultiplyAdd(
+					XMVectorSet(static_cast< F32 >(p[0u]), 
+								static_cast< F32 >(p[1u]), 
+								static_cast< F32 >(p[2u]), 
+								0.0f), 
+					scale, offset);
+			};
+
+			for (auto i = start; i < end; ++i) {
+				model_part.m_aabb = AABB::Union(model_part.m_aabb, position(i));
+			}
+
+			model_part.m_sphere = BoundingSphere(model_part.m_aabb.Centroid());
+
+			for (auto i = start; i < end; ++i) {
+				model_part.m_sphere 
+					= BoundingSphere::Union(model_part.m_sphere, position(i));
+			}
+
+			return;
+		}
+
+		const auto vertices = GetVertices();
+
 		for (auto i = start; i < end; ++i) {
-			const auto& v = m_vertex_buffer[m_index_buffer[i]];
+			const auto& v = vertices[indices[i]];
 			model_part.m_aabb = AABB::Union(model_part.m_aabb, v);
 		}
 
 		model_part.m_sphere = BoundingSphere(model_part.m_aabb.Centroid());
 
 		for (auto i = start; i < end; ++i) {
-			const auto& v = m_vertex_buffer[m_index_buffer[i]];
+			const auto& v = vertices[indices[i]];
 			model_part.m_sphere = BoundingSphere::Union(model_part.m_sphere, v);
 		}
 	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::SetupDequantization(ModelPart& model_part) noexcept {
+
+		if (0u == model_part.m_nb_indices) {
+			return;
+		}
+
+		// The vertices of a model part are contained in a single quantized 
+		// vertex range. The quantized vertex ranges are sorted by start 
+		// vertex.
+		const auto vertex = static_cast< U32 >(
+			GetIndices()[model_part.m_start_index]);
+		const auto it = std::upper_bound(
+			m_mapped_vertex_ranges.begin(), m_mapped_vertex_ranges.end(), 
+			vertex, [](U32 lhs, const QuantizedVertexRange& rhs) noexcept {
+				return lhs < rhs.m_start_vertex;
+			});
+		if (m_mapped_vertex_ranges.begin() == it) {
+			return;
+		}
+
+		const auto& range = *(it - 1);
+		model_part.m_position_offset = range.m_offset;
+		model_part.m_position_scale  = range.m_scale;
+	}
 }
\ No newline at end of file
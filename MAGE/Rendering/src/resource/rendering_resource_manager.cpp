@@ -12,7 +12,8 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
-	ResourceManager::ResourceManager(ID3D11Device& device) 
+	ResourceManager::ResourceManager(ID3D11Device& device, 
+									 JobSystem& job_system) 
 		: m_device(device), 
 		m_model_descriptor_pool(), 
 		m_vs_pool(), 
@@ -22,9 +23,15 @@ namespace mage::rendering {
 		m_ps_pool(),
 		m_cs_pool(),
 		m_sprite_font_pool(),
-		m_texture_pool() {}
+		m_texture_pool(),
+		m_job_system(job_system),
+		m_loads(MakeUnique< JobCounter >()) {}
 
 	ResourceManager::ResourceManager(ResourceManager&& manager) noexcept = default;
 
-	ResourceManager::~ResourceManager() = default;
+	ResourceManager::~ResourceManager() {
+		if (m_loads) {
+			m_job_system.get().Wait(*m_loads);
+		}
+	}
 }
@@ -124,8 +124,11 @@ namespace mage::rendering {
 
 		 @param[in]		device
 						A reference to the device.
+		 @param[in]		job_system
+						A reference to the job system for creating resources 
+						asynchronously.
 		 */
-		ResourceManager(ID3D11Device& device);
+		explicit ResourceManager(ID3D11Device& device, JobSystem& job_system);
 		
 		/**
 		 Constructs a resource manager from the given resource manager.
@@ -176,6 +179,18 @@ namespace mage::rendering {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Returns the job system for creating resources of this resource 
+		 manager.
+
+		 @return		A reference to the job system for creating resources 
+						of this resource manager.
+		 */
+		[[nodiscard]]
+		JobSystem& GetJobSystem() const noexcept {
+			return m_job_system;
+		}
+
 		/**
 		 Checks whether this resource manager contains a resource of the given 
 		 type corresponding to the given globally unique identifier.
@@ -406,6 +421,56 @@ namespace mage::rendering {
 									 const D3D11_TEXTURE2D_DESC& desc, 
 									 const D3D11_SUBRESOURCE_DATA& initial_data);
 
+		/**
+		 Creates a model descriptor (if not existing) asynchronously.
+
+		 Concurrent requests for the same model descriptor share a single 
+		 creation.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		desc
+						A reference to the mesh descriptor (which will be 
+						copied).
+		 @param[in]		export_as_MDL
+						@c true if the model descriptor needs to be exported as 
+						MDL file. @c false otherwise.
+		 @return		A future of the pointer to the model descriptor. The 
+						future holds the exception (if any) thrown while 
+						creating the model descriptor.
+		 */
+		template< typename ResourceT, typename VertexT, typename IndexT >
+		typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+			std::shared_future< ModelDescriptorPtr > > 
+			GetOrCreateAsync(const std::wstring& fname,
+							 const  MeshDescriptor< VertexT, IndexT >& 
+							 desc = MeshDescriptor< VertexT, IndexT >(), 
+							 bool export_as_MDL = false);
+
+		/**
+		 Creates a texture (if not existing) asynchronously.
+
+		 Concurrent requests for the same texture share a single creation.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @return		A future of the pointer to the texture. The future 
+						holds the exception (if any) thrown while creating the 
+						texture.
+		 */
+		template< typename ResourceT >
+		typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
+			std::shared_future< TexturePtr > > 
+			GetOrCreateAsync(const std::wstring& fname);
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -491,6 +556,21 @@ namespace mage::rendering {
 		 The texture resource pool of this resource manager.
 		 */
 		typename pool_type< Texture > m_texture_pool;
+
+		/**
+		 A reference to the job system for creating resources asynchronously 
+		 of this resource manager.
+		 */
+		std::reference_wrapper< JobSystem > m_job_system;
+
+		/**
+		 A pointer to the job counter of the asynchronous resource creations 
+		 of this resource manager.
+
+		 The job counter is waited for before the resource pools of this 
+		 resource manager are destructed.
+		 */
+		UniquePtr< JobCounter > m_loads;
 	};
 }
 
@@ -232,5 +232,31 @@ namespace mage::rendering {
 												  desc, initial_data);
 	}
 
+	template< typename ResourceT, typename VertexT, typename IndexT >
+	inline typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+		std::shared_future< ModelDescriptorPtr > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname,
+										  const MeshDescriptor< VertexT, IndexT >& desc,
+										  bool export_as_MDL) {
+
+		return GetPool< ResourceT >().GetOrCreateAsync(m_job_system, *m_loads, 
+													   fname, 
+													   std::ref(m_device), 
+													   std::ref(*this), 
+													   key_type< ResourceT >(fname), 
+													   desc, export_as_MDL);
+	}
+
+	template< typename ResourceT >
+	inline typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
+		std::shared_future< TexturePtr > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname) {
+
+		return GetPool< ResourceT >().GetOrCreateAsync(m_job_system, *m_loads, 
+													   fname, 
+													   std::ref(m_device), 
+													   key_type< ResourceT >(fname));
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
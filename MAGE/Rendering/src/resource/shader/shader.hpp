@@ -8,6 +8,7 @@
 #include "resource\resource.hpp"
 #include "resource\shader\compiled_shader.hpp"
 #include "renderer\pipeline.hpp"
+#include "renderer\command_list.hpp"
 
 #pragma endregion
 
@@ -112,6 +113,17 @@ namespace mage::rendering {
 			Pipeline::VS::BindShader(device_context, m_vertex_shader.Get());
 		}
 
+		/**
+		 Records binding this vertex shader.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 */
+		void BindShader(CommandList& commands) const {
+			commands.BindInputLayout(*m_vertex_layout.Get());
+			commands.BindShader< Pipeline::VS >(m_vertex_shader.Get());
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -246,6 +258,14 @@ namespace mage::rendering {
 		 */
 		void BindShader(ID3D11DeviceContext& device_context) const noexcept;
 
+		/**
+		 Records binding this shader.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 */
+		void BindShader(CommandList& commands) const;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -111,4 +111,11 @@ namespace mage::rendering {
 
 		PipelineStageT::BindShader(device_context, m_shader.Get());
 	}
+
+	template< typename ShaderT, typename PipelineStageT >
+	inline void Shader< ShaderT, PipelineStageT >
+		::BindShader(CommandList& commands) const {
+
+		commands.BindShader< PipelineStageT >(m_shader.Get());
+	}
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "resource\shader\shader_factory.hpp"
 #include "resource\mesh\vertex.hpp"
+#include "renderer\buffer\instance_buffer.hpp"
 
 // Back Buffer
 #include "backbuffer\back_buffer_PS.hpp"
@@ -24,6 +25,8 @@
 
 // Transform
 #include "transform\transform_VS.hpp"
+#include "transform\transform_instanced_VS.hpp"
+#include "transform\transform_quantized_instanced_VS.hpp"
 
 #pragma endregion
 
@@ -119,5 +122,17 @@ namespace mage::rendering {
 						gsl::make_span(vertex_t::s_input_element_descs));
 	}
 
+	VertexShaderPtr CreateTransformInstancedVS(ResourceManager& resource_manager) {
+		return CreateVS(resource_manager, 
+						MAGE_SHADER_ARGS(g_transform_instanced_VS), 
+						gsl::make_span(InstanceBuffer::s_input_element_descs));
+	}
+
+	VertexShaderPtr CreateTransformQuantizedInstancedVS(ResourceManager& resource_manager) {
+		return CreateVS(resource_manager, 
+						MAGE_SHADER_ARGS(g_transform_quantized_instanced_VS), 
+						gsl::make_span(InstanceBuffer::s_quantized_input_element_descs));
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
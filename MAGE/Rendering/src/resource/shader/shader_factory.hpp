@@ -286,6 +286,28 @@ namespace mage::rendering {
 	 */
 	VertexShaderPtr CreateDepthVS(ResourceManager& resource_manager);
 
+	/**
+	 Creates a depth instanced vertex shader.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the depth instanced vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateDepthInstancedVS(ResourceManager& resource_manager);
+
+	/**
+	 Creates a depth quantized instanced vertex shader.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the depth quantized instanced vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateDepthQuantizedInstancedVS(ResourceManager& resource_manager);
+
 	/**
 	 Creates a depth transparent vertex shader.
 
@@ -297,6 +319,28 @@ namespace mage::rendering {
 	 */
 	VertexShaderPtr CreateDepthTransparentVS(ResourceManager& resource_manager);
 
+	/**
+	 Creates a depth transparent instanced vertex shader.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the depth transparent instanced vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateDepthTransparentInstancedVS(ResourceManager& resource_manager);
+
+	/**
+	 Creates a depth transparent quantized instanced vertex shader.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the depth transparent quantized instanced vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateDepthTransparentQuantizedInstancedVS(ResourceManager& resource_manager);
+
 	/**
 	 Creates a depth transparent pixel shader.
 
@@ -570,6 +614,28 @@ namespace mage::rendering {
 	 */
 	VertexShaderPtr CreateTransformVS(ResourceManager& resource_manager);
 
+	/**
+	 Creates a transform instanced vertex shader.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the transform instanced vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateTransformInstancedVS(ResourceManager& resource_manager);
+
+	/**
+	 Creates a transform quantized instanced vertex shader.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the transform quantized instanced vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateTransformQuantizedInstancedVS(ResourceManager& resource_manager);
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -588,6 +654,17 @@ namespace mage::rendering {
 	 */
 	VertexShaderPtr CreateVoxelizationVS(ResourceManager& resource_manager);
 
+	/**
+	 Creates a voxelization quantized vertex shader.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the voxelization quantized vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateVoxelizationQuantizedVS(ResourceManager& resource_manager);
+
 	/**
 	 Creates a voxelization geometry shader.
 
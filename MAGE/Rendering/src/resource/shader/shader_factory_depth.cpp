@@ -5,11 +5,16 @@
 
 #include "resource\shader\shader_factory.hpp"
 #include "resource\mesh\vertex.hpp"
+#include "renderer\buffer\instance_buffer.hpp"
 
 // Depth: Opaque
 #include "depth\depth_VS.hpp"
+#include "depth\depth_instanced_VS.hpp"
+#include "depth\depth_quantized_instanced_VS.hpp"
 // Depth: Transparent
 #include "depth\depth_transparent_VS.hpp"
+#include "depth\depth_transparent_instanced_VS.hpp"
+#include "depth\depth_transparent_quantized_instanced_VS.hpp"
 #include "depth\depth_transparent_PS.hpp"
 
 #pragma endregion
@@ -42,6 +47,18 @@ namespace mage::rendering {
 						gsl::make_span(vertex_t::s_input_element_descs));
 	}
 
+	VertexShaderPtr CreateDepthInstancedVS(ResourceManager& resource_manager) {
+		return CreateVS(resource_manager, 
+						MAGE_SHADER_ARGS(g_depth_instanced_VS), 
+						gsl::make_span(InstanceBuffer::s_input_element_descs));
+	}
+
+	VertexShaderPtr CreateDepthQuantizedInstancedVS(ResourceManager& resource_manager) {
+		return CreateVS(resource_manager, 
+						MAGE_SHADER_ARGS(g_depth_quantized_instanced_VS), 
+						gsl::make_span(InstanceBuffer::s_quantized_input_element_descs));
+	}
+
 	VertexShaderPtr CreateDepthTransparentVS(ResourceManager& resource_manager) {
 		using vertex_t = VertexPositionNormalTexture;
 		return CreateVS(resource_manager, 
@@ -49,6 +66,18 @@ namespace mage::rendering {
 						gsl::make_span(vertex_t::s_input_element_descs));
 	}
 
+	VertexShaderPtr CreateDepthTransparentInstancedVS(ResourceManager& resource_manager) {
+		return CreateVS(resource_manager, 
+						MAGE_SHADER_ARGS(g_depth_transparent_instanced_VS), 
+						gsl::make_span(InstanceBuffer::s_input_element_descs));
+	}
+
+	VertexShaderPtr CreateDepthTransparentQuantizedInstancedVS(ResourceManager& resource_manager) {
+		return CreateVS(resource_manager, 
+						MAGE_SHADER_ARGS(g_depth_transparent_quantized_instanced_VS), 
+						gsl::make_span(InstanceBuffer::s_quantized_input_element_descs));
+	}
+
 	PixelShaderPtr CreateDepthTransparentPS(ResourceManager& resource_manager) {
 		return CreatePS(resource_manager, 
 						MAGE_SHADER_ARGS(g_depth_transparent_PS));
@@ -9,6 +9,7 @@
 // Voxelization
 #include "voxelization\voxelization_CS.hpp"
 #include "voxelization\voxelization_VS.hpp"
+#include "voxelization\voxelization_quantized_VS.hpp"
 #include "voxelization\voxelization_GS.hpp"
 // Voxelization: Opaque
 #include "voxelization\voxelization_emissive_PS.hpp"
@@ -50,6 +51,13 @@ namespace mage::rendering {
 						gsl::make_span(vertex_t::s_input_element_descs));
 	}
 
+	VertexShaderPtr CreateVoxelizationQuantizedVS(ResourceManager& resource_manager) {
+		using vertex_t = QuantizedVertexPositionNormalTexture;
+		return CreateVS(resource_manager, 
+						MAGE_SHADER_ARGS(g_voxelization_quantized_VS), 
+						gsl::make_span(vertex_t::s_input_element_descs));
+	}
+
 	GeometryShaderPtr CreateVoxelizationGS(ResourceManager& resource_manager) {
 		return CreateGS(resource_manager, 
 						MAGE_SHADER_ARGS(g_voxelization_GS));
@@ -8,19 +8,47 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
-	Model::Model(ID3D11Device& device) 
+	namespace {
+
+		/**
+		 The projected diameter of the bounding sphere of a model as a 
+		 fraction of the viewport height above which the finest level of 
+		 detail is selected.
+		 */
+		constexpr F32 g_lod_screen_size = 0.25f;
+	}
+
+	Model::Model() 
 		: Component(),
-		m_buffer(device),
+		m_buffer_allocation(),
+		m_buffer(),
+		m_buffer_data(),
+		m_transform_version(0ull),
+		m_appearance_dirty(true),
 		m_aabb(),
 		m_sphere(),
 		m_mesh(), 
 		m_start_index(0u), 
 		m_nb_indices(0u),
+		m_lods(),
+		m_position_offset(0.0f, 0.0f, 0.0f),
+		m_position_scale(1.0f, 1.0f, 1.0f),
 		m_texture_transform(),
 		m_material(),
 		m_light_occlusion(true) {}
@@ -35,19 +63,79 @@ namespace mage::rendering {
 						size_t start_index,
 						size_t nb_indices, 
 						AABB aabb, 
-						BoundingSphere bs) {
+						BoundingSphere bs, 
+						std::vector< U32x2 > lods,
+						const F32x3& position_offset,
+						const F32x3& position_scale) {
+
+		m_aabb             = std::move(aabb);
+		m_sphere           = std::move(bs);
+		m_mesh             = std::move(mesh);
+		m_start_index      = start_index;
+		m_nb_indices       = nb_indices;
+		m_lods             = std::move(lods);
+		m_position_offset  = position_offset;
+		m_position_scale   = position_scale;
+		m_appearance_dirty = true;
+	}
 
-		m_aabb        = std::move(aabb);
-		m_sphere      = std::move(bs);
-		m_mesh        = std::move(mesh);
-		m_start_index = start_index;
-		m_nb_indices  = nb_indices;
+	[[nodiscard]]
+	size_t XM_CALLCONV Model::SelectLOD(FXMMATRIX object_to_view,
+										CXMMATRIX view_to_projection,
+										F32 bias) const noexcept {
+		using std::empty;
+		if (empty(m_lods)) {
+			return 0u;
+		}
+
+		// The object-to-view transformation matrix may contain a scale.
+		const auto scale = std::max({
+			XMVectorGetX(XMVector3LengthSq(object_to_view.r[0])),
+			XMVectorGetX(XMVector3LengthSq(object_to_view.r[1])),
+			XMVectorGetX(XMVector3LengthSq(object_to_view.r[2]))
+		});
+		const auto radius = m_sphere.Radius() * std::sqrt(scale);
+
+		// The unbiased level of detail is the finest level of detail if the 
+		// bounding sphere contains or is close to the eye.
+		auto lod = 0.0f;
+
+		// The projected diameter as a fraction of the viewport height.
+		auto size = radius * XMVectorGetY(view_to_projection.r[1]);
+		bool contains_eye = false;
+		if (0.0f != XMVectorGetW(view_to_projection.r[2])) {
+			const auto p_view = XMVector3TransformCoord(m_sphere.Centroid(), 
+														object_to_view);
+			const auto depth  = XMVectorGetZ(p_view);
+			contains_eye = (depth <= radius);
+			size /= depth;
+		}
+
+		if (!contains_eye && 0.0f < size) {
+			lod = std::max(std::log2(g_lod_screen_size / size), 0.0f);
+		}
+
+		// The bias applies to all views (e.g., occluder views close to a 
+		// large model).
+		return static_cast< size_t >(std::clamp(std::floor(lod + bias), 
+			0.0f, static_cast< F32 >(m_lods.size())));
 	}
 
-	void Model::UpdateBuffer(ID3D11DeviceContext& device_context) const {
+	bool Model::UpdateBufferData() const {
 		Assert(HasOwner());
 		
 		const auto& transform         = GetOwner()->GetTransform();
+		
+		// Transform versions are never zero. Clean models are skipped 
+		// without recomputing their buffer data.
+		if (!m_appearance_dirty 
+			&& transform.GetVersion() == m_transform_version) {
+			return false;
+		}
+
+		m_transform_version = transform.GetVersion();
+		m_appearance_dirty  = false;
+
 		const auto  object_to_world   = transform.GetObjectToWorldMatrix();
 		const auto  world_to_object   = transform.GetWorldToObjectMatrix();
 		const auto  texture_transform = m_texture_transform.GetTransformMatrix();
@@ -63,8 +151,25 @@ namespace mage::rendering {
 			                          : m_material.GetBaseColor();
 		buffer.m_roughness            = m_material.GetRoughness();
 		buffer.m_metalness            = m_material.GetMetalness();
+		// Dequantization
+		buffer.m_position_offset      = m_position_offset;
+		buffer.m_position_scale       = m_position_scale;
+
+		// Static models keep their buffer data.
+		if (0 == std::memcmp(&buffer, &m_buffer_data, sizeof(buffer))) {
+			return false;
+		}
+
+		m_buffer_data = buffer;
+		return true;
+	}
+
+	void Model::UploadBufferData(ID3D11Device& device, 
+								 ID3D11DeviceContext& device_context) const {
+		if (!m_buffer) {
+			m_buffer = MakeUnique< ConstantBuffer< ModelBuffer > >(device);
+		}
 
-		// Update the model buffer.
-		m_buffer.UpdateData(device_context, buffer);
+		m_buffer->UpdateData(device_context, m_buffer_data);
 	}
 }
\ No newline at end of file
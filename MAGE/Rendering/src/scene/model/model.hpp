@@ -11,6 +11,7 @@
 #include "geometry\bounding_volume.hpp"
 #include "transform\texture_transform.hpp"
 #include "renderer\buffer\constant_buffer.hpp"
+#include "renderer\buffer\upload_buffer.hpp"
 #include "renderer\buffer\model_buffer.hpp"
 
 #pragma endregion
@@ -36,11 +37,8 @@ namespace mage::rendering {
 
 		/**
 		 Constructs a model.
-
-		 @param[in]		device
-						A reference to the device.
 		 */
-		explicit Model(ID3D11Device& device);
+		Model();
 
 		/**
 		 Constructs a model from the given model.
@@ -103,12 +101,35 @@ namespace mage::rendering {
 						The AABB.
 		 @param[in]		bs
 						The bounding sphere.
+		 @param[in]		lods
+						A vector containing the index ranges (i.e. start 
+						index and number of indices) of the coarser levels of 
+						detail in the mesh, ordered from fine to coarse.
+		 @param[in]		position_offset
+						A reference to the dequantization offset of the 
+						vertex positions in the mesh (if quantized).
+		 @param[in]		position_scale
+						A reference to the dequantization scale of the vertex 
+						positions in the mesh (if quantized).
 		 */
 		void SetMesh(SharedPtr< const Mesh > mesh,
 					 size_t start_index,
 					 size_t nb_indices,
 					 AABB aabb,
-					 BoundingSphere bs);
+					 BoundingSphere bs, 
+					 std::vector< U32x2 > lods = {},
+					 const F32x3& position_offset = { 0.0f, 0.0f, 0.0f },
+					 const F32x3& position_scale  = { 1.0f, 1.0f, 1.0f });
+
+		/**
+		 Returns the mesh of this model.
+
+		 @return		A pointer to the mesh of this model.
+		 */
+		[[nodiscard]]
+		const Mesh* GetMesh() const noexcept {
+			return m_mesh.get();
+		}
 
 		/**
 		 Returns the AABB of this model.
@@ -130,27 +151,72 @@ namespace mage::rendering {
 			return m_sphere;
 		}
 
+		/**
+		 Returns the number of levels of detail of this model.
+
+		 @return		The number of levels of detail of this model (i.e. the
+						finest level of detail and the coarser levels of 
+						detail).
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfLODs() const noexcept {
+			return 1u + m_lods.size();
+		}
+
 		/**
 		 Returns the start index of this model in the mesh of this model.
 
-		 @return		The start index of this model in the mesh of this model.
+		 @pre			@a lod is less than the number of levels of detail of
+						this model.
+		 @param[in]		lod
+						The level of detail.
+		 @return		The start index of the given level of detail of this 
+						model in the mesh of this model.
 		 */
 		[[nodiscard]]
-		size_t GetStartIndex() const noexcept {
-			return m_start_index;
+		size_t GetStartIndex(size_t lod = 0u) const noexcept {
+			return (0u == lod) ? m_start_index : m_lods[lod - 1u][0u];
 		}
 
 		/**
 		 Returns the number of indices of this model in the mesh of this model.
 
-		 @return		The number of indices of this model in the mesh of this 
-						model.
+		 @pre			@a lod is less than the number of levels of detail of
+						this model.
+		 @param[in]		lod
+						The level of detail.
+		 @return		The number of indices of the given level of detail of 
+						this model in the mesh of this model.
 		 */
 		[[nodiscard]]
-		size_t GetNumberOfIndices() const noexcept {
-			return m_nb_indices;
+		size_t GetNumberOfIndices(size_t lod = 0u) const noexcept {
+			return (0u == lod) ? m_nb_indices : m_lods[lod - 1u][1u];
 		}
 
+		/**
+		 Selects the level of detail of this model for the given view from the
+		 projected size of the bounding sphere of this model.
+
+		 The finest level of detail is selected if the projected diameter of 
+		 the bounding sphere covers at least a quarter of the viewport height.
+		 Each halving of the projected diameter selects the next coarser level
+		 of detail. The bias is added to the unbiased level of detail (which is 
+		 never negative) in all cases.
+
+		 @param[in]		object_to_view
+						The object-to-view transformation matrix.
+		 @param[in]		view_to_projection
+						The view-to-projection transformation matrix.
+		 @param[in]		bias
+						The level of detail bias. Positive biases select 
+						coarser levels of detail.
+		 @return		The selected level of detail of this model.
+		 */
+		[[nodiscard]]
+		size_t XM_CALLCONV SelectLOD(FXMMATRIX object_to_view,
+									 CXMMATRIX view_to_projection,
+									 F32 bias = 0.0f) const noexcept;
+
 		/**
 		 Binds the mesh of this model.
 
@@ -180,9 +246,55 @@ namespace mage::rendering {
 
 		 @param[in]		device_context
 						A reference to the device context.
+		 @param[in]		lod
+						The level of detail.
 		 */
-		void Draw(ID3D11DeviceContext& device_context) const noexcept {
-			m_mesh->Draw(device_context, m_start_index, m_nb_indices);
+		void Draw(ID3D11DeviceContext& device_context, 
+				  size_t lod = 0u) const noexcept {
+			m_mesh->Draw(device_context, 
+						 GetStartIndex(lod), GetNumberOfIndices(lod));
+		}
+
+		/**
+		 Draws instances of this model.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		start_instance
+						The start instance.
+		 @param[in]		nb_instances
+						The number of instances.
+		 @param[in]		lod
+						The level of detail.
+		 */
+		void DrawInstanced(ID3D11DeviceContext& device_context,
+						   U32 start_instance,
+						   U32 nb_instances, 
+						   size_t lod = 0u) const noexcept {
+			m_mesh->DrawInstanced(device_context, 
+								  GetStartIndex(lod), GetNumberOfIndices(lod),
+								  start_instance, nb_instances);
+		}
+
+		/**
+		 Records drawing instances of this model.
+
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		start_instance
+						The start instance.
+		 @param[in]		nb_instances
+						The number of instances.
+		 @param[in]		lod
+						The level of detail.
+		 */
+		void DrawInstanced(CommandList& commands,
+						   U32 start_instance,
+						   U32 nb_instances, 
+						   size_t lod = 0u) const {
+			m_mesh->DrawInstanced(commands, 
+								  GetStartIndex(lod), GetNumberOfIndices(lod),
+								  start_instance, nb_instances);
 		}
 
 		//---------------------------------------------------------------------
@@ -192,10 +304,13 @@ namespace mage::rendering {
 		/**
 		 Returns the texture transform of this model.
 
+		 The buffer data of this model is updated in the next frame.
+
 		 @return		A reference to the texture transform of this model.
 		 */
 		[[nodiscard]]
 		TextureTransform& GetTextureTransform() noexcept {
+			m_appearance_dirty = true;
 			return m_texture_transform;
 		}
 
@@ -212,10 +327,13 @@ namespace mage::rendering {
 		/**
 		 Returns the material of this model.
 
+		 The buffer data of this model is updated in the next frame.
+
 		 @return		A reference to the material of this model.
 		 */
 		[[nodiscard]]
 		Material& GetMaterial() noexcept {
+			m_appearance_dirty = true;
 			return m_material;
 		}
 
@@ -281,16 +399,75 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Updates the buffer of this model.
+		 Updates the buffer data of this model.
+
+		 The buffer data is only recomputed if the transform of the owner of
+		 this model was resolved or the appearance of this model was accessed
+		 for writing since the last update.
+
+		 @return		@c true if the buffer data of this model changed.
+						@c false otherwise.
+		 */
+		bool UpdateBufferData() const;
+
+		/**
+		 Checks whether the buffer of this model is still valid in the given
+		 upload buffer.
 
+		 @param[in]		buffer
+						A reference to the upload buffer.
+		 @return		@c true if the buffer of this model is still valid in
+						the given upload buffer. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasValidBuffer(const UploadBuffer& buffer) const noexcept {
+			return buffer.IsValid(m_buffer_allocation);
+		}
+
+		/**
+		 Uploads the buffer data of this model to the given upload buffer.
+
+		 @pre			The given upload buffer is mapped.
+		 @param[in]		buffer
+						A reference to the upload buffer.
+		 */
+		void UploadBufferData(UploadBuffer& buffer) const noexcept {
+			m_buffer_allocation = buffer.Allocate(&m_buffer_data, 
+												  sizeof(m_buffer_data));
+		}
+
+		/**
+		 Uploads the buffer data of this model to the constant buffer of this 
+		 model.
+
+		 This is the fallback for devices which do not support upload buffers
+		 (i.e. D3D11.0 devices).
+
+		 @param[in]		device
+						A reference to the device.
 		 @param[in]		device_context
 						A reference to the device context.
+		 @throws		Exception
+						Failed to upload the buffer data of this model.
 		 */
-		void UpdateBuffer(ID3D11DeviceContext& device_context) const;
+		void UploadBufferData(ID3D11Device& device, 
+							  ID3D11DeviceContext& device_context) const;
+
+		/**
+		 Returns the buffer data of this model.
+
+		 @return		A reference to the buffer data of this model as of the
+						last update of the buffer of this model.
+		 */
+		[[nodiscard]]
+		const ModelBuffer& GetBufferData() const noexcept {
+			return m_buffer_data;
+		}
 
 		/**
 		 Binds the buffer of this model to the given pipeline stage.
 
+		 @pre			The buffer of this model is valid.
 		 @tparam		PipelineStageT
 						The pipeline stage type.
 		 @param[in]		device_context
@@ -301,10 +478,40 @@ namespace mage::rendering {
 						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
 		 */
 		template< typename PipelineStageT >
-		void BindBuffer(ID3D11DeviceContext& device_context,
+		void BindBuffer(ID3D11DeviceContext& device_context, 
 						U32 slot) const noexcept {
+			if (m_buffer) {
+				m_buffer->Bind< PipelineStageT >(device_context, slot);
+			}
+			else {
+				m_buffer_allocation.m_buffer->Bind< PipelineStageT >(
+					slot, m_buffer_allocation);
+			}
+		}
+
+		/**
+		 Records binding the buffer of this model to the given pipeline stage.
 
-			m_buffer.Bind< PipelineStageT >(device_context, slot);
+		 @pre			The buffer of this model is valid.
+		 @tparam		PipelineStageT
+						The pipeline stage type.
+		 @param[in]		commands
+						A reference to the command list.
+		 @param[in]		slot
+						The index into the device's zero-based array to set 
+						the constant buffer to (ranges from 0 to 
+						@c D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT - 1).
+		 */
+		template< typename PipelineStageT >
+		void BindBuffer(CommandList& commands, U32 slot) const {
+			if (m_buffer) {
+				commands.BindConstantBuffer< PipelineStageT >(
+					slot, &m_buffer->Get());
+			}
+			else {
+				m_buffer_allocation.m_buffer->Bind< PipelineStageT >(
+					commands, slot, m_buffer_allocation);
+			}
 		}
 
 	private:
@@ -314,9 +521,33 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 The buffer of this model.
+		 The allocation of the buffer of this model.
+		 */
+		mutable UploadAllocation m_buffer_allocation;
+
+		/**
+		 A pointer to the constant buffer of this model (only used if upload
+		 buffers are not supported).
+		 */
+		mutable UniquePtr< ConstantBuffer< ModelBuffer > > m_buffer;
+
+		/**
+		 The buffer data of this model.
+		 */
+		mutable ModelBuffer m_buffer_data;
+
+		/**
+		 The version of the transform of the owner of this model as of the 
+		 last update of the buffer data of this model.
+		 */
+		mutable U64 m_transform_version;
+
+		/**
+		 A flag indicating whether the texture transform or material of this
+		 model were accessed for writing since the last update of the buffer
+		 data of this model.
 		 */
-		mutable ConstantBuffer< ModelBuffer > m_buffer;
+		mutable bool m_appearance_dirty;
 
 		//---------------------------------------------------------------------
 		// Member Variables: Geometry
@@ -347,6 +578,25 @@ namespace mage::rendering {
 		 */
 		size_t m_nb_indices;
 
+		/**
+		 A vector containing the index ranges (i.e. start index and number of
+		 indices) of the coarser levels of detail of this model in the mesh 
+		 of this model.
+		 */
+		std::vector< U32x2 > m_lods;
+
+		/**
+		 The dequantization offset of the quantized vertex positions of this 
+		 model in the mesh of this model.
+		 */
+		F32x3 m_position_offset;
+
+		/**
+		 The dequantization scale of the quantized vertex positions of this 
+		 model in the mesh of this model.
+		 */
+		F32x3 m_position_scale;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Appearance
 		//---------------------------------------------------------------------
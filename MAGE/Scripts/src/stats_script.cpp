@@ -74,10 +74,28 @@ namespace mage::script {
 			std::to_wstring(m_fps),
 			std::move(color)));
 		
-		wchar_t buffer[64];
+		const auto& frame_statistics = engine.GetFrameStatistics();
+
+		wchar_t buffer[256];
 		_snwprintf_s(buffer, std::size(buffer), 
-			         L"\nSPF: %.2fms\nCPU: %.1f%%\nRAM: %uMB\nDCs: %u", 
-					 m_spf, m_cpu, m_ram, rendering::Pipeline::s_nb_draws);
+			         L"\nSPF: %.2fms\nCPU: %.1f%%\nRAM: %uMB"
+					 L"\nLatency: %.2fms\nThroughput: %.1fFPS\nDCs: %u"
+					 L"\nSkipped binds: %u/%u/%u"
+					 L"\nMaps: %u (%.1fKB)"
+					 L"\nHeap allocs: %u", 
+					 m_spf, m_cpu, m_ram, 
+					 frame_statistics.GetLatency().count() * 1000.0, 
+					 frame_statistics.GetThroughput(), 
+					 rendering::Pipeline::s_nb_draws, 
+					 rendering::Pipeline::s_nb_skipped_shader_binds.load(
+						 std::memory_order_relaxed), 
+					 rendering::Pipeline::s_nb_skipped_srv_binds.load(
+						 std::memory_order_relaxed), 
+					 rendering::Pipeline::s_nb_skipped_buffer_binds.load(
+						 std::memory_order_relaxed), 
+					 rendering::Pipeline::s_nb_maps, 
+					 rendering::Pipeline::s_nb_mapped_bytes / 1024.0f, 
+					 g_nb_aligned_allocations.load(std::memory_order_relaxed));
 		m_text->AppendText(std::wstring(buffer));
 	}
 }
\ No newline at end of file
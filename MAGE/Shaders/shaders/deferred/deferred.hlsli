@@ -20,6 +20,7 @@
 // DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_OMNI        | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_SPOT        | not defined
+// DISABLE_LIGHT_CLUSTERS                   | not defined
 // DISABLE_VCT                              | not defined
 // GROUP_SIZE                               | GROUP_SIZE_2D_DEFAULT (CS only)
 // MSAA                                     | not defined (PS only)
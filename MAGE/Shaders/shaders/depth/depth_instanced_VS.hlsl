@@ -0,0 +1,17 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "depth\depth_input.hlsli"
+#include "transform\instancing.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+float4 VS(VSInputPositionNormalTextureInstance input) : SV_Position {
+	const ModelInstance instance = g_instances[input.instance];
+
+    return Transform(input.p, 
+	                 instance.object_to_world, 
+					 g_world_to_camera2, 
+					 g_camera2_to_projection2);
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "depth\depth_input.hlsli"
+#include "transform\instancing.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+float4 VS(VSInputQuantizedPositionNormalTextureInstance input) : SV_Position {
+	const ModelInstance instance = g_instances[input.instance];
+
+	const float3 p = Dequantize(input.p.xyz, 
+								instance.position_offset, 
+								instance.position_scale);
+
+    return Transform(p, 
+	                 instance.object_to_world, 
+					 g_world_to_camera2, 
+					 g_camera2_to_projection2);
+}
\ No newline at end of file
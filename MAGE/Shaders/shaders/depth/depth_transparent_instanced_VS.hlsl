@@ -0,0 +1,20 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "depth\depth_input.hlsli"
+#include "transform\instancing.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+PSInputTexture VS(VSInputPositionNormalTextureInstance input) {
+	const ModelInstance instance = g_instances[input.instance];
+
+	PSInputTexture output;
+	output.p   = Transform(input.p,
+						   instance.object_to_world,
+						   g_world_to_camera2,
+						   g_camera2_to_projection2);
+	output.tex = Transform(input.tex, instance.texture_transform);
+	return output;
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "depth\depth_input.hlsli"
+#include "transform\instancing.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+PSInputTexture VS(VSInputQuantizedPositionNormalTextureInstance input) {
+	const ModelInstance instance = g_instances[input.instance];
+
+	const float3 p = Dequantize(input.p.xyz, 
+								instance.position_offset, 
+								instance.position_scale);
+
+	PSInputTexture output;
+	output.p   = Transform(p,
+						   instance.object_to_world,
+						   g_world_to_camera2,
+						   g_camera2_to_projection2);
+	output.tex = Transform(input.tex, instance.texture_transform);
+	return output;
+}
\ No newline at end of file
@@ -20,6 +20,7 @@
 // DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_OMNI        | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_SPOT        | not defined
+// DISABLE_LIGHT_CLUSTERS                   | not defined
 // DISABLE_TEXTURE_BASE_COLOR               | not defined
 // DISABLE_TEXTURE_MATERIAL                 | not defined
 // DISABLE_TSNM                             | not defined
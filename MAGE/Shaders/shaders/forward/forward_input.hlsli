@@ -56,6 +56,20 @@ CBUFFER(Model, SLOT_CBUFFER_MODEL) {
 	 The (linear) metalness of the material.
 	 */
 	float    g_metalness               : packoffset(c13.y);
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Dequantization
+	//-------------------------------------------------------------------------
+
+	/**
+	 The dequantization offset of the quantized vertex positions.
+	 */
+	float3   g_position_offset         : packoffset(c14);
+
+	/**
+	 The dequantization scale of the quantized vertex positions.
+	 */
+	float3   g_position_scale          : packoffset(c15);
 }
 
 //-----------------------------------------------------------------------------
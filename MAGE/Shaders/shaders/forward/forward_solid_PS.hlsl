@@ -11,6 +11,7 @@
 // DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_OMNI        | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_SPOT        | not defined
+// DISABLE_LIGHT_CLUSTERS                   | not defined
 // MSAA_AS_SSAA                             | not defined
 
 //-----------------------------------------------------------------------------
@@ -508,4 +508,42 @@ struct ShadowMappedSpotLight : SpotLight {
 	}
 };
 
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions: Light Clusters
+//-----------------------------------------------------------------------------
+
+/**
+ A struct of light clusters (i.e. froxels of the view frustum).
+ 
+ Each member contains the offset into the light index list (.x) and the 
+ number of lights (.y) of the corresponding light type overlapping this light 
+ cluster.
+ */
+struct LightCluster {
+
+	//-------------------------------------------------------------------------
+	// Member Variables
+	//-------------------------------------------------------------------------
+
+	/**
+	 The omni lights of this light cluster.
+	 */
+	uint2 m_omni_lights;
+
+	/**
+	 The spotlights of this light cluster.
+	 */
+	uint2 m_spot_lights;
+
+	/**
+	 The shadow mapped omni lights of this light cluster.
+	 */
+	uint2 m_sm_omni_lights;
+
+	/**
+	 The shadow mapped spotlights of this light cluster.
+	 */
+	uint2 m_sm_spot_lights;
+};
+
 #endif // MAGE_HEADER_LIGHT
\ No newline at end of file
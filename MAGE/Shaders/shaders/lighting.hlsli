@@ -25,6 +25,7 @@
 // DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_OMNI        | not defined
 // DISABLE_LIGHTS_SHADOW_MAPPED_SPOT        | not defined
+// DISABLE_LIGHT_CLUSTERS                   | not defined
 // DISABLE_VCT                              | not defined
 
 //-----------------------------------------------------------------------------
@@ -96,6 +97,22 @@ CBUFFER(LightBuffer, SLOT_CBUFFER_LIGHTING) {
 	 The radiance of the ambient light in the scene.
 	 */ 
 	float3 g_La                     : packoffset(c2);
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Light Clusters
+	//-------------------------------------------------------------------------
+
+	/**
+	 The scale of the (base-2) logarithm of the camera-space z coordinate to 
+	 obtain the light cluster slice.
+	 */
+	float g_light_cluster_z_scale   : packoffset(c3.x);
+
+	/**
+	 The bias of the (base-2) logarithm of the camera-space z coordinate to 
+	 obtain the light cluster slice.
+	 */
+	float g_light_cluster_z_bias    : packoffset(c3.y);
 }
 
 #endif // BRDF_FUNCTION
@@ -145,6 +162,13 @@ TEXTURE_2D_ARRAY(g_spot_sms, float,
 
 #endif // DISABLE_LIGHTS_SHADOW_MAPPED
 
+#ifndef DISABLE_LIGHT_CLUSTERS
+STRUCTURED_BUFFER(g_light_clusters, LightCluster, 
+				  SLOT_SRV_LIGHT_CLUSTERS);
+STRUCTURED_BUFFER(g_light_indices, uint, 
+				  SLOT_SRV_LIGHT_INDEX_LIST);
+#endif // DISABLE_LIGHT_CLUSTERS
+
 #ifndef DISABLE_VCT
 TEXTURE_3D(g_voxel_texture, float4, SLOT_SRV_VOXEL_TEXTURE);
 #endif // DISABLE_VCT
@@ -170,11 +194,51 @@ float FogFactor_Exponential(float distance, float density) {
 
 #ifdef BRDF_FUNCTION
 
+#ifndef DISABLE_LIGHT_CLUSTERS
+
+/**
+ Returns the light cluster containing the given position.
+
+ @param[in]		p_world
+				The position expressed in world space.
+ @return		The light cluster containing the given position.
+ */
+LightCluster GetLightCluster(float3 p_world) {
+	const float4 p_camera = mul(float4(p_world, 1.0f), g_world_to_camera);
+	const float4 p_proj   = mul(p_camera, g_camera_to_projection);
+	const float3 p_ndc    = HomogeneousDivide(p_proj);
+
+	// [0,1]^2 -> [0,X)x[0,Y)
+	const float2 grid_xy  = float2(LIGHT_CLUSTER_GRID_X, LIGHT_CLUSTER_GRID_Y);
+	const float2 p_uv     = NDCtoUV(p_ndc.xy);
+	const uint2  index_xy = min((uint2)(saturate(p_uv) * grid_xy), 
+								uint2(LIGHT_CLUSTER_GRID_X - 1, 
+									  LIGHT_CLUSTER_GRID_Y - 1));
+	
+	// The slices are distributed exponentially along the camera-space z axis.
+	const float slice     = log2(max(p_camera.z, 1e-6f)) 
+		                  * g_light_cluster_z_scale + g_light_cluster_z_bias;
+	const uint  index_z   = min((uint)max(slice, 0.0f), 
+								LIGHT_CLUSTER_GRID_Z - 1);
+
+	const uint index = (index_z * LIGHT_CLUSTER_GRID_Y + index_xy.y) 
+		             * LIGHT_CLUSTER_GRID_X + index_xy.x;
+	return g_light_clusters[index];
+}
+
+#endif // DISABLE_LIGHT_CLUSTERS
+
 float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world, 
 				   Material material) {
 
 	float3 L = 0.0f;
 
+	#ifndef DISABLE_LIGHT_CLUSTERS
+	// Only the lights overlapping the light cluster of the hit position are 
+	// considered. Directional lights are not clustered.
+	const LightCluster cluster = GetLightCluster(p_world);
+	#endif // DISABLE_LIGHT_CLUSTERS
+
 	#ifndef DISABLE_LIGHTS_AMBIENT
 	// Indirect illumination: ambient lights
 	{
@@ -203,7 +267,12 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 
 	#ifndef DISABLE_LIGHTS_OMNI
 	// Direct illumination: omni lights
+	#ifdef DISABLE_LIGHT_CLUSTERS
 	for (uint i1 = 0u; i1 < g_nb_omni_lights; ++i1) {
+	#else  // DISABLE_LIGHT_CLUSTERS
+	for (uint j1 = 0u; j1 < cluster.m_omni_lights.y; ++j1) {
+		const uint i1 = g_light_indices[cluster.m_omni_lights.x + j1];
+	#endif // DISABLE_LIGHT_CLUSTERS
 		const OmniLight light = g_omni_lights[i1];
 		
 		// Compute the light (hit-to-light) direction and 
@@ -221,7 +290,12 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 
 	#ifndef DISABLE_LIGHTS_SPOT
 	// Direct illumination: spotlights
+	#ifdef DISABLE_LIGHT_CLUSTERS
 	for (uint i2 = 0u; i2 < g_nb_spot_lights; ++i2) {
+	#else  // DISABLE_LIGHT_CLUSTERS
+	for (uint j2 = 0u; j2 < cluster.m_spot_lights.y; ++j2) {
+		const uint i2 = g_light_indices[cluster.m_spot_lights.x + j2];
+	#endif // DISABLE_LIGHT_CLUSTERS
 		const SpotLight light = g_spot_lights[i2];
 		
 		// Compute the light (hit-to-light) direction and 
@@ -260,7 +334,12 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 
 	#ifndef DISABLE_LIGHTS_SHADOW_MAPPED_OMNI
 	// Direct illumination: omni lights with shadow mapping
+	#ifdef DISABLE_LIGHT_CLUSTERS
 	for (uint i4 = 0u; i4 < g_nb_sm_omni_lights; ++i4) {
+	#else  // DISABLE_LIGHT_CLUSTERS
+	for (uint j4 = 0u; j4 < cluster.m_sm_omni_lights.y; ++j4) {
+		const uint i4 = g_light_indices[cluster.m_sm_omni_lights.x + j4];
+	#endif // DISABLE_LIGHT_CLUSTERS
 		const ShadowMappedOmniLight light = g_sm_omni_lights[i4];
 		const ShadowCubeMap map = { g_pcf_sampler, g_omni_sms, i4 };
 
@@ -279,7 +358,12 @@ float3 GetRadiance(float3 p_world, float3 n_world, float3 v_world,
 
 	#ifndef DISABLE_LIGHTS_SHADOW_MAPPED_SPOT
 	// Direct illumination: spotlights with shadow mapping
+	#ifdef DISABLE_LIGHT_CLUSTERS
 	for (uint i5 = 0u; i5 < g_nb_sm_spot_lights; ++i5) {
+	#else  // DISABLE_LIGHT_CLUSTERS
+	for (uint j5 = 0u; j5 < cluster.m_sm_spot_lights.y; ++j5) {
+		const uint i5 = g_light_indices[cluster.m_sm_spot_lights.x + j5];
+	#endif // DISABLE_LIGHT_CLUSTERS
 		const ShadowMappedSpotLight light = g_sm_spot_lights[i5];
 		const ShadowMap map = { g_pcf_sampler, g_spot_sms, i5 };
 		
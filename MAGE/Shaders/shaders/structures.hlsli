@@ -78,6 +78,42 @@ struct VSInputPositionNormalColorTexture {
 	float2 tex   : TEXCOORD0;
 };
 
+/**
+ A vertex shader input struct of vertices having a position, a normal and a 
+ pair of texture coordinates, and of instances having an index.
+ */
+struct VSInputPositionNormalTextureInstance {
+	float3 p        : POSITION0;
+	float3 n        : NORMAL0;
+	float2 tex      : TEXCOORD0;
+	uint   instance : INSTANCE0;
+};
+
+/**
+ A vertex shader input struct of quantized vertices having a position, a 
+ normal and a pair of texture coordinates.
+
+ The position is expressed in normalized coordinates relative to the 
+ dequantization offset and scale of the model, the normal is octahedral 
+ encoded and the texture coordinates are half floats.
+ */
+struct VSInputQuantizedPositionNormalTexture {
+	float4 p        : POSITION0;
+	float2 n        : NORMAL0;
+	float2 tex      : TEXCOORD0;
+};
+
+/**
+ A vertex shader input struct of quantized vertices having a position, a 
+ normal and a pair of texture coordinates, and of instances having an index.
+ */
+struct VSInputQuantizedPositionNormalTextureInstance {
+	float4 p        : POSITION0;
+	float2 n        : NORMAL0;
+	float2 tex      : TEXCOORD0;
+	uint   instance : INSTANCE0;
+};
+
 //-----------------------------------------------------------------------------
 // GS Input Structures
 //-----------------------------------------------------------------------------
@@ -0,0 +1,80 @@
+#ifndef MAGE_HEADER_INSTANCING
+#define MAGE_HEADER_INSTANCING
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "global.hlsli"
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions 
+//-----------------------------------------------------------------------------
+
+/**
+ A struct of model instances (see the Model constant buffer).
+ */
+struct ModelInstance {
+
+	/**
+	 The object-to-world transformation matrix.
+	 */
+	float4x4 object_to_world;
+
+	/**
+	 The object-to-world inverse transpose transformation matrix 
+	 = the normal-to-world transformation matrix.
+	 */
+	float4x4 normal_to_world;
+
+	/**
+	 The texture transformation matrix.
+	 */
+	float4x4 texture_transform;
+
+	/**
+	 The (linear) base color of the material.
+	 */
+	float4   base_color;
+
+	/**
+	 The (linear) roughness of the material.
+	 */
+	float    roughness;
+
+	/**
+	 The (linear) metalness of the material.
+	 */
+	float    metalness;
+
+	/**
+	 The padding.
+	 */
+	uint2    padding0;
+
+	/**
+	 The dequantization offset of the quantized vertex positions.
+	 */
+	float3   position_offset;
+
+	/**
+	 The padding.
+	 */
+	uint     padding1;
+
+	/**
+	 The dequantization scale of the quantized vertex positions.
+	 */
+	float3   position_scale;
+
+	/**
+	 The padding.
+	 */
+	uint     padding2;
+};
+
+//-----------------------------------------------------------------------------
+// SRVs
+//-----------------------------------------------------------------------------
+STRUCTURED_BUFFER(g_instances, ModelInstance, SLOT_SRV_INSTANCES);
+
+#endif // MAGE_HEADER_INSTANCING
\ No newline at end of file
@@ -5,6 +5,7 @@
 // Engine Includes
 //-----------------------------------------------------------------------------
 #include "structures.hlsli"
+#include "unit_vector.hlsli"
 
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions 
@@ -73,6 +74,52 @@ float2 Transform(float2 tex,
 	return mul(float4(tex, 0.0f, 1.0f), texture_transform).xy;
 }
 
+/**
+ Dequantizes the given position.
+
+ @param[in]		p_unorm
+				The quantized position in the [0,1] range.
+ @param[in]		offset
+				The dequantization offset (i.e. the minimum point of the 
+				quantization AABB) expressed in object space.
+ @param[in]		scale
+				The dequantization scale (i.e. the size of the quantization 
+				AABB) expressed in object space.
+ @return		The position expressed in object space.
+ */
+float3 Dequantize(float3 p_unorm, 
+				  float3 offset, 
+				  float3 scale) {
+
+	return offset + scale * p_unorm;
+}
+
+/**
+ Dequantizes the given quantized vertex input structure.
+
+ @param[in]		input
+				The quantized vertex input structure.
+ @param[in]		offset
+				The dequantization offset (i.e. the minimum point of the 
+				quantization AABB) expressed in object space.
+ @param[in]		scale
+				The dequantization scale (i.e. the size of the quantization 
+				AABB) expressed in object space.
+ @return		The vertex input structure.
+ */
+VSInputPositionNormalTexture Dequantize(VSInputQuantizedPositionNormalTexture input, 
+										float3 offset, 
+										float3 scale) {
+
+	VSInputPositionNormalTexture output;
+
+	output.p   = Dequantize(input.p.xyz, offset, scale);
+	output.n   = DecodeUnitVector_Octahedron(SNormToUNorm(input.n));
+	output.tex = input.tex;
+
+	return output;
+}
+
 /**
  Transforms the given vertex input structure.
 
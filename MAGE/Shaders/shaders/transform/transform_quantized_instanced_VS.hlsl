@@ -0,0 +1,27 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "forward\forward_input.hlsli"
+#include "transform\instancing.hlsli"
+#include "transform\transform.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+PSInputPositionNormalTexture VS(VSInputQuantizedPositionNormalTextureInstance input) {
+	const ModelInstance instance = g_instances[input.instance];
+
+	VSInputQuantizedPositionNormalTexture vertex;
+	vertex.p   = input.p;
+	vertex.n   = input.n;
+	vertex.tex = input.tex;
+
+	return Transform(Dequantize(vertex, 
+								instance.position_offset, 
+								instance.position_scale), 
+					 instance.object_to_world, 
+					 g_world_to_camera,
+					 g_camera_to_projection, 
+					 (float3x3)instance.normal_to_world, 
+					 instance.texture_transform);
+}
\ No newline at end of file
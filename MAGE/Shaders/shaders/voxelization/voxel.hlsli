@@ -32,4 +32,30 @@ float3 DecodeNormal(uint encoded_n) {
 	return NORMAL_DECODE_FUNCTION(UnpackR16G16(encoded_n));
 }
 
+/**
+ Returns the resolution (in bricks) of the voxel grid with the given 
+ resolution (in voxels).
+
+ @param[in]		resolution
+				The resolution (in voxels) of the voxel grid.
+ @return		The resolution (in bricks) of the voxel grid.
+ */
+uint GetVoxelBrickResolution(uint resolution) {
+	return (resolution + VOXEL_BRICK_RESOLUTION - 1u) / VOXEL_BRICK_RESOLUTION;
+}
+
+/**
+ Flattens the given brick index (using x->y->z ordering, matching 
+ UnflattenIndex).
+
+ @param[in]		brick
+				The 3D brick index.
+ @param[in]		brick_resolution
+				The resolution (in bricks) of the voxel grid.
+ @return		The flattened 1D brick index.
+ */
+uint FlattenBrickIndex(uint3 brick, uint brick_resolution) {
+	return brick.x + brick_resolution * (brick.y + brick_resolution * brick.z);
+}
+
 #endif // MAGE_HEADER_VOXEL
\ No newline at end of file
@@ -28,15 +28,36 @@
 //-----------------------------------------------------------------------------
 // Engine Includes
 //-----------------------------------------------------------------------------
+// Voxels are shaded outside the light clusters of the view frustum.
+#define DISABLE_LIGHT_CLUSTERS
 #include "forward\forward_input.hlsli"
 #include "lighting.hlsli"
 #include "voxelization\voxel.hlsli"
 
+//-----------------------------------------------------------------------------
+// SRV
+//-----------------------------------------------------------------------------
+STRUCTURED_BUFFER(voxel_brick_mask, uint, SLOT_SRV_VOXEL_BRICK_MASK);
+
 //-----------------------------------------------------------------------------
 // UAV
 //-----------------------------------------------------------------------------
 RW_STRUCTURED_BUFFER(voxel_grid, Voxel, SLOT_UAV_VOXEL_BUFFER);
 
+/**
+ Checks whether the brick containing the given voxel is dirty.
+
+ @param[in]		index
+				The voxel index.
+ @return		@c true if the brick containing the given voxel is dirty.
+				@c false otherwise.
+ */
+bool IsDirtyBrick(uint3 index) {
+	const uint brick = FlattenBrickIndex(index / VOXEL_BRICK_RESOLUTION, 
+		GetVoxelBrickResolution(g_voxel_grid_resolution));
+	return 0u != (voxel_brick_mask[brick >> 5u] & (1u << (brick & 31u)));
+}
+
 //-----------------------------------------------------------------------------
 // Pixel Shader
 //-----------------------------------------------------------------------------
@@ -50,6 +71,13 @@ void PS(PSInputPositionNormalTexture input) {
 		return;
 	}
 
+	// Only the voxels of dirty bricks are revoxelized, the other voxels 
+	// keep their radiance.
+	[branch]
+	if (!IsDirtyBrick(index)) {
+		return;
+	}
+
 	// Obtain the base color of the material.
 	const float4 base_color = GetMaterialBaseColor(input.tex_material);
 	
@@ -1,16 +1,17 @@
-//-----------------------------------------------------------------------------
-// Engine Configuration
-//-----------------------------------------------------------------------------
-// Defines			                        | Default
-//-----------------------------------------------------------------------------
-// GROUP_SIZE                               | GROUP_SIZE_3D_DEFAULT
-
 //-----------------------------------------------------------------------------
 // Engine Includes
 //-----------------------------------------------------------------------------
 #include "global.hlsli"
 #include "voxelization\voxel.hlsli"
 
+//-----------------------------------------------------------------------------
+// SRV
+//-----------------------------------------------------------------------------
+
+// The first element contains the number of dirty bricks, the remaining 
+// elements contain the (flattened) indices of the dirty bricks.
+STRUCTURED_BUFFER(dirty_bricks, uint, SLOT_SRV_VOXEL_DIRTY_BRICKS);
+
 //-----------------------------------------------------------------------------
 // UAV
 //-----------------------------------------------------------------------------
@@ -21,12 +22,21 @@ RW_TEXTURE_3D(voxel_texture,     float4, SLOT_UAV_VOXEL_TEXTURE);
 // Compute Shader
 //-----------------------------------------------------------------------------
 
-#ifndef GROUP_SIZE
-	#define GROUP_SIZE GROUP_SIZE_3D_DEFAULT
-#endif
+// Each thread group processes one dirty brick.
+[numthreads(VOXEL_BRICK_RESOLUTION, VOXEL_BRICK_RESOLUTION, VOXEL_BRICK_RESOLUTION)]
+void CS(uint3 group_id : SV_GroupID, uint3 group_thread_id : SV_GroupThreadID) {
+
+	const uint index = group_id.y * MAX_NB_GROUPS_PER_DIMENSION + group_id.x;
+	
+	[branch]
+	if (dirty_bricks[0] <= index) {
+		return;
+	}
 
-[numthreads(GROUP_SIZE, GROUP_SIZE, GROUP_SIZE)]
-void CS(uint3 thread_id : SV_DispatchThreadID) {
+	const uint  brick_resolution = GetVoxelBrickResolution(g_voxel_grid_resolution);
+	const uint3 brick     = UnflattenIndex(dirty_bricks[1u + index], 
+										   (uint3)brick_resolution);
+	const uint3 thread_id = brick * VOXEL_BRICK_RESOLUTION + group_thread_id;
 
 	[branch]
 	if (any(g_voxel_grid_resolution <= thread_id)) {
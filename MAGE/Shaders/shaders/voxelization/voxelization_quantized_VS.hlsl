@@ -0,0 +1,15 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "forward\forward_input.hlsli"
+#include "transform\transform.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+GSInputPositionNormalTexture VS(VSInputQuantizedPositionNormalTexture input) {
+	return Transform(Dequantize(input, g_position_offset, g_position_scale), 
+					 g_object_to_world, 
+					 (float3x3)g_normal_to_world,
+					 g_texture_transform);
+}
\ No newline at end of file
@@ -32,6 +32,7 @@
 #define MAGE_AMD_WAFEFRONT_SIZE 64
 #define GROUP_SIZE_2D_DEFAULT   16  // 16^2 = 256, 256/64 = 4
 #define GROUP_SIZE_3D_DEFAULT    8  //  8^3 = 512, 512/64 = 8
+#define MAX_NB_GROUPS_PER_DIMENSION 65535
 
 //-----------------------------------------------------------------------------
 // Engine Includes: Samplers
@@ -68,7 +69,9 @@
 // Engine Includes: Light and Shadow Map SRVs
 //-----------------------------------------------------------------------------
 
+// Light Clusters
 #define SLOT_SRV_LIGHT_INDEX_LIST                  0
+#define SLOT_SRV_LIGHT_CLUSTERS                   19
 // Lights
 #define SLOT_SRV_DIRECTIONAL_LIGHTS                1
 #define SLOT_SRV_OMNI_LIGHTS                       2
@@ -81,11 +84,21 @@
 #define SLOT_SRV_OMNI_SHADOW_MAPS                  8
 #define SLOT_SRV_SPOT_SHADOW_MAPS                  9
 
+// The number of light clusters along the x, y and z axis of the view frustum.
+#define LIGHT_CLUSTER_GRID_X      16
+#define LIGHT_CLUSTER_GRID_Y       9
+#define LIGHT_CLUSTER_GRID_Z      24
+
 //-----------------------------------------------------------------------------
 // Engine Includes: Voxelization
 //-----------------------------------------------------------------------------
 
 #define SLOT_SRV_VOXEL_TEXTURE                    10
+#define SLOT_SRV_VOXEL_BRICK_MASK                 17
+#define SLOT_SRV_VOXEL_DIRTY_BRICKS               18
+
+// The resolution of a voxel brick (i.e. the unit of revoxelization).
+#define VOXEL_BRICK_RESOLUTION    GROUP_SIZE_3D_DEFAULT
 
 //-----------------------------------------------------------------------------
 // Engine Includes: GBuffer SRVs
@@ -104,6 +117,12 @@
 #define SLOT_SRV_SPRITE                           15
 #define SLOT_SRV_TEXTURE                          15
 
+//-----------------------------------------------------------------------------
+// Engine Includes: Instancing SRVs
+//-----------------------------------------------------------------------------
+
+#define SLOT_SRV_INSTANCES                        16
+
 //-----------------------------------------------------------------------------
 // Engine Includes: General UAVs
 //-----------------------------------------------------------------------------
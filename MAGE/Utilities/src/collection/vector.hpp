@@ -6,6 +6,7 @@
 #pragma region
 
 #include "memory\allocation.hpp"
+#include "memory\memory_arena.hpp"
 
 #pragma endregion
 
@@ -25,4 +26,7 @@ namespace mage {
 
 	template< typename T >
 	using AlignedVector = std::vector< T, AlignedAllocator< T > >;
+
+	template< typename T >
+	using ArenaVector = std::vector< T, MemoryArena::Allocator< T > >;
 }
\ No newline at end of file
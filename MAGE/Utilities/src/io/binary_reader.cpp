@@ -7,6 +7,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -16,44 +25,16 @@ namespace mage {
 						UniquePtr< U8[] >& data,
 						size_t& size) {
 
-		const auto file_handle 
-			= CreateUniqueHandle(CreateFile2(path.c_str(),
-											 GENERIC_READ, 
-											 FILE_SHARE_READ, 
-											 OPEN_EXISTING, 
-											 nullptr));
-		
-		FILE_STANDARD_INFO file_info;
-		{
-			const BOOL result = GetFileInformationByHandleEx(file_handle.get(), 
-															 FileStandardInfo, 
-															 &file_info, 
-															 sizeof(file_info));
-			ThrowIfFailed(result, 
-						  "%ls: could not retrieve file information.", 
-						  path.c_str());
-			ThrowIfFailed((0 == file_info.EndOfFile.HighPart), 
-						  "%ls: file too big for 32-bit allocation.", 
-						  path.c_str());
-		}
+		const MappedFile file(path);
 		
 		// Allocate buffer.
-		const auto nb_bytes = file_info.EndOfFile.LowPart;
-		size = static_cast< size_t >(nb_bytes);
-		data = MakeUnique< U8[] >(nb_bytes);
+		size = file.GetSize();
+		data = MakeUnique< U8[] >(size);
 		ThrowIfFailed((nullptr != data), 
 					  "%ls: file too big for allocation.", path.c_str());
 
 		// Populate buffer.
-		{
-			DWORD nb_bytes_read = 0;
-			const BOOL result = ReadFile(file_handle.get(), data.get(), 
-										 nb_bytes, &nb_bytes_read, nullptr);
-			ThrowIfFailed(result, 
-						  "%ls: could not load file data.", path.c_str());
-			ThrowIfFailed((nb_bytes <= nb_bytes_read), 
-						  "%ls: could not load all file data.", path.c_str());
-		}
+		std::copy_n(file.GetData().data(), size, data.get());
 	}
 
 	//-------------------------------------------------------------------------
@@ -66,7 +47,7 @@ namespace mage {
 		m_big_endian(true),
 		m_pos(nullptr), 
 		m_end(nullptr), 
-		m_data() {}
+		m_file() {}
 
 	BinaryReader::BinaryReader(BinaryReader&& reader) noexcept = default;
 
@@ -78,14 +59,18 @@ namespace mage {
 	void BinaryReader::ReadFromFile(std::filesystem::path path, 
 									bool big_endian) {
 
-		m_path       = std::move(path);
+		m_file = MappedFile(std::move(path));
+		
+		ReadFromFile(m_file, big_endian);
+	}
+
+	void BinaryReader::ReadFromFile(const MappedFile& file, bool big_endian) {
+		m_path       = file.GetPath();
 		m_big_endian = big_endian;
 
-		size_t nb_bytes = 0u;
-		ReadBinaryFile(m_path, m_data, nb_bytes);
-		
-		m_pos = m_data.get();
-		m_end = m_data.get() + nb_bytes;
+		const auto data = file.GetData();
+		m_pos = data.data();
+		m_end = data.data() + data.size();
 		
 		ReadData();
 	}
@@ -130,7 +115,7 @@ namespace mage {
 		: m_path(), 
 		m_pos(nullptr), 
 		m_end(nullptr), 
-		m_data() {}
+		m_file() {}
 
 	BigEndianBinaryReader::BigEndianBinaryReader(
 		BigEndianBinaryReader&& reader) noexcept = default;
@@ -141,13 +126,17 @@ namespace mage {
 		::operator=(BigEndianBinaryReader&& reader) noexcept = default;
 
 	void BigEndianBinaryReader::ReadFromFile(std::filesystem::path path) {
-		m_path = std::move(path);
+		m_file = MappedFile(std::move(path));
+
+		ReadFromFile(m_file);
+	}
 
-		size_t nb_bytes = 0u;
-		ReadBinaryFile(m_path, m_data, nb_bytes);
+	void BigEndianBinaryReader::ReadFromFile(const MappedFile& file) {
+		m_path = file.GetPath();
 
-		m_pos  = m_data.get();
-		m_end  = m_data.get() + nb_bytes;
+		const auto data = file.GetData();
+		m_pos  = data.data();
+		m_end  = data.data() + data.size();
 		
 		ReadData();
 	}
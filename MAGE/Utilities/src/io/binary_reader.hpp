@@ -6,6 +6,7 @@
 #pragma region
 
 #include "io\binary_utils.hpp"
+#include "io\mapped_file.hpp"
 
 #pragma endregion
 
@@ -91,6 +92,22 @@ namespace mage {
 						Failed to read from the file.
 		 */
 		void ReadFromFile(std::filesystem::path path, bool big_endian);
+
+		/**
+		 Reads from the given mapped file.
+
+		 The given mapped file is not copied and must outlive all data
+		 referenced by this binary reader.
+
+		 @param[in]		file
+						A reference to the mapped file.
+		 @param[in]		big_endian
+						Flag indicating whether the given byte array should be 
+						interpreted as big endian or not (i.e. little endian).
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		void ReadFromFile(const MappedFile& file, bool big_endian);
 		
 		/**
 		 Reads the input string.
@@ -226,9 +243,9 @@ namespace mage {
 		const U8* m_end;
 
 		/**
-		 A pointer to the data to read of this binary reader.
+		 The mapped file to read of this binary reader.
 		 */
-		UniquePtr< U8[] > m_data;
+		MappedFile m_file;
 	};
 
 	#pragma endregion
@@ -287,6 +304,19 @@ namespace mage {
 		 */
 		void ReadFromFile(std::filesystem::path path);
 
+		/**
+		 Reads from the given mapped file.
+
+		 The given mapped file is not copied and must outlive all data
+		 referenced by this big endian binary reader.
+
+		 @param[in]		file
+						A reference to the mapped file.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		void ReadFromFile(const MappedFile& file);
+
 		/**
 		 Reads the input string.
 
@@ -418,9 +448,9 @@ namespace mage {
 		const U8* m_end;
 
 		/**
-		 A pointer to the data to read of this big endian binary reader.
+		 The mapped file to read of this big endian binary reader.
 		 */
-		UniquePtr< U8[] > m_data;
+		MappedFile m_file;
 	};
 
 	#pragma endregion
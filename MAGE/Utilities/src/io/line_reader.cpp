@@ -4,6 +4,7 @@
 #pragma region
 
 #include "io\line_reader.hpp"
+#include "io\mapped_file.hpp"
 #include "logging\error.hpp"
 
 #pragma endregion
@@ -13,6 +14,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -23,6 +25,23 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace {
+
+		/**
+		 Checks whether the given character is a whitespace character (i.e. 
+		 matches @c \\s of the default regex within a line).
+
+		 @param[in]		c
+						The character.
+		 @return		@c true if the given character is a whitespace 
+						character. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool IsWhitespace(char c) noexcept {
+			return ' ' == c || '\t' == c || '\r' == c || '\v' == c || '\f' == c;
+		}
+	}
+
 	const std::regex LineReader::s_default_regex
 		= std::regex(R"((\"([^\"]*)\")|(\S+))");
 
@@ -32,35 +51,71 @@ namespace mage {
 	};
 
 	LineReader::LineReader()
-		: m_regex(), 
+		: m_use_regex(false),
+		m_regex(), 
 		m_selection_function(), 
 		m_path(), 
 		m_iterator(), 
+		m_line_first(nullptr),
+		m_line_last(nullptr),
+		m_token(),
+		m_has_token(false),
 		m_line_number(0) {}
 
 	LineReader::LineReader(LineReader&& reader) noexcept 
-		: m_regex(std::move(reader.m_regex)), 
+		: m_use_regex(reader.m_use_regex),
+		m_regex(std::move(reader.m_regex)), 
 		m_selection_function(std::move(reader.m_selection_function)),
 		m_path(std::move(reader.m_path)), 
 		m_iterator(reader.m_iterator),
+		m_line_first(reader.m_line_first),
+		m_line_last(reader.m_line_last),
+		m_token(reader.m_token),
+		m_has_token(reader.m_has_token),
 		m_line_number(reader.m_line_number) {}
 
 	LineReader::~LineReader() = default;
 
 	LineReader& LineReader::operator=(LineReader&& reader) noexcept {
+		m_use_regex          = reader.m_use_regex;
 		m_regex              = std::move(reader.m_regex);
 		m_selection_function = std::move(reader.m_selection_function);
 		m_path               = std::move(reader.m_path);
 		m_iterator           = reader.m_iterator;
+		m_line_first         = reader.m_line_first;
+		m_line_last          = reader.m_line_last;
+		m_token              = reader.m_token;
+		m_has_token          = reader.m_has_token;
 		m_line_number        = reader.m_line_number;
 		return *this;
 	}
 
+	void LineReader::ReadFromFile(std::filesystem::path path) {
+		m_path               = std::move(path);
+		m_use_regex          = false;
+		m_regex              = {};
+		m_selection_function = {};
+
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		const MappedFile file(m_path);
+		const auto data = file.GetData();
+		Process(std::string_view(reinterpret_cast< const char* >(data.data()), 
+								 file.GetSize()), 
+				0u);
+
+		// Postprocessing
+		Postprocess();
+	}
+
 	void LineReader::ReadFromFile(std::filesystem::path path, 
 								  std::regex regex, 
 								  SelectionFunction selection_function) {
 
 		m_path               = std::move(path);
+		m_use_regex          = true;
 		m_regex              = std::move(regex);
 		m_selection_function = std::move(selection_function);
 
@@ -77,11 +132,31 @@ namespace mage {
 		Postprocess();
 	}
 
-	void LineReader::ReadFromMemory(const std::string &input,
+	void LineReader::ReadFromMemory(std::string_view input, 
+									std::filesystem::path path, 
+									U32 line_number) {
+
+		m_path               = std::move(path);
+		m_use_regex          = false;
+		m_regex              = {};
+		m_selection_function = {};
+
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		Process(input, line_number);
+
+		// Postprocessing
+		Postprocess();
+	}
+
+	void LineReader::ReadFromMemory(const std::string& input,
 									std::regex regex, 
 									SelectionFunction selection_function) {
 
 		m_path               = L"input string";
+		m_use_regex          = true;
 		m_regex              = std::move(regex);
 		m_selection_function = std::move(selection_function);
 		
@@ -104,6 +179,7 @@ namespace mage {
 		std::string line;
 		while (std::getline(stream, line)) {
 			m_iterator = std::sregex_iterator(line.cbegin(), line.cend(), m_regex);
+			ReadNextToken();
 			if (ContainsTokens()) {
 				ReadLine();
 			}
@@ -111,7 +187,36 @@ namespace mage {
 			++m_line_number;
 		}
 
-		m_iterator = {};
+		m_iterator  = {};
+		m_token     = {};
+		m_has_token = false;
+	}
+
+	void LineReader::Process(std::string_view input, U32 line_number) {
+		m_line_number = line_number;
+
+		auto first = input.data();
+		const auto last = input.data() + input.size();
+		// Mimic std::getline: a trailing newline does not start a new line.
+		while (last != first) {
+			const auto line_last = std::find(first, last, '\n');
+			
+			m_line_first = first;
+			m_line_last  = line_last;
+			ScanNextToken();
+			if (ContainsTokens()) {
+				ReadLine();
+			}
+
+			++m_line_number;
+
+			first = (last == line_last) ? last : line_last + 1;
+		}
+
+		m_line_first = nullptr;
+		m_line_last  = nullptr;
+		m_token      = {};
+		m_has_token  = false;
 	}
 
 	void LineReader::Postprocess() {}
@@ -124,21 +229,57 @@ namespace mage {
 		}
 	}
 
-	[[nodiscard]]
-	bool LineReader::ContainsTokens() const noexcept {
+	void LineReader::ReadNextToken() noexcept {
+		if (!m_use_regex) {
+			ScanNextToken();
+			return;
+		}
+
 		static const std::sregex_iterator end_iterator;
-		return end_iterator != m_iterator;
-	}
+		if (end_iterator == m_iterator) {
+			m_token     = {};
+			m_has_token = false;
+			return;
+		}
 
-	[[nodiscard]]
-	const std::string_view LineReader::GetCurrentToken() const noexcept {
 		const auto token = m_selection_function(*m_iterator);
 		if (token.matched) {
-			return { &*token.first, 
-				     static_cast< size_t >(token.second - token.first) };
+			m_token = { &*token.first, 
+				        static_cast< size_t >(token.second - token.first) };
 		}
 		else {
-			return {};
+			m_token = {};
 		}
+		
+		m_has_token = true;
+		++m_iterator;
+	}
+
+	void LineReader::ScanNextToken() noexcept {
+		// Skip the leading whitespace.
+		m_line_first = std::find_if_not(m_line_first, m_line_last, IsWhitespace);
+		if (m_line_last == m_line_first) {
+			m_token     = {};
+			m_has_token = false;
+			return;
+		}
+
+		m_has_token = true;
+
+		// The contents of a double-quoted string (if terminated on this line).
+		if ('"' == *m_line_first) {
+			const auto first = m_line_first + 1;
+			const auto last  = std::find(first, m_line_last, '"');
+			if (m_line_last != last) {
+				m_token      = { first, static_cast< size_t >(last - first) };
+				m_line_first = last + 1;
+				return;
+			}
+		}
+
+		// A whitespace separated character sequence.
+		const auto first = m_line_first;
+		m_line_first = std::find_if(m_line_first, m_line_last, IsWhitespace);
+		m_token      = { first, static_cast< size_t >(m_line_first - first) };
 	}
-}
+}
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include <filesystem>
 #include <istream>
 #include <regex>
+#include <string_view>
 
 #pragma endregion
 
@@ -28,6 +29,11 @@ namespace mage {
 
 	/**
 	 A class of line readers for reading (non-binary) text files line by line.
+
+	 Line readers support two tokenizers. By default, the lines are split by 
+	 hand on whitespace and double quotes directly in a memory-mapped file 
+	 (or the input string) without copying. Alternatively, the lines are 
+	 tokenized with a given (line) regex and selection function.
 	 */
 	class LineReader {
 
@@ -86,6 +92,20 @@ namespace mage {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Reads from the file associated with the given path.
+
+		 The tokens are the whitespace separated character sequences and the 
+		 contents of double-quoted strings (i.e. the tokens of the default 
+		 regex and selection function).
+
+		 @param[in]		path
+						The path.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		void ReadFromFile(std::filesystem::path path);
+
 		/**
 		 Reads from the file associated with the given path.
 
@@ -99,10 +119,32 @@ namespace mage {
 						Failed to read from the file.
 		 */
 		void ReadFromFile(std::filesystem::path path, 
-						  std::regex regex = s_default_regex, 
+						  std::regex regex, 
 						  SelectionFunction selection_function 
 						  = s_default_selection_function);
 		
+		/**
+		 Reads from the given input string.
+
+		 The tokens are the whitespace separated character sequences and the 
+		 contents of double-quoted strings (i.e. the tokens of the default 
+		 regex and selection function).
+
+		 @param[in]		input
+						The input string.
+		 @param[in]		path
+						The path to report (e.g., the path of the file 
+						containing the given input string).
+		 @param[in]		line_number
+						The line number of the first line of the given input 
+						string.
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void ReadFromMemory(std::string_view input, 
+							std::filesystem::path path = L"input string", 
+							U32 line_number = 0u);
+
 		/**
 		 Reads from the given input string.
 
@@ -115,8 +157,8 @@ namespace mage {
 		 @throws		Exception
 						Failed to read from the given input string.
 		 */
-		void ReadFromMemory(const std::string &input,
-							std::regex regex = s_default_regex,
+		void ReadFromMemory(const std::string& input,
+							std::regex regex,
 							SelectionFunction selection_function
 							= s_default_selection_function);
 
@@ -234,7 +276,9 @@ namespace mage {
 						@c false otherwise.
 		 */
 		[[nodiscard]]
-		bool ContainsTokens() const noexcept;
+		bool ContainsTokens() const noexcept {
+			return m_has_token;
+		}
 
 	private:
 
@@ -251,7 +295,8 @@ namespace mage {
 		virtual void Preprocess();
 
 		/**
-		 Processes the given input stream (line by line).
+		 Processes the given input stream (line by line) with the regex 
+		 tokenizer.
 
 		 @param[in]		stream
 						A reference to the input stream.
@@ -260,6 +305,19 @@ namespace mage {
 		 */
 		void Process(std::istream& stream);
 
+		/**
+		 Processes the given input (line by line) with the hand-written 
+		 tokenizer.
+
+		 @param[in]		input
+						The input.
+		 @param[in]		line_number
+						The line number of the first line of the given input.
+		 @throws		Exception
+						Failed to process the given input.
+		 */
+		void Process(std::string_view input, U32 line_number);
+
 		/**
 		 Reads the current line of this line reader.
 
@@ -282,12 +340,31 @@ namespace mage {
 		 @return		The current token of this line reader.
 		 */
 		[[nodiscard]]
-		const std::string_view GetCurrentToken() const noexcept;
+		const std::string_view GetCurrentToken() const noexcept {
+			return m_token;
+		}
+
+		/**
+		 Advances to the next token of the current line of this line reader.
+		 */
+		void ReadNextToken() noexcept;
+
+		/**
+		 Advances to the next token of the current line of this line reader 
+		 with the hand-written tokenizer.
+		 */
+		void ScanNextToken() noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
+		/**
+		 A flag indicating whether this line reader currently tokenizes with 
+		 its regex.
+		 */
+		bool m_use_regex;
+
 		/**
 		 The current (line) regex of this line reader.
 		 */
@@ -305,11 +382,33 @@ namespace mage {
 		std::filesystem::path m_path;
 
 		/**
-		 An iterator to the current token of the current line of this line 
-		 reader.
+		 An iterator to the next match of the current line of this line 
+		 reader (regex tokenizer).
 		 */
 		std::sregex_iterator m_iterator;
 
+		/**
+		 A pointer to the next character of the current line of this line 
+		 reader (hand-written tokenizer).
+		 */
+		const char* m_line_first;
+
+		/**
+		 A pointer to the past-the-end character of the current line of this 
+		 line reader (hand-written tokenizer).
+		 */
+		const char* m_line_last;
+
+		/**
+		 The current token of this line reader.
+		 */
+		std::string_view m_token;
+
+		/**
+		 A flag indicating whether this line reader has a current token.
+		 */
+		bool m_has_token;
+
 		/**
 		 The current line number of this line reader.
 		 */
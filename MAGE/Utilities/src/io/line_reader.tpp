@@ -28,13 +28,13 @@ namespace mage {
 		if (const auto result = StringTo< T >(first, last); 
 		    bool(result)) {
 
-			++m_iterator;
+			ReadNextToken();
 			return *result;
 		}
 		else {
 			throw Exception("%ls: line %u: invalid value found: %s.",
 							GetPath().c_str(), GetCurrentLineNumber(), 
-							m_iterator->str().c_str());
+							std::string(token).c_str());
 		}
 	}
 
@@ -47,7 +47,7 @@ namespace mage {
 
 		const auto result = GetCurrentToken();
 
-		++m_iterator;
+		ReadNextToken();
 		return result;
 	}
 
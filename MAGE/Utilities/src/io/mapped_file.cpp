@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\mapped_file.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <limits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		#ifdef _WIN32
+
+		/**
+		 Maps the file associated with the given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @param[out]	size
+						A reference to the size in bytes of the file.
+		 @return		A pointer to the mapped data of the file. @c nullptr
+						for empty files.
+		 @throws		Exception
+						Failed to map the file.
+		 */
+		[[nodiscard]]
+		const U8* MapFile(const std::filesystem::path& path, size_t& size) {
+			const auto file_handle
+				= CreateUniqueHandle(CreateFile2(path.c_str(),
+												 GENERIC_READ,
+												 FILE_SHARE_READ,
+												 OPEN_EXISTING,
+												 nullptr));
+			ThrowIfFailed((nullptr != file_handle),
+						  "%ls: could not open file.", path.c_str());
+
+			FILE_STANDARD_INFO file_info;
+			{
+				const BOOL result
+					= GetFileInformationByHandleEx(file_handle.get(),
+												   FileStandardInfo,
+												   &file_info,
+												   sizeof(file_info));
+				ThrowIfFailed(result,
+							  "%ls: could not retrieve file information.",
+							  path.c_str());
+			}
+
+			const auto nb_bytes = static_cast< U64 >(file_info.EndOfFile.QuadPart);
+			ThrowIfFailed((nb_bytes <= std::numeric_limits< size_t >::max()),
+						  "%ls: file too big for the address space.",
+						  path.c_str());
+
+			size = static_cast< size_t >(nb_bytes);
+			if (0u == size) {
+				// Empty files cannot be mapped.
+				return nullptr;
+			}
+
+			// The view keeps the file mapping object alive.
+			const auto mapping_handle
+				= CreateUniqueHandle(CreateFileMapping(file_handle.get(),
+													   nullptr,
+													   PAGE_READONLY,
+													   0u, 0u,
+													   nullptr));
+			ThrowIfFailed((nullptr != mapping_handle),
+						  "%ls: could not create file mapping.", path.c_str());
+
+			const auto data = MapViewOfFile(mapping_handle.get(),
+											FILE_MAP_READ,
+											0u, 0u, 0u);
+			ThrowIfFailed((nullptr != data),
+						  "%ls: could not map file.", path.c_str());
+
+			return static_cast< const U8* >(data);
+		}
+
+		#else  // _WIN32
+
+		/**
+		 Maps the file associated with the given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @param[out]	size
+						A reference to the size in bytes of the file.
+		 @return		A pointer to the mapped data of the file. @c nullptr
+						for empty files.
+		 @throws		Exception
+						Failed to map the file.
+		 */
+		[[nodiscard]]
+		const U8* MapFile(const std::filesystem::path& path, size_t& size) {
+			const int fd = open(path.c_str(), O_RDONLY);
+			ThrowIfFailed((-1 != fd),
+						  "%s: could not open file.", path.c_str());
+
+			struct stat file_info;
+			if (-1 == fstat(fd, &file_info)) {
+				close(fd);
+				throw Exception("%s: could not retrieve file information.",
+								path.c_str());
+			}
+
+			size = static_cast< size_t >(file_info.st_size);
+			if (0u == size) {
+				// Empty files cannot be mapped.
+				close(fd);
+				return nullptr;
+			}
+
+			// The mapping keeps the file alive.
+			void* const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+			close(fd);
+			ThrowIfFailed((MAP_FAILED != data),
+						  "%s: could not map file.", path.c_str());
+
+			return static_cast< const U8* >(data);
+		}
+
+		#endif // _WIN32
+	}
+
+	namespace details {
+
+		void FileViewUnmapper::operator()(const U8* data) const noexcept {
+			#ifdef _WIN32
+			UnmapViewOfFile(data);
+			#else  // _WIN32
+			munmap(const_cast< U8* >(data), m_size);
+			#endif // _WIN32
+		}
+	}
+
+	MappedFile::MappedFile() noexcept
+		: m_path(),
+		m_data(nullptr, details::FileViewUnmapper{ 0u }),
+		m_size(0u) {}
+
+	MappedFile::MappedFile(std::filesystem::path path)
+		: m_path(std::move(path)),
+		m_data(nullptr, details::FileViewUnmapper{ 0u }),
+		m_size(0u) {
+
+		const auto data = MapFile(m_path, m_size);
+		m_data = UniquePtr< const U8, details::FileViewUnmapper >(
+			data, details::FileViewUnmapper{ m_size });
+	}
+
+	MappedFile::MappedFile(MappedFile&& file) noexcept = default;
+
+	MappedFile::~MappedFile() = default;
+
+	MappedFile& MappedFile::operator=(MappedFile&& file) noexcept = default;
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		/**
+		 A struct of file view destructors (i.e. for unmapping file views).
+		 */
+		struct FileViewUnmapper {
+
+			/**
+			 Unmaps the given file view.
+
+			 @param[in]		data
+							A pointer to the first byte of the file view.
+			 */
+			void operator()(const U8* data) const noexcept;
+
+			/**
+			 The size in bytes of the file view.
+			 */
+			size_t m_size;
+		};
+	}
+
+	/**
+	 A class of read-only memory-mapped files.
+
+	 The complete file is mapped into the address space of the process. The
+	 pages are only read from disk when they are accessed for the first
+	 time. Files larger than 4GB are supported on 64-bit platforms.
+	 */
+	class MappedFile {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty mapped file.
+		 */
+		MappedFile() noexcept;
+
+		/**
+		 Constructs a mapped file for the file associated with the given
+		 path.
+
+		 @param[in]		path
+						The path.
+		 @throws		Exception
+						Failed to map the file.
+		 */
+		explicit MappedFile(std::filesystem::path path);
+
+		/**
+		 Constructs a mapped file from the given mapped file.
+
+		 @param[in]		file
+						A reference to the mapped file to copy.
+		 */
+		MappedFile(const MappedFile& file) = delete;
+
+		/**
+		 Constructs a mapped file by moving the given mapped file.
+
+		 @param[in]		file
+						A reference to the mapped file to move.
+		 */
+		MappedFile(MappedFile&& file) noexcept;
+
+		/**
+		 Destructs this mapped file.
+		 */
+		~MappedFile();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given mapped file to this mapped file.
+
+		 @param[in]		file
+						A reference to the mapped file to copy.
+		 @return		A reference to the copy of the given mapped file (i.e.
+						this mapped file).
+		 */
+		MappedFile& operator=(const MappedFile& file) = delete;
+
+		/**
+		 Moves the given mapped file to this mapped file.
+
+		 @param[in]		file
+						A reference to the mapped file to move.
+		 @return		A reference to the moved mapped file (i.e. this mapped
+						file).
+		 */
+		MappedFile& operator=(MappedFile&& file) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the path of this mapped file.
+
+		 @return		A reference to the path of this mapped file.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetPath() const noexcept {
+			return m_path;
+		}
+
+		/**
+		 Returns the data of this mapped file.
+
+		 @return		The data of this mapped file.
+		 */
+		[[nodiscard]]
+		gsl::span< const U8 > GetData() const noexcept {
+			const auto size = m_data ? m_size : 0u;
+			return gsl::make_span(m_data.get(),
+								  static_cast< std::ptrdiff_t >(size));
+		}
+
+		/**
+		 Returns the size of this mapped file.
+
+		 @return		The size in bytes of this mapped file.
+		 */
+		[[nodiscard]]
+		size_t GetSize() const noexcept {
+			return m_data ? m_size : 0u;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of this mapped file.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 A pointer to the mapped data of this mapped file.
+		 */
+		UniquePtr< const U8, details::FileViewUnmapper > m_data;
+
+		/**
+		 The size in bytes of this mapped file.
+		 */
+		size_t m_size;
+	};
+}
\ No newline at end of file
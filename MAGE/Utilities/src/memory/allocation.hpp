@@ -5,6 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "type\atomic_types.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
@@ -24,6 +25,12 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 The number of heap allocations made with 
+	 {@link mage::AllocAligned(size_t, size_t)}.
+	 */
+	inline AtomicU32 g_nb_aligned_allocations(0u);
+
 	/**
 	 Allocates memory on a given alignment boundary of the given size.
 	 
@@ -38,6 +45,7 @@ namespace mage {
 	 */
 	[[nodiscard]]
 	inline void* AllocAligned(size_t size, size_t alignment) noexcept {
+		g_nb_aligned_allocations.fetch_add(1u, std::memory_order_relaxed);
 		return _aligned_malloc(size, alignment);
 	}
 
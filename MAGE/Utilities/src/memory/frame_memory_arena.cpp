@@ -0,0 +1,27 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory\frame_memory_arena.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	FrameMemoryArena::FrameMemoryArena(size_t maximum_block_size,
+									   size_t alignment)
+		: m_arenas{ MemoryArena(maximum_block_size, alignment),
+		            MemoryArena(maximum_block_size, alignment) },
+		m_index(0u) {}
+
+	FrameMemoryArena::~FrameMemoryArena() = default;
+
+	void FrameMemoryArena::NextFrame() {
+		m_index = 1u - m_index;
+		m_arenas[m_index].Reset();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory\memory_arena.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of double-buffered frame memory arenas.
+
+	 A frame memory arena hands out transient memory for containers which
+	 only live during a single frame. All memory allocated during a frame
+	 remains valid until the end of the next frame, after which the
+	 corresponding memory arena is reset as a whole. The blocks of the memory
+	 arenas are reused, so no heap allocations are needed once both memory
+	 arenas have grown to the peak frame size.
+	 */
+	class FrameMemoryArena {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a frame memory arena.
+
+		 @param[in]		maximum_block_size
+						The maximum block size in bytes.
+		 @param[in]		alignment
+						The alignment in bytes.
+		 */
+		explicit FrameMemoryArena(size_t maximum_block_size,
+								  size_t alignment = 16u);
+
+		/**
+		 Constructs a frame memory arena from the given frame memory arena.
+
+		 @param[in]		arena
+						A reference to the frame memory arena to copy.
+		 */
+		FrameMemoryArena(const FrameMemoryArena& arena) = delete;
+
+		/**
+		 Constructs a frame memory arena by moving the given frame memory
+		 arena.
+
+		 @param[in]		arena
+						A reference to the frame memory arena to move.
+		 */
+		FrameMemoryArena(FrameMemoryArena&& arena) = delete;
+
+		/**
+		 Destructs this frame memory arena.
+		 */
+		~FrameMemoryArena();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given frame memory arena to this frame memory arena.
+
+		 @param[in]		arena
+						A reference to the frame memory arena to copy.
+		 @return		A reference to the copy of the given frame memory arena
+						(i.e. this frame memory arena).
+		 */
+		FrameMemoryArena& operator=(const FrameMemoryArena& arena) = delete;
+
+		/**
+		 Moves the given frame memory arena to this frame memory arena.
+
+		 @param[in]		arena
+						A reference to the frame memory arena to move.
+		 @return		A reference to the moved frame memory arena (i.e. this
+						frame memory arena).
+		 */
+		FrameMemoryArena& operator=(FrameMemoryArena&& arena) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts a new frame. The memory allocated during the frame before the
+		 previous frame is released.
+		 */
+		void NextFrame();
+
+		/**
+		 Returns the memory arena of the current frame of this frame memory
+		 arena.
+
+		 @return		A reference to the memory arena of the current frame
+						of this frame memory arena.
+		 */
+		[[nodiscard]]
+		MemoryArena& GetMemoryArena() noexcept {
+			return m_arenas[m_index];
+		}
+
+		/**
+		 Returns an allocator for the current frame of this frame memory
+		 arena.
+
+		 @tparam		T
+						The data type of the allocator.
+		 @return		An allocator for the current frame of this frame memory
+						arena.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		MemoryArena::Allocator< T > GetAllocator() noexcept {
+			return GetMemoryArena().GetAllocator< T >();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The memory arenas of this frame memory arena.
+		 */
+		MemoryArena m_arenas[2];
+
+		/**
+		 The index of the memory arena of the current frame of this frame
+		 memory arena.
+		 */
+		size_t m_index;
+	};
+}
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include <functional>
 #include <gsl\gsl>
 #include <memory>
+#include <vector>
 #include <wrl.h>
 
 #pragma endregion
@@ -352,17 +353,236 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	template< typename T, size_t A >
+	class AlignedAllocator;
+
+	namespace details {
+
+		/**
+		 Returns the address of the given (non-pointer) element.
+
+		 @tparam		ElementT
+						The element type.
+		 @param[in]		element
+						A reference to the element.
+		 @return		A pointer to the given element.
+		 */
+		template< typename ElementT >
+		[[nodiscard]]
+		constexpr ElementT* GetProxyElement(ElementT& element) noexcept {
+			return &element;
+		}
+
+		/**
+		 Returns the address of the element managed by the given unique
+		 pointer.
+
+		 @tparam		ElementT
+						The element type.
+		 @tparam		DeleterT
+						The deleter type.
+		 @param[in]		element
+						A reference to the unique pointer.
+		 @return		A pointer to the element managed by the given unique
+						pointer.
+		 */
+		template< typename ElementT, typename DeleterT >
+		[[nodiscard]]
+		inline ElementT* GetProxyElement(
+			UniquePtr< ElementT, DeleterT >& element) noexcept {
+
+			return element.get();
+		}
+
+		/**
+		 Returns the address of the element at the given index of the given
+		 container if that element still has the given generation.
+
+		 The generation of an element is its guid. A terminated slot that
+		 gets reused, is filled with a newly constructed element having a new
+		 guid. Proxy pointers to the old element become stale as a result.
+
+		 @tparam		ContainerT
+						The container type.
+		 @param[in]		elements
+						A reference to the container.
+		 @param[in]		index
+						The index into the container.
+		 @param[in]		generation
+						The generation.
+		 @return		@c nullptr if the given index is out of range or if
+						the element at the given index has a different
+						generation.
+		 @return		A pointer to the element at the given index of the
+						given container.
+		 */
+		template< typename ContainerT >
+		[[nodiscard]]
+		inline auto FindProxyElement(ContainerT& elements,
+									 U32 index,
+									 U64 generation) noexcept {
+
+			using std::size;
+			using ElementT = std::remove_pointer_t< decltype(
+				GetProxyElement(elements[index])) >;
+
+			if (size(elements) <= index) {
+				return static_cast< ElementT* >(nullptr);
+			}
+
+			const auto element = GetProxyElement(elements[index]);
+			return (element && generation == element->GetGuid()) ?
+				element : nullptr;
+		}
+
+		/**
+		 Returns the address of the element at the given index of the given
+		 type-erased container if that element still has the given
+		 generation.
+
+		 @tparam		ContainerT
+						The container type.
+		 @param[in]		container
+						A pointer to the container.
+		 @param[in]		index
+						The index into the container.
+		 @param[in]		generation
+						The generation.
+		 @return		@c nullptr if the given index is out of range or if
+						the element at the given index has a different
+						generation.
+		 @return		A pointer to the element at the given index of the
+						given container.
+		 */
+		template< typename ContainerT >
+		[[nodiscard]]
+		void* GetProxyAddress(void* container,
+							  U32 index,
+							  U64 generation) noexcept {
+
+			return static_cast< void* >(FindProxyElement(
+				*static_cast< ContainerT* >(container), index, generation));
+		}
+
+		/**
+		 A struct of proxy container types.
+		 */
+		struct ProxyContainerType final {
+
+			/**
+			 The function pointer for resolving a (container, index,
+			 generation) triple to the address of an element.
+			 */
+			void* (*m_getter)(void*, U32, U64) noexcept;
+		};
+
+		/**
+		 The proxy container type of containers of the given type. The
+		 address of this variable identifies the container type. The variable
+		 is not @c const, so that the linker never folds the variables of two
+		 different container types.
+
+		 @tparam		ContainerT
+						The container type.
+		 */
+		template< typename ContainerT >
+		inline ProxyContainerType g_proxy_container_type
+			= { &GetProxyAddress< ContainerT > };
+
+		/**
+		 The container type whose proxy pointers to elements of the given
+		 type are resolved inline.
+
+		 @tparam		T
+						The element type.
+		 */
+		template< typename T >
+		using ProxyInlineContainer = std::vector< std::remove_cv_t< T >,
+			AlignedAllocator< std::remove_cv_t< T >, alignof(T) > >;
+
+		/**
+		 Returns the byte offset obtained by statically casting a pointer of
+		 the given from-type to a pointer of the given to-type.
+
+		 The offset between a class and a non-virtual base class does not
+		 depend on the object. The object is therefore never accessed.
+
+		 @tparam		ToT
+						The conversion to-type.
+		 @tparam		FromT
+						The conversion from-type.
+		 @return		The byte offset obtained by statically casting a
+						pointer of type @a FromT to a pointer of type
+						@a ToT.
+		 */
+		template< typename ToT, typename FromT >
+		[[nodiscard]]
+		inline S32 GetProxyCastOffset() noexcept {
+			// Any non-null, suitably aligned address will do.
+			constexpr std::uintptr_t address = 64u;
+
+			const auto from = reinterpret_cast< FromT* >(address);
+			const auto to   = static_cast< ToT* >(from);
+			return static_cast< S32 >(
+				reinterpret_cast< std::uintptr_t >(to) - address);
+		}
+
+		/**
+		 Checks whether the object at the given address of the given
+		 from-type is an object of the given to-type.
+
+		 @tparam		ToT
+						The conversion to-type.
+		 @tparam		FromT
+						The conversion from-type.
+		 @param[in]		from
+						A pointer to the object of type @a FromT.
+		 @return		@c true if the object at the given address is an
+						object of type @a ToT. @c false otherwise.
+		 */
+		template< typename ToT, typename FromT >
+		[[nodiscard]]
+		bool IsProxyDynamicType(const volatile void* from) noexcept {
+			return nullptr != dynamic_cast< const volatile ToT* >(
+				static_cast< const volatile FromT* >(from));
+		}
+	}
+
 	/**
 	 A class of proxy pointers.
 
+	 A proxy pointer is a handle (i.e. container pointer, index and
+	 generation) to an element of a container whose elements can be
+	 relocated. The element type must provide a @c GetGuid() member method.
+
+	 Proxy pointers of type @c T into an @c AlignedVector< T > resolve inline.
+	 Proxy pointers into other containers (e.g., proxy pointers to a base
+	 class of the element type) resolve through a function pointer of their
+	 container type.
+
+	 A cast of a proxy pointer keeps the handle and only changes the pointer
+	 adjustment (and, for a dynamic cast, the type check) applied at
+	 dereference time. Memory resource types are related through single, 
+	 non-virtual inheritance.
+
 	 @tparam		T
-					The memory resource type.	
+					The memory resource type.
 	 */
 	template< typename T >
 	class ProxyPtr {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The function pointer type for checking the dynamic type of an
+		 object.
+		 */
+		using Checker = bool (*)(const volatile void*) noexcept;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -370,20 +590,25 @@ namespace mage {
 		/**
 		 Constructs a proxy pointer.
 		 */
-		ProxyPtr() noexcept
-			: ProxyPtr([]() noexcept -> T* {
-				return nullptr;
-			}) {}
+		constexpr ProxyPtr() noexcept
+			: m_container(nullptr),
+			m_container_type(nullptr),
+			m_checker(nullptr),
+			m_index(0u),
+			m_offset(0),
+			m_checker_offset(0),
+			m_generation(0ull) {}
 
 		/**
 		 Constructs a proxy pointer.
 		 */
-		ProxyPtr(std::nullptr_t) noexcept
+		constexpr ProxyPtr(std::nullptr_t) noexcept
 			: ProxyPtr() {}
 
 		/**
 		 Constructs a proxy pointer for the given container and index.
 
+		 @pre			@a index is a valid index into @a container.
 		 @tparam		ContainerT
 						The container type.
 		 @param[in]		container
@@ -393,18 +618,18 @@ namespace mage {
 		 */
 		template< typename ContainerT >
 		explicit ProxyPtr(ContainerT& container, size_t index) noexcept
-			: ProxyPtr([&container, index]() noexcept {
-				return &container[index];
-			}) {}
-			
-		/**
-		 Constructs a proxy pointer with the given getter function.
-
-		 @param[in]		getter
-						The getter function.
-		 */
-		explicit ProxyPtr(std::function< T*() > getter) noexcept
-			: m_getter(std::move(getter)) {}
+			: m_container(static_cast< void* >(&container)),
+			m_container_type(&details::g_proxy_container_type< ContainerT >),
+			m_checker(nullptr),
+			m_index(static_cast< U32 >(index)),
+			m_offset(0),
+			m_checker_offset(0),
+			m_generation(0ull) {
+
+			const auto element = details::GetProxyElement(container[index]);
+			m_offset     = GetOffset(element, static_cast< T* >(element));
+			m_generation = element->GetGuid();
+		}
 
 		/**
 		 Constructs a proxy pointer from the given proxy pointer.
@@ -412,17 +637,15 @@ namespace mage {
 		 @param[in]		ptr
 						A reference to the proxy pointer.
 		 */
-		ProxyPtr(const ProxyPtr& ptr) noexcept
-			: m_getter(ptr.m_getter) {}
-		
+		constexpr ProxyPtr(const ProxyPtr& ptr) noexcept = default;
+
 		/**
 		 Constructs a proxy pointer by moving the given proxy pointer.
 
 		 @param[in]		ptr
 						A reference to the proxy pointer to move.
 		 */
-		ProxyPtr(ProxyPtr&& ptr) noexcept
-			: m_getter(std::move(ptr.m_getter)) {}
+		constexpr ProxyPtr(ProxyPtr&& ptr) noexcept = default;
 
 		/**
 		 Constructs a proxy pointer from the given proxy pointer.
@@ -432,24 +655,11 @@ namespace mage {
 		 @param[in]		ptr
 						A reference to the proxy pointer.
 		 */
-		template< typename FromT, 
+		template< typename FromT,
 			      typename = std::enable_if_t< std::is_convertible_v< FromT*, T* > > >
 		ProxyPtr(const ProxyPtr< FromT >& ptr) noexcept
-			: ProxyPtr(ptr.m_getter) {}
+			: ProxyPtr(ptr, details::GetProxyCastOffset< T, FromT >()) {}
 
-		/**
-		 Constructs a proxy pointer by moving the given proxy pointer.
-
-		 @tparam		FromT
-						The memory resource type.
-		 @param[in]		ptr
-						A reference to the proxy pointer to move.
-		 */
-		template< typename FromT,
-			      typename = std::enable_if_t< std::is_convertible_v< FromT*, T* > > >
-		ProxyPtr(ProxyPtr< FromT >&& ptr) noexcept
-			: ProxyPtr(std::move(ptr.m_getter)) {}
-	
 		/**
 		 Destructs this proxy pointer.
 		 */
@@ -464,33 +674,27 @@ namespace mage {
 
 		 @param[in]		ptr
 						A reference to the proxy pointer to copy.
-		 @return		A reference to the copy of the given proxy pointer 
+		 @return		A reference to the copy of the given proxy pointer
 						(i.e. this proxy pointer).
 		 */
-		ProxyPtr& operator=(const ProxyPtr& ptr) noexcept {
-			m_getter = ptr.m_getter;
-			return *this;
-		}
-		
+		ProxyPtr& operator=(const ProxyPtr& ptr) noexcept = default;
+
 		/**
 		 Moves the given proxy pointer to this proxy pointer.
 
 		 @param[in]		ptr
 						A reference to the proxy pointer to move.
-		 @return		A reference to the moved proxy pointer (i.e. this proxy 
+		 @return		A reference to the moved proxy pointer (i.e. this proxy
 						pointer).
 		 */
-		ProxyPtr& operator=(ProxyPtr&& ptr) noexcept {
-			m_getter = std::move(ptr.m_getter);
-			return *this;
-		}
+		ProxyPtr& operator=(ProxyPtr&& ptr) noexcept = default;
 
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
 
 		/**
-		 Converts this proxy pointer to a @c bool.		
+		 Converts this proxy pointer to a @c bool.
 		 */
 		explicit operator bool() const noexcept {
 			return nullptr != Get();
@@ -499,7 +703,7 @@ namespace mage {
 		/**
 		 Returns the memory resource pointed to by this proxy pointer.
 
-		 @return		A reference to the memory resource pointed to by this 
+		 @return		A reference to the memory resource pointed to by this
 						proxy pointer.
 		 */
 		T& operator*() const noexcept {
@@ -509,7 +713,7 @@ namespace mage {
 		/**
 		 Returns the memory resource pointed to by this proxy pointer.
 
-		 @return		A pointer to the memory resource pointed to by this 
+		 @return		A pointer to the memory resource pointed to by this
 						proxy pointer.
 		 */
 		T* operator->() const noexcept {
@@ -519,12 +723,37 @@ namespace mage {
 		/**
 		 Returns the memory resource pointed to by this proxy pointer.
 
-		 @return		A pointer to the memory resource pointed to by this 
+		 @return		@c nullptr if this proxy pointer is empty or stale
+						(i.e. the referenced slot has been reused).
+		 @return		A pointer to the memory resource pointed to by this
 						proxy pointer.
 		 */
 		[[nodiscard]]
 		T* Get() const noexcept {
-			return m_getter();
+			using ContainerT = details::ProxyInlineContainer< T >;
+
+			// The elements of the container are of type T: neither an
+			// adjustment nor a type check is needed.
+			if (&details::g_proxy_container_type< ContainerT > 
+				== m_container_type) {
+
+				return details::FindProxyElement(
+					*static_cast< ContainerT* >(m_container), 
+					m_index, m_generation);
+			}
+
+			if (nullptr == m_container_type) {
+				return nullptr;
+			}
+
+			const auto address = static_cast< U8* >(
+				m_container_type->m_getter(m_container, m_index, m_generation));
+			if (nullptr == address
+				|| (m_checker && !m_checker(address + m_checker_offset))) {
+				return nullptr;
+			}
+
+			return reinterpret_cast< T* >(address + m_offset);
 		}
 
 		/**
@@ -534,24 +763,24 @@ namespace mage {
 						The memory resource type.
 		 @param[in]		rhs
 						A reference to the proxy pointer.
-		 @return		@c true if the given proxy pointer is equal to this 
+		 @return		@c true if the given proxy pointer is equal to this
 						proxy pointer. @c false otherwise.
 		 */
 		template< typename U >
 		[[nodiscard]]
 		bool operator==(const ProxyPtr< U >& rhs) const noexcept {
-			return Get() == rhs.Get(); 
+			return Get() == rhs.Get();
 		}
-		
+
 		/**
-		 Checks whether the given proxy pointer is not equal to this proxy 
+		 Checks whether the given proxy pointer is not equal to this proxy
 		 pointer.
 
 		 @tparam		U
 						The memory resource type.
 		 @param[in]		rhs
 						A reference to the proxy pointer.
-		 @return		@c true if the given proxy pointer is not equal to this 
+		 @return		@c true if the given proxy pointer is not equal to this
 						proxy pointer. @c false otherwise.
 		 */
 		template< typename U >
@@ -560,14 +789,122 @@ namespace mage {
 			return !(*this == rhs);
 		}
 
+	private:
+
+		//---------------------------------------------------------------------
+		// Friends
+		//---------------------------------------------------------------------
+
+		template< typename U >
+		friend class ProxyPtr;
+
+		template< typename ToT, typename FromT >
+		friend ProxyPtr< ToT > static_pointer_cast(
+			const ProxyPtr< FromT >& ptr) noexcept;
+
+		template< typename ToT, typename FromT >
+		friend ProxyPtr< ToT > dynamic_pointer_cast(
+			const ProxyPtr< FromT >& ptr) noexcept;
+
+		template< typename ToT, typename FromT >
+		friend ProxyPtr< ToT > const_pointer_cast(
+			const ProxyPtr< FromT >& ptr) noexcept;
+
+		template< typename ToT, typename FromT >
+		friend ProxyPtr< ToT > reinterpret_pointer_cast(
+			const ProxyPtr< FromT >& ptr) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a proxy pointer which shares the handle and type check of
+		 the given proxy pointer, but whose memory resource is obtained by
+		 adjusting the memory resource of the given proxy pointer with the
+		 given byte offset.
+
+		 @tparam		FromT
+						The memory resource type.
+		 @param[in]		ptr
+						A reference to the proxy pointer.
+		 @param[in]		offset
+						The byte offset between the memory resource of the
+						given proxy pointer and the memory resource of this
+						proxy pointer.
+		 */
+		template< typename FromT >
+		explicit ProxyPtr(const ProxyPtr< FromT >& ptr, S32 offset) noexcept
+			: m_container(ptr.m_container),
+			m_container_type(ptr.m_container_type),
+			m_checker(ptr.m_checker),
+			m_index(ptr.m_index),
+			m_offset(ptr.m_offset + offset),
+			m_checker_offset(ptr.m_checker_offset),
+			m_generation(ptr.m_generation) {}
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the byte offset between the given addresses.
+
+		 @param[in]		from
+						The from-address.
+		 @param[in]		to
+						The to-address.
+		 @return		The byte offset between the given addresses.
+		 */
+		[[nodiscard]]
+		static S32 GetOffset(const volatile void* from,
+							 const volatile void* to) noexcept {
+
+			return static_cast< S32 >(
+				reinterpret_cast< const volatile U8* >(to)
+				- reinterpret_cast< const volatile U8* >(from));
+		}
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		/**
-		 The getter of this proxy pointer. 
+		 A pointer to the container of this proxy pointer.
+		 */
+		void* m_container;
+
+		/**
+		 A pointer to the container type of this proxy pointer.
+		 */
+		const details::ProxyContainerType* m_container_type;
+
+		/**
+		 The dynamic type check of this proxy pointer.
+		 */
+		Checker m_checker;
+
+		/**
+		 The index into the container of this proxy pointer.
 		 */
-		std::function< T*() > m_getter;
+		U32 m_index;
+
+		/**
+		 The byte offset between the element and the memory resource of this
+		 proxy pointer.
+		 */
+		S32 m_offset;
+
+		/**
+		 The byte offset between the element and the object passed to the
+		 dynamic type check of this proxy pointer.
+		 */
+		S32 m_checker_offset;
+
+		/**
+		 The generation (i.e. the guid of the element) of this proxy pointer.
+		 */
+		U64 m_generation;
 	};
 
 	/**
@@ -635,8 +972,8 @@ namespace mage {
 	}
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by statically 
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose stored memory resource is obtained by
+	 statically casting the stored memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -644,14 +981,15 @@ namespace mage {
 					The conversion from-type.
 	 @param[in]		ptr
 					A reference to the proxy pointer to cast.
-	 @return		The moved proxy pointer.
+	 @return		The converted proxy pointer.
 	 */
 	template< typename ToT, typename FromT >
 	ProxyPtr< ToT > static_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by statically 
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose stored memory resource is obtained by
+	 dynamically casting the stored memory resource of the given proxy
+	 pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -659,44 +997,14 @@ namespace mage {
 					The conversion from-type.
 	 @param[in]		ptr
 					A reference to the proxy pointer to cast.
-	 @return		The moved proxy pointer.
-	 */
-	template< typename ToT, typename FromT >
-	ProxyPtr< ToT > static_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
-
-	/**
-	 Creates a proxy pointer whose stored getter is obtained by dynamically 
-	 casting the stored getter of the given proxy pointer.
-
-	 @tparam		ToT
-					The conversion to-type.
-	 @tparam		FromT
-					The conversion from-type.
-	 @param[in]		ptr
-					A reference to the proxy pointer to cast.
-	 @return		The moved proxy pointer.
+	 @return		The converted proxy pointer.
 	 */
 	template< typename ToT, typename FromT >
 	ProxyPtr< ToT > dynamic_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by dynamically 
-	 casting the stored getter of the given proxy pointer.
-
-	 @tparam		ToT
-					The conversion to-type.
-	 @tparam		FromT
-					The conversion from-type.
-	 @param[in]		ptr
-					A reference to the proxy pointer to cast.
-	 @return		The moved proxy pointer.
-	 */
-	template< typename ToT, typename FromT >
-	ProxyPtr< ToT > dynamic_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
-
-	/**
-	 Creates a proxy pointer whose stored getter is obtained by const 
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose stored memory resource is obtained by
+	 const casting the stored memory resource of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -704,14 +1012,15 @@ namespace mage {
 					The conversion from-type.
 	 @param[in]		ptr
 					A reference to the proxy pointer to cast.
-	 @return		The moved proxy pointer.
+	 @return		The converted proxy pointer.
 	 */
 	template< typename ToT, typename FromT >
 	ProxyPtr< ToT > const_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by const 
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose stored memory resource is obtained by
+	 reinterpret casting the stored memory resource of the given proxy
+	 pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -719,41 +1028,11 @@ namespace mage {
 					The conversion from-type.
 	 @param[in]		ptr
 					A reference to the proxy pointer to cast.
-	 @return		The moved proxy pointer.
-	 */
-	template< typename ToT, typename FromT >
-	ProxyPtr< ToT > const_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
-
-	/**
-	 Creates a proxy pointer whose stored getter is obtained by reinterpret 
-	 casting the stored getter of the given proxy pointer.
-
-	 @tparam		ToT
-					The conversion to-type.
-	 @tparam		FromT
-					The conversion from-type.
-	 @param[in]		ptr
-					A reference to the proxy pointer to cast.
-	 @return		The moved proxy pointer.
+	 @return		The converted proxy pointer.
 	 */
 	template< typename ToT, typename FromT >
 	ProxyPtr< ToT > reinterpret_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
-	/**
-	 Creates a proxy pointer whose stored getter is obtained by reinterpret 
-	 casting the stored getter of the given proxy pointer.
-
-	 @tparam		ToT
-					The conversion to-type.
-	 @tparam		FromT
-					The conversion from-type.
-	 @param[in]		ptr
-					A reference to the proxy pointer to cast.
-	 @return		The moved proxy pointer.
-	 */
-	template< typename ToT, typename FromT >
-	ProxyPtr< ToT > reinterpret_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
-
 	#pragma endregion
 }
 
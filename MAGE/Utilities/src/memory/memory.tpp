@@ -69,58 +69,35 @@ namespace mage {
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > static_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(ptr.m_getter)]() noexcept {
-			return static_cast< ToT* >(getter());
-		});
-	}
-
-	template< typename ToT, typename FromT >
-	inline ProxyPtr< ToT > static_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(std::move(ptr.m_getter))]() noexcept {
-			return static_cast< ToT* >(getter());
-		});
+		return ProxyPtr< ToT >(ptr, details::GetProxyCastOffset< ToT, FromT >());
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > dynamic_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(ptr.m_getter)]() noexcept {
-			return dynamic_cast< ToT* >(getter());
-		});
-	}
+		ProxyPtr< ToT > result(ptr, details::GetProxyCastOffset< ToT, FromT >());
+		
+		// An upcast always succeeds for an object of the from-type. Any other 
+		// cast is checked against the object of the from-type at dereference 
+		// time.
+		if constexpr (!std::is_base_of_v< std::remove_cv_t< ToT >, 
+			                              std::remove_cv_t< FromT > >) {
+			result.m_checker        = &details::IsProxyDynamicType< ToT, FromT >;
+			result.m_checker_offset = ptr.m_offset;
+		}
 
-	template< typename ToT, typename FromT >
-	inline ProxyPtr< ToT > dynamic_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(std::move(ptr.m_getter))]() noexcept {
-			return dynamic_cast< ToT* >(getter());
-		});
+		return result;
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > const_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(ptr.m_getter)]() noexcept {
-			return const_cast< ToT* >(getter());
-		});
-	}
-
-	template< typename ToT, typename FromT >
-	inline ProxyPtr< ToT > const_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(std::move(ptr.m_getter))]() noexcept {
-			return const_cast< ToT* >(getter());
-		});
+		// Casting away constness never adjusts the address.
+		return ProxyPtr< ToT >(ptr, 0);
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > reinterpret_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(ptr.m_getter)]() noexcept {
-			return reinterpret_cast< ToT* >(getter());
-		});
-	}
-
-	template< typename ToT, typename FromT >
-	inline ProxyPtr< ToT > reinterpret_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(std::move(ptr.m_getter))]() noexcept {
-			return reinterpret_cast< ToT* >(getter());
-		});
+		// Reinterpreting never adjusts the address.
+		return ProxyPtr< ToT >(ptr, 0);
 	}
 
 	#pragma endregion
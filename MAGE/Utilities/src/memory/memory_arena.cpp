@@ -8,11 +8,56 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace {
+
+		/**
+		 Returns the floor of the binary logarithm of the given size.
+
+		 @pre			@a size is not equal to zero.
+		 @param[in]		size
+						The size.
+		 @return		The floor of the binary logarithm of the given size.
+		 */
+		[[nodiscard]]
+		inline size_t FloorLog2(size_t size) noexcept {
+			size_t log2 = 0u;
+			for (size_t shift = sizeof(size_t) * 4u; 0u != shift; shift >>= 1u) {
+				if (size >> shift) {
+					size >>= shift;
+					log2 += shift;
+				}
+			}
+
+			return log2;
+		}
+
+		/**
+		 Returns the ceiling of the binary logarithm of the given size.
+
+		 @param[in]		size
+						The size.
+		 @return		The ceiling of the binary logarithm of the given size.
+		 */
+		[[nodiscard]]
+		inline size_t CeilLog2(size_t size) noexcept {
+			return (size <= 1u) ? 0u : FloorLog2(size - 1u) + 1u;
+		}
+	}
+
 	MemoryArena::MemoryArena(size_t maximum_block_size, size_t alignment)
 		: m_alignment(alignment), 
 		m_maximum_block_size(maximum_block_size),
@@ -30,8 +75,10 @@ namespace mage {
 			FreeAligned(block.second);
 		}
 
-		for (const auto& block : m_available_blocks) {
-			FreeAligned(block.second);
+		for (const auto& blocks : m_available_blocks) {
+			for (const auto& block : blocks) {
+				FreeAligned(block.second);
+			}
 		}
 	}
 
@@ -43,49 +90,56 @@ namespace mage {
 			size += block.first;
 		}
 
-		for (const auto& block : m_available_blocks) {
-			size += block.first;
+		for (const auto& blocks : m_available_blocks) {
+			for (const auto& block : blocks) {
+				size += block.first;
+			}
 		}
 
 		return size;
 	}
 
 	void MemoryArena::Reset() {
-		using std::begin;
-
+		// The current block remains the current block.
 		m_current_block_pos = 0;
-		m_current_block     = MemoryBlock(0, nullptr);
-		m_available_blocks.splice(begin(m_available_blocks), m_used_blocks);
+
+		// Return the used blocks to the free list of their size class.
+		for (const auto& block : m_used_blocks) {
+			m_available_blocks[FloorLog2(block.first)].push_back(block);
+		}
+
+		m_used_blocks.clear();
 	}
 
 	void* MemoryArena::Alloc(size_t size) {
-		using std::begin;
-		using std::end;
-		
-		// Round up the given size to minimum machine alignment.
-		size = ((size + 15) & (~15));
+		// Round up the given size to the alignment.
+		size = (size + m_alignment - 1) & ~(m_alignment - 1);
 
 		if (m_current_block_pos + size > GetCurrentBlockSize()) {
 			
 			// Store current block (if existing) as used block.
 			if (GetCurrentBlockPtr()) {
 				m_used_blocks.push_back(m_current_block);
+				m_current_block = MemoryBlock(0, nullptr);
 			}
 
-			// Fetch new block from available blocks.
-			for (auto it = begin(m_available_blocks); 
-				 it != end(m_available_blocks); ++it) {
+			// Fetch new block from available blocks. All blocks of a size 
+			// class of at least the ceiling of the binary logarithm of the 
+			// given size are large enough.
+			for (auto i = CeilLog2(size); i < s_nb_size_classes; ++i) {
+				auto& blocks = m_available_blocks[i];
 				
-				if (it->first >= size) {
-					m_current_block = *it;
-					m_available_blocks.erase(it);
+				if (!blocks.empty()) {
+					m_current_block = blocks.back();
+					blocks.pop_back();
 					break;
 				}
 			}
 
 			if (!GetCurrentBlockPtr()) {
 				// Allocate new block.
-				const auto alloc_size = std::max(size, GetMaximumBlockSize());
+				const auto alloc_size = size_t(1) << CeilLog2(
+					std::max(size, GetMaximumBlockSize()));
 				const auto alloc_ptr = AllocAlignedData< U8 >(alloc_size, m_alignment);
 
 				if (!alloc_ptr) {
@@ -14,7 +14,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <list>
+#include <vector>
 
 #pragma endregion
 
@@ -25,6 +25,10 @@ namespace mage {
 
 	/**
 	 A class of memory arenas.
+
+	 The blocks of a memory arena have a power-of-two size. Blocks which are 
+	 no longer used are kept in a free list per size class, so that a block 
+	 large enough for a given allocation is found in constant time.
 	 */
 	class MemoryArena {
 
@@ -39,6 +43,7 @@ namespace mage {
 
 		 @param[in]		maximum_block_size
 						The maximum block size in bytes.
+		 @pre			@a alignment is a power of two.
 		 @param[in]		alignment
 						The alignment in bytes.
 		 */
@@ -146,11 +151,14 @@ namespace mage {
 
 		/**
 		 Resets this memory arena.
+
+		 All blocks of this memory arena are kept for subsequent allocations.
 		 */
 		void Reset();
 
 		/**
 		 Allocates a block of memory of the given size on this memory arena.
+		 The block of memory is aligned on the alignment of this memory arena.
 
 		 @param[in]		size
 						The requested size in bytes to allocate in memory.
@@ -381,6 +389,9 @@ namespace mage {
 
 			friend class MemoryArena;
 
+			template< typename U >
+			friend class Allocator;
+
 			//-----------------------------------------------------------------
 			// Constructors
 			//-----------------------------------------------------------------
@@ -413,7 +424,7 @@ namespace mage {
 		 */
 		template< typename T >
 		[[nodiscard]]
-		Allocator< T > GetAllocator() const noexcept{
+		Allocator< T > GetAllocator() noexcept {
 			return Allocator< T >(this);
 		}
 
@@ -428,6 +439,16 @@ namespace mage {
 		 */
 		using MemoryBlock = std::pair< size_t, U8* >;
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of size classes of memory arenas. The blocks of size 
+		 class @c i have a size of 2^i bytes.
+		 */
+		static constexpr size_t s_nb_size_classes = sizeof(size_t) * 8u;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -455,12 +476,13 @@ namespace mage {
 		/**
 		 A collection containing the used blocks of this memory arena.
 		 */
-		std::list< MemoryBlock > m_used_blocks;
+		std::vector< MemoryBlock > m_used_blocks;
 
 		/**
-		 A collection containing the available blocks of this memory arena.
+		 The collections containing the available blocks of this memory arena 
+		 indexed by size class.
 		 */
-		std::list< MemoryBlock > m_available_blocks;
+		std::vector< MemoryBlock > m_available_blocks[s_nb_size_classes];
 	};
 }
 
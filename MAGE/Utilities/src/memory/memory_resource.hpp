@@ -0,0 +1,219 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory\memory_arena.hpp"
+#include "memory\memory_stack.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <memory_resource>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of memory resources adapting memory arenas and memory stacks to 
+	 @c std::pmr::memory_resource.
+
+	 Memory allocated through a memory resource is released as a whole by 
+	 resetting (or rolling back) the adapted memory arena or memory stack. 
+	 Deallocations through a memory resource have no effect.
+
+	 @tparam		MemoryT
+					The memory type (i.e. @c MemoryArena, 
+					@c SingleEndedMemoryStack or @c DoubleEndedMemoryStack).
+	 */
+	template< typename MemoryT >
+	class MemoryResource final : public std::pmr::memory_resource {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a memory resource for the given memory.
+
+		 @param[in]		memory
+						A reference to the memory arena or memory stack.
+		 */
+		explicit MemoryResource(MemoryT& memory) noexcept
+			: std::pmr::memory_resource(), 
+			m_memory(memory) {}
+
+		/**
+		 Constructs a memory resource from the given memory resource.
+
+		 @param[in]		resource
+						A reference to the memory resource to copy.
+		 */
+		MemoryResource(const MemoryResource& resource) noexcept = default;
+
+		/**
+		 Constructs a memory resource by moving the given memory resource.
+
+		 @param[in]		resource
+						A reference to the memory resource to move.
+		 */
+		MemoryResource(MemoryResource&& resource) noexcept = default;
+
+		/**
+		 Destructs this memory resource.
+		 */
+		virtual ~MemoryResource() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given memory resource to this memory resource.
+
+		 @param[in]		resource
+						A reference to the memory resource to copy.
+		 @return		A reference to the copy of the given memory resource 
+						(i.e. this memory resource).
+		 */
+		MemoryResource& operator=(const MemoryResource& resource) = delete;
+
+		/**
+		 Moves the given memory resource to this memory resource.
+
+		 @param[in]		resource
+						A reference to the memory resource to move.
+		 @return		A reference to the moved memory resource (i.e. this 
+						memory resource).
+		 */
+		MemoryResource& operator=(MemoryResource&& resource) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the memory of this memory resource.
+
+		 @return		A reference to the memory arena or memory stack of this 
+						memory resource.
+		 */
+		[[nodiscard]]
+		MemoryT& GetMemory() const noexcept {
+			return m_memory;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Allocates a block of memory of the given size and alignment on this 
+		 memory resource.
+
+		 @param[in]		size
+						The requested size in bytes to allocate in memory.
+		 @param[in]		alignment
+						The requested alignment in bytes.
+		 @return		A pointer to the memory block that was allocated.
+		 @throws		std::bad_alloc
+						Failed to allocate the memory block.
+		 */
+		virtual void* do_allocate(size_t size, size_t alignment) override;
+
+		/**
+		 Deallocates the given block of memory. Memory arenas and memory 
+		 stacks cannot release individual blocks of memory, so this method has 
+		 no effect.
+
+		 @param[in]		data
+						A pointer to the memory block to deallocate.
+		 @param[in]		size
+						The size in bytes of the memory block.
+		 @param[in]		alignment
+						The alignment in bytes of the memory block.
+		 */
+		virtual void do_deallocate([[maybe_unused]] void* data, 
+								   [[maybe_unused]] size_t size, 
+								   [[maybe_unused]] size_t alignment) override {}
+
+		/**
+		 Checks whether memory allocated from this memory resource can be 
+		 deallocated from the given memory resource and vice versa.
+
+		 @param[in]		resource
+						A reference to the memory resource to compare with.
+		 @return		@c true if and only if the given memory resource is 
+						this memory resource.
+		 */
+		[[nodiscard]]
+		virtual bool do_is_equal(
+			const std::pmr::memory_resource& resource) const noexcept override {
+
+			return this == &resource;
+		}
+
+		/**
+		 Allocates a block of memory of the given size on the memory of this 
+		 memory resource.
+
+		 @param[in]		size
+						The requested size in bytes to allocate in memory.
+		 @return		@c nullptr if the allocation failed.
+		 @return		A pointer to the memory block that was allocated.
+		 */
+		[[nodiscard]]
+		void* Alloc(size_t size);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the memory arena or memory stack of this memory 
+		 resource.
+		 */
+		std::reference_wrapper< MemoryT > m_memory;
+	};
+
+	/**
+	 A memory resource for memory arenas.
+	 */
+	using MemoryArenaResource = MemoryResource< MemoryArena >;
+
+	/**
+	 A memory resource for single-ended memory stacks.
+	 */
+	using SingleEndedMemoryStackResource 
+		= MemoryResource< SingleEndedMemoryStack >;
+
+	/**
+	 A memory resource for (the low side of) double-ended memory stacks.
+	 */
+	using DoubleEndedMemoryStackResource 
+		= MemoryResource< DoubleEndedMemoryStack >;
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory\memory_resource.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <memory>
+#include <new>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename MemoryT >
+	void* MemoryResource< MemoryT >::do_allocate(size_t size, size_t alignment) {
+		if constexpr (std::is_same_v< MemoryArena, MemoryT >) {
+			// Memory arenas align all their blocks of memory.
+			if (alignment <= m_memory.get().GetAlignment()) {
+				const auto ptr = Alloc(size);
+				if (!ptr) {
+					throw std::bad_alloc();
+				}
+
+				return ptr;
+			}
+		}
+
+		// Allocate a larger block of memory to align the block of memory.
+		auto space = size + alignment - 1;
+		auto ptr   = Alloc(space);
+		if (!ptr || !std::align(alignment, size, ptr, space)) {
+			throw std::bad_alloc();
+		}
+
+		return ptr;
+	}
+
+	template< typename MemoryT >
+	[[nodiscard]]
+	inline void* MemoryResource< MemoryT >::Alloc(size_t size) {
+		if constexpr (std::is_same_v< DoubleEndedMemoryStack, MemoryT >) {
+			return m_memory.get().AllocLow(size);
+		}
+		else {
+			return m_memory.get().Alloc(size);
+		}
+	}
+}
\ No newline at end of file
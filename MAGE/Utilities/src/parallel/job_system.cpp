@@ -0,0 +1,345 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.hpp"
+#include "parallel\parallel.hpp"
+#include "logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include <objbase.h>
+#endif // _WIN32
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		/**
+		 A struct of jobs.
+		 */
+		struct Job {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The task of this job.
+			 */
+			JobSystem::Task m_task;
+
+			/**
+			 A pointer to the job counter associated with this job.
+			 */
+			JobCounter* m_counter;
+		};
+	}
+
+	namespace {
+
+		/**
+		 A pointer to the job system of the calling thread (if the calling
+		 thread is a worker of some job system).
+		 */
+		thread_local const JobSystem* g_job_system = nullptr;
+
+		/**
+		 The index of the worker of the calling thread in the job system of
+		 the calling thread.
+		 */
+		thread_local size_t g_worker_index = 0u;
+
+		/**
+		 The number of unsuccessful attempts to find a job before a worker
+		 thread goes to sleep.
+		 */
+		constexpr U32 g_nb_spins = 64u;
+	}
+
+	//-------------------------------------------------------------------------
+	// JobCounter
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	JobCounter::JobCounter() noexcept
+		: m_count(0u),
+		m_mutex(),
+		m_continuations() {}
+
+	JobCounter::~JobCounter() = default;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// JobSystem
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of workers.
+	 */
+	struct JobSystem::Worker {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The jobs of this worker.
+		 */
+		WorkStealingDeque< Job* > m_jobs;
+	};
+
+	JobSystem::JobSystem(size_t nb_threads)
+		: m_workers(),
+		m_shared_jobs(),
+		m_mutex(),
+		m_condition(),
+		m_nb_scheduled_jobs(0u),
+		m_nb_sleeping_threads(0u),
+		m_terminate(false),
+		m_threads() {
+
+		if (0u == nb_threads) {
+			nb_threads = std::max(NumberOfSystemCores(), U16(1u)) - 1u;
+		}
+
+		m_workers.reserve(nb_threads + 1u);
+		for (size_t i = 0u; i <= nb_threads; ++i) {
+			m_workers.push_back(MakeUnique< Worker >());
+		}
+
+		// The calling thread is the first worker.
+		g_job_system   = this;
+		g_worker_index = 0u;
+
+		m_threads.reserve(nb_threads);
+		for (size_t i = 1u; i <= nb_threads; ++i) {
+			m_threads.emplace_back(&JobSystem::Run, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem() {
+		m_terminate.store(true, std::memory_order_release);
+		{
+			// Synchronize with the worker threads going to sleep.
+			const std::scoped_lock lock(m_mutex);
+		}
+		m_condition.notify_all();
+
+		for (auto& thread : m_threads) {
+			thread.join();
+		}
+
+		if (this == g_job_system) {
+			g_job_system = nullptr;
+		}
+
+		// Destruct the jobs which have never been waited for.
+		for (const auto& worker : m_workers) {
+			while (const auto job = worker->m_jobs.Pop()) {
+				const UniquePtr< Job > owned_job(job);
+			}
+		}
+		for (const auto job : m_shared_jobs) {
+			const UniquePtr< Job > owned_job(job);
+		}
+	}
+
+	void JobSystem::Submit(Task task, JobCounter& counter) {
+		{
+			const std::scoped_lock lock(counter.m_mutex);
+			counter.m_count.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		Schedule(MakeUnique< Job >(Job{ std::move(task), &counter }).release());
+	}
+
+	void JobSystem::Submit(Task task, JobCounter& counter,
+						   JobCounter& dependency) {
+		{
+			const std::scoped_lock lock(counter.m_mutex);
+			counter.m_count.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		auto job = MakeUnique< Job >(Job{ std::move(task), &counter });
+		{
+			const std::scoped_lock lock(dependency.m_mutex);
+			if (0u != dependency.m_count.load(std::memory_order_relaxed)) {
+				// Scheduled once the dependency is done.
+				dependency.m_continuations.push_back(job.release());
+				return;
+			}
+		}
+
+		Schedule(job.release());
+	}
+
+	void JobSystem::Wait(JobCounter& counter) noexcept {
+		while (!counter.IsDone()) {
+			if (const auto job = FindJob(); job) {
+				Execute(job);
+			}
+			else {
+				std::this_thread::yield();
+			}
+		}
+
+		// The thread finishing the last job may still hold the mutex of the
+		// job counter.
+		const std::scoped_lock lock(counter.m_mutex);
+	}
+
+	void JobSystem::Schedule(Job* job) {
+		m_nb_scheduled_jobs.fetch_add(1u);
+
+		if (this == g_job_system) {
+			if (!m_workers[g_worker_index]->m_jobs.Push(job)) {
+				// The deque is full: execute the job immediately.
+				m_nb_scheduled_jobs.fetch_sub(1u);
+				Execute(job);
+				return;
+			}
+		}
+		else {
+			const std::scoped_lock lock(m_mutex);
+			m_shared_jobs.push_back(job);
+		}
+
+		if (0u != m_nb_sleeping_threads.load()) {
+			{
+				// Synchronize with the worker threads going to sleep.
+				const std::scoped_lock lock(m_mutex);
+			}
+			m_condition.notify_one();
+		}
+	}
+
+	[[nodiscard]]
+	JobSystem::Job* JobSystem::FindJob() noexcept {
+		const auto is_worker = (this == g_job_system);
+		Job* job = nullptr;
+
+		// Pop a job from the own deque.
+		if (is_worker) {
+			job = m_workers[g_worker_index]->m_jobs.Pop();
+		}
+
+		// Take a shared job.
+		if (!job) {
+			std::unique_lock lock(m_mutex, std::try_to_lock);
+			if (lock.owns_lock() && !m_shared_jobs.empty()) {
+				job = m_shared_jobs.front();
+				m_shared_jobs.pop_front();
+			}
+		}
+
+		// Steal a job from another worker.
+		if (!job) {
+			const auto nb_workers = m_workers.size();
+			const auto first      = is_worker ? g_worker_index + 1u : 0u;
+			for (size_t i = 0u; i < nb_workers && !job; ++i) {
+				const auto victim = (first + i) % nb_workers;
+				if (is_worker && victim == g_worker_index) {
+					continue;
+				}
+
+				job = m_workers[victim]->m_jobs.Steal();
+			}
+		}
+
+		if (job) {
+			m_nb_scheduled_jobs.fetch_sub(1u);
+		}
+
+		return job;
+	}
+
+	void JobSystem::Execute(Job* job) noexcept {
+		const UniquePtr< Job > owned_job(job);
+
+		try {
+			owned_job->m_task();
+		}
+		catch (const std::exception& e) {
+			Error("Job failed: %s", e.what());
+		}
+		catch (...) {
+			Error("Job failed.");
+		}
+
+		auto& counter = *owned_job->m_counter;
+		std::vector< Job* > continuations;
+		{
+			const std::scoped_lock lock(counter.m_mutex);
+			if (1u == counter.m_count.fetch_sub(1u, std::memory_order_acq_rel)) {
+				continuations.swap(counter.m_continuations);
+			}
+		}
+
+		// The job counter may not be accessed anymore.
+		for (const auto continuation : continuations) {
+			Schedule(continuation);
+		}
+	}
+
+	void JobSystem::Run(size_t index) noexcept {
+		g_job_system   = this;
+		g_worker_index = index;
+
+		#ifdef _WIN32
+		// Jobs may use WIC or other COM components.
+		const HRESULT result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+		#endif // _WIN32
+
+		U32 nb_spins = 0u;
+		while (!m_terminate.load(std::memory_order_acquire)) {
+			if (const auto job = FindJob(); job) {
+				Execute(job);
+				nb_spins = 0u;
+				continue;
+			}
+
+			if (++nb_spins < g_nb_spins) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock lock(m_mutex);
+			m_nb_sleeping_threads.fetch_add(1u);
+			m_condition.wait(lock, [this]() noexcept {
+				return 0u != m_nb_scheduled_jobs.load()
+					|| m_terminate.load(std::memory_order_acquire);
+			});
+			m_nb_sleeping_threads.fetch_sub(1u);
+			nb_spins = 0u;
+		}
+
+		#ifdef _WIN32
+		if (SUCCEEDED(result)) {
+			CoUninitialize();
+		}
+		#endif // _WIN32
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,441 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\work_stealing_deque.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	// Forward declarations.
+	class JobSystem;
+
+	namespace details {
+		struct Job;
+	}
+
+	//-------------------------------------------------------------------------
+	// JobCounter
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of job counters counting the unfinished jobs associated with
+	 them.
+
+	 A job counter is done if all its associated jobs are finished. Jobs can
+	 depend on a job counter: such jobs are only scheduled once the job
+	 counter is done.
+	 */
+	class JobCounter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a job counter.
+		 */
+		JobCounter() noexcept;
+
+		/**
+		 Constructs a job counter from the given job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to copy.
+		 */
+		JobCounter(const JobCounter& counter) = delete;
+
+		/**
+		 Constructs a job counter by moving the given job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to move.
+		 */
+		JobCounter(JobCounter&& counter) = delete;
+
+		/**
+		 Destructs this job counter.
+
+		 @pre			This job counter is done and has been waited for with
+						@c JobSystem::Wait.
+		 */
+		~JobCounter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given job counter to this job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to copy.
+		 @return		A reference to the copy of the given job counter (i.e.
+						this job counter).
+		 */
+		JobCounter& operator=(const JobCounter& counter) = delete;
+
+		/**
+		 Moves the given job counter to this job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to move.
+		 @return		A reference to the moved job counter (i.e. this job
+						counter).
+		 */
+		JobCounter& operator=(JobCounter&& counter) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether all the jobs associated with this job counter are
+		 finished.
+
+		 @return		@c true if all the jobs associated with this job
+						counter are finished. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDone() const noexcept {
+			return 0u == m_count.load(std::memory_order_acquire);
+		}
+
+	private:
+
+		friend class JobSystem;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of unfinished jobs associated with this job counter.
+
+		 Only modified while holding the mutex of this job counter, but read
+		 without locking.
+		 */
+		AtomicU32 m_count;
+
+		/**
+		 The mutex of this job counter.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The jobs depending on this job counter.
+		 */
+		std::vector< details::Job* > m_continuations;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// JobSystem
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of job systems executing jobs on a set of worker threads with
+	 work stealing.
+
+	 Each worker thread owns a lock-free deque of jobs. A worker thread pushes
+	 and pops its own jobs in LIFO order and steals jobs in FIFO order from the
+	 other worker threads if its own deque is empty. The thread constructing
+	 the job system is a worker as well, but only executes jobs while waiting
+	 for a job counter. Jobs submitted by other threads are queued in a shared
+	 (locked) queue.
+	 */
+	class JobSystem {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The task type of job systems.
+		 */
+		using Task = std::function< void() >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a job system.
+
+		 @param[in]		nb_threads
+						The number of worker threads (excluding the calling
+						thread). If zero, the number of system cores minus one
+						is used.
+		 */
+		explicit JobSystem(size_t nb_threads = 0u);
+
+		/**
+		 Constructs a job system from the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system to copy.
+		 */
+		JobSystem(const JobSystem& job_system) = delete;
+
+		/**
+		 Constructs a job system by moving the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system to move.
+		 */
+		JobSystem(JobSystem&& job_system) = delete;
+
+		/**
+		 Destructs this job system.
+
+		 @pre			All submitted jobs have been waited for.
+		 */
+		~JobSystem();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given job system to this job system.
+
+		 @param[in]		job_system
+						A reference to the job system to copy.
+		 @return		A reference to the copy of the given job system (i.e.
+						this job system).
+		 */
+		JobSystem& operator=(const JobSystem& job_system) = delete;
+
+		/**
+		 Moves the given job system to this job system.
+
+		 @param[in]		job_system
+						A reference to the job system to move.
+		 @return		A reference to the moved job system (i.e. this job
+						system).
+		 */
+		JobSystem& operator=(JobSystem&& job_system) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of threads executing jobs of this job system
+		 (including the thread that constructed this job system).
+
+		 @return		The number of threads executing jobs of this job
+						system.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfThreads() const noexcept {
+			return m_workers.size();
+		}
+
+		/**
+		 Submits the given task to this job system.
+
+		 @pre			The given task does not throw exceptions. Exceptions
+						escaping from a task are reported and discarded.
+		 @param[in]		task
+						The task.
+		 @param[in]		counter
+						A reference to the job counter to associate with the
+						task.
+		 */
+		void Submit(Task task, JobCounter& counter);
+
+		/**
+		 Submits the given task to this job system. The task is only scheduled
+		 once the given dependency is done.
+
+		 @pre			The given task does not throw exceptions. Exceptions
+						escaping from a task are reported and discarded.
+		 @param[in]		task
+						The task.
+		 @param[in]		counter
+						A reference to the job counter to associate with the
+						task.
+		 @param[in]		dependency
+						A reference to the job counter the task depends on.
+		 */
+		void Submit(Task task, JobCounter& counter, JobCounter& dependency);
+
+		/**
+		 Waits until the given job counter is done. The calling thread
+		 executes jobs while waiting.
+
+		 @param[in]		counter
+						A reference to the job counter.
+		 */
+		void Wait(JobCounter& counter) noexcept;
+
+		/**
+		 Applies the given function to each index of the given index range in
+		 parallel and waits for completion.
+
+		 If a batch throws an exception, the remaining batches are still 
+		 executed and the first exception thrown is rethrown once all batches 
+		 are done.
+
+		 @tparam		FunctionT
+						The function type.
+		 @param[in]		first
+						The first index.
+		 @param[in]		last
+						The past-the-end index.
+		 @param[in]		function
+						The function which is called with the first and
+						past-the-end index of each batch (i.e. a subrange).
+		 @param[in]		batch_size
+						The number of indices per job. If zero, the range is
+						split into four batches per thread.
+		 */
+		template< typename FunctionT >
+		void ParallelFor(size_t first,
+						 size_t last,
+						 const FunctionT& function,
+						 size_t batch_size = 0u);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The job type of job systems.
+		 */
+		using Job = details::Job;
+
+		/**
+		 A struct of workers.
+		 */
+		struct Worker;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Schedules the given job.
+
+		 @param[in]		job
+						A pointer to the job.
+		 */
+		void Schedule(Job* job);
+
+		/**
+		 Finds a job to execute for the calling thread.
+
+		 @return		A pointer to the job. @c nullptr if no job is
+						available.
+		 */
+		[[nodiscard]]
+		Job* FindJob() noexcept;
+
+		/**
+		 Executes and destructs the given job.
+
+		 @param[in]		job
+						A pointer to the job.
+		 */
+		void Execute(Job* job) noexcept;
+
+		/**
+		 Executes jobs on the worker thread with the given index until this
+		 job system terminates.
+
+		 @param[in]		index
+						The index of the worker thread.
+		 */
+		void Run(size_t index) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The workers of this job system. The first worker belongs to the thread
+		 that constructed this job system.
+		 */
+		std::vector< UniquePtr< Worker > > m_workers;
+
+		/**
+		 The jobs submitted by threads which are not workers of this job
+		 system.
+		 */
+		std::deque< Job* > m_shared_jobs;
+
+		/**
+		 The mutex for accessing the shared jobs of this job system and for
+		 sleeping.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable for waking up sleeping worker threads of this
+		 job system.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 The number of scheduled, but not yet started jobs of this job system.
+		 */
+		AtomicU32 m_nb_scheduled_jobs;
+
+		/**
+		 The number of sleeping worker threads of this job system.
+		 */
+		AtomicU32 m_nb_sleeping_threads;
+
+		/**
+		 A flag indicating whether this job system terminates.
+		 */
+		AtomicBool m_terminate;
+
+		/**
+		 The worker threads of this job system.
+		 */
+		std::vector< std::thread > m_threads;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename FunctionT >
+	void JobSystem::ParallelFor(size_t first,
+								size_t last,
+								const FunctionT& function,
+								size_t batch_size) {
+
+		if (last <= first) {
+			return;
+		}
+
+		const auto nb_indices = last - first;
+		if (0u == batch_size) {
+			batch_size = std::max(nb_indices / (4u * GetNumberOfThreads()),
+								  size_t(1u));
+		}
+
+		// The first exception thrown by any batch is rethrown once all 
+		// batches are done.
+		std::exception_ptr exception;
+		std::mutex exception_mutex;
+		const auto execute_batch = [&function, &exception, &exception_mutex]
+			(size_t batch_first, size_t batch_last) noexcept {
+
+			try {
+				function(batch_first, batch_last);
+			}
+			catch (...) {
+				const std::scoped_lock lock(exception_mutex);
+				if (!exception) {
+					exception = std::current_exception();
+				}
+			}
+		};
+
+		// The calling thread executes the first batch itself.
+		const auto first_last = first + std::min(batch_size, nb_indices);
+
+		JobCounter counter;
+		try {
+			for (auto batch_first = first_last; batch_first < last;) {
+				const auto batch_last = batch_first
+					                  + std::min(batch_size, last - batch_first);
+
+				Submit([&execute_batch, batch_first, batch_last]() {
+					execute_batch(batch_first, batch_last);
+				}, counter);
+
+				batch_first = batch_last;
+			}
+		}
+		catch (...) {
+			// The submitted jobs reference the local variables.
+			Wait(counter);
+			throw;
+		}
+
+		execute_batch(first, first_last);
+
+		Wait(counter);
+
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+}
\ No newline at end of file
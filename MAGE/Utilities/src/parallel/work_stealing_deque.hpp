@@ -0,0 +1,167 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\atomic_types.hpp"
+#include "memory\memory.hpp"
+#include "logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of fixed-capacity, lock-free work-stealing deques (Chase-Lev).
+
+	 The owner thread pushes and pops items at the bottom of the deque. All
+	 other threads steal items from the top of the deque.
+
+	 @pre			@c T is a pointer type.
+	 @tparam		T
+					The item type.
+	 */
+	template< typename T >
+	class WorkStealingDeque {
+
+	public:
+
+		static_assert(std::is_pointer_v< T >);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a work-stealing deque.
+
+		 @pre			@a capacity is a power of two.
+		 @param[in]		capacity
+						The capacity.
+		 */
+		explicit WorkStealingDeque(size_t capacity = 4096u);
+
+		/**
+		 Constructs a work-stealing deque from the given work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to copy.
+		 */
+		WorkStealingDeque(const WorkStealingDeque& deque) = delete;
+
+		/**
+		 Constructs a work-stealing deque by moving the given work-stealing
+		 deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to move.
+		 */
+		WorkStealingDeque(WorkStealingDeque&& deque) = delete;
+
+		/**
+		 Destructs this work-stealing deque.
+		 */
+		~WorkStealingDeque();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given work-stealing deque to this work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to copy.
+		 @return		A reference to the copy of the given work-stealing
+						deque (i.e. this work-stealing deque).
+		 */
+		WorkStealingDeque& operator=(const WorkStealingDeque& deque) = delete;
+
+		/**
+		 Moves the given work-stealing deque to this work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to move.
+		 @return		A reference to the moved work-stealing deque (i.e.
+						this work-stealing deque).
+		 */
+		WorkStealingDeque& operator=(WorkStealingDeque&& deque) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Pushes the given item at the bottom of this work-stealing deque.
+
+		 @pre			The calling thread is the owner of this work-stealing
+						deque.
+		 @param[in]		item
+						The item.
+		 @return		@c true if the given item is pushed. @c false if this
+						work-stealing deque is full.
+		 */
+		[[nodiscard]]
+		bool Push(T item) noexcept;
+
+		/**
+		 Pops an item from the bottom of this work-stealing deque.
+
+		 @pre			The calling thread is the owner of this work-stealing
+						deque.
+		 @return		The popped item. @c nullptr if this work-stealing deque
+						is empty.
+		 */
+		[[nodiscard]]
+		T Pop() noexcept;
+
+		/**
+		 Steals an item from the top of this work-stealing deque.
+
+		 @return		The stolen item. @c nullptr if this work-stealing deque
+						is empty or if another thread took the item first.
+		 */
+		[[nodiscard]]
+		T Steal() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the top item of this work-stealing deque.
+		 */
+		alignas(64) AtomicS64 m_top;
+
+		/**
+		 The index of the past-the-bottom item of this work-stealing deque.
+		 */
+		alignas(64) AtomicS64 m_bottom;
+
+		/**
+		 The capacity mask of this work-stealing deque.
+		 */
+		alignas(64) S64 m_mask;
+
+		/**
+		 A pointer to the circular buffer of this work-stealing deque.
+		 */
+		UniquePtr< std::atomic< T >[] > m_buffer;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\work_stealing_deque.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename T >
+	WorkStealingDeque< T >::WorkStealingDeque(size_t capacity)
+		: m_top(0),
+		m_bottom(0),
+		m_mask(static_cast< S64 >(capacity) - 1),
+		m_buffer(MakeUnique< std::atomic< T >[] >(capacity)) {
+
+		Assert(0u != capacity && 0u == (capacity & (capacity - 1u)));
+	}
+
+	template< typename T >
+	WorkStealingDeque< T >::~WorkStealingDeque() = default;
+
+	template< typename T >
+	[[nodiscard]]
+	bool WorkStealingDeque< T >::Push(T item) noexcept {
+		const auto bottom = m_bottom.load(std::memory_order_relaxed);
+		const auto top    = m_top.load(std::memory_order_acquire);
+		if (bottom - top > m_mask) {
+			return false;
+		}
+
+		m_buffer[bottom & m_mask].store(item, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	T WorkStealingDeque< T >::Pop() noexcept {
+		const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		m_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		auto top = m_top.load(std::memory_order_relaxed);
+
+		if (top > bottom) {
+			// Empty deque.
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		auto item = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+		if (top == bottom) {
+			// Last item: race against the thieves.
+			if (!m_top.compare_exchange_strong(top, top + 1,
+											   std::memory_order_seq_cst,
+											   std::memory_order_relaxed)) {
+				item = nullptr;
+			}
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		return item;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	T WorkStealingDeque< T >::Steal() noexcept {
+		auto top = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const auto bottom = m_bottom.load(std::memory_order_acquire);
+
+		if (top >= bottom) {
+			// Empty deque.
+			return nullptr;
+		}
+
+		const auto item = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+		if (!m_top.compare_exchange_strong(top, top + 1,
+										   std::memory_order_seq_cst,
+										   std::memory_order_relaxed)) {
+			// Lost the race against the owner or another thief.
+			return nullptr;
+		}
+
+		return item;
+	}
+}
\ No newline at end of file
@@ -6,6 +6,8 @@
 #pragma region
 
 #include "type\types.hpp"
+#include "type\atomic_types.hpp"
+#include "parallel\job_system.hpp"
 
 #pragma endregion
 
@@ -14,8 +16,11 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <functional>
+#include <future>
 #include <map>
 #include <mutex>
+#include <tuple>
 
 #pragma endregion
 
@@ -166,6 +171,10 @@ namespace mage {
 		 given key, a new resource is created from the given arguments, added 
 		 to this resource pool and returned.
 
+		 The resource is created on the calling thread without locking this 
+		 resource pool. Concurrent requests for the same key share a single 
+		 creation.
+
 		 @tparam		ConstructorArgsT
 						The argument types for creating a new resource of type 
 						@c ResourceT.
@@ -189,6 +198,10 @@ namespace mage {
 		 given key, a new resource is created from the given arguments, added 
 		 to this resource pool and returned.
 
+		 The resource is created on the calling thread without locking this 
+		 resource pool. Concurrent requests for the same key share a single 
+		 creation.
+
 		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
 		 @tparam		DerivedResourceT
 						The derived resource type.
@@ -206,6 +219,87 @@ namespace mage {
 		template< typename DerivedResourceT, typename... ConstructorArgsT >
 		SharedPtr< ResourceT > GetOrCreateDerived(const KeyT& key, 
 			                                      ConstructorArgsT&&... args);
+
+		/**
+		 Returns a future of the resource corresponding to the given key from 
+		 this resource pool.
+
+		 If no resource is contained in this resource pool corresponding to the 
+		 given key and no such resource is being created, a new resource is 
+		 created from the given arguments on the given job system and added 
+		 to this resource pool. Concurrent requests for the same key share a 
+		 single creation.
+
+		 @pre			This resource pool outlives the creation (i.e. the 
+						given job counter is waited for before this resource 
+						pool is destructed).
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type 
+						@c ResourceT.
+		 @param[in]		job_system
+						A reference to the job system.
+		 @param[in]		counter
+						A reference to the job counter to associate with the 
+						creation.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type 
+						@c ResourceT. The arguments are copied (like 
+						@c std::thread): use @c std::ref to pass references.
+		 @return		A future of the pointer to the resource corresponding 
+						to the given key from this resource pool. The future 
+						holds the exception (if any) thrown while creating the 
+						resource.
+		 */
+		template< typename... ConstructorArgsT >
+		std::shared_future< SharedPtr< ResourceT > > 
+			GetOrCreateAsync(JobSystem& job_system, 
+				             JobCounter& counter, 
+				             const KeyT& key, 
+				             ConstructorArgsT&&... args);
+
+		/**
+		 Returns a future of the resource corresponding to the given key from 
+		 this resource pool.
+
+		 If no resource is contained in this resource pool corresponding to the 
+		 given key and no such resource is being created, a new resource is 
+		 created from the given arguments on the given job system and added 
+		 to this resource pool. Concurrent requests for the same key share a 
+		 single creation.
+
+		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
+		 @pre			This resource pool outlives the creation (i.e. the 
+						given job counter is waited for before this resource 
+						pool is destructed).
+		 @tparam		DerivedResourceT
+						The derived resource type.
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type 
+						@c DerivedResourceT.
+		 @param[in]		job_system
+						A reference to the job system.
+		 @param[in]		counter
+						A reference to the job counter to associate with the 
+						creation.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type 
+						@c DerivedResourceT. The arguments are copied (like 
+						@c std::thread): use @c std::ref to pass references.
+		 @return		A future of the pointer to the resource corresponding 
+						to the given key from this resource pool. The future 
+						holds the exception (if any) thrown while creating the 
+						resource.
+		 */
+		template< typename DerivedResourceT, typename... ConstructorArgsT >
+		std::shared_future< SharedPtr< ResourceT > > 
+			GetOrCreateDerivedAsync(JobSystem& job_system, 
+				                    JobCounter& counter, 
+				                    const KeyT& key, 
+				                    ConstructorArgsT&&... args);
 		
 		/**
 		 Removes the resource corresponding to the given key from this resource 
@@ -232,6 +326,60 @@ namespace mage {
 		 */
 		using ResourceMap = std::map< KeyT, WeakPtr< ResourceT > >;
 
+		/**
+		 A class of in-flight resource creations.
+		 */
+		class Load;
+
+		/**
+		 A load map used by a resource pool.
+		 */
+		using LoadMap = std::map< KeyT, SharedPtr< Load > >;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the resource corresponding to the given key from this 
+		 resource pool.
+
+		 @pre			The mutex of this resource pool is locked by the 
+						calling thread.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @return		@c nullptr, if no resource is contained in this 
+						resource pool corresponding to the given key.
+		 @return		A pointer to the resource corresponding to the given key 
+						from this resource pool.
+		 */
+		[[nodiscard]]
+		SharedPtr< ResourceT > FindResource(const KeyT& key) noexcept;
+
+		/**
+		 Executes the given load of this resource pool, if the given load has 
+		 not been started yet.
+
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		load
+						A reference to the load.
+		 */
+		void Run(const KeyT& key, Load& load) noexcept;
+
+		/**
+		 Executes the given (started) load of this resource pool.
+
+		 The created resource is added to this resource pool before the future 
+		 of the given load is made ready.
+
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		load
+						A reference to the load.
+		 */
+		void Execute(const KeyT& key, Load& load) noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -242,10 +390,154 @@ namespace mage {
 		ResourceMap m_resource_map;
 
 		/**
-		 The mutex for accessing the resource map of this resource pool.
+		 The load map containing the in-flight resource creations of this 
+		 resource pool.
+		 */
+		LoadMap m_load_map;
+
+		/**
+		 The mutex for accessing the resource and load map of this resource 
+		 pool.
 		 */
 		mutable std::mutex m_mutex;
 
+		/**
+		 A class of in-flight resource creations.
+
+		 A load is started at most once: either by the thread requesting the 
+		 resource synchronously, by a worker thread or by a thread waiting for 
+		 a not yet started load (which avoids starving the job system when 
+		 resource creations request other resources).
+		 */
+		class Load {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Class Member Types
+			//-----------------------------------------------------------------
+
+			/**
+			 The function type for creating the resource.
+			 */
+			using CreateFunction = std::function< SharedPtr< ResourceT >() >;
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a load.
+
+			 @param[in]		create
+							The function for creating the resource.
+			 */
+			explicit Load(CreateFunction create)
+				: m_create(std::move(create)),
+				m_promise(),
+				m_future(m_promise.get_future().share()),
+				m_started(false) {}
+
+			/**
+			 Constructs a load from the given load.
+
+			 @param[in]		load
+							A reference to the load to copy.
+			 */
+			Load(const Load& load) = delete;
+
+			/**
+			 Constructs a load by moving the given load.
+
+			 @param[in]		load
+							A reference to the load to move.
+			 */
+			Load(Load&& load) = delete;
+
+			/**
+			 Destructs this load.
+			 */
+			~Load() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			/**
+			 Copies the given load to this load.
+
+			 @param[in]		load
+							A reference to the load to copy.
+			 @return		A reference to the copy of the given load (i.e. 
+							this load).
+			 */
+			Load& operator=(const Load& load) = delete;
+
+			/**
+			 Moves the given load to this load.
+
+			 @param[in]		load
+							A reference to the load to move.
+			 @return		A reference to the moved load (i.e. this load).
+			 */
+			Load& operator=(Load&& load) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Marks this load as started.
+
+			 @return		@c true if this load was not started before. 
+							@c false otherwise.
+			 */
+			[[nodiscard]]
+			bool Start() noexcept {
+				return !m_started.exchange(true);
+			}
+
+			/**
+			 Returns the future of this load.
+
+			 @return		The future of this load.
+			 */
+			[[nodiscard]]
+			const std::shared_future< SharedPtr< ResourceT > >& 
+				GetFuture() const noexcept {
+
+				return m_future;
+			}
+
+		private:
+
+			friend class ResourcePool;
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The function for creating the resource of this load.
+			 */
+			CreateFunction m_create;
+
+			/**
+			 The promise of this load.
+			 */
+			std::promise< SharedPtr< ResourceT > > m_promise;
+
+			/**
+			 The future of this load.
+			 */
+			std::shared_future< SharedPtr< ResourceT > > m_future;
+
+			/**
+			 A flag indicating whether this load has been started.
+			 */
+			AtomicBool m_started;
+		};
+
 		/**
 		 A class of resources.
 
@@ -17,6 +17,7 @@ namespace mage {
 		const std::scoped_lock lock(pool.m_mutex);
 
 		m_resource_map = std::move(pool.m_resource_map);
+		m_load_map     = std::move(pool.m_load_map);
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -39,44 +40,22 @@ namespace mage {
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
-	bool ResourcePool< KeyT, ResourceT >::Contains(const KeyT& key) noexcept {
+	inline bool ResourcePool< KeyT, ResourceT >
+		::Contains(const KeyT& key) noexcept {
+		
 		const std::scoped_lock lock(m_mutex);
 
-		if (const auto it = m_resource_map.find(key); 
-			it != m_resource_map.end()) {
-
-			const auto resource = it->second.lock();
-			
-			if (resource) {
-				return true;
-			}
-			
-			m_resource_map.erase(it);
-		}
-
-		return false;
+		return nullptr != FindResource(key);
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
-	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
+	inline SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::Get(const KeyT& key) noexcept {
 		
 		const std::scoped_lock lock(m_mutex);
 
-		if (const auto it = m_resource_map.find(key); 
-			it != m_resource_map.end()) {
-
-			const auto resource = it->second.lock();
-			
-			if (resource) {
-				return resource;
-			}
-
-			m_resource_map.erase(it);
-		}
-
-		return SharedPtr< ResourceT >();
+		return FindResource(key);
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -93,26 +72,106 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 		
-		const std::scoped_lock lock(m_mutex);
-
-		if (const auto it = m_resource_map.find(key); 
-			it != m_resource_map.end()) {
+		SharedPtr< Load > load;
+		bool owner = false;
+		{
+			const std::scoped_lock lock(m_mutex);
 
-			const auto resource = it->second.lock();
-			if (resource) {
+			if (auto resource = FindResource(key); resource) {
 				return resource;
 			}
+
+			if (const auto it = m_load_map.find(key); 
+				it != m_load_map.end()) {
+
+				load = it->second;
+			}
+			else {
+				// The arguments are only used by this thread, before this 
+				// method returns.
+				load = MakeShared< Load >([this, &key, &args...]() {
+					return SharedPtr< ResourceT >(
+						MakeAllocatedShared< Resource< DerivedResourceT > >
+						(*this, key, std::forward< ConstructorArgsT >(args)...));
+				});
+				owner = load->Start();
+				
+				m_load_map.emplace(key, load);
+			}
+		}
+
+		// The resource is created without holding the lock.
+		if (owner) {
+			Execute(key, *load);
+		}
+		else {
+			// Help if the load is still waiting for a worker thread.
+			Run(key, *load);
+		}
+
+		return load->GetFuture().get();
+	}
+
+	template< typename KeyT, typename ResourceT >
+	template< typename... ConstructorArgsT >
+	inline std::shared_future< SharedPtr< ResourceT > > 
+		ResourcePool< KeyT, ResourceT >
+		::GetOrCreateAsync(JobSystem& job_system, 
+			               JobCounter& counter, 
+			               const KeyT& key, 
+			               ConstructorArgsT&&... args) {
+
+		return GetOrCreateDerivedAsync< ResourceT, ConstructorArgsT... >(
+			job_system, counter, key, 
+			std::forward< ConstructorArgsT >(args)...);
+	}
+
+	template< typename KeyT, typename ResourceT >
+	template< typename DerivedResourceT, typename... ConstructorArgsT >
+	std::shared_future< SharedPtr< ResourceT > > 
+		ResourcePool< KeyT, ResourceT >
+		::GetOrCreateDerivedAsync(JobSystem& job_system, 
+			                      JobCounter& counter, 
+			                      const KeyT& key, 
+			                      ConstructorArgsT&&... args) {
+
+		SharedPtr< Load > load;
+		{
+			const std::scoped_lock lock(m_mutex);
+
+			if (auto resource = FindResource(key); resource) {
+				std::promise< SharedPtr< ResourceT > > promise;
+				promise.set_value(std::move(resource));
+				return promise.get_future().share();
+			}
+
+			if (const auto it = m_load_map.find(key); 
+				it != m_load_map.end()) {
+
+				return it->second->GetFuture();
+			}
+
+			// std::make_tuple unwraps std::reference_wrapper arguments.
+			load = MakeShared< Load >([this, key, 
+				arguments = std::make_tuple(
+					std::forward< ConstructorArgsT >(args)...)]() mutable {
+
+				return std::apply([this, &key](auto&&... arguments) {
+					return SharedPtr< ResourceT >(
+						MakeAllocatedShared< Resource< DerivedResourceT > >
+						(*this, key, 
+						 std::forward< decltype(arguments) >(arguments)...));
+				}, std::move(arguments));
+			});
 			
-			m_resource_map.erase(it);
+			m_load_map.emplace(key, load);
 		}
 
-		const auto new_resource 
-			= MakeAllocatedShared< Resource< DerivedResourceT > >
-			  (*this, key, std::forward< ConstructorArgsT >(args)...);
-		
-		m_resource_map.emplace(key, new_resource);
-		
-		return new_resource;
+		job_system.Submit([this, key, load]() {
+			Run(key, *load);
+		}, counter);
+
+		return load->GetFuture();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -133,6 +192,64 @@ namespace mage {
 		m_resource_map.clear();
 	}
 
+	template< typename KeyT, typename ResourceT >
+	[[nodiscard]]
+	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
+		::FindResource(const KeyT& key) noexcept {
+
+		if (const auto it = m_resource_map.find(key); 
+			it != m_resource_map.end()) {
+
+			auto resource = it->second.lock();
+			if (resource) {
+				return resource;
+			}
+
+			m_resource_map.erase(it);
+		}
+
+		return SharedPtr< ResourceT >();
+	}
+
+	template< typename KeyT, typename ResourceT >
+	inline void ResourcePool< KeyT, ResourceT >
+		::Run(const KeyT& key, Load& load) noexcept {
+
+		if (load.Start()) {
+			Execute(key, load);
+		}
+	}
+
+	template< typename KeyT, typename ResourceT >
+	void ResourcePool< KeyT, ResourceT >
+		::Execute(const KeyT& key, Load& load) noexcept {
+
+		SharedPtr< ResourceT > resource;
+		try {
+			resource = load.m_create();
+		}
+		catch (...) {
+			load.m_create = nullptr;
+			{
+				const std::scoped_lock lock(m_mutex);
+				m_load_map.erase(key);
+			}
+			
+			load.m_promise.set_exception(std::current_exception());
+			return;
+		}
+
+		// Release the (possibly referenced) arguments.
+		load.m_create = nullptr;
+		{
+			const std::scoped_lock lock(m_mutex);
+			m_resource_map.insert_or_assign(key, resource);
+			m_load_map.erase(key);
+		}
+
+		load.m_promise.set_value(std::move(resource));
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -15,6 +15,9 @@
 #pragma region
 
 #include <charconv>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
 
 #pragma endregion
 
@@ -43,32 +46,92 @@ namespace mage {
 		}
 	}
 
+	namespace details {
+
+		/**
+		 Converts the given range of characters to a floating point value.
+
+		 Unlike @c strtof and @c strtod, the given range of characters does not 
+		 need to be followed by a null-terminating character (e.g., a token of 
+		 a memory-mapped file).
+
+		 @tparam		T
+						The floating point type.
+		 @param[in]		first
+						A pointer to the first character.
+		 @param[in]		last
+						A pointer to the past-the-end character.
+		 @return		The @c T value represented by the given range of 
+						characters, if the given range of characters represents 
+						a @c T value. @c std::nullopt otherwise.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		inline const std::optional< T > FloatingPointStringTo(
+			NotNull< const char* > first, NotNull< const char* > last) noexcept {
+
+			const char*       cfirst = first;
+			const char* const clast  = last;
+			
+			// Accept an explicit plus sign (like strtof and strtod).
+			if (1 < clast - cfirst && '+' == *cfirst && '-' != *(cfirst + 1)) {
+				++cfirst;
+			}
+
+			#ifdef __cpp_lib_to_chars
+
+			T result = {};
+			const auto [ptr, error_code] = std::from_chars(cfirst, clast, result);
+			if (clast != ptr || std::errc() != error_code) {
+				return {};
+			}
+			
+			return result;
+
+			#else  // __cpp_lib_to_chars
+
+			// Fall back to strtof and strtod on a null-terminated copy for 
+			// standard libraries without floating point from_chars.
+			char buffer[128];
+			const auto size = static_cast< size_t >(clast - cfirst);
+			if (0u == size || std::size(buffer) <= size) {
+				return {};
+			}
+
+			std::memcpy(buffer, cfirst, size);
+			buffer[size] = '\0';
+			
+			char* inner_context = nullptr;
+			T result;
+			if constexpr (std::is_same_v< F32, T >) {
+				result = strtof(buffer, &inner_context);
+			}
+			else {
+				result = strtod(buffer, &inner_context);
+			}
+
+			if (buffer + size != inner_context) {
+				return {};
+			}
+			
+			return result;
+
+			#endif // __cpp_lib_to_chars
+		}
+	}
+
 	template<>
 	[[nodiscard]]
 	inline const std::optional< F32 > StringTo(NotNull< const char* > first,
 											   NotNull< const char* > last) noexcept {
-		char* inner_context = nullptr;
-		const F32 result = strtof(first, &inner_context);
-		if (last == inner_context) {
-			return result;
-		}
-		else {
-			return {};
-		}
+		return details::FloatingPointStringTo< F32 >(first, last);
 	}
 
 	template<>
 	[[nodiscard]]
 	inline const std::optional< F64 > StringTo(NotNull< const char* > first,
 											   NotNull< const char* > last) noexcept {
-		char* inner_context = nullptr;
-		const F64 result = strtod(first, &inner_context);
-		if (last == inner_context) {
-			return result;
-		}
-		else {
-			return {};
-		}
+		return details::FloatingPointStringTo< F64 >(first, last);
 	}
 
 	template<>
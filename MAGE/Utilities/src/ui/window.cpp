@@ -275,6 +275,15 @@ namespace mage {
 				Warning("Registering PrintScreen hot key failed.");
 			}
 		}
+		{
+			const BOOL result = RegisterHotKey(m_window, 
+											   static_cast< int >(HotKey::CtrlPrintScreen), 
+											   MOD_CONTROL | MOD_NOREPEAT, 
+											   VK_SNAPSHOT);
+			if (FALSE == result) {
+				Warning("Registering Ctrl+PrintScreen hot key failed.");
+			}
+		}
 	}
 
 	void Window::Show(int nCmdShow) {
@@ -34,13 +34,15 @@ namespace mage {
 
 	 This contains: 
 	 @c Unused, 
-	 @c PrintScreen, and 
-	 @c AltPrintScreen.
+	 @c PrintScreen, 
+	 @c AltPrintScreen, and 
+	 @c CtrlPrintScreen.
 	 */
 	enum class HotKey : U8 {
 		Unused = 0,
 		PrintScreen,
 		AltPrintScreen,
+		CtrlPrintScreen,
 	};
 
 	#pragma endregion